@@ -0,0 +1,100 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file allocationCounter.cpp
+* @author Christophe Calmejane
+*/
+
+#include "allocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<std::uint64_t> s_AllocationsCount{ 0u };
+static thread_local std::uint32_t s_ExclusionDepth{ 0u };
+
+static void* allocate(std::size_t const size)
+{
+	if (s_ExclusionDepth == 0u)
+	{
+		s_AllocationsCount.fetch_add(1u, std::memory_order_relaxed);
+	}
+	if (auto* const ptr = std::malloc(size == 0u ? 1u : size))
+	{
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size)
+{
+	return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+	return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept
+{
+	std::free(ptr);
+}
+
+namespace allocationCounter
+{
+std::uint64_t getAllocationsCount() noexcept
+{
+	return s_AllocationsCount.load(std::memory_order_relaxed);
+}
+
+void excludeCurrentThread() noexcept
+{
+	// Never decremented, the thread_local variable goes away with the thread
+	++s_ExclusionDepth;
+}
+
+ScopedExclusion::ScopedExclusion() noexcept
+{
+	++s_ExclusionDepth;
+}
+
+ScopedExclusion::~ScopedExclusion() noexcept
+{
+	--s_ExclusionDepth;
+}
+
+} // namespace allocationCounter
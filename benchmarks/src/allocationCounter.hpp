@@ -0,0 +1,52 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file allocationCounter.hpp
+* @author Christophe Calmejane
+* @brief Counts the heap allocations of the whole process, by replacing the global operator new (defined in allocationCounter.cpp, which must be linked once per benchmark executable).
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace allocationCounter
+{
+/** Returns the number of heap allocations since the start of the process */
+std::uint64_t getAllocationsCount() noexcept;
+
+/** Excludes all the allocations made by the current thread from the count, until the thread exits (used by the threads dedicated to the simulation side of a benchmark) */
+void excludeCurrentThread() noexcept;
+
+/** Excludes the allocations made by the current thread from the count, for the lifetime of the object (used by the simulation side of a benchmark) */
+class ScopedExclusion final
+{
+public:
+	ScopedExclusion() noexcept;
+	~ScopedExclusion() noexcept;
+
+	// Deleted compiler auto-generated methods
+	ScopedExclusion(ScopedExclusion const&) = delete;
+	ScopedExclusion(ScopedExclusion&&) = delete;
+	ScopedExclusion& operator=(ScopedExclusion const&) = delete;
+	ScopedExclusion& operator=(ScopedExclusion&&) = delete;
+};
+
+} // namespace allocationCounter
@@ -0,0 +1,240 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+/**
+* @file enumerationBenchmark.cpp
+* @author Christophe Calmejane
+* @brief End-to-end enumeration benchmark of the controller: simulated entities (replaying the AEM conversation recorded from a JSON entity model) are advertised on a virtual network, and the time until all of them are declared online by the controller is measured.
+* @details Counters: "packets/entity" (ADP, AECP and ACMP messages exchanged with the simulated entities), "commands/entity" (commands sent by the controller),
+*          "allocs/entity" (heap allocations of the controller side only), "peak_rss_MiB" (process peak resident set size, monotonic for the whole run) and "errors" (query errors reported by the controller).
+*          Extra options (to be specified before the Google Benchmark ones):
+*            --entity_model=<file>            JSON entity model (ControlledEntity dump or entity model file) to replay (default: data/TalkerListener.json)
+*            --response_latency_us=<usec>     Latency of the simulated entities before sending a response (default: 0)
+*          Use --benchmark_out=<file> --benchmark_out_format=json for machine-readable results.
+*/
+
+#include "allocationCounter.hpp"
+#include "simulatedEntities.hpp"
+
+// Public API
+#include <la/avdecc/controller/avdeccController.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#if defined(_WIN32)
+#	define WIN32_LEAN_AND_MEAN
+#	include <Windows.h>
+#	include <Psapi.h>
+#else // !_WIN32
+#	include <sys/resource.h>
+#endif // _WIN32
+
+static auto constexpr NetworkInterfaceID = "BenchmarkNetwork";
+/** Maximum time for all the entities to be online: a fixed part plus a per-entity part (the controller limits the count of entities enumerated in parallel) */
+static auto constexpr EnumerationBaseTimeout = std::chrono::seconds{ 30 };
+static auto constexpr EnumerationPerEntityTimeout = std::chrono::milliseconds{ 250 };
+
+static std::string s_EntityModelFilePath{ "data/TalkerListener.json" };
+static std::chrono::microseconds s_ResponseLatency{ 0 };
+static std::optional<EntityModelConversation> s_Conversation{ std::nullopt };
+
+/** Returns the peak resident set size of the process, in MiB */
+static double getPeakRssMiB() noexcept
+{
+#if defined(_WIN32)
+	auto counters = PROCESS_MEMORY_COUNTERS{};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return static_cast<double>(counters.PeakWorkingSetSize) / (1024.0 * 1024.0);
+	}
+	return 0.0;
+#else // !_WIN32
+	auto usage = rusage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		return 0.0;
+	}
+#	if defined(__APPLE__)
+	return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0); // Bytes
+#	else // !__APPLE__
+	return static_cast<double>(usage.ru_maxrss) / 1024.0; // KiB
+#	endif // __APPLE__
+#endif // _WIN32
+}
+
+/** Counts the entities declared online (or in error) by the controller */
+class EnumerationObserver final : public la::avdecc::controller::Controller::DefaultedObserver
+{
+public:
+	/** Waits until the specified count of entities is online, returns false on timeout */
+	bool waitForOnline(std::size_t const count) noexcept
+	{
+		auto lg = std::unique_lock{ _lock };
+		return _cond.wait_for(lg, EnumerationBaseTimeout + EnumerationPerEntityTimeout * count,
+			[this, count]()
+			{
+				return _onlineCount >= count;
+			});
+	}
+
+	std::size_t getErrorsCount() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+		return _errorsCount;
+	}
+
+private:
+	// la::avdecc::controller::Controller::Observer overrides
+	virtual void onEntityQueryError(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::Controller::QueryCommandError const /*error*/) noexcept override
+	{
+		auto const lg = std::lock_guard{ _lock };
+		++_errorsCount;
+	}
+	virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const /*entity*/) noexcept override
+	{
+		{
+			auto const lg = std::lock_guard{ _lock };
+			++_onlineCount;
+		}
+		_cond.notify_all();
+	}
+
+	mutable std::mutex _lock{};
+	std::condition_variable _cond{};
+	std::size_t _onlineCount{ 0u };
+	std::size_t _errorsCount{ 0u };
+};
+
+static void benchmarkEnumeration(benchmark::State& state)
+{
+	auto const entitiesCount = static_cast<std::size_t>(state.range(0));
+	auto simulatedEntities = SimulatedEntities{ NetworkInterfaceID, *s_Conversation, s_ResponseLatency };
+
+	auto totalPackets = std::uint64_t{ 0u };
+	auto totalCommands = std::uint64_t{ 0u };
+	auto totalAllocations = std::uint64_t{ 0u };
+	auto totalErrors = std::size_t{ 0u };
+
+	for (auto _ : state)
+	{
+		auto observer = EnumerationObserver{};
+		auto controller = la::avdecc::controller::Controller::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, NetworkInterfaceID, 0x0001, la::avdecc::UniqueIdentifier{}, "en", nullptr, std::nullopt, nullptr);
+		controller->registerObserver(&observer);
+		simulatedEntities.resetStatistics();
+
+		auto const allocationsBefore = allocationCounter::getAllocationsCount();
+		auto const start = std::chrono::steady_clock::now();
+		simulatedEntities.advertise(entitiesCount);
+		auto const isComplete = observer.waitForOnline(entitiesCount);
+		auto const elapsed = std::chrono::steady_clock::now() - start;
+		auto const allocations = allocationCounter::getAllocationsCount() - allocationsBefore;
+
+		// Remove the entities before the next iteration (the controller is destroyed anyway)
+		simulatedEntities.depart(entitiesCount);
+		controller->unregisterObserver(&observer);
+		controller.reset();
+
+		if (!isComplete)
+		{
+			state.SkipWithError("Timeout waiting for all the entities to be online");
+			break;
+		}
+
+		auto const statistics = simulatedEntities.getStatistics();
+		state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+		totalPackets += statistics.commandsReceived + statistics.messagesSent;
+		totalCommands += statistics.commandsReceived;
+		totalAllocations += allocations;
+		totalErrors += observer.getErrorsCount();
+	}
+
+	auto const count = static_cast<double>(state.iterations() * entitiesCount);
+	if (count > 0.0)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * entitiesCount));
+		state.counters["packets/entity"] = static_cast<double>(totalPackets) / count;
+		state.counters["commands/entity"] = static_cast<double>(totalCommands) / count;
+		state.counters["allocs/entity"] = static_cast<double>(totalAllocations) / count;
+		state.counters["errors"] = static_cast<double>(totalErrors);
+	}
+	state.counters["peak_rss_MiB"] = getPeakRssMiB();
+	state.counters["latency_us"] = static_cast<double>(s_ResponseLatency.count());
+}
+
+/** Removes the option from the command line and returns its value, if present */
+static std::optional<std::string> extractOption(int& argc, char** argv, std::string const& optionName)
+{
+	auto const prefix = "--" + optionName + "=";
+	for (auto i = 1; i < argc; ++i)
+	{
+		auto const arg = std::string{ argv[i] };
+		if (arg.compare(0, prefix.size(), prefix) == 0)
+		{
+			for (auto j = i; j < argc - 1; ++j)
+			{
+				argv[j] = argv[j + 1];
+			}
+			--argc;
+			return arg.substr(prefix.size());
+		}
+	}
+	return std::nullopt;
+}
+
+int main(int argc, char** argv)
+{
+	if (auto const value = extractOption(argc, argv, "entity_model"))
+	{
+		s_EntityModelFilePath = *value;
+	}
+	if (auto const value = extractOption(argc, argv, "response_latency_us"))
+	{
+		s_ResponseLatency = std::chrono::microseconds{ std::strtoll(value->c_str(), nullptr, 10) };
+	}
+
+	try
+	{
+		s_Conversation = EntityModelConversation::loadFromJson(s_EntityModelFilePath);
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+
+	benchmark::RegisterBenchmark("Enumeration", benchmarkEnumeration)->RangeMultiplier(10)->Range(1, 1000)->ArgName("entities")->UseManualTime()->Unit(benchmark::kMillisecond);
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
@@ -0,0 +1,236 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file parsersBenchmark.cpp
+* @author Christophe Calmejane
+* @brief Microbenchmarks of the receive path, for each sample frame: PDU deserialization, AEM/MVU payload deserialization and full dispatch (EthernetPacketDispatcher and state machines).
+* @details Time per iteration is the time per frame, "allocs/frame" is the average number of heap allocations per frame.
+*/
+
+#include "allocationCounter.hpp"
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/memoryBuffer.hpp>
+
+// Internal API
+#include "protocolInterface/protocolInterface_virtual.hpp"
+#include "sampleFrames.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace aemPayload = la::avdecc::protocol::aemPayload;
+
+static auto constexpr ExecutorName = "avdecc::protocol::PI";
+
+/** Runs the method once per iteration, reporting the allocations per frame */
+template<typename Method>
+static void runBenchmark(benchmark::State& state, Method&& method)
+{
+	auto const allocationsBefore = allocationCounter::getAllocationsCount();
+	for (auto _ : state)
+	{
+		method();
+	}
+	auto const allocations = allocationCounter::getAllocationsCount() - allocationsBefore;
+	state.SetItemsProcessed(state.iterations());
+	state.counters["allocs/frame"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+/** Deserializes the PDU layer only (no payload), creating the PDU like the EthernetPacketDispatcher does */
+static void benchmarkPdu(benchmark::State& state, SampleFrame const& frame)
+{
+	auto const* const avtpdu = frame.data.data() + la::avdecc::protocol::EtherLayer2::HeaderLength;
+	auto const avtpduSize = frame.data.size() - la::avdecc::protocol::EtherLayer2::HeaderLength;
+	auto const subType = static_cast<std::uint8_t>(avtpdu[0] & 0x7f);
+	auto const messageType = la::avdecc::protocol::AecpMessageType{ static_cast<la::avdecc::protocol::AecpMessageType::value_type>(avtpdu[1] & 0x7f) };
+
+	runBenchmark(state,
+		[avtpdu, avtpduSize, subType, messageType]()
+		{
+			auto des = la::avdecc::protocol::DeserializationBuffer{ avtpdu, avtpduSize };
+			switch (subType)
+			{
+				case la::avdecc::protocol::AvtpSubType_Adp:
+				{
+					auto adpdu = la::avdecc::protocol::Adpdu::create();
+					la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(adpdu.get(), des);
+					la::avdecc::protocol::deserialize<la::avdecc::protocol::Adpdu>(adpdu.get(), des);
+					benchmark::DoNotOptimize(adpdu);
+					break;
+				}
+				case la::avdecc::protocol::AvtpSubType_Acmp:
+				{
+					auto acmpdu = la::avdecc::protocol::Acmpdu::create();
+					la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(acmpdu.get(), des);
+					la::avdecc::protocol::deserialize<la::avdecc::protocol::Acmpdu>(acmpdu.get(), des);
+					benchmark::DoNotOptimize(acmpdu);
+					break;
+				}
+				case la::avdecc::protocol::AvtpSubType_Aecp:
+				{
+					auto aecpdu = la::avdecc::protocol::Aecpdu::UniquePointer{ nullptr, nullptr };
+					if (messageType == la::avdecc::protocol::AecpMessageType::AemCommand || messageType == la::avdecc::protocol::AecpMessageType::AemResponse)
+					{
+						aecpdu = la::avdecc::protocol::AemAecpdu::create(messageType == la::avdecc::protocol::AecpMessageType::AemResponse);
+					}
+					else if (messageType == la::avdecc::protocol::AecpMessageType::AddressAccessCommand || messageType == la::avdecc::protocol::AecpMessageType::AddressAccessResponse)
+					{
+						aecpdu = la::avdecc::protocol::AaAecpdu::create(messageType == la::avdecc::protocol::AecpMessageType::AddressAccessResponse);
+					}
+					else
+					{
+						aecpdu = la::avdecc::protocol::MvuAecpdu::create(messageType == la::avdecc::protocol::AecpMessageType::VendorUniqueResponse);
+					}
+					la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(aecpdu.get(), des);
+					la::avdecc::protocol::deserialize<la::avdecc::protocol::Aecpdu>(aecpdu.get(), des);
+					benchmark::DoNotOptimize(aecpdu);
+					break;
+				}
+				default:
+					break;
+			}
+		});
+}
+
+/** Deserializes the AEM payload of the frame (the AEM header is only deserialized once, outside of the measurement) */
+static void benchmarkAemPayload(benchmark::State& state, SampleFrame const& frame, std::function<void(la::avdecc::protocol::AemAecpdu const&)> const& deserializer)
+{
+	auto des = la::avdecc::protocol::DeserializationBuffer{ frame.data.data() + la::avdecc::protocol::EtherLayer2::HeaderLength, frame.data.size() - la::avdecc::protocol::EtherLayer2::HeaderLength };
+	auto const isResponse = (frame.data[la::avdecc::protocol::EtherLayer2::HeaderLength + 1] & 0x7f) == la::avdecc::protocol::AecpMessageType::AemResponse.getValue();
+	auto aem = la::avdecc::protocol::AemAecpdu{ isResponse };
+	la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(&aem, des);
+	la::avdecc::protocol::deserialize<la::avdecc::protocol::Aecpdu>(&aem, des);
+
+	runBenchmark(state,
+		[&aem, &deserializer]()
+		{
+			deserializer(aem);
+		});
+}
+
+/** Dispatches the whole frame through a ProtocolInterfaceVirtual (EthernetPacketDispatcher, state machines and executor hop included) */
+static void benchmarkDispatch(benchmark::State& state, SampleFrame const& frame)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(ExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(ExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const protocolInterface = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("BenchmarkInterface", sampleFrames::ControllerMacAddress, ExecutorName));
+
+	runBenchmark(state,
+		[&protocolInterface, &frame]()
+		{
+			protocolInterface->injectRawPacket(la::avdecc::MemoryBuffer{ frame.data.data(), frame.data.size() });
+			la::avdecc::ExecutorManager::getInstance().flush(ExecutorName);
+		});
+}
+
+static SampleFrame const& findFrame(SampleFrames const& frames, std::string const& name)
+{
+	for (auto const& frame : frames)
+	{
+		if (frame.name == name)
+		{
+			return frame;
+		}
+	}
+	throw std::invalid_argument("Unknown sample frame: " + name);
+}
+
+int main(int argc, char** argv)
+{
+	static auto const s_Frames = sampleFrames::buildSampleFrames();
+
+	for (auto const& frame : s_Frames)
+	{
+		benchmark::RegisterBenchmark(("Pdu/" + frame.name).c_str(), benchmarkPdu, frame);
+		benchmark::RegisterBenchmark(("EthernetPacketDispatcher/" + frame.name).c_str(), benchmarkDispatch, frame);
+	}
+
+	// Payloads (the most frequent ones during enumeration and monitoring)
+	benchmark::RegisterBenchmark("AemPayload/read_entity_descriptor_response", benchmarkAemPayload, findFrame(s_Frames, "aem_read_entity_descriptor_response"),
+		[](la::avdecc::protocol::AemAecpdu const& aem)
+		{
+			auto const status = static_cast<la::avdecc::entity::LocalEntity::AemCommandStatus>(aem.getStatus().getValue());
+			auto const [commonSize, configurationIndex, descriptorType, descriptorIndex] = aemPayload::deserializeReadDescriptorCommonResponse(status, aem.getPayload());
+			benchmark::DoNotOptimize(aemPayload::deserializeReadEntityDescriptorResponse(aem.getPayload(), commonSize, la::avdecc::protocol::AemAecpStatus{ aem.getStatus().getValue() }));
+		});
+	benchmark::RegisterBenchmark("AemPayload/read_configuration_descriptor_response", benchmarkAemPayload, findFrame(s_Frames, "aem_read_configuration_descriptor_response"),
+		[](la::avdecc::protocol::AemAecpdu const& aem)
+		{
+			auto const status = static_cast<la::avdecc::entity::LocalEntity::AemCommandStatus>(aem.getStatus().getValue());
+			auto const [commonSize, configurationIndex, descriptorType, descriptorIndex] = aemPayload::deserializeReadDescriptorCommonResponse(status, aem.getPayload());
+			benchmark::DoNotOptimize(aemPayload::deserializeReadConfigurationDescriptorResponse(aem.getPayload(), commonSize, la::avdecc::protocol::AemAecpStatus{ aem.getStatus().getValue() }));
+		});
+	benchmark::RegisterBenchmark("AemPayload/get_stream_info_response", benchmarkAemPayload, findFrame(s_Frames, "aem_get_stream_info_response"),
+		[](la::avdecc::protocol::AemAecpdu const& aem)
+		{
+			benchmark::DoNotOptimize(aemPayload::deserializeGetStreamInfoResponse(static_cast<la::avdecc::entity::LocalEntity::AemCommandStatus>(aem.getStatus().getValue()), aem.getPayload()));
+		});
+	benchmark::RegisterBenchmark("AemPayload/get_counters_response", benchmarkAemPayload, findFrame(s_Frames, "aem_get_counters_response"),
+		[](la::avdecc::protocol::AemAecpdu const& aem)
+		{
+			benchmark::DoNotOptimize(aemPayload::deserializeGetCountersResponse(static_cast<la::avdecc::entity::LocalEntity::AemCommandStatus>(aem.getStatus().getValue()), aem.getPayload()));
+		});
+	// Response payload size validation, compared to relying on the deserialization exception for malformed frames
+	benchmark::RegisterBenchmark("AemPayload/get_counters_response_validated", benchmarkAemPayload, findFrame(s_Frames, "aem_get_counters_response"),
+		[](la::avdecc::protocol::AemAecpdu const& aem)
+		{
+			auto const status = static_cast<la::avdecc::entity::LocalEntity::AemCommandStatus>(aem.getStatus().getValue());
+			if (aemPayload::isValidResponsePayloadSize(aem.getCommandType(), status, aem.getPayload()))
+			{
+				benchmark::DoNotOptimize(aemPayload::deserializeGetCountersResponse(status, aem.getPayload()));
+			}
+		});
+	benchmark::RegisterBenchmark("AemPayload/truncated_get_counters_response_exception", benchmarkAemPayload, findFrame(s_Frames, "aem_get_counters_response"),
+		[](la::avdecc::protocol::AemAecpdu const& aem)
+		{
+			auto const [payload, payloadSize] = aem.getPayload();
+			try
+			{
+				benchmark::DoNotOptimize(aemPayload::deserializeGetCountersResponse(static_cast<la::avdecc::entity::LocalEntity::AemCommandStatus>(aem.getStatus().getValue()), la::avdecc::protocol::AemAecpdu::Payload{ payload, payloadSize / 2u }));
+			}
+			catch (aemPayload::IncorrectPayloadSizeException const&)
+			{
+			}
+		});
+	benchmark::RegisterBenchmark("AemPayload/truncated_get_counters_response_validated", benchmarkAemPayload, findFrame(s_Frames, "aem_get_counters_response"),
+		[](la::avdecc::protocol::AemAecpdu const& aem)
+		{
+			auto const [payload, payloadSize] = aem.getPayload();
+			benchmark::DoNotOptimize(aemPayload::isValidResponsePayloadSize(aem.getCommandType(), static_cast<la::avdecc::entity::LocalEntity::AemCommandStatus>(aem.getStatus().getValue()), la::avdecc::protocol::AemAecpdu::Payload{ payload, payloadSize / 2u }));
+		});
+	benchmark::RegisterBenchmark("AemPayload/get_audio_map_response", benchmarkAemPayload, findFrame(s_Frames, "aem_get_audio_map_response"),
+		[](la::avdecc::protocol::AemAecpdu const& aem)
+		{
+			benchmark::DoNotOptimize(aemPayload::deserializeGetAudioMapResponse(static_cast<la::avdecc::entity::LocalEntity::AemCommandStatus>(aem.getStatus().getValue()), aem.getPayload()));
+		});
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
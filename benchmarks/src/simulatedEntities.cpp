@@ -0,0 +1,844 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+/**
+* @file simulatedEntities.cpp
+* @author Christophe Calmejane
+*/
+
+#include "simulatedEntities.hpp"
+#include "allocationCounter.hpp"
+
+// Public API
+#include <la/avdecc/internals/jsonSerialization.hpp>
+#include <la/avdecc/internals/serialization.hpp>
+#include <la/avdecc/utils.hpp>
+
+// Internal API
+#include "protocol/protocolAemPayloads.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <stdexcept>
+
+namespace aemPayload = la::avdecc::protocol::aemPayload;
+namespace model = la::avdecc::entity::model;
+
+using PayloadSerializer = la::avdecc::Serializer<la::avdecc::protocol::AemAecpdu::MaximumSendPayloadBufferLength>;
+
+static constexpr auto ResponderExecutorName = "avdecc::benchmark::Responder";
+static constexpr auto ResponderMacAddress = la::networkInterface::MacAddress{ 0x00, 0x1B, 0x92, 0xBE, 0x4C, 0x01 };
+static constexpr auto SimulatedEntityIDBase = std::uint64_t{ 0x001B92FFFE000000 };
+static constexpr auto AdpValidTime = std::uint8_t{ 31u }; // In 2-seconds units, max allowed value
+/** Offset to be added to the position in our payload buffers to get the value of a descriptor 'offset' field (the spec starts counting at 'descriptor_type' field, our buffers start at 'configuration_index') */
+static constexpr auto DescriptorOffsetAdjustment = std::uint16_t{ 4u };
+/** Size of the common part of a READ_DESCRIPTOR response (configuration_index, reserved, descriptor_type, descriptor_index) */
+static constexpr auto DescriptorCommonSize = std::uint16_t{ 8u };
+/** Maximum number of mappings in a single GET_AUDIO_MAP response */
+static constexpr auto MaxMappingsPerResponse = (la::avdecc::protocol::AemAecpdu::MaximumSendPayloadBufferLength - la::avdecc::protocol::aemPayload::AecpAemGetAudioMapResponsePayloadMinSize) / 8u;
+
+static EntityModelConversation::Payload toPayload(PayloadSerializer const& ser)
+{
+	return EntityModelConversation::Payload{ ser.data(), ser.data() + ser.size() };
+}
+
+template<typename Container>
+static void serializeArray(PayloadSerializer& ser, Container const& values)
+{
+	for (auto const& v : values)
+	{
+		ser << v;
+	}
+}
+
+/** Returns the value of a descriptor 'offset' field, for the specified size of the static part of the descriptor */
+static constexpr std::uint16_t makeDescriptorOffset(std::uint16_t const staticPartSize) noexcept
+{
+	return static_cast<std::uint16_t>(DescriptorCommonSize + staticPartSize - DescriptorOffsetAdjustment);
+}
+
+/* ************************************************************ */
+/* EntityModelConversation                                      */
+/* ************************************************************ */
+EntityModelConversation EntityModelConversation::loadFromJson(std::string const& filePath)
+{
+	auto ifs = std::ifstream{ filePath };
+	if (!ifs.is_open())
+	{
+		throw std::runtime_error("Cannot open entity model file: " + filePath);
+	}
+
+	auto conversation = EntityModelConversation{};
+
+	try
+	{
+		auto const object = nlohmann::json::parse(ifs);
+
+		// Either a ControlledEntity dump (with ADP information) or an EntityModel file
+		if (auto const adpIt = object.find("adp_information"); adpIt != object.end())
+		{
+			conversation._entityModelID = la::avdecc::UniqueIdentifier{ std::stoull(adpIt->at("common").at("entity_model_id").get<std::string>(), nullptr, 16) };
+		}
+		else
+		{
+			conversation._entityModelID = la::avdecc::UniqueIdentifier{ std::stoull(object.at("entity_model_id").get<std::string>(), nullptr, 16) };
+		}
+		try
+		{
+			conversation._entityTree = model::jsonSerializer::createEntityTree(object.at("entity_model"), model::jsonSerializer::Flags{ model::jsonSerializer::Flag::ProcessStaticModel, model::jsonSerializer::Flag::ProcessDynamicModel });
+		}
+		catch (la::avdecc::jsonSerializer::DeserializationException const&)
+		{
+			// Dynamic model not present (or from an older dump format), only use the static model and the first supported format/sampling rate
+			conversation._entityTree = model::jsonSerializer::createEntityTree(object.at("entity_model"), model::jsonSerializer::Flags{ model::jsonSerializer::Flag::ProcessStaticModel });
+			for (auto& [configurationIndex, configurationTree] : conversation._entityTree.configurationTrees)
+			{
+				for (auto& [audioUnitIndex, audioUnitTree] : configurationTree.audioUnitTrees)
+				{
+					if (!audioUnitTree.staticModel.samplingRates.empty())
+					{
+						audioUnitTree.dynamicModel.currentSamplingRate = *audioUnitTree.staticModel.samplingRates.begin();
+					}
+				}
+				for (auto& [streamIndex, streamModels] : configurationTree.streamInputModels)
+				{
+					if (!streamModels.staticModel.formats.empty())
+					{
+						streamModels.dynamicModel.streamFormat = *streamModels.staticModel.formats.begin();
+					}
+				}
+				for (auto& [streamIndex, streamModels] : configurationTree.streamOutputModels)
+				{
+					if (!streamModels.staticModel.formats.empty())
+					{
+						streamModels.dynamicModel.streamFormat = *streamModels.staticModel.formats.begin();
+					}
+				}
+			}
+		}
+	}
+	catch (la::avdecc::Exception const& e)
+	{
+		throw std::runtime_error("Cannot load entity model file '" + filePath + "': " + e.what());
+	}
+	catch (std::exception const& e)
+	{
+		throw std::runtime_error("Cannot load entity model file '" + filePath + "': " + e.what());
+	}
+
+	// Record all READ_DESCRIPTOR responses
+	auto const record = [&conversation](model::ConfigurationIndex const configurationIndex, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, auto const& serializeDescriptor)
+	{
+		auto ser = aemPayload::serializeReadDescriptorCommonResponse(configurationIndex, descriptorType, descriptorIndex);
+		serializeDescriptor(ser);
+		conversation._descriptorResponses.emplace(DescriptorKey{ configurationIndex, descriptorType, descriptorIndex }, toPayload(ser));
+	};
+
+	for (auto const& [configurationIndex, configurationTree] : conversation._entityTree.configurationTrees)
+	{
+		auto const isCurrentConfiguration = configurationIndex == conversation._entityTree.dynamicModel.currentConfiguration;
+
+		// Configuration
+		record(configurationIndex, model::DescriptorType::Configuration, configurationIndex,
+			[&configurationTree](auto& ser)
+			{
+				auto descriptor = model::ConfigurationDescriptor{};
+				descriptor.objectName = configurationTree.dynamicModel.objectName;
+				descriptor.localizedDescription = configurationTree.staticModel.localizedDescription;
+				descriptor.descriptorCounts = configurationTree.staticModel.descriptorCounts;
+				aemPayload::serializeReadConfigurationDescriptorResponse(ser, descriptor);
+			});
+
+		// Audio Units (and their Stream Ports, Audio Clusters and Audio Maps)
+		for (auto const& [audioUnitIndex, audioUnitTree] : configurationTree.audioUnitTrees)
+		{
+			record(configurationIndex, model::DescriptorType::AudioUnit, audioUnitIndex,
+				[&audioUnitTree](auto& ser)
+				{
+					auto const& s = audioUnitTree.staticModel;
+					auto const& d = audioUnitTree.dynamicModel;
+					ser << d.objectName << s.localizedDescription << s.clockDomainIndex;
+					ser << s.numberOfStreamInputPorts << s.baseStreamInputPort << s.numberOfStreamOutputPorts << s.baseStreamOutputPort;
+					ser << s.numberOfExternalInputPorts << s.baseExternalInputPort << s.numberOfExternalOutputPorts << s.baseExternalOutputPort;
+					ser << s.numberOfInternalInputPorts << s.baseInternalInputPort << s.numberOfInternalOutputPorts << s.baseInternalOutputPort;
+					ser << s.numberOfControls << s.baseControl << s.numberOfSignalSelectors << s.baseSignalSelector;
+					ser << s.numberOfMixers << s.baseMixer << s.numberOfMatrices << s.baseMatrix;
+					ser << s.numberOfSplitters << s.baseSplitter << s.numberOfCombiners << s.baseCombiner;
+					ser << s.numberOfDemultiplexers << s.baseDemultiplexer << s.numberOfMultiplexers << s.baseMultiplexer;
+					ser << s.numberOfTranscoders << s.baseTranscoder << s.numberOfControlBlocks << s.baseControlBlock;
+					ser << d.currentSamplingRate;
+					ser << makeDescriptorOffset(140u) << static_cast<std::uint16_t>(s.samplingRates.size());
+					serializeArray(ser, s.samplingRates);
+				});
+
+			auto const recordStreamPorts = [&](model::DescriptorType const streamPortType, model::AudioUnitTree::StreamPortTrees const& streamPortTrees)
+			{
+				for (auto const& [streamPortIndex, streamPortTree] : streamPortTrees)
+				{
+					record(configurationIndex, streamPortType, streamPortIndex,
+						[&streamPortTree](auto& ser)
+						{
+							auto const& s = streamPortTree.staticModel;
+							ser << s.clockDomainIndex << s.portFlags << s.numberOfControls << s.baseControl << s.numberOfClusters << s.baseCluster << s.numberOfMaps << s.baseMap;
+						});
+					for (auto const& [clusterIndex, clusterModels] : streamPortTree.audioClusterModels)
+					{
+						record(configurationIndex, model::DescriptorType::AudioCluster, clusterIndex,
+							[&clusterModels](auto& ser)
+							{
+								auto const& s = clusterModels.staticModel;
+								ser << clusterModels.dynamicModel.objectName << s.localizedDescription << s.signalType << s.signalIndex << s.signalOutput << s.pathLatency << s.blockLatency << s.channelCount << s.format;
+							});
+					}
+					for (auto const& [mapIndex, mapModels] : streamPortTree.audioMapModels)
+					{
+						record(configurationIndex, model::DescriptorType::AudioMap, mapIndex,
+							[&mapModels](auto& ser)
+							{
+								auto const& mappings = mapModels.staticModel.mappings;
+								ser << makeDescriptorOffset(4u) << static_cast<std::uint16_t>(mappings.size());
+								for (auto const& mapping : mappings)
+								{
+									ser << mapping.streamIndex << mapping.streamChannel << mapping.clusterOffset << mapping.clusterChannel;
+								}
+							});
+					}
+
+					// Dynamic mappings, split in as many responses as required
+					if (isCurrentConfiguration && streamPortTree.staticModel.hasDynamicAudioMap)
+					{
+						auto const& mappings = streamPortTree.dynamicModel.dynamicAudioMap;
+						auto const numberOfMaps = static_cast<model::MapIndex>((mappings.size() + MaxMappingsPerResponse - 1u) / MaxMappingsPerResponse);
+						auto& responses = conversation._audioMapResponses[DynamicKey{ streamPortType, streamPortIndex }];
+						for (auto mapIndex = model::MapIndex{ 0u }; mapIndex < std::max(numberOfMaps, model::MapIndex{ 1u }); ++mapIndex)
+						{
+							auto const first = mappings.begin() + std::min<std::size_t>(mapIndex * MaxMappingsPerResponse, mappings.size());
+							auto const last = mappings.begin() + std::min<std::size_t>((mapIndex + 1u) * MaxMappingsPerResponse, mappings.size());
+							responses.push_back(toPayload(aemPayload::serializeGetAudioMapResponse(streamPortType, streamPortIndex, mapIndex, std::max(numberOfMaps, model::MapIndex{ 1u }), model::AudioMappings{ first, last })));
+						}
+					}
+				}
+			};
+			recordStreamPorts(model::DescriptorType::StreamPortInput, audioUnitTree.streamPortInputTrees);
+			recordStreamPorts(model::DescriptorType::StreamPortOutput, audioUnitTree.streamPortOutputTrees);
+		}
+
+		// Streams
+		auto const recordStream = [&](model::DescriptorType const streamType, model::StreamIndex const streamIndex, model::StreamNodeStaticModel const& s, model::StreamNodeDynamicModel const& d)
+		{
+			record(configurationIndex, streamType, streamIndex,
+				[&s, &d](auto& ser)
+				{
+					auto const isRedundant =
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+						!s.redundantStreams.empty();
+#else // !ENABLE_AVDECC_FEATURE_REDUNDANCY
+						false;
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+					// Milan redundant streams have 2 more fields (redundant_offset and number_of_redundant_streams) after the static part
+					auto const formatsOffset = makeDescriptorOffset(isRedundant ? 132u : 128u);
+					ser << d.objectName << s.localizedDescription << s.clockDomainIndex << s.streamFlags << d.streamFormat;
+					ser << formatsOffset << static_cast<std::uint16_t>(s.formats.size());
+					ser << s.backupTalkerEntityID_0 << s.backupTalkerUniqueID_0 << s.backupTalkerEntityID_1 << s.backupTalkerUniqueID_1 << s.backupTalkerEntityID_2 << s.backupTalkerUniqueID_2;
+					ser << s.backedupTalkerEntityID << s.backedupTalkerUnique << s.avbInterfaceIndex << s.bufferLength;
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+					if (isRedundant)
+					{
+						ser << static_cast<std::uint16_t>(formatsOffset + s.formats.size() * sizeof(model::StreamFormat)) << static_cast<std::uint16_t>(s.redundantStreams.size());
+					}
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+					serializeArray(ser, s.formats);
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+					serializeArray(ser, s.redundantStreams);
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+				});
+		};
+		for (auto const& [streamIndex, streamModels] : configurationTree.streamInputModels)
+		{
+			recordStream(model::DescriptorType::StreamInput, streamIndex, streamModels.staticModel, streamModels.dynamicModel);
+		}
+		for (auto const& [streamIndex, streamModels] : configurationTree.streamOutputModels)
+		{
+			recordStream(model::DescriptorType::StreamOutput, streamIndex, streamModels.staticModel, streamModels.dynamicModel);
+		}
+
+		// Jacks
+		auto const recordJacks = [&](model::DescriptorType const jackType, model::ConfigurationTree::JackTrees const& jackTrees)
+		{
+			for (auto const& [jackIndex, jackTree] : jackTrees)
+			{
+				record(configurationIndex, jackType, jackIndex,
+					[&jackTree](auto& ser)
+					{
+						auto const& s = jackTree.staticModel;
+						ser << jackTree.dynamicModel.objectName << s.localizedDescription << s.jackFlags << s.jackType << s.numberOfControls << s.baseControl;
+					});
+			}
+		};
+		recordJacks(model::DescriptorType::JackInput, configurationTree.jackInputTrees);
+		recordJacks(model::DescriptorType::JackOutput, configurationTree.jackOutputTrees);
+
+		// AVB Interfaces
+		for (auto const& [avbInterfaceIndex, avbInterfaceModels] : configurationTree.avbInterfaceModels)
+		{
+			record(configurationIndex, model::DescriptorType::AvbInterface, avbInterfaceIndex,
+				[&avbInterfaceModels](auto& ser)
+				{
+					auto const& s = avbInterfaceModels.staticModel;
+					auto const& d = avbInterfaceModels.dynamicModel;
+					ser << d.objectName << s.localizedDescription << d.macAddress << s.interfaceFlags << d.clockIdentity;
+					ser << d.priority1 << d.clockClass << d.offsetScaledLogVariance << d.clockAccuracy << d.priority2 << d.domainNumber;
+					ser << d.logSyncInterval << d.logAnnounceInterval << d.logPDelayInterval << s.portNumber;
+				});
+			if (isCurrentConfiguration && avbInterfaceModels.dynamicModel.asPath)
+			{
+				conversation._asPathResponses.emplace(avbInterfaceIndex, toPayload(aemPayload::serializeGetAsPathResponse(avbInterfaceIndex, *avbInterfaceModels.dynamicModel.asPath)));
+			}
+		}
+
+		// Clock Sources
+		for (auto const& [clockSourceIndex, clockSourceModels] : configurationTree.clockSourceModels)
+		{
+			record(configurationIndex, model::DescriptorType::ClockSource, clockSourceIndex,
+				[&clockSourceModels](auto& ser)
+				{
+					auto const& s = clockSourceModels.staticModel;
+					auto const& d = clockSourceModels.dynamicModel;
+					ser << d.objectName << s.localizedDescription << d.clockSourceFlags << s.clockSourceType << d.clockSourceIdentifier << s.clockSourceLocationType << s.clockSourceLocationIndex;
+				});
+		}
+
+		// Memory Objects
+		for (auto const& [memoryObjectIndex, memoryObjectModels] : configurationTree.memoryObjectModels)
+		{
+			record(configurationIndex, model::DescriptorType::MemoryObject, memoryObjectIndex,
+				[&memoryObjectModels](auto& ser)
+				{
+					auto const& s = memoryObjectModels.staticModel;
+					auto const& d = memoryObjectModels.dynamicModel;
+					ser << d.objectName << s.localizedDescription << s.memoryObjectType << s.targetDescriptorType << s.targetDescriptorIndex << s.startAddress << s.maximumLength << d.length;
+				});
+		}
+
+		// Locales (and their Strings)
+		for (auto const& [localeIndex, localeTree] : configurationTree.localeTrees)
+		{
+			record(configurationIndex, model::DescriptorType::Locale, localeIndex,
+				[&localeTree](auto& ser)
+				{
+					auto const& s = localeTree.staticModel;
+					ser << s.localeID << s.numberOfStringDescriptors << s.baseStringDescriptorIndex;
+				});
+			for (auto const& [stringsIndex, stringsModels] : localeTree.stringsModels)
+			{
+				record(configurationIndex, model::DescriptorType::Strings, stringsIndex,
+					[&stringsModels](auto& ser)
+					{
+						serializeArray(ser, stringsModels.staticModel.strings);
+					});
+			}
+		}
+
+		// Clock Domains
+		for (auto const& [clockDomainIndex, clockDomainModels] : configurationTree.clockDomainModels)
+		{
+			record(configurationIndex, model::DescriptorType::ClockDomain, clockDomainIndex,
+				[&clockDomainModels](auto& ser)
+				{
+					auto const& s = clockDomainModels.staticModel;
+					auto const& d = clockDomainModels.dynamicModel;
+					ser << d.objectName << s.localizedDescription << d.clockSourceIndex << makeDescriptorOffset(72u) << static_cast<std::uint16_t>(s.clockSources.size());
+					serializeArray(ser, s.clockSources);
+				});
+		}
+
+		// Timings
+		for (auto const& [timingIndex, timingModels] : configurationTree.timingModels)
+		{
+			record(configurationIndex, model::DescriptorType::Timing, timingIndex,
+				[&timingModels](auto& ser)
+				{
+					auto const& s = timingModels.staticModel;
+					ser << timingModels.dynamicModel.objectName << s.localizedDescription << s.algorithm << makeDescriptorOffset(72u) << static_cast<std::uint16_t>(s.ptpInstances.size());
+					serializeArray(ser, s.ptpInstances);
+				});
+		}
+
+		// PTP Instances (and their PTP Ports)
+		for (auto const& [ptpInstanceIndex, ptpInstanceTree] : configurationTree.ptpInstanceTrees)
+		{
+			record(configurationIndex, model::DescriptorType::PtpInstance, ptpInstanceIndex,
+				[&ptpInstanceTree](auto& ser)
+				{
+					auto const& s = ptpInstanceTree.staticModel;
+					ser << ptpInstanceTree.dynamicModel.objectName << s.localizedDescription << s.clockIdentity << s.flags << s.numberOfControls << s.baseControl << s.numberOfPtpPorts << s.basePtpPort;
+				});
+			for (auto const& [ptpPortIndex, ptpPortModels] : ptpInstanceTree.ptpPortModels)
+			{
+				record(configurationIndex, model::DescriptorType::PtpPort, ptpPortIndex,
+					[&ptpPortModels](auto& ser)
+					{
+						auto const& s = ptpPortModels.staticModel;
+						ser << ptpPortModels.dynamicModel.objectName << s.localizedDescription << s.portNumber << s.portType << s.flags << s.avbInterfaceIndex << s.profileIdentifier;
+					});
+			}
+		}
+	}
+
+	return conversation;
+}
+
+la::avdecc::UniqueIdentifier EntityModelConversation::getEntityModelID() const noexcept
+{
+	return _entityModelID;
+}
+
+std::uint16_t EntityModelConversation::getTalkerStreamSources() const noexcept
+{
+	if (auto const configIt = _entityTree.configurationTrees.find(_entityTree.dynamicModel.currentConfiguration); configIt != _entityTree.configurationTrees.end())
+	{
+		return static_cast<std::uint16_t>(configIt->second.streamOutputModels.size());
+	}
+	return 0u;
+}
+
+std::uint16_t EntityModelConversation::getListenerStreamSinks() const noexcept
+{
+	if (auto const configIt = _entityTree.configurationTrees.find(_entityTree.dynamicModel.currentConfiguration); configIt != _entityTree.configurationTrees.end())
+	{
+		return static_cast<std::uint16_t>(configIt->second.streamInputModels.size());
+	}
+	return 0u;
+}
+
+la::avdecc::entity::EntityCapabilities EntityModelConversation::getEntityCapabilities() noexcept
+{
+	// Only advertise AEM, so the controller won't try to query Milan (MVU) information
+	return la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported };
+}
+
+la::avdecc::entity::TalkerCapabilities EntityModelConversation::getTalkerCapabilities() const noexcept
+{
+	if (getTalkerStreamSources() == 0u)
+	{
+		return {};
+	}
+	return la::avdecc::entity::TalkerCapabilities{ la::avdecc::entity::TalkerCapability::Implemented, la::avdecc::entity::TalkerCapability::AudioSource };
+}
+
+la::avdecc::entity::ListenerCapabilities EntityModelConversation::getListenerCapabilities() const noexcept
+{
+	if (getListenerStreamSinks() == 0u)
+	{
+		return {};
+	}
+	return la::avdecc::entity::ListenerCapabilities{ la::avdecc::entity::ListenerCapability::Implemented, la::avdecc::entity::ListenerCapability::AudioSink };
+}
+
+EntityModelConversation::Payload EntityModelConversation::buildEntityDescriptorResponse(la::avdecc::UniqueIdentifier const entityID) const
+{
+	auto descriptor = model::EntityDescriptor{};
+	descriptor.entityID = entityID;
+	descriptor.entityModelID = _entityModelID;
+	descriptor.entityCapabilities = getEntityCapabilities();
+	descriptor.talkerStreamSources = getTalkerStreamSources();
+	descriptor.talkerCapabilities = getTalkerCapabilities();
+	descriptor.listenerStreamSinks = getListenerStreamSinks();
+	descriptor.listenerCapabilities = getListenerCapabilities();
+	descriptor.entityName = _entityTree.dynamicModel.entityName;
+	descriptor.vendorNameString = _entityTree.staticModel.vendorNameString;
+	descriptor.modelNameString = _entityTree.staticModel.modelNameString;
+	descriptor.firmwareVersion = _entityTree.dynamicModel.firmwareVersion;
+	descriptor.groupName = _entityTree.dynamicModel.groupName;
+	descriptor.serialNumber = _entityTree.dynamicModel.serialNumber;
+	descriptor.configurationsCount = static_cast<std::uint16_t>(_entityTree.configurationTrees.size());
+	descriptor.currentConfiguration = _entityTree.dynamicModel.currentConfiguration;
+
+	auto ser = aemPayload::serializeReadDescriptorCommonResponse(model::ConfigurationIndex{ 0u }, model::DescriptorType::Entity, model::DescriptorIndex{ 0u });
+	aemPayload::serializeReadEntityDescriptorResponse(ser, descriptor);
+	return toPayload(ser);
+}
+
+EntityModelConversation::Payload const* EntityModelConversation::findDescriptorResponse(model::ConfigurationIndex const configurationIndex, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex) const noexcept
+{
+	if (auto const it = _descriptorResponses.find(DescriptorKey{ configurationIndex, descriptorType, descriptorIndex }); it != _descriptorResponses.end())
+	{
+		return &it->second;
+	}
+	return nullptr;
+}
+
+EntityModelConversation::Payload const* EntityModelConversation::findAudioMapResponse(model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, model::MapIndex const mapIndex) const noexcept
+{
+	if (auto const it = _audioMapResponses.find(DynamicKey{ descriptorType, descriptorIndex }); it != _audioMapResponses.end() && mapIndex < it->second.size())
+	{
+		return &it->second[mapIndex];
+	}
+	return nullptr;
+}
+
+EntityModelConversation::Payload const* EntityModelConversation::findAsPathResponse(model::DescriptorIndex const descriptorIndex) const noexcept
+{
+	if (auto const it = _asPathResponses.find(descriptorIndex); it != _asPathResponses.end())
+	{
+		return &it->second;
+	}
+	return nullptr;
+}
+
+/* ************************************************************ */
+/* SimulatedEntities                                            */
+/* ************************************************************ */
+SimulatedEntities::SimulatedEntities(std::string const& networkInterfaceID, EntityModelConversation const& conversation, std::chrono::microseconds const responseLatency)
+	: _conversation{ conversation }
+	, _responseLatency{ responseLatency }
+{
+	auto const exclusion = allocationCounter::ScopedExclusion{};
+
+	_executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(ResponderExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(ResponderExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	// Everything running on the responder executor (frames parsing and observers) belongs to the simulation, exclude the whole thread before it processes anything
+	la::avdecc::ExecutorManager::getInstance().pushJob(ResponderExecutorName,
+		[]()
+		{
+			allocationCounter::excludeCurrentThread();
+		});
+	_protocolInterface = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual(networkInterfaceID, ResponderMacAddress, ResponderExecutorName));
+	_protocolInterface->registerObserver(this);
+
+	if (_responseLatency.count() > 0)
+	{
+		_senderThread = std::thread(
+			[this]()
+			{
+				la::avdecc::utils::setCurrentThreadName("avdecc::benchmark::Sender");
+				allocationCounter::excludeCurrentThread();
+				auto lg = std::unique_lock{ _lock };
+				while (!_shouldTerminate)
+				{
+					if (_pendingResponses.empty())
+					{
+						_cond.wait(lg);
+						continue;
+					}
+					// Responses are queued with the same latency, so the first one is always the next to be sent
+					auto const sendTime = _pendingResponses.front().sendTime;
+					if (std::chrono::steady_clock::now() < sendTime)
+					{
+						_cond.wait_until(lg, sendTime);
+						continue;
+					}
+					auto response = std::move(_pendingResponses.front());
+					_pendingResponses.pop_front();
+					lg.unlock();
+					sendResponse(response);
+					lg.lock();
+				}
+			});
+	}
+}
+
+SimulatedEntities::~SimulatedEntities() noexcept
+{
+	auto const exclusion = allocationCounter::ScopedExclusion{};
+
+	_protocolInterface->unregisterObserver(this);
+	_protocolInterface->shutdown();
+
+	if (_senderThread.joinable())
+	{
+		{
+			auto const lg = std::lock_guard{ _lock };
+			_shouldTerminate = true;
+		}
+		_cond.notify_all();
+		_senderThread.join();
+	}
+}
+
+void SimulatedEntities::advertise(std::size_t const count)
+{
+	sendAdp(count, la::avdecc::protocol::AdpMessageType::EntityAvailable);
+}
+
+void SimulatedEntities::depart(std::size_t const count)
+{
+	sendAdp(count, la::avdecc::protocol::AdpMessageType::EntityDeparting);
+}
+
+SimulatedEntities::Statistics SimulatedEntities::getStatistics() const noexcept
+{
+	return Statistics{ _commandsReceived.load(), _messagesSent.load() };
+}
+
+void SimulatedEntities::resetStatistics() noexcept
+{
+	_commandsReceived = 0u;
+	_messagesSent = 0u;
+}
+
+la::avdecc::UniqueIdentifier SimulatedEntities::getEntityID(std::size_t const index) noexcept
+{
+	return la::avdecc::UniqueIdentifier{ SimulatedEntityIDBase + index + 1u };
+}
+
+bool SimulatedEntities::isSimulatedEntity(la::avdecc::UniqueIdentifier const entityID) const noexcept
+{
+	auto const value = entityID.getValue();
+	return value > SimulatedEntityIDBase && value <= SimulatedEntityIDBase + _entitiesCount;
+}
+
+void SimulatedEntities::sendAdp(std::size_t const count, la::avdecc::protocol::AdpMessageType const messageType)
+{
+	auto const exclusion = allocationCounter::ScopedExclusion{};
+	auto const isAvailable = messageType == la::avdecc::protocol::AdpMessageType::EntityAvailable;
+
+	// Commands targeting the entities are accepted as soon as they are advertised
+	if (isAvailable && count > _entitiesCount)
+	{
+		_entitiesCount = count;
+	}
+
+	for (auto index = std::size_t{ 0u }; index < count; ++index)
+	{
+		auto const entityID = getEntityID(index);
+
+		auto frame = la::avdecc::protocol::Adpdu{};
+		// Set Ether2 fields
+		frame.setSrcAddress(ResponderMacAddress);
+		frame.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+		// Set ADP fields
+		frame.setMessageType(messageType);
+		frame.setValidTime(isAvailable ? AdpValidTime : 0u);
+		frame.setEntityID(entityID);
+		if (isAvailable)
+		{
+			frame.setEntityModelID(_conversation.getEntityModelID());
+			frame.setEntityCapabilities(EntityModelConversation::getEntityCapabilities());
+			frame.setTalkerStreamSources(_conversation.getTalkerStreamSources());
+			frame.setTalkerCapabilities(_conversation.getTalkerCapabilities());
+			frame.setListenerStreamSinks(_conversation.getListenerStreamSinks());
+			frame.setListenerCapabilities(_conversation.getListenerCapabilities());
+			frame.setAvailableIndex(_availableIndex);
+		}
+
+		_protocolInterface->sendAdpMessage(frame);
+		++_messagesSent;
+	}
+	++_availableIndex;
+}
+
+la::avdecc::protocol::Aecpdu::UniquePointer SimulatedEntities::buildAemResponse(la::avdecc::protocol::AemAecpdu const& command) const
+{
+	auto status = la::avdecc::protocol::AecpStatus{ la::avdecc::protocol::AecpStatus::Success };
+	auto const* payload = static_cast<EntityModelConversation::Payload const*>(nullptr);
+	auto entityPayload = EntityModelConversation::Payload{};
+
+	auto const commandType = command.getCommandType();
+	if (commandType == la::avdecc::protocol::AemCommandType::ReadDescriptor)
+	{
+		auto const [configurationIndex, descriptorType, descriptorIndex] = aemPayload::deserializeReadDescriptorCommand(command.getPayload());
+		if (descriptorType == model::DescriptorType::Entity)
+		{
+			entityPayload = _conversation.buildEntityDescriptorResponse(command.getTargetEntityID());
+			payload = &entityPayload;
+		}
+		else if (descriptorType == model::DescriptorType::Control)
+		{
+			status = la::avdecc::protocol::AecpStatus::NotImplemented;
+		}
+		else
+		{
+			payload = _conversation.findDescriptorResponse(configurationIndex, descriptorType, descriptorIndex);
+			if (!payload)
+			{
+				status = la::avdecc::protocol::AemAecpStatus::NoSuchDescriptor;
+			}
+		}
+	}
+	else if (commandType == la::avdecc::protocol::AemCommandType::RegisterUnsolicitedNotification || commandType == la::avdecc::protocol::AemCommandType::DeregisterUnsolicitedNotification)
+	{
+		// Empty response payload
+	}
+	else if (commandType == la::avdecc::protocol::AemCommandType::GetAudioMap)
+	{
+		auto const [descriptorType, descriptorIndex, mapIndex] = aemPayload::deserializeGetAudioMapCommand(command.getPayload());
+		payload = _conversation.findAudioMapResponse(descriptorType, descriptorIndex, mapIndex);
+		if (!payload)
+		{
+			status = la::avdecc::protocol::AemAecpStatus::NoSuchDescriptor;
+		}
+	}
+	else if (commandType == la::avdecc::protocol::AemCommandType::GetAsPath)
+	{
+		auto const [descriptorIndex] = aemPayload::deserializeGetAsPathCommand(command.getPayload());
+		payload = _conversation.findAsPathResponse(descriptorIndex);
+		if (!payload)
+		{
+			status = la::avdecc::protocol::AecpStatus::NotImplemented;
+		}
+	}
+	else
+	{
+		// Not part of the recorded conversation
+		status = la::avdecc::protocol::AecpStatus::NotImplemented;
+	}
+
+	if (status == la::avdecc::protocol::AecpStatus::NotImplemented)
+	{
+		// Reflect the command
+		auto response = command.responseCopy();
+		response->setSrcAddress(ResponderMacAddress);
+		response->setDestAddress(command.getSrcAddress());
+		response->setStatus(status);
+		return response;
+	}
+
+	auto response = la::avdecc::protocol::AemAecpdu::create(true);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*response);
+	// Set Ether2 fields
+	aem.setSrcAddress(ResponderMacAddress);
+	aem.setDestAddress(command.getSrcAddress());
+	// Set AECP fields
+	aem.setStatus(status);
+	aem.setTargetEntityID(command.getTargetEntityID());
+	aem.setControllerEntityID(command.getControllerEntityID());
+	aem.setSequenceID(command.getSequenceID());
+	// Set AEM fields
+	aem.setUnsolicited(false);
+	aem.setCommandType(commandType);
+	if (payload)
+	{
+		aem.setCommandSpecificData(payload->data(), payload->size());
+	}
+	else
+	{
+		// Only reflect the command payload in case of error
+		auto const [commandPayload, commandPayloadLength] = command.getPayload();
+		aem.setCommandSpecificData(commandPayload, commandPayloadLength);
+	}
+	return response;
+}
+
+void SimulatedEntities::queueResponse(PendingResponse&& response) noexcept
+{
+	if (_responseLatency.count() == 0)
+	{
+		sendResponse(response);
+		return;
+	}
+
+	response.sendTime = std::chrono::steady_clock::now() + _responseLatency;
+	{
+		auto const lg = std::lock_guard{ _lock };
+		_pendingResponses.push_back(std::move(response));
+	}
+	_cond.notify_one();
+}
+
+void SimulatedEntities::sendResponse(PendingResponse const& response) const noexcept
+{
+	if (response.aecpdu)
+	{
+		// Directly send the message (the response has been built as a copy, and the sendAecpResponse method requires ownership)
+		_protocolInterface->sendAecpMessage(*response.aecpdu);
+	}
+	else if (response.acmpdu)
+	{
+		_protocolInterface->sendAcmpMessage(*response.acmpdu);
+	}
+	++_messagesSent;
+}
+
+/* ************************************************************ */
+/* la::avdecc::protocol::ProtocolInterface::Observer overrides  */
+/* ************************************************************ */
+void SimulatedEntities::onAecpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept
+{
+	auto const messageType = aecpdu.getMessageType();
+	auto const isCommand = messageType == la::avdecc::protocol::AecpMessageType::AemCommand || messageType == la::avdecc::protocol::AecpMessageType::AddressAccessCommand || messageType == la::avdecc::protocol::AecpMessageType::VendorUniqueCommand;
+
+	// Only process commands targeting one of the simulated entities
+	if (!isCommand || !isSimulatedEntity(aecpdu.getTargetEntityID()))
+	{
+		return;
+	}
+	++_commandsReceived;
+
+	try
+	{
+		auto response = PendingResponse{};
+		if (messageType == la::avdecc::protocol::AecpMessageType::AemCommand)
+		{
+			response.aecpdu = buildAemResponse(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu));
+		}
+		else
+		{
+			// Not part of the recorded conversation
+			response.aecpdu = aecpdu.responseCopy();
+			response.aecpdu->setSrcAddress(ResponderMacAddress);
+			response.aecpdu->setDestAddress(aecpdu.getSrcAddress());
+			response.aecpdu->setStatus(la::avdecc::protocol::AecpStatus::NotImplemented);
+		}
+		queueResponse(std::move(response));
+	}
+	catch (...)
+	{
+		// Malformed command, let it timeout
+	}
+}
+
+void SimulatedEntities::onAcmpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Acmpdu const& acmpdu) noexcept
+{
+	auto const messageType = acmpdu.getMessageType();
+	auto const isTalkerCommand = messageType == la::avdecc::protocol::AcmpMessageType::ConnectTxCommand || messageType == la::avdecc::protocol::AcmpMessageType::DisconnectTxCommand || messageType == la::avdecc::protocol::AcmpMessageType::GetTxStateCommand || messageType == la::avdecc::protocol::AcmpMessageType::GetTxConnectionCommand;
+	auto const isListenerCommand = messageType == la::avdecc::protocol::AcmpMessageType::ConnectRxCommand || messageType == la::avdecc::protocol::AcmpMessageType::DisconnectRxCommand || messageType == la::avdecc::protocol::AcmpMessageType::GetRxStateCommand;
+
+	// Only process commands targeting one of the simulated entities
+	if (!(isTalkerCommand && isSimulatedEntity(acmpdu.getTalkerEntityID())) && !(isListenerCommand && isSimulatedEntity(acmpdu.getListenerEntityID())))
+	{
+		return;
+	}
+	++_commandsReceived;
+
+	auto response = PendingResponse{};
+	response.acmpdu = acmpdu;
+	auto& frame = *response.acmpdu;
+	// Set Ether2 fields
+	frame.setSrcAddress(ResponderMacAddress);
+	frame.setDestAddress(la::avdecc::protocol::Acmpdu::Multicast_Mac_Address);
+	// Set ACMP fields (responses are always the command + 1)
+	frame.setMessageType(la::avdecc::protocol::AcmpMessageType{ static_cast<std::uint8_t>(messageType.getValue() + 1u) });
+	// The simulated streams are never connected
+	if (messageType == la::avdecc::protocol::AcmpMessageType::GetTxStateCommand || messageType == la::avdecc::protocol::AcmpMessageType::GetRxStateCommand)
+	{
+		frame.setStatus(la::avdecc::protocol::AcmpStatus::Success);
+		frame.setConnectionCount(0u);
+		if (isListenerCommand)
+		{
+			frame.setTalkerEntityID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+		}
+	}
+	else
+	{
+		frame.setStatus(la::avdecc::protocol::AcmpStatus::NotSupported);
+	}
+	queueResponse(std::move(response));
+}
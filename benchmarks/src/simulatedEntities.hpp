@@ -0,0 +1,158 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file simulatedEntities.hpp
+* @author Christophe Calmejane
+* @brief Simulated AEM entities answering a controller over a virtual network, by replaying the responses recorded from a JSON entity model.
+*/
+
+#pragma once
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/internals/entityModelTree.hpp>
+#include <la/avdecc/internals/protocolInterface.hpp>
+
+// Internal API
+#include "protocolInterface/protocolInterface_virtual.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+/**
+* @brief AEM conversation of an entity, recorded from a JSON entity model (ControlledEntity dump or entity model file).
+* @details All READ_DESCRIPTOR responses (except for the ENTITY descriptor that depends on the simulated EntityID) are serialized once when loading,
+*          so replaying them costs a lookup and a copy. CONTROL descriptors are not recorded (the library only knows how to serialize their dynamic values).
+*/
+class EntityModelConversation final
+{
+public:
+	using Payload = std::vector<std::uint8_t>;
+
+	/** Loads the conversation from a JSON file. Throws std::runtime_error if the file cannot be loaded */
+	static EntityModelConversation loadFromJson(std::string const& filePath);
+
+	la::avdecc::UniqueIdentifier getEntityModelID() const noexcept;
+	std::uint16_t getTalkerStreamSources() const noexcept;
+	std::uint16_t getListenerStreamSinks() const noexcept;
+	static la::avdecc::entity::EntityCapabilities getEntityCapabilities() noexcept;
+	la::avdecc::entity::TalkerCapabilities getTalkerCapabilities() const noexcept;
+	la::avdecc::entity::ListenerCapabilities getListenerCapabilities() const noexcept;
+
+	/** Returns the READ_DESCRIPTOR response payload of the ENTITY descriptor, for the specified simulated entity */
+	Payload buildEntityDescriptorResponse(la::avdecc::UniqueIdentifier const entityID) const;
+	/** Returns the recorded READ_DESCRIPTOR response payload, or nullptr if the descriptor is unknown */
+	Payload const* findDescriptorResponse(la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::DescriptorType const descriptorType, la::avdecc::entity::model::DescriptorIndex const descriptorIndex) const noexcept;
+	/** Returns the recorded GET_AUDIO_MAP response payload for a stream port of the current configuration, or nullptr if the stream port or the map index is unknown */
+	Payload const* findAudioMapResponse(la::avdecc::entity::model::DescriptorType const descriptorType, la::avdecc::entity::model::DescriptorIndex const descriptorIndex, la::avdecc::entity::model::MapIndex const mapIndex) const noexcept;
+	/** Returns the recorded GET_AS_PATH response payload for an AVB interface of the current configuration, or nullptr if not known */
+	Payload const* findAsPathResponse(la::avdecc::entity::model::DescriptorIndex const descriptorIndex) const noexcept;
+
+private:
+	using DescriptorKey = std::tuple<la::avdecc::entity::model::ConfigurationIndex, la::avdecc::entity::model::DescriptorType, la::avdecc::entity::model::DescriptorIndex>;
+	using DynamicKey = std::tuple<la::avdecc::entity::model::DescriptorType, la::avdecc::entity::model::DescriptorIndex>;
+
+	EntityModelConversation() = default;
+
+	la::avdecc::entity::model::EntityTree _entityTree{};
+	la::avdecc::UniqueIdentifier _entityModelID{};
+	std::map<DescriptorKey, Payload> _descriptorResponses{};
+	std::map<DynamicKey, std::vector<Payload>> _audioMapResponses{};
+	std::map<la::avdecc::entity::model::DescriptorIndex, Payload> _asPathResponses{};
+};
+
+/**
+* @brief Simulates a set of entities sharing the same EntityModelConversation, on a single virtual protocol interface.
+* @details All the simulated entities share the MacAddress of the virtual protocol interface. ADP, AECP and ACMP messages targeting the simulated entities are answered after the configured response latency
+*          (AEM commands not part of the recorded conversation are answered with NOT_IMPLEMENTED, ACMP commands with NOT_SUPPORTED).
+*          The allocations made by the simulated entities are excluded from the allocationCounter.
+*/
+class SimulatedEntities final : private la::avdecc::protocol::ProtocolInterface::Observer
+{
+public:
+	struct Statistics
+	{
+		std::uint64_t commandsReceived{ 0u }; /** AECP and ACMP commands received from the controller */
+		std::uint64_t messagesSent{ 0u }; /** ADP advertisements and AECP/ACMP responses sent to the controller */
+	};
+
+	/** Creates simulated entities on the specified virtual network */
+	SimulatedEntities(std::string const& networkInterfaceID, EntityModelConversation const& conversation, std::chrono::microseconds const responseLatency);
+	~SimulatedEntities() noexcept;
+
+	/** Advertises (ENTITY_AVAILABLE) the first 'count' simulated entities, incrementing their available_index */
+	void advertise(std::size_t const count);
+	/** Departs (ENTITY_DEPARTING) the first 'count' simulated entities */
+	void depart(std::size_t const count);
+
+	Statistics getStatistics() const noexcept;
+	void resetStatistics() noexcept;
+
+	// Deleted compiler auto-generated methods
+	SimulatedEntities(SimulatedEntities const&) = delete;
+	SimulatedEntities(SimulatedEntities&&) = delete;
+	SimulatedEntities& operator=(SimulatedEntities const&) = delete;
+	SimulatedEntities& operator=(SimulatedEntities&&) = delete;
+
+private:
+	struct PendingResponse
+	{
+		std::chrono::steady_clock::time_point sendTime{};
+		la::avdecc::protocol::Aecpdu::UniquePointer aecpdu{ nullptr, nullptr };
+		std::optional<la::avdecc::protocol::Acmpdu> acmpdu{ std::nullopt };
+	};
+
+	// la::avdecc::protocol::ProtocolInterface::Observer overrides
+	virtual void onAecpduReceived(la::avdecc::protocol::ProtocolInterface* const pi, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override;
+	virtual void onAcmpduReceived(la::avdecc::protocol::ProtocolInterface* const pi, la::avdecc::protocol::Acmpdu const& acmpdu) noexcept override;
+
+	static la::avdecc::UniqueIdentifier getEntityID(std::size_t const index) noexcept;
+	bool isSimulatedEntity(la::avdecc::UniqueIdentifier const entityID) const noexcept;
+	void sendAdp(std::size_t const count, la::avdecc::protocol::AdpMessageType const messageType);
+	la::avdecc::protocol::Aecpdu::UniquePointer buildAemResponse(la::avdecc::protocol::AemAecpdu const& command) const;
+	void queueResponse(PendingResponse&& response) noexcept;
+	void sendResponse(PendingResponse const& response) const noexcept;
+
+	EntityModelConversation const& _conversation;
+	std::chrono::microseconds const _responseLatency{};
+	la::avdecc::ExecutorManager::ExecutorWrapper::UniquePointer _executorWrapper{ nullptr, nullptr };
+	std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual> _protocolInterface{ nullptr };
+	std::atomic<std::size_t> _entitiesCount{ 0u };
+	std::uint32_t _availableIndex{ 0u };
+	std::atomic<std::uint64_t> _commandsReceived{ 0u };
+	mutable std::atomic<std::uint64_t> _messagesSent{ 0u };
+	// Delayed responses
+	std::mutex _lock{};
+	std::condition_variable _cond{};
+	std::deque<PendingResponse> _pendingResponses{};
+	bool _shouldTerminate{ false };
+	std::thread _senderThread{};
+};
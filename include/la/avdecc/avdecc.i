@@ -461,6 +461,10 @@ DEFINE_ENUM_CLASS(la::avdecc::protocol::ProtocolInterface, Type, "uint")
 %ignore la::avdecc::protocol::ProtocolInterface::sendAcmpResponse; // Ignore method (we don't want to handle Acmpdu now)
 %ignore la::avdecc::protocol::ProtocolInterface::getVuAecpCommandTimeout; // Ignore method (we don't want to handle VuAecpdu now)
 %ignore la::avdecc::protocol::ProtocolInterface::getVendorUniqueDelegate; // Ignore method (we don't want to handle VuAecpdu now)
+%ignore la::avdecc::protocol::ProtocolInterface::AecpCongestionControlParameters; // Ignore struct (we don't want to handle congestion control now)
+%ignore la::avdecc::protocol::ProtocolInterface::AecpCongestionControlStatistics; // Ignore struct (we don't want to handle congestion control now)
+%ignore la::avdecc::protocol::ProtocolInterface::setAecpCongestionControlParameters; // Ignore method (we don't want to handle congestion control now)
+%ignore la::avdecc::protocol::ProtocolInterface::getAecpCongestionControlStatistics; // Ignore method (we don't want to handle congestion control now)
 %unique_ptr(la::avdecc::protocol::ProtocolInterface) // Define unique_ptr for ProtocolInterface
 // Extend the class
 %extend la::avdecc::protocol::ProtocolInterface
@@ -613,6 +617,15 @@ DEFINE_OPTIONAL_CLASS(la::avdecc::entity::model, ClockDomainCounters, OptClockDo
 
 // Bind structs and classes
 %rename($ignore, %$isclass) ""; // Ignore all structs/classes, manually re-enable
+%nspace la::avdecc::entity::model::DescriptorCountersStorage;
+%rename("%s") la::avdecc::entity::model::DescriptorCountersStorage; // Unignore class
+%ignore la::avdecc::entity::model::DescriptorCountersStorage::base_iterator; // Iterators are not bound, use find/at/count
+%ignore la::avdecc::entity::model::DescriptorCountersStorage::operator[]; // Don't know how to properly bind a reference return value
+%ignore la::avdecc::entity::model::DescriptorCountersStorage::emplace;
+%ignore la::avdecc::entity::model::DescriptorCountersStorage::DescriptorCountersStorage(DescriptorCountersStorage&&);
+%ignore la::avdecc::entity::model::DescriptorCountersStorage::operator=;
+%rename("isEqual") la::avdecc::entity::model::DescriptorCountersStorage::operator==;
+%rename("isDifferent") la::avdecc::entity::model::DescriptorCountersStorage::operator!=;
 DEFINE_AEM_TREE_COMMON(StreamInputConnectionInfo)
 DEFINE_AEM_TREE_COMMON(StreamDynamicInfo)
 DEFINE_AEM_TREE_COMMON(AvbInterfaceInfo)
@@ -683,12 +696,12 @@ DEFINE_AEM_TREE_NODE(Entity);
 %template(TimingNodeModelMap) std::map<la::avdecc::entity::model::TimingIndex, la::avdecc::entity::model::TimingNodeModels>;
 %template(PtpPortNodeModelMap) std::map<la::avdecc::entity::model::PtpPortIndex, la::avdecc::entity::model::PtpPortNodeModels>;
 %template(ConfigurationTreeMap) std::map<la::avdecc::entity::model::ConfigurationIndex, la::avdecc::entity::model::ConfigurationTree>;
-%template(EntityCounters) std::map<la::avdecc::entity::EntityCounterValidFlag, la::avdecc::entity::model::DescriptorCounter>;
-%template(StreamInputCounters) std::map<la::avdecc::entity::StreamInputCounterValidFlag, la::avdecc::entity::model::DescriptorCounter>;
-%template(StreamOutputCounters) std::map<la::avdecc::entity::StreamOutputCounterValidFlag, la::avdecc::entity::model::DescriptorCounter>;
+%template(EntityCounters) la::avdecc::entity::model::DescriptorCountersStorage<la::avdecc::entity::EntityCounterValidFlag>;
+%template(StreamInputCounters) la::avdecc::entity::model::DescriptorCountersStorage<la::avdecc::entity::StreamInputCounterValidFlag>;
+%template(StreamOutputCounters) la::avdecc::entity::model::DescriptorCountersStorage<la::avdecc::entity::StreamOutputCounterValidFlag>;
 %template(StreamOutputCounters17221) std::map<la::avdecc::entity::StreamOutputCounterValidFlag17221, la::avdecc::entity::model::DescriptorCounter>;
-%template(AvbInterfaceCounters) std::map<la::avdecc::entity::AvbInterfaceCounterValidFlag, la::avdecc::entity::model::DescriptorCounter>;
-%template(ClockDomainCounters) std::map<la::avdecc::entity::ClockDomainCounterValidFlag, la::avdecc::entity::model::DescriptorCounter>;
+%template(AvbInterfaceCounters) la::avdecc::entity::model::DescriptorCountersStorage<la::avdecc::entity::AvbInterfaceCounterValidFlag>;
+%template(ClockDomainCounters) la::avdecc::entity::model::DescriptorCountersStorage<la::avdecc::entity::ClockDomainCounterValidFlag>;
 %template(LocalizedStringMap) std::unordered_map<la::avdecc::entity::model::StringsIndex, la::avdecc::entity::model::AvdeccFixedString>;
 
 ////////////////////////////////////////
@@ -0,0 +1,219 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccController.h
+* @author Christophe Calmejane
+* @brief Avdecc Controller C Bindings header file.
+* @details Flat, read-only views of the ControlledEntities are borrowed from the controller model under a guard (no copy, no allocation),
+*          and the controller events are queued and delivered in batches from the thread of your choice.
+*/
+
+#pragma once
+
+#include "../avdecc.h"
+
+#include <stddef.h>
+
+#define LA_AVDECC_CONTROLLER_HANDLE LA_AVDECC_HANDLE
+#define LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE LA_AVDECC_HANDLE
+
+typedef unsigned char avdecc_controller_error_t;
+typedef unsigned short avdecc_controller_event_type_t;
+typedef unsigned char avdecc_controller_stream_input_connection_state_t;
+
+/** Valid values for avdecc_controller_error_t */
+enum avdecc_controller_error_e
+{
+	avdecc_controller_error_no_error = 0,
+	avdecc_controller_error_invalid_protocol_interface_type = 1, /**< Selected protocol interface type is invalid. */
+	avdecc_controller_error_interface_open_error = 2, /**< Failed to open interface. */
+	avdecc_controller_error_interface_not_found = 3, /**< Specified interface not found. */
+	avdecc_controller_error_interface_invalid = 4, /**< Specified interface is invalid. */
+	avdecc_controller_error_duplicate_prog_id = 5, /**< Specified ProgID is already in use on the local computer. */
+	avdecc_controller_error_invalid_entity_model = 6, /**< Provided EntityModel is invalid. */
+	avdecc_controller_error_duplicate_executor_name = 7, /**< Provided executor name already exists. */
+	avdecc_controller_error_unknown_executor_name = 8, /**< Provided executor name doesn't exist. */
+	avdecc_controller_error_unknown_entity = 20, /**< Specified entity is not (or no longer) online. */
+	avdecc_controller_error_not_supported = 21, /**< Query not supported by the entity (AEM not supported or failed to be enumerated). */
+	avdecc_controller_error_invalid_descriptor_index = 22, /**< Specified descriptor index does not exist in the current configuration. */
+	avdecc_controller_error_invalid_parameters = 23, /**< Specified parameters are invalid. */
+	avdecc_controller_error_invalid_controller_handle = 97, /**< Passed LA_AVDECC_CONTROLLER_HANDLE is invalid. */
+	avdecc_controller_error_invalid_guard_handle = 98, /**< Passed LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE is invalid. */
+	avdecc_controller_error_internal_error = 99, /**< Internal error, please report the issue. */
+};
+
+/** Valid values for avdecc_controller_event_type_t */
+enum avdecc_controller_event_type_e
+{
+	avdecc_controller_event_type_entity_online = 1, /**< Entity is online (fully enumerated). */
+	avdecc_controller_event_type_entity_offline = 2, /**< Entity went offline, no view can be retrieved anymore. */
+	avdecc_controller_event_type_entity_capabilities_changed = 3,
+	avdecc_controller_event_type_entity_association_id_changed = 4,
+	avdecc_controller_event_type_unsolicited_registration_changed = 5,
+	avdecc_controller_event_type_compatibility_flags_changed = 6,
+	avdecc_controller_event_type_acquire_state_changed = 7,
+	avdecc_controller_event_type_lock_state_changed = 8,
+	avdecc_controller_event_type_entity_name_changed = 9,
+	avdecc_controller_event_type_entity_group_name_changed = 10,
+	avdecc_controller_event_type_stream_input_connection_changed = 11, /**< descriptor_index is the StreamIndex. */
+	avdecc_controller_event_type_stream_output_connections_changed = 12, /**< descriptor_index is the StreamIndex. */
+	avdecc_controller_event_type_stream_input_format_changed = 13, /**< descriptor_index is the StreamIndex. */
+	avdecc_controller_event_type_stream_output_format_changed = 14, /**< descriptor_index is the StreamIndex. */
+	avdecc_controller_event_type_stream_input_running_changed = 15, /**< descriptor_index is the StreamIndex. */
+	avdecc_controller_event_type_stream_output_running_changed = 16, /**< descriptor_index is the StreamIndex. */
+	avdecc_controller_event_type_audio_unit_sampling_rate_changed = 17, /**< descriptor_index is the AudioUnitIndex. */
+	avdecc_controller_event_type_clock_source_changed = 18, /**< descriptor_index is the ClockDomainIndex. */
+	avdecc_controller_event_type_control_values_changed = 19, /**< descriptor_index is the ControlIndex. */
+	avdecc_controller_event_type_stream_port_input_audio_mappings_changed = 20, /**< descriptor_index is the StreamPortIndex. */
+	avdecc_controller_event_type_stream_port_output_audio_mappings_changed = 21, /**< descriptor_index is the StreamPortIndex. */
+	avdecc_controller_event_type_avb_interface_link_status_changed = 22, /**< descriptor_index is the AvbInterfaceIndex. */
+	avdecc_controller_event_type_events_lost = 0xffff, /**< Too many events were pending and some of them have been dropped. Views of all entities should be refreshed. */
+};
+
+/** Valid values for avdecc_controller_stream_input_connection_state_t */
+enum avdecc_controller_stream_input_connection_state_e
+{
+	avdecc_controller_stream_input_connection_state_not_connected = 0,
+	avdecc_controller_stream_input_connection_state_fast_connecting = 1,
+	avdecc_controller_stream_input_connection_state_connected = 2,
+};
+
+/* ************************************************************************** */
+/* Controller events                                                          */
+/* ************************************************************************** */
+
+/** A controller event. The new state must be retrieved using the views (events only carry which part of which entity changed). */
+typedef struct avdecc_controller_event_s
+{
+	avdecc_controller_event_type_t event_type;
+	avdecc_unique_identifier_t entity_id;
+	avdecc_entity_model_descriptor_type_t descriptor_type;
+	avdecc_entity_model_descriptor_index_t descriptor_index;
+} avdecc_controller_event_t, *avdecc_controller_event_p;
+typedef avdecc_controller_event_t const* avdecc_controller_event_cp;
+
+/** Handler called with a batch of events, in the order they occured. The events array is only valid during the call. */
+typedef void(LA_AVDECC_BINDINGS_C_CALL_CONVENTION* avdecc_controller_events_cb)(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_controller_event_cp const events, size_t const eventsCount);
+
+/* ************************************************************************** */
+/* Borrowed views                                                             */
+/* ************************************************************************** */
+
+/** A string borrowed from the controller model. Not NULL terminated. */
+typedef struct avdecc_controller_string_view_s
+{
+	char const* data;
+	size_t length;
+} avdecc_controller_string_view_t, *avdecc_controller_string_view_p;
+typedef avdecc_controller_string_view_t const* avdecc_controller_string_view_cp;
+
+/** Flat view of an entity. Borrowed pointers are valid until the guard it was retrieved from is released. */
+typedef struct avdecc_controller_entity_view_s
+{
+	avdecc_unique_identifier_t entity_id;
+	avdecc_unique_identifier_t entity_model_id;
+	avdecc_entity_entity_capabilities_t entity_capabilities;
+	avdecc_entity_talker_capabilities_t talker_capabilities;
+	avdecc_entity_listener_capabilities_t listener_capabilities;
+	avdecc_bool_t is_aem_supported; /**< If false, only the ADP fields above are valid. */
+	avdecc_bool_t is_acquired;
+	avdecc_bool_t is_acquired_by_other;
+	avdecc_bool_t is_locked;
+	avdecc_bool_t is_locked_by_other;
+	avdecc_bool_t is_subscribed_to_unsolicited_notifications;
+	avdecc_entity_model_descriptor_index_t current_configuration;
+	avdecc_controller_string_view_t entity_name;
+	avdecc_controller_string_view_t group_name;
+	avdecc_controller_string_view_t firmware_version;
+	avdecc_controller_string_view_t serial_number;
+	unsigned short audio_units_count; /**< In the current configuration. */
+	unsigned short stream_inputs_count; /**< In the current configuration. */
+	unsigned short stream_outputs_count; /**< In the current configuration. */
+} avdecc_controller_entity_view_t, *avdecc_controller_entity_view_p;
+typedef avdecc_controller_entity_view_t const* avdecc_controller_entity_view_cp;
+
+/** Flat view of an audio unit. Borrowed pointers are valid until the guard it was retrieved from is released. */
+typedef struct avdecc_controller_audio_unit_view_s
+{
+	avdecc_controller_string_view_t object_name;
+	avdecc_entity_model_descriptor_index_t clock_domain_index;
+	unsigned short number_of_stream_input_ports;
+	avdecc_entity_model_descriptor_index_t base_stream_input_port;
+	unsigned short number_of_stream_output_ports;
+	avdecc_entity_model_descriptor_index_t base_stream_output_port;
+	avdecc_entity_model_sampling_rate_t current_sampling_rate;
+	avdecc_entity_model_sampling_rate_t const* sampling_rates; /**< Borrowed array of supported sampling rates. */
+	size_t sampling_rates_count;
+} avdecc_controller_audio_unit_view_t, *avdecc_controller_audio_unit_view_p;
+typedef avdecc_controller_audio_unit_view_t const* avdecc_controller_audio_unit_view_cp;
+
+/** Flat view of a stream (input or output). Borrowed pointers are valid until the guard it was retrieved from is released. */
+typedef struct avdecc_controller_stream_view_s
+{
+	avdecc_controller_string_view_t object_name;
+	avdecc_entity_model_descriptor_index_t clock_domain_index;
+	avdecc_entity_stream_flags_t stream_flags;
+	avdecc_entity_model_descriptor_index_t avb_interface_index;
+	avdecc_entity_model_stream_format_t current_format;
+	avdecc_entity_model_stream_format_t const* formats; /**< Borrowed array of supported stream formats. */
+	size_t formats_count;
+	avdecc_bool_t is_running_valid;
+	avdecc_bool_t is_running;
+	avdecc_controller_stream_input_connection_state_t connection_state; /**< Only valid for a stream input. */
+	avdecc_entity_model_stream_identification_t connected_talker; /**< Only valid for a stream input, if connection_state is not avdecc_controller_stream_input_connection_state_not_connected. */
+} avdecc_controller_stream_view_t, *avdecc_controller_stream_view_p;
+typedef avdecc_controller_stream_view_t const* avdecc_controller_stream_view_cp;
+
+/* ************************************************************************** */
+/* Controller APIs                                                            */
+/* ************************************************************************** */
+
+/** Creates a new Controller. avdecc_controller_error_no_error is returned in case of success and createdControllerHandle is initialized with the newly created ControllerHandle. LA_AVDECC_Controller_destroy must be called when the Controller is no longer in use. executorName can be NULL to use the default executor. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_create(avdecc_protocol_interface_type_t const protocolInterfaceType, avdecc_const_string_t networkInterfaceID, unsigned short const progID, avdecc_unique_identifier_t const entityModelID, avdecc_const_string_t preferedLocale, avdecc_const_string_t executorName, LA_AVDECC_CONTROLLER_HANDLE* const createdControllerHandle);
+/** Destroys a previously created Controller. All the guards retrieved from this Controller must have been released. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_destroy(LA_AVDECC_CONTROLLER_HANDLE const handle);
+/** Sets application data on a Controller. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_setApplicationData(LA_AVDECC_CONTROLLER_HANDLE const handle, void* applicationData);
+/** Retrieves application data from a Controller. */
+LA_AVDECC_BINDINGS_C_API void* LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_getApplicationData(LA_AVDECC_CONTROLLER_HANDLE const handle);
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_discoverRemoteEntities(LA_AVDECC_CONTROLLER_HANDLE const handle);
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_discoverRemoteEntity(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_unique_identifier_t const entityID);
+/** Calls onEvents once with all the events queued since the previous call (onEvents is not called if there are no pending events). No lock is held during the call, so any API can be called from the handler. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_dispatchEvents(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_controller_events_cb const onEvents);
+
+/* ************************************************************************** */
+/* ControlledEntityGuard APIs                                                 */
+/* ************************************************************************** */
+
+/** Locks the specified entity and returns a guard handle to retrieve views of it. The controller cannot update the entity until LA_AVDECC_ControlledEntityGuard_release is called, so it should not be kept for more than a few milliseconds. The guard holds a (recursive) lock and must be used and released from the thread that retrieved it. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_getControlledEntityGuard(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_unique_identifier_t const entityID, LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE* const guardHandle);
+/** Releases the guard, invalidating all the views retrieved from it. Must be called from the thread that retrieved the guard. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_release(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle);
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getEntityView(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_controller_entity_view_p const view);
+/** Retrieves a view of an audio unit of the current configuration. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getAudioUnitView(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const audioUnitIndex, avdecc_controller_audio_unit_view_p const view);
+/** Retrieves a view of a stream input of the current configuration. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getStreamInputView(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const streamIndex, avdecc_controller_stream_view_p const view);
+/** Retrieves a view of a stream output of the current configuration. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getStreamOutputView(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const streamIndex, avdecc_controller_stream_view_p const view);
+/** Retrieves the (borrowed) dynamic audio mappings of a stream port input of the current configuration. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getStreamPortInputAudioMappings(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const streamPortIndex, avdecc_entity_model_audio_mapping_cp* const mappings, size_t* const mappingsCount);
+/** Retrieves the (borrowed) dynamic audio mappings of a stream port output of the current configuration. */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getStreamPortOutputAudioMappings(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const streamPortIndex, avdecc_entity_model_audio_mapping_cp* const mappings, size_t* const mappingsCount);
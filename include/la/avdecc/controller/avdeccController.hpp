@@ -37,6 +37,7 @@
 #include "internals/virtualEntityBuilder.hpp"
 #include "internals/exports.hpp"
 
+#include <array>
 #include <memory>
 #include <functional>
 #include <cstdint>
@@ -295,6 +296,7 @@ public:
 		virtual void onAvbInterfaceInfoChanged(la::avdecc::controller::Controller const* const controller, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AvbInterfaceInfo const& info) noexcept = 0;
 		virtual void onAsPathChanged(la::avdecc::controller::Controller const* const controller, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AsPath const& asPath) noexcept = 0;
 		virtual void onAvbInterfaceLinkStatusChanged(la::avdecc::controller::Controller const* const controller, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::controller::ControlledEntity::InterfaceLinkStatus const linkStatus) noexcept = 0;
+		/** Counters notifications are only sent when at least one counter changed. Use counters.getChangedCounters() and counters.getDelta() to know what changed since the previous notification */
 		virtual void onEntityCountersChanged(la::avdecc::controller::Controller const* const controller, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::EntityCounters const& counters) noexcept = 0;
 		virtual void onAvbInterfaceCountersChanged(la::avdecc::controller::Controller const* const controller, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AvbInterfaceCounters const& counters) noexcept = 0;
 		virtual void onClockDomainCountersChanged(la::avdecc::controller::Controller const* const controller, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::ClockDomainCounters const& counters) noexcept = 0;
@@ -442,6 +444,136 @@ public:
 		virtual ~ExclusiveAccessToken() = default;
 	};
 
+	/**
+	* @brief Subscription to the dynamic values of a numeric control (typically a meter or a level indicator).
+	* @details Each unsolicited update of the control values is decoded and pushed into a lock-free single-producer/single-consumer ring, bypassing the model update and the Observer notifications.
+	*          Samples are pushed from the networking thread and must be popped from a single thread. If the ring is full, new samples are dropped.
+	*/
+	class ControlValuesSubscription
+	{
+	public:
+		using SharedPointer = std::shared_ptr<ControlValuesSubscription>;
+
+		static constexpr std::size_t MaxValues = 16u; /** Maximum number of values in a sample, additional values are ignored */
+
+		struct Sample
+		{
+			std::chrono::steady_clock::time_point timestamp{};
+			std::uint16_t valuesCount{ 0u };
+			std::array<double, MaxValues> values{};
+		};
+
+		virtual UniqueIdentifier getEntityID() const noexcept = 0;
+		virtual entity::model::ControlIndex getControlIndex() const noexcept = 0;
+		/** Pops the oldest sample from the ring. Returns false if the ring is empty. Must always be called from the same thread. */
+		virtual bool pop(Sample& sample) noexcept = 0;
+		/** Returns the number of samples dropped because the ring was full */
+		virtual std::uint64_t getDroppedSamplesCount() const noexcept = 0;
+
+		// Deleted compiler auto-generated methods
+		ControlValuesSubscription(ControlValuesSubscription&&) = delete;
+		ControlValuesSubscription(ControlValuesSubscription const&) = delete;
+		ControlValuesSubscription& operator=(ControlValuesSubscription const&) = delete;
+		ControlValuesSubscription& operator=(ControlValuesSubscription&&) = delete;
+
+	protected:
+		ControlValuesSubscription() = default;
+		virtual ~ControlValuesSubscription() = default;
+	};
+
+	/** A command of a batch (see executeBatchCommands). Use the make* factory methods to create a command. */
+	struct BatchCommand
+	{
+		enum class Type : std::uint8_t
+		{
+			SetStreamInputFormat = 0, /**< Uses targetEntityID, descriptorIndex (StreamIndex) and streamFormat */
+			SetStreamOutputFormat = 1, /**< Uses targetEntityID, descriptorIndex (StreamIndex) and streamFormat */
+			SetAudioUnitSamplingRate = 2, /**< Uses targetEntityID, descriptorIndex (AudioUnitIndex) and samplingRate */
+			SetClockSource = 3, /**< Uses targetEntityID, descriptorIndex (ClockDomainIndex) and clockSourceIndex */
+			SetControlValues = 4, /**< Uses targetEntityID, descriptorIndex (ControlIndex) and controlValues */
+			ConnectStream = 5, /**< Uses targetEntityID (listener), descriptorIndex (listener StreamIndex) and talkerStream */
+		};
+
+		Type type{ Type::SetStreamInputFormat };
+		UniqueIdentifier targetEntityID{};
+		entity::model::DescriptorIndex descriptorIndex{ 0u };
+		entity::model::StreamFormat streamFormat{};
+		entity::model::SamplingRate samplingRate{};
+		entity::model::ClockSourceIndex clockSourceIndex{ 0u };
+		entity::model::ControlValues controlValues{};
+		entity::model::StreamIdentification talkerStream{};
+
+		static BatchCommand makeSetStreamInputFormat(UniqueIdentifier const targetEntityID, entity::model::StreamIndex const streamIndex, entity::model::StreamFormat const streamFormat) noexcept
+		{
+			auto command = BatchCommand{ Type::SetStreamInputFormat, targetEntityID, streamIndex };
+			command.streamFormat = streamFormat;
+			return command;
+		}
+		static BatchCommand makeSetStreamOutputFormat(UniqueIdentifier const targetEntityID, entity::model::StreamIndex const streamIndex, entity::model::StreamFormat const streamFormat) noexcept
+		{
+			auto command = BatchCommand{ Type::SetStreamOutputFormat, targetEntityID, streamIndex };
+			command.streamFormat = streamFormat;
+			return command;
+		}
+		static BatchCommand makeSetAudioUnitSamplingRate(UniqueIdentifier const targetEntityID, entity::model::AudioUnitIndex const audioUnitIndex, entity::model::SamplingRate const samplingRate) noexcept
+		{
+			auto command = BatchCommand{ Type::SetAudioUnitSamplingRate, targetEntityID, audioUnitIndex };
+			command.samplingRate = samplingRate;
+			return command;
+		}
+		static BatchCommand makeSetClockSource(UniqueIdentifier const targetEntityID, entity::model::ClockDomainIndex const clockDomainIndex, entity::model::ClockSourceIndex const clockSourceIndex) noexcept
+		{
+			auto command = BatchCommand{ Type::SetClockSource, targetEntityID, clockDomainIndex };
+			command.clockSourceIndex = clockSourceIndex;
+			return command;
+		}
+		static BatchCommand makeSetControlValues(UniqueIdentifier const targetEntityID, entity::model::ControlIndex const controlIndex, entity::model::ControlValues const& controlValues) noexcept
+		{
+			auto command = BatchCommand{ Type::SetControlValues, targetEntityID, controlIndex };
+			command.controlValues = controlValues;
+			return command;
+		}
+		static BatchCommand makeConnectStream(entity::model::StreamIdentification const& talkerStream, entity::model::StreamIdentification const& listenerStream) noexcept
+		{
+			auto command = BatchCommand{ Type::ConnectStream, listenerStream.entityID, listenerStream.streamIndex };
+			command.talkerStream = talkerStream;
+			return command;
+		}
+	};
+	using BatchCommands = std::vector<BatchCommand>;
+
+	/** Result of a command of a batch. Commands rejected by the validation are never sent and have UnknownEntity or NoSuchDescriptor/ListenerUnknownID status. */
+	struct BatchCommandResult
+	{
+		entity::ControllerEntity::AemCommandStatus aemStatus{ entity::ControllerEntity::AemCommandStatus::Success }; /**< Status of the AECP commands */
+		entity::ControllerEntity::ControlStatus controlStatus{ entity::ControllerEntity::ControlStatus::Success }; /**< Status of the ACMP commands */
+
+		bool isSuccess() const noexcept
+		{
+			return !!aemStatus && !!controlStatus;
+		}
+	};
+	using BatchCommandResults = std::vector<BatchCommandResult>; /** Results, in the same order than the commands */
+
+	/** Priority of an entity in the enumeration queue (see enableEnumerationScheduling), lower values being enumerated first */
+	enum class EnumerationPriority : std::uint8_t
+	{
+		Visible = 0, /**< Entity currently visible to the user */
+		Talker = 1, /**< Entity implementing a talker (default priority of the entities advertising talker capabilities) */
+		Default = 2, /**< Any other entity */
+	};
+
+	/** Statistics of the enumeration of the entities */
+	struct EnumerationStatistics
+	{
+		std::uint32_t waitingEntities{ 0u }; /**< Entities waiting in the enumeration queue */
+		std::uint32_t enumeratingEntities{ 0u }; /**< Entities currently retrieving their static model (only counted while the enumerations are scheduled) */
+		std::uint32_t usableEntities{ 0u }; /**< Entities that went online since the controller was created */
+		std::optional<std::chrono::milliseconds> timeToFirstUsableEntity{ std::nullopt }; /**< Time between the discovery of the first entity and the first entity going online */
+		std::chrono::milliseconds averageTimeToUsable{ 0 }; /**< Average time between the discovery of an entity and it going online */
+		std::chrono::milliseconds maxTimeToUsable{ 0 }; /**< Maximum time between the discovery of an entity and it going online */
+	};
+
 	/* Enumeration and Control Protocol (AECP) AEM handlers. WARNING: The 'entity' parameter might be nullptr even if 'status' is AemCommandStatus::Success, in case the unit goes offline right after processing our command. */
 	using AcquireEntityHandler = std::function<void(la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::ControllerEntity::AemCommandStatus const status, la::avdecc::UniqueIdentifier const owningEntity)>;
 	using ReleaseEntityHandler = std::function<void(la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::ControllerEntity::AemCommandStatus const status, la::avdecc::UniqueIdentifier const owningEntity)>;
@@ -497,8 +629,11 @@ public:
 	using DisconnectStreamHandler = std::function<void(la::avdecc::controller::ControlledEntity const* const listenerEntity, la::avdecc::entity::model::StreamIndex const listenerStreamIndex, la::avdecc::entity::ControllerEntity::ControlStatus const status)>;
 	using DisconnectTalkerStreamHandler = std::function<void(la::avdecc::entity::ControllerEntity::ControlStatus const status)>;
 	using GetListenerStreamStateHandler = std::function<void(la::avdecc::controller::ControlledEntity const* const talkerEntity, la::avdecc::controller::ControlledEntity const* const listenerEntity, la::avdecc::entity::model::StreamIndex const talkerStreamIndex, la::avdecc::entity::model::StreamIndex const listenerStreamIndex, std::uint16_t const connectionCount, la::avdecc::entity::ConnectionFlags const flags, la::avdecc::entity::ControllerEntity::ControlStatus const status)>;
+	/* Batch handlers */
+	using BatchCommandsHandler = std::function<void(la::avdecc::controller::Controller::BatchCommandResults const& results, std::size_t const failedCount)>;
 	/* Other handlers */
 	using RequestExclusiveAccessResultHandler = std::function<void(la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::ControllerEntity::AemCommandStatus const status, la::avdecc::controller::Controller::ExclusiveAccessToken::UniquePointer&& token)>;
+	using LoadConfigurationStaticModelHandler = std::function<void(la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::ControllerEntity::AemCommandStatus const status)>;
 
 	/**
 	* @brief Factory method to create a new Controller.
@@ -543,7 +678,11 @@ public:
 	virtual bool forgetRemoteEntity(UniqueIdentifier const entityID) const noexcept = 0;
 	/** Sets automatic discovery delay. 0 (default) for no automatic discovery. */
 	virtual void setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) noexcept = 0;
-	/** Enables the EntityModel cache */
+	/**
+	* @brief Enables the EntityModel cache.
+	* @details The static model of an entity is then loaded from the cache if an entity with the same EntityModelID was already enumerated.
+	* @warning The EntityModelID is trusted to identify the static model: an entity whose model changed without changing its EntityModelID (a firmware update for example) will keep the previous static model until the cache is disabled.
+	*/
 	virtual void enableEntityModelCache() noexcept = 0;
 	/** Disables the EntityModel cache */
 	virtual void disableEntityModelCache() noexcept = 0;
@@ -551,10 +690,49 @@ public:
 	virtual void enableFullStaticEntityModelEnumeration() noexcept = 0;
 	/** Disables complete EntityModel (static part) enumeration.*/
 	virtual void disableFullStaticEntityModelEnumeration() noexcept = 0;
+	/**
+	* @brief Retrieves the static model of a configuration that was not enumerated (only the current configuration is, unless enableFullStaticEntityModelEnumeration is used).
+	* @details Requests for a configuration already being retrieved are coalesced. The handler is called right away if the model is already complete, which makes this method usable as an accessor to call before drilling into a configuration, or as a prefetch hint (with an empty handler) for the configurations likely to be needed.
+	* @param[in] targetEntityID The entity (must be online).
+	* @param[in] configurationIndex The configuration to retrieve.
+	* @param[in] handler Called once all the descriptors of the configuration have been retrieved (status is the first fatal error if any), or if the entity goes offline in the meantime (with a nullptr entity).
+	*/
+	virtual void loadConfigurationStaticModel(UniqueIdentifier const targetEntityID, entity::model::ConfigurationIndex const configurationIndex, LoadConfigurationStaticModelHandler const& handler) noexcept = 0;
 	/** Enables fast enumeration using packed dynamic info queries (requires enableEntityModelCache) */
 	virtual void enableFastEnumeration() noexcept = 0;
 	/** Disables fast enumeration */
 	virtual void disableFastEnumeration() noexcept = 0;
+	/** Enables the history of AVB_INTERFACE, STREAM_INPUT and STREAM_OUTPUT counters, keeping up to samplesPerDescriptor (at least 2) timestamped samples for each descriptor (only the counters that changed are stored with each sample, older samples are dropped earlier if many counters change). The memory used by all entities is capped to maxMemorySize bytes, descriptors over that limit have no history. */
+	virtual void enableCountersHistory(std::uint16_t const samplesPerDescriptor, std::size_t const maxMemorySize) noexcept = 0;
+	/** Disables the counters history, releasing all samples */
+	virtual void disableCountersHistory() noexcept = 0;
+	/** Enables the periodic refresh of the counters of all entities (using GET_DYNAMIC_INFO when supported). Each entity is polled at most every period (slower if it responds slowly or fails to respond, or if it recently sent unsolicited counters notifications), with at most maxInflightCommands polling commands inflight at any time for all entities. */
+	virtual void enableCountersPolling(std::chrono::milliseconds const period, std::uint16_t const maxInflightCommands) noexcept = 0;
+	/** Disables the periodic refresh of the counters */
+	virtual void disableCountersPolling() noexcept = 0;
+	/** Enables the scheduling of the enumerations. At most maxConcurrentEntities entities retrieve their static model at the same time, the others waiting in a queue ordered by priority (see setEnumerationPriority) then discovery order. */
+	virtual void enableEnumerationScheduling(std::uint16_t const maxConcurrentEntities) noexcept = 0;
+	/** Disables the scheduling of the enumerations (default), all entities being enumerated as soon as they are discovered */
+	virtual void disableEnumerationScheduling() noexcept = 0;
+	/** Sets the enumeration priority of an entity, which might not be discovered yet. Pass std::nullopt to restore the default priority (based on the entity capabilities). */
+	virtual void setEnumerationPriority(UniqueIdentifier const entityID, std::optional<EnumerationPriority> const priority) noexcept = 0;
+	/** Returns the statistics of the enumeration of the entities */
+	virtual EnumerationStatistics getEnumerationStatistics() const noexcept = 0;
+
+	/* Control values streaming */
+	/**
+	* @brief Subscribes to the dynamic values of a LINEAR or ARRAY control of the current configuration.
+	* @details While a control has at least one subscription, its unsolicited updates are only delivered to the subscriptions: the ControlledEntity model is not updated and Observer::onControlValuesChanged is not called.
+	*          Subscriptions stop receiving samples when the entity goes offline or changes its current configuration, subscribe again once the entity is back online.
+	* @param[in] entityID The entity owning the control.
+	* @param[in] controlIndex The control to subscribe to.
+	* @param[in] decimation Only one update out of decimation is pushed (1 to push all updates).
+	* @param[in] ringCapacity The maximum number of samples waiting to be popped (rounded up to a power of 2).
+	* @return The subscription, or nullptr if the entity or the control is unknown, or if the control values are not numeric LINEAR or ARRAY values.
+	*/
+	virtual ControlValuesSubscription::SharedPointer subscribeToControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex, std::uint16_t const decimation = 1u, std::uint16_t const ringCapacity = 64u) noexcept = 0;
+	/** Removes the subscription, no more samples will be pushed to it */
+	virtual void unsubscribeFromControlValues(ControlValuesSubscription::SharedPointer const& subscription) noexcept = 0;
 
 	/* Enumeration and Control Protocol (AECP) AEM. WARNING: The completion handler will not be called if the controller is destroyed while the query is inflight. Otherwise it will always be called. */
 	virtual void acquireEntity(UniqueIdentifier const targetEntityID, bool const isPersistent, AcquireEntityHandler const& handler) const noexcept = 0;
@@ -618,8 +796,25 @@ public:
 	virtual void disconnectTalkerStream(entity::model::StreamIdentification const& talkerStream, entity::model::StreamIdentification const& listenerStream, DisconnectTalkerStreamHandler const& handler) const noexcept = 0;
 	virtual void getListenerStreamState(entity::model::StreamIdentification const& listenerStream, GetListenerStreamStateHandler const& handler) const noexcept = 0;
 
+	/* Batched commands */
+	/**
+	* @brief Sends multiple commands, possibly to multiple entities, reporting a single completion.
+	* @details All commands are validated in a single locked pass (commands targeting an unknown entity or descriptor are rejected without being sent), then the valid ones are all enqueued at once.
+	*          Commands are paced per target entity the same way than individual commands. The model is updated (and the observers notified) the same way than individual commands.
+	* @param[in] commands The commands to send.
+	* @param[in] handler Called once all the commands completed (or were rejected), with the result of each command and the number of failed commands. Might be called before the method returns.
+	*/
+	virtual void executeBatchCommands(BatchCommands const& commands, BatchCommandsHandler const& handler) const noexcept = 0;
+
 	/** Gets a lock guarded ControlledEntity. While the returned object is in the scope, you are guaranteed to have exclusive access on the ControlledEntity. The returned guard should not be kept or held for more than a few milliseconds. */
 	virtual ControlledEntityGuard getControlledEntityGuard(UniqueIdentifier const entityID) const noexcept = 0;
+	/**
+	* @brief Gets the latest immutable snapshot of a ControlledEntity (nullptr if the entity is offline).
+	* @details Snapshots are published by the networking thread once the entity has been modified, so the returned snapshot might not yet include the most recent changes.
+	*          Getting a snapshot never takes the lock of the entities, and a snapshot is never modified: it can be kept and read from any thread, without any lock.
+	*          Successive snapshots of an entity share the same model until it is modified. Counters history is not part of the snapshot.
+	*/
+	virtual SharedConstControlledEntity getControlledEntitySnapshot(UniqueIdentifier const entityID) const noexcept = 0;
 
 	/** Requests an ExclusiveAccessToken for the specified entityID. If the call succeeded (AemCommandStatus::Success), a valid token will be returned. The handler will always be called, either before the call returns or asynchronously. */
 	virtual void requestExclusiveAccess(UniqueIdentifier const entityID, ExclusiveAccessToken::AccessType const type, RequestExclusiveAccessResultHandler&& handler) const noexcept = 0;
@@ -630,7 +825,7 @@ public:
 	virtual void unlock() noexcept = 0;
 
 	/* Model serialization methods */
-	/** Serializes all discovered ControlledEntities as JSON and save to specified file. If 'continueOnError' is specified and some error(s) occured, SerializationError::Incomplete will be returned. */
+	/** Serializes all discovered ControlledEntities as JSON and save to specified file, streaming one entity at a time (each entity is only locked while taking its snapshot). If 'continueOnError' is specified and some error(s) occured, SerializationError::Incomplete will be returned. */
 	virtual std::tuple<avdecc::jsonSerializer::SerializationError, std::string> serializeAllControlledEntitiesAsJson(std::string const& filePath, entity::model::jsonSerializer::Flags const flags, std::string const& dumpSource, bool const continueOnError) const noexcept = 0;
 	/** Serializes specified ControlledEntity as JSON and save to specified file. */
 	virtual std::tuple<avdecc::jsonSerializer::SerializationError, std::string> serializeControlledEntityAsJson(UniqueIdentifier const entityID, std::string const& filePath, entity::model::jsonSerializer::Flags const flags, std::string const& dumpSource) const noexcept = 0;
@@ -650,7 +845,7 @@ public:
 	virtual std::tuple<avdecc::jsonSerializer::DeserializationError, std::string> createVirtualEntityFromEntityModelFile(std::string const& filePath, model::VirtualEntityBuilder* const builder, bool const isBinaryFormat = true) noexcept = 0;
 
 	/* Other helpful methods */
-	/** Re-enumerates the specified entity */
+	/** Re-enumerates the specified entity. The static model is not retrieved again if the entity still advertises the same EntityModelID and its current CONFIGURATION descriptor did not change (only the dynamic information is). */
 	virtual bool refreshEntity(UniqueIdentifier const entityID) noexcept = 0;
 	/** Removes a Virtual Entity from the controller */
 	virtual bool unloadVirtualEntity(UniqueIdentifier const entityID) noexcept = 0;
@@ -185,6 +185,8 @@ DEFINE_ENUM_CLASS(la::avdecc::controller::ControlledEntity, CompatibilityFlag, "
 #endif
 };
 
+%template(DiagnosticsIndexSet) la::avdecc::utils::FlatSet<la::avdecc::entity::model::DescriptorIndex, 4>;
+
 %nspace la::avdecc::controller::ControlledEntityGuard;
 %rename("%s") la::avdecc::controller::ControlledEntityGuard; // Unignore class
 %ignore la::avdecc::controller::ControlledEntityGuard::operator bool; // Ignore operator bool, isValid() is already defined
@@ -340,6 +342,12 @@ DEFINE_OBSERVER_CLASS(la::avdecc::controller::Controller::DefaultedObserver)
 #else
 %ignore la::avdecc::controller::Controller::requestExclusiveAccess; // Ignore until https://github.com/swig/swig/issues/2411 is fixed
 #endif
+%ignore la::avdecc::controller::Controller::subscribeToControlValues; // Ignore for now, lock-free ring buffers are meant to be consumed from native code
+%ignore la::avdecc::controller::Controller::unsubscribeFromControlValues; // Ignore for now, lock-free ring buffers are meant to be consumed from native code
+%ignore la::avdecc::controller::Controller::executeBatchCommands; // Ignore for now, need to be able to correctly handle the BatchCommand struct
+%ignore la::avdecc::controller::Controller::getControlledEntitySnapshot; // Ignore for now, SharedConstControlledEntity is not exposed
+%ignore la::avdecc::controller::Controller::setEnumerationPriority; // Ignore for now, need to be able to correctly handle the optional EnumerationPriority
+%ignore la::avdecc::controller::Controller::getEnumerationStatistics; // Ignore for now, need to be able to correctly handle the EnumerationStatistics struct
 
 // %rename("%s") la::avdecc::controller::Controller::Error; // Must unignore the enum since it's inside a class
 // %rename("%s") la::avdecc::controller::Controller::QueryCommandError; // Must unignore the enum since it's inside a class
@@ -111,8 +111,17 @@ public:
 	struct Diagnostics
 	{
 		bool redundancyWarning{ false }; /** Flag indicating a Milan redundant device has both interfaces connected to the same network */
-		std::set<entity::model::ControlIndex> controlCurrentValueOutOfBounds{}; /** List of Controls whose current value is outside the specified min-max range */
-		std::set<entity::model::StreamIndex> streamInputOverLatency{}; /** List of StreamInput whose MSRP Latency is greater than Talker's Presentation Time */
+		utils::FlatSet<entity::model::ControlIndex, 4> controlCurrentValueOutOfBounds{}; /** List of Controls whose current value is outside the specified min-max range */
+		utils::FlatSet<entity::model::StreamIndex, 4> streamInputOverLatency{}; /** List of StreamInput whose MSRP Latency is greater than Talker's Presentation Time */
+	};
+
+	/* Statistics of a descriptor counter computed from its history, over a sliding window (see la::avdecc::controller::Controller::enableCountersHistory) */
+	struct CounterHistoryStatistics
+	{
+		entity::model::DescriptorCounter delta{ 0u }; /** Counter increase over the window */
+		std::chrono::milliseconds duration{}; /** Duration actually covered by the samples of the window */
+		double ratePerSecond{ 0.0 }; /** Counter increase per second over the window (0 if duration is null) */
+		std::size_t samplesCount{ 0u }; /** Number of samples in the window */
 	};
 
 	// Getters
@@ -198,6 +207,11 @@ public:
 	virtual std::uint64_t getAemAecpUnsolicitedLossCounter() const noexcept = 0;
 	virtual std::chrono::milliseconds const& getEnumerationTime() const noexcept = 0;
 
+	// Counters history (only available if enabled on the Controller). The window ends at the most recent sample. Returns std::nullopt if there are less than 2 samples of the counter in the window
+	virtual std::optional<CounterHistoryStatistics> getAvbInterfaceCounterHistoryStatistics(entity::model::AvbInterfaceIndex const avbInterfaceIndex, entity::AvbInterfaceCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept = 0;
+	virtual std::optional<CounterHistoryStatistics> getStreamInputCounterHistoryStatistics(entity::model::StreamIndex const streamIndex, entity::StreamInputCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept = 0;
+	virtual std::optional<CounterHistoryStatistics> getStreamOutputCounterHistoryStatistics(entity::model::StreamIndex const streamIndex, entity::StreamOutputCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept = 0;
+
 	// Diagnostics
 	virtual la::avdecc::controller::ControlledEntity::Diagnostics const& getDiagnostics() const noexcept = 0;
 
@@ -224,6 +238,7 @@ protected:
 };
 
 using SharedControlledEntity = std::shared_ptr<ControlledEntity>;
+using SharedConstControlledEntity = std::shared_ptr<ControlledEntity const>;
 
 /* ************************************************************************** */
 /* ControlledEntityGuard                                                      */
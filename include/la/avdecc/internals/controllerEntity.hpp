@@ -34,6 +34,7 @@
 #include "entityAddressAccessTypes.hpp"
 #include "exports.hpp"
 
+#include <any>
 #include <thread>
 #include <unordered_map>
 #include <string>
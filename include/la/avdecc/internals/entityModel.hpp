@@ -50,6 +50,11 @@ namespace entity
 {
 namespace model
 {
+/* Lists of a descriptor, sorted, with inline storage big enough for what most devices advertise */
+using SamplingRates = utils::FlatSet<SamplingRate, 8>;
+using StreamFormats = utils::FlatSet<StreamFormat, 8>;
+using RedundantStreams = utils::FlatSet<StreamIndex, 2>;
+
 /** ENTITY Descriptor - IEEE1722.1-2013 Clause 7.2.1 */
 struct EntityDescriptor
 {
@@ -120,7 +125,7 @@ struct AudioUnitDescriptor
 	std::uint16_t numberOfControlBlocks{ 0u };
 	ControlBlockIndex baseControlBlock{ ControlBlockIndex(0u) };
 	SamplingRate currentSamplingRate{};
-	std::set<SamplingRate> samplingRates{};
+	SamplingRates samplingRates{};
 };
 
 /** VIDEO_UNIT Descriptor - IEEE1722.1-2013 Clause 7.2.4 */
@@ -145,9 +150,9 @@ struct StreamDescriptor
 	std::uint16_t backedupTalkerUnique{ 0u };
 	AvbInterfaceIndex avbInterfaceIndex{ AvbInterfaceIndex(0u) };
 	std::uint32_t bufferLength{ 0u };
-	std::set<StreamFormat> formats{};
+	StreamFormats formats{};
 #ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
-	std::set<StreamIndex> redundantStreams{};
+	RedundantStreams redundantStreams{};
 #endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
 };
 
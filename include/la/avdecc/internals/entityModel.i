@@ -406,6 +406,6 @@ DEFINE_AEM_STRUCT(MilanInfo);
 %template(StringArray) std::array<la::avdecc::entity::model::AvdeccFixedString, 7>;
 SWIG_STD_VECTOR_ENHANCED(la::avdecc::entity::model::DescriptorIndex); // Swig is struggling with DescriptorIndex alias (it's a std::uint16_t)
 %template(DescriptorVector) std::vector<la::avdecc::entity::model::DescriptorIndex>;
-%template(SamplingRateSet) std::set<la::avdecc::entity::model::SamplingRate>;
-%template(StreamFormatSet) std::set<la::avdecc::entity::model::StreamFormat>;
-%template(RedundantStreamIndexSet) std::set<la::avdecc::entity::model::StreamIndex>;
\ No newline at end of file
+%template(SamplingRateSet) la::avdecc::utils::FlatSet<la::avdecc::entity::model::SamplingRate, 8>;
+%template(StreamFormatSet) la::avdecc::utils::FlatSet<la::avdecc::entity::model::StreamFormat, 8>;
+%template(RedundantStreamIndexSet) la::avdecc::utils::FlatSet<la::avdecc::entity::model::StreamIndex, 2>;
\ No newline at end of file
@@ -21,7 +21,6 @@
 * @file entityModelControlValues.hpp
 * @author Christophe Calmejane
 * @brief Avdecc entity model control descriptor values.
-* @warning All structures have to be exported on unix-like systems (using LA_AVDECC_TYPE_INFO_EXPORT) so type_info is correctly visible outside the shared library (required for std::any_cast to work)
 */
 
 #pragma once
@@ -91,7 +90,7 @@ class LA_AVDECC_TYPE_INFO_EXPORT LinearValues final
 public:
 	using control_value_details_traits = ControlValues::control_value_details_traits<LinearValues<ValueType>>;
 	using value_type = ValueType;
-	using Values = std::vector<ValueType>;
+	using Values = utils::SmallVector<ValueType, 1>; // Most linear controls only have a single value, store it inline
 	static_assert(control_value_details_traits::is_value_details, "LinearValues, ControlValues::control_value_details_traits::is_value_details trait not defined for requested ValueType. Did you include entityModelControlValuesTraits.hpp?");
 
 	constexpr LinearValues() noexcept {}
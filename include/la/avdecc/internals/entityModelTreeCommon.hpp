@@ -117,11 +117,6 @@ constexpr bool operator!=(AvbInterfaceInfo const& lhs, AvbInterfaceInfo const& r
 }
 
 using StreamConnections = std::set<StreamIdentification>;
-using StreamFormats = std::set<StreamFormat>;
-#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
-using RedundantStreams = std::set<StreamIndex>;
-#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
-using SamplingRates = std::set<SamplingRate>;
 using AvdeccFixedStrings = std::array<AvdeccFixedString, 7>;
 using ClockSources = std::vector<ClockSourceIndex>;
 using PtpInstances = std::vector<PtpInstanceIndex>;
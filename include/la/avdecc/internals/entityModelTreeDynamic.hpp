@@ -32,6 +32,10 @@
 #include <cstdint>
 #include <map>
 #include <optional>
+#include <array>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
 
 namespace la
 {
@@ -41,11 +45,352 @@ namespace entity
 {
 namespace model
 {
-using EntityCounters = std::map<entity::EntityCounterValidFlag, DescriptorCounter>;
-using AvbInterfaceCounters = std::map<entity::AvbInterfaceCounterValidFlag, DescriptorCounter>;
-using ClockDomainCounters = std::map<entity::ClockDomainCounterValidFlag, DescriptorCounter>;
-using StreamInputCounters = std::map<entity::StreamInputCounterValidFlag, DescriptorCounter>;
-using StreamOutputCounters = std::map<entity::StreamOutputCounterValidFlag, DescriptorCounter>;
+/**
+* @brief Fixed-size storage for the counters of a descriptor.
+* @details Counters are stored in a fixed 32 slots array indexed by the bit position of their CounterValidFlag, along with a bitmask of the valid counters.
+*          No allocation is ever made. Each call to #update also keeps track of the counters that changed and of their delta since the previous update.
+*          Provides a std::map like interface (iterating over valid counters only, in ascending flag order).
+*/
+template<typename CounterValidFlagType>
+class DescriptorCountersStorage final
+{
+public:
+	using key_type = CounterValidFlagType;
+	using mapped_type = DescriptorCounter;
+	using value_type = std::pair<key_type, mapped_type>;
+	using size_type = size_t;
+	using ValidFlags = utils::EnumBitfield<key_type>;
+	static constexpr size_t MaxCounters = std::tuple_size_v<DescriptorCounters>;
+
+	template<typename ContainerType, typename ValueType>
+	class base_iterator final
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = DescriptorCountersStorage::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = ValueType*;
+		using reference = ValueType&;
+
+		base_iterator(ContainerType* const container, size_t const position) noexcept
+			: _container{ container }
+			, _position{ position }
+		{
+			skipInvalid();
+		}
+
+		// Allow conversion from iterator to const_iterator
+		template<typename OtherContainerType, typename OtherValueType, typename = std::enable_if_t<std::is_const_v<ValueType> && !std::is_const_v<OtherValueType>>>
+		base_iterator(base_iterator<OtherContainerType, OtherValueType> const& other) noexcept
+			: _container{ other._container }
+			, _position{ other._position }
+		{
+		}
+
+		reference operator*() const noexcept
+		{
+			return _container->_counters[_position];
+		}
+
+		pointer operator->() const noexcept
+		{
+			return &_container->_counters[_position];
+		}
+
+		base_iterator& operator++() noexcept
+		{
+			++_position;
+			skipInvalid();
+			return *this;
+		}
+
+		base_iterator operator++(int) noexcept
+		{
+			auto tmp = *this;
+			operator++();
+			return tmp;
+		}
+
+		bool operator==(base_iterator const& other) const noexcept
+		{
+			return _position == other._position;
+		}
+
+		bool operator!=(base_iterator const& other) const noexcept
+		{
+			return !operator==(other);
+		}
+
+	private:
+		template<typename, typename>
+		friend class base_iterator;
+
+		void skipInvalid() noexcept
+		{
+			while (_position < MaxCounters && !_container->isValidPosition(_position))
+			{
+				++_position;
+			}
+		}
+
+		ContainerType* _container{ nullptr };
+		size_t _position{ MaxCounters };
+	};
+	using iterator = base_iterator<DescriptorCountersStorage, value_type>;
+	using const_iterator = base_iterator<DescriptorCountersStorage const, value_type const>;
+
+	/** Constructor */
+	DescriptorCountersStorage() noexcept
+	{
+		for (auto position = size_t{ 0u }; position < MaxCounters; ++position)
+		{
+			_counters[position].first = static_cast<key_type>(static_cast<DescriptorCounterValidFlag>(1u) << position);
+		}
+	}
+
+	/** Updates the counters flagged in validCounters with the values from the raw GET_COUNTERS array, computing the changed counters and their delta since the previous update */
+	void update(ValidFlags const validCounters, DescriptorCounters const& counters) noexcept
+	{
+		auto const newValid = validCounters.value();
+		auto changed = DescriptorCounterValidFlag{ 0u };
+
+		for (auto position = size_t{ 0u }; position < MaxCounters; ++position)
+		{
+			auto const mask = static_cast<DescriptorCounterValidFlag>(1u) << position;
+			if ((newValid & mask) == 0u)
+			{
+				_deltas[position] = 0u;
+				continue;
+			}
+			auto const value = counters[position];
+			auto& previous = _counters[position].second;
+			// Previously unknown counter, or new value
+			if ((_valid & mask) == 0u || previous != value)
+			{
+				changed |= mask;
+				_deltas[position] = (_valid & mask) == 0u ? 0u : static_cast<DescriptorCounter>(value - previous); // Unsigned arithmetic handles counter wrap around
+				previous = value;
+			}
+			else
+			{
+				_deltas[position] = 0u;
+			}
+		}
+
+		_valid |= newValid;
+		_changed = changed;
+	}
+
+	/** Returns true if the flag can be stored (ie. it is exactly one bit) */
+	static bool isValidKey(key_type const flag) noexcept
+	{
+		return positionOf(flag) < MaxCounters;
+	}
+
+	/** Returns the counters that are valid (ie. have been set at least once) */
+	ValidFlags getValidCounters() const noexcept
+	{
+		auto flags = ValidFlags{};
+		flags.assign(_valid);
+		return flags;
+	}
+
+	/** Returns the counters that changed during the last call to #update (newly valid counters are considered changed) */
+	ValidFlags getChangedCounters() const noexcept
+	{
+		auto flags = ValidFlags{};
+		flags.assign(_changed);
+		return flags;
+	}
+
+	/** Returns the delta of the specified counter since the previous call to #update (0 if the counter did not change, or was not previously valid) */
+	DescriptorCounter getDelta(key_type const flag) const noexcept
+	{
+		auto const position = positionOf(flag);
+		return position < MaxCounters ? _deltas[position] : DescriptorCounter{ 0u };
+	}
+
+	/* std::map like interface */
+	iterator begin() noexcept
+	{
+		return iterator{ this, 0u };
+	}
+	const_iterator begin() const noexcept
+	{
+		return const_iterator{ this, 0u };
+	}
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+	iterator end() noexcept
+	{
+		return iterator{ this, MaxCounters };
+	}
+	const_iterator end() const noexcept
+	{
+		return const_iterator{ this, MaxCounters };
+	}
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	bool empty() const noexcept
+	{
+		return _valid == 0u;
+	}
+
+	size_type size() const noexcept
+	{
+		return getValidCounters().count();
+	}
+
+	size_type count(key_type const flag) const noexcept
+	{
+		auto const position = positionOf(flag);
+		return position < MaxCounters && isValidPosition(position) ? 1u : 0u;
+	}
+
+	iterator find(key_type const flag) noexcept
+	{
+		auto const position = positionOf(flag);
+		return position < MaxCounters && isValidPosition(position) ? iterator{ this, position } : end();
+	}
+
+	const_iterator find(key_type const flag) const noexcept
+	{
+		auto const position = positionOf(flag);
+		return position < MaxCounters && isValidPosition(position) ? const_iterator{ this, position } : end();
+	}
+
+	/** Returns the value of the specified counter. Throws std::out_of_range if the counter is not valid. */
+	mapped_type const& at(key_type const flag) const
+	{
+		auto const position = positionOf(flag);
+		if (position >= MaxCounters || !isValidPosition(position))
+		{
+			throw std::out_of_range("DescriptorCountersStorage::at() invalid counter");
+		}
+		return _counters[position].second;
+	}
+
+	/** Returns a reference to the specified counter, setting it valid (with a value of 0) if it was not. Throws std::out_of_range if the flag is not a single bit. */
+	mapped_type& operator[](key_type const flag)
+	{
+		auto const position = positionOf(flag);
+		if (position >= MaxCounters)
+		{
+			throw std::out_of_range("DescriptorCountersStorage::operator[] invalid counter");
+		}
+		if (!isValidPosition(position))
+		{
+			_valid |= static_cast<DescriptorCounterValidFlag>(1u) << position;
+			_counters[position].second = 0u;
+		}
+		return _counters[position].second;
+	}
+
+	/** Inserts the counter if not already valid. Throws std::out_of_range if the flag is not a single bit. */
+	std::pair<iterator, bool> insert(value_type const& value)
+	{
+		auto const position = positionOf(value.first);
+		if (position >= MaxCounters)
+		{
+			throw std::out_of_range("DescriptorCountersStorage::insert() invalid counter");
+		}
+		if (isValidPosition(position))
+		{
+			return { iterator{ this, position }, false };
+		}
+		_valid |= static_cast<DescriptorCounterValidFlag>(1u) << position;
+		_counters[position].second = value.second;
+		return { iterator{ this, position }, true };
+	}
+
+	template<typename... Args>
+	std::pair<iterator, bool> emplace(Args&&... args)
+	{
+		return insert(value_type{ std::forward<Args>(args)... });
+	}
+
+	size_type erase(key_type const flag) noexcept
+	{
+		auto const count = this->count(flag);
+		if (count != 0u)
+		{
+			_valid &= ~(static_cast<DescriptorCounterValidFlag>(1u) << positionOf(flag));
+		}
+		return count;
+	}
+
+	void clear() noexcept
+	{
+		_valid = 0u;
+		_changed = 0u;
+	}
+
+	/** Equality only compares the valid counters and their values (changes tracking is ignored) */
+	bool operator==(DescriptorCountersStorage const& other) const noexcept
+	{
+		if (_valid != other._valid)
+		{
+			return false;
+		}
+		for (auto position = size_t{ 0u }; position < MaxCounters; ++position)
+		{
+			if (isValidPosition(position) && _counters[position].second != other._counters[position].second)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool operator!=(DescriptorCountersStorage const& other) const noexcept
+	{
+		return !operator==(other);
+	}
+
+	// Defaulted compiler auto-generated methods
+	DescriptorCountersStorage(DescriptorCountersStorage&&) noexcept = default;
+	DescriptorCountersStorage(DescriptorCountersStorage const&) noexcept = default;
+	DescriptorCountersStorage& operator=(DescriptorCountersStorage const&) noexcept = default;
+	DescriptorCountersStorage& operator=(DescriptorCountersStorage&&) noexcept = default;
+
+private:
+	/** Returns the bit position of the flag, or MaxCounters if the flag is not exactly one bit */
+	static size_t positionOf(key_type const flag) noexcept
+	{
+		auto const value = static_cast<DescriptorCounterValidFlag>(flag);
+		if (value == 0u || (value & (value - 1u)) != 0u)
+		{
+			return MaxCounters;
+		}
+		auto position = size_t{ 0u };
+		while ((value >> position) != 1u)
+		{
+			++position;
+		}
+		return position;
+	}
+
+	bool isValidPosition(size_t const position) const noexcept
+	{
+		return (_valid & (static_cast<DescriptorCounterValidFlag>(1u) << position)) != 0u;
+	}
+
+	std::array<value_type, MaxCounters> _counters{};
+	std::array<DescriptorCounter, MaxCounters> _deltas{};
+	DescriptorCounterValidFlag _valid{ 0u };
+	DescriptorCounterValidFlag _changed{ 0u };
+};
+
+using EntityCounters = DescriptorCountersStorage<entity::EntityCounterValidFlag>;
+using AvbInterfaceCounters = DescriptorCountersStorage<entity::AvbInterfaceCounterValidFlag>;
+using ClockDomainCounters = DescriptorCountersStorage<entity::ClockDomainCounterValidFlag>;
+using StreamInputCounters = DescriptorCountersStorage<entity::StreamInputCounterValidFlag>;
+using StreamOutputCounters = DescriptorCountersStorage<entity::StreamOutputCounterValidFlag>;
 
 struct AudioUnitNodeDynamicModel
 {
@@ -30,8 +30,9 @@
 #include "uniqueIdentifier.hpp"
 #include "exports.hpp"
 
-#include <any>
+#include <cstddef>
 #include <cstdint>
+#include <new>
 #include <string>
 #include <array>
 #include <vector>
@@ -1371,7 +1372,11 @@ private:
 
 LA_AVDECC_API std::string LA_AVDECC_CALL_CONVENTION controlValueTypeToString(ControlValueType::Type const controlValueType) noexcept;
 
-/** Control Values - IEEE1722.1-2013 Clause 7.3.5 */
+/**
+* @brief Control Values - IEEE1722.1-2013 Clause 7.3.5
+* @details Type-erased storage of the values of a control, tagged by ControlValueType::Type and static/dynamic state (which uniquely identify the stored ValueDetailsType).
+*          Values fitting in InlineStorageSize bytes (which includes single valued linear dynamic values) are stored inline, without any heap allocation.
+*/
 class ControlValues final
 {
 public:
@@ -1385,32 +1390,36 @@ public:
 		static constexpr ControlValueType::Type control_value_type = ControlValueType::Type::Expansion; // Not the best default value but none is provided by the standard
 	};
 
+	/** Size of the inline storage, values of bigger types are heap allocated */
+	static constexpr size_t InlineStorageSize = 48u;
+
 	constexpr ControlValues() noexcept {}
 
 	template<class ValueDetailsType, typename Traits = control_value_details_traits<std::decay_t<ValueDetailsType>>, typename = std::enable_if_t<!std::is_same_v<std::decay_t<ValueDetailsType>, ControlValues>>>
-	explicit ControlValues(ValueDetailsType const& values) noexcept
+	explicit ControlValues(ValueDetailsType&& values) noexcept
 		: _isValid{ true }
 		, _type{ Traits::control_value_type }
 		, _areDynamic{ Traits::is_dynamic }
 		, _countMustBeIdentical{ Traits::static_dynamic_counts_identical ? *Traits::static_dynamic_counts_identical : false } // Check for optional presence delayed to body so we have a nicer message than with an enable_if template parameter
-		, _countValues{ values.countValues() }
-		, _values{ values }
+		, _countValues{ values.countValues() } // Careful with order here, we might be moving 'values'
 	{
 		static_assert(Traits::is_value_details, "ControlValues::ControlValues, control_value_details_traits::is_value_details trait not defined for requested ValueDetailsType. Did you include entityModelControlValuesTraits.hpp?");
 		static_assert(Traits::static_dynamic_counts_identical.has_value(), "ControlValues::ControlValues, control_value_details_traits::static_dynamic_counts_identical trait not defined for requested ValueDetailsType.");
+		using Type = std::decay_t<ValueDetailsType>;
+		if constexpr (isStoredInline<Type>())
+		{
+			new (_storage.buffer) Type(std::forward<ValueDetailsType>(values));
+		}
+		else
+		{
+			*reinterpret_cast<Type**>(_storage.buffer) = new Type(std::forward<ValueDetailsType>(values));
+		}
+		_operations = getOperations<Type>();
 	}
 
-	template<class ValueDetailsType, typename Traits = control_value_details_traits<std::decay_t<ValueDetailsType>>, typename = std::enable_if_t<!std::is_same_v<std::decay_t<ValueDetailsType>, ControlValues>>>
-	explicit ControlValues(ValueDetailsType&& values) noexcept
-		: _isValid{ true }
-		, _type{ Traits::control_value_type }
-		, _areDynamic{ Traits::is_dynamic }
-		, _countMustBeIdentical{ Traits::static_dynamic_counts_identical ? *Traits::static_dynamic_counts_identical : false } // Check for optional presence delayed to body so we have a nicer message than with an enable_if template parameter
-		, _countValues{ values.countValues() } // Careful with order here, we are moving 'values'
-		, _values{ std::forward<ValueDetailsType>(values) }
+	~ControlValues() noexcept
 	{
-		static_assert(Traits::is_value_details, "ControlValues::ControlValues, control_value_details_traits::is_value_details trait not defined for requested ValueDetailsType. Did you include entityModelControlValuesTraits.hpp?");
-		static_assert(Traits::static_dynamic_counts_identical.has_value(), "ControlValues::ControlValues, control_value_details_traits::static_dynamic_counts_identical trait not defined for requested ValueDetailsType.");
+		reset();
 	}
 
 	constexpr ControlValueType::Type getType() const noexcept
@@ -1453,8 +1462,9 @@ public:
 		return isValid();
 	}
 
+	/** Returns a reference to the stored values (no copy is made). Throws std::invalid_argument if the ValueDetailsType does not match the stored values. */
 	template<class ValueDetailsType, typename Traits = control_value_details_traits<std::decay_t<ValueDetailsType>>>
-	std::decay_t<ValueDetailsType> getValues() const
+	std::decay_t<ValueDetailsType> const& getValues() const&
 	{
 		static_assert(Traits::is_value_details, "ControlValues::getValues, control_value_details_traits::is_value_details trait not defined for requested ValueDetailsType. Did you include entityModelControlValuesTraits.hpp?");
 		if (!isValid())
@@ -1469,7 +1479,15 @@ public:
 		{
 			throw std::invalid_argument("ControlValues::getValues, static/dynamic mismatch");
 		}
-		return std::any_cast<std::decay_t<ValueDetailsType>>(_values);
+		return get<std::decay_t<ValueDetailsType>>();
+	}
+
+	/** Returns the stored values, moved out of a temporary ControlValues. Throws std::invalid_argument if the ValueDetailsType does not match the stored values. */
+	template<class ValueDetailsType, typename Traits = control_value_details_traits<std::decay_t<ValueDetailsType>>>
+	std::decay_t<ValueDetailsType> getValues() &&
+	{
+		auto const& values = static_cast<ControlValues const&>(*this).getValues<ValueDetailsType>();
+		return std::move(const_cast<std::decay_t<ValueDetailsType>&>(values));
 	}
 
 	// Comparison operators
@@ -1496,19 +1514,159 @@ public:
 		return getValues<ValueDetailsType>() == other.getValues<ValueDetailsType>();
 	}
 
-	// Defaulted compiler auto-generated methods
-	ControlValues(ControlValues const&) = default;
-	ControlValues(ControlValues&&) = default;
-	ControlValues& operator=(ControlValues const&) = default;
-	ControlValues& operator=(ControlValues&&) = default;
+	ControlValues(ControlValues const& other)
+		: _isValid{ other._isValid }
+		, _type{ other._type }
+		, _areDynamic{ other._areDynamic }
+		, _countMustBeIdentical{ other._countMustBeIdentical }
+		, _countValues{ other._countValues }
+	{
+		if (other._operations)
+		{
+			other._operations->copy(_storage.buffer, other._storage.buffer);
+			_operations = other._operations;
+		}
+	}
+
+	ControlValues(ControlValues&& other) noexcept
+		: _isValid{ other._isValid }
+		, _type{ other._type }
+		, _areDynamic{ other._areDynamic }
+		, _countMustBeIdentical{ other._countMustBeIdentical }
+		, _countValues{ other._countValues }
+	{
+		takeValues(other);
+	}
+
+	ControlValues& operator=(ControlValues const& other)
+	{
+		if (this != &other)
+		{
+			*this = ControlValues{ other };
+		}
+		return *this;
+	}
+
+	ControlValues& operator=(ControlValues&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			_isValid = other._isValid;
+			_type = other._type;
+			_areDynamic = other._areDynamic;
+			_countMustBeIdentical = other._countMustBeIdentical;
+			_countValues = other._countValues;
+			takeValues(other);
+		}
+		return *this;
+	}
 
 private:
+	/** Operations on the stored values, one static instance per ValueDetailsType (also acts as the type tag of the storage) */
+	struct Operations
+	{
+		void (*copy)(void* to, void const* from); // Copy constructs the values from 'from' storage into 'to' storage
+		void (*move)(void* to, void* from); // Move constructs the values from 'from' storage into 'to' storage, then destroys 'from' values (never throws)
+		void (*destroy)(void* values); // Destroys the values (never throws)
+	};
+
+	struct alignas(std::max_align_t) Storage
+	{
+		std::byte buffer[InlineStorageSize];
+	};
+
+	template<class ValueDetailsType>
+	static constexpr bool isStoredInline() noexcept
+	{
+		return sizeof(ValueDetailsType) <= InlineStorageSize && alignof(ValueDetailsType) <= alignof(Storage) && std::is_nothrow_move_constructible_v<ValueDetailsType>;
+	}
+
+	template<class ValueDetailsType>
+	static Operations const* getOperations() noexcept
+	{
+		if constexpr (isStoredInline<ValueDetailsType>())
+		{
+			static constexpr auto s_Operations = Operations{
+				[](void* const to, void const* const from)
+				{
+					new (to) ValueDetailsType(*std::launder(static_cast<ValueDetailsType const*>(from)));
+				},
+				[](void* const to, void* const from) noexcept
+				{
+					auto* const values = std::launder(static_cast<ValueDetailsType*>(from));
+					new (to) ValueDetailsType(std::move(*values));
+					values->~ValueDetailsType();
+				},
+				[](void* const values) noexcept
+				{
+					std::launder(static_cast<ValueDetailsType*>(values))->~ValueDetailsType();
+				},
+			};
+			return &s_Operations;
+		}
+		else
+		{
+			static constexpr auto s_Operations = Operations{
+				[](void* const to, void const* const from)
+				{
+					*static_cast<ValueDetailsType**>(to) = new ValueDetailsType(**static_cast<ValueDetailsType* const*>(from));
+				},
+				[](void* const to, void* const from) noexcept
+				{
+					*static_cast<ValueDetailsType**>(to) = *static_cast<ValueDetailsType**>(from);
+				},
+				[](void* const values) noexcept
+				{
+					delete *static_cast<ValueDetailsType**>(values);
+				},
+			};
+			return &s_Operations;
+		}
+	}
+
+	template<class ValueDetailsType>
+	ValueDetailsType const& get() const noexcept
+	{
+		if constexpr (isStoredInline<ValueDetailsType>())
+		{
+			return *std::launder(reinterpret_cast<ValueDetailsType const*>(_storage.buffer));
+		}
+		else
+		{
+			return **reinterpret_cast<ValueDetailsType* const*>(_storage.buffer);
+		}
+	}
+
+	void takeValues(ControlValues& other) noexcept
+	{
+		if (other._operations)
+		{
+			other._operations->move(_storage.buffer, other._storage.buffer);
+			_operations = other._operations;
+			other._operations = nullptr;
+		}
+		// Moved-from object no longer holds any values
+		other._isValid = false;
+		other._countValues = 0u;
+	}
+
+	void reset() noexcept
+	{
+		if (_operations)
+		{
+			_operations->destroy(_storage.buffer);
+			_operations = nullptr;
+		}
+	}
+
 	bool _isValid{ false };
 	ControlValueType::Type _type{};
 	bool _areDynamic{ false };
 	bool _countMustBeIdentical{ false };
 	std::uint16_t _countValues{ 0u };
-	std::any _values{};
+	Operations const* _operations{ nullptr };
+	Storage _storage{};
 };
 
 /** Stream Identification (EntityID/StreamIndex couple) */
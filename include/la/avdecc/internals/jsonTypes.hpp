@@ -201,7 +201,12 @@ struct adl_serializer<la::avdecc::entity::model::EntityCounters>
 			if (key == la::avdecc::entity::model::EntityCounters::key_type::None)
 			{
 				logJsonSerializer(la::avdecc::logger::Level::Warn, std::string("Unknown EntityCounterValidFlag name: ") + name);
-				counters.insert(std::make_pair(static_cast<la::avdecc::entity::model::EntityCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str())), value.get<la::avdecc::entity::model::EntityCounters::mapped_type>()));
+				auto const flag = static_cast<la::avdecc::entity::model::EntityCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str()));
+				// Only keep unknown counters that can be stored (single bit flag)
+				if (la::avdecc::entity::model::EntityCounters::isValidKey(flag))
+				{
+					counters.insert(std::make_pair(flag, value.get<la::avdecc::entity::model::EntityCounters::mapped_type>()));
+				}
 			}
 			else
 			{
@@ -245,7 +250,12 @@ struct adl_serializer<la::avdecc::entity::model::AvbInterfaceCounters>
 			if (key == la::avdecc::entity::model::AvbInterfaceCounters::key_type::None)
 			{
 				logJsonSerializer(la::avdecc::logger::Level::Warn, std::string("Unknown AvbInterfaceCounterValidFlag name: ") + name);
-				counters.insert(std::make_pair(static_cast<la::avdecc::entity::model::AvbInterfaceCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str())), value.get<la::avdecc::entity::model::AvbInterfaceCounters::mapped_type>()));
+				auto const flag = static_cast<la::avdecc::entity::model::AvbInterfaceCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str()));
+				// Only keep unknown counters that can be stored (single bit flag)
+				if (la::avdecc::entity::model::AvbInterfaceCounters::isValidKey(flag))
+				{
+					counters.insert(std::make_pair(flag, value.get<la::avdecc::entity::model::AvbInterfaceCounters::mapped_type>()));
+				}
 			}
 			else
 			{
@@ -289,7 +299,12 @@ struct adl_serializer<la::avdecc::entity::model::ClockDomainCounters>
 			if (key == la::avdecc::entity::model::ClockDomainCounters::key_type::None)
 			{
 				logJsonSerializer(la::avdecc::logger::Level::Warn, std::string("Unknown ClockDomainCounterValidFlag name: ") + name);
-				counters.insert(std::make_pair(static_cast<la::avdecc::entity::model::ClockDomainCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str())), value.get<la::avdecc::entity::model::ClockDomainCounters::mapped_type>()));
+				auto const flag = static_cast<la::avdecc::entity::model::ClockDomainCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str()));
+				// Only keep unknown counters that can be stored (single bit flag)
+				if (la::avdecc::entity::model::ClockDomainCounters::isValidKey(flag))
+				{
+					counters.insert(std::make_pair(flag, value.get<la::avdecc::entity::model::ClockDomainCounters::mapped_type>()));
+				}
 			}
 			else
 			{
@@ -333,7 +348,12 @@ struct adl_serializer<la::avdecc::entity::model::StreamInputCounters>
 			if (key == la::avdecc::entity::model::StreamInputCounters::key_type::None)
 			{
 				logJsonSerializer(la::avdecc::logger::Level::Warn, std::string("Unknown StreamInputCounterValidFlag name: ") + name);
-				counters.insert(std::make_pair(static_cast<la::avdecc::entity::model::StreamInputCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str())), value.get<la::avdecc::entity::model::StreamInputCounters::mapped_type>()));
+				auto const flag = static_cast<la::avdecc::entity::model::StreamInputCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str()));
+				// Only keep unknown counters that can be stored (single bit flag)
+				if (la::avdecc::entity::model::StreamInputCounters::isValidKey(flag))
+				{
+					counters.insert(std::make_pair(flag, value.get<la::avdecc::entity::model::StreamInputCounters::mapped_type>()));
+				}
 			}
 			else
 			{
@@ -377,7 +397,12 @@ struct adl_serializer<la::avdecc::entity::model::StreamOutputCounters>
 			if (key == la::avdecc::entity::model::StreamOutputCounters::key_type::None)
 			{
 				logJsonSerializer(la::avdecc::logger::Level::Warn, std::string("Unknown StreamOutputCounterValidFlag name: ") + name);
-				counters.insert(std::make_pair(static_cast<la::avdecc::entity::model::StreamOutputCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str())), value.get<la::avdecc::entity::model::StreamOutputCounters::mapped_type>()));
+				auto const flag = static_cast<la::avdecc::entity::model::StreamOutputCounters::key_type>(la::avdecc::utils::convertFromString<la::avdecc::entity::model::DescriptorCounterValidFlag>(name.c_str()));
+				// Only keep unknown counters that can be stored (single bit flag)
+				if (la::avdecc::entity::model::StreamOutputCounters::isValidKey(flag))
+				{
+					counters.insert(std::make_pair(flag, value.get<la::avdecc::entity::model::StreamOutputCounters::mapped_type>()));
+				}
 			}
 			else
 			{
@@ -449,6 +474,48 @@ void from_json(json const& j, Enum& flags)
 	}
 }
 
+/* FlatSet conversion (serialized as an array, like std::set) */
+template<typename T, size_t InlineCapacity, typename Compare>
+void to_json(json& j, FlatSet<T, InlineCapacity, Compare> const& values)
+{
+	j = json::array();
+	for (auto const& v : values)
+	{
+		j.push_back(v);
+	}
+}
+template<typename T, size_t InlineCapacity, typename Compare>
+void from_json(json const& j, FlatSet<T, InlineCapacity, Compare>& values)
+{
+	values.clear();
+	values.reserve(j.size());
+	for (auto const& o : j)
+	{
+		values.insert(o.get<T>());
+	}
+}
+
+/* SmallVector conversion (serialized as an array, like std::vector) */
+template<typename T, size_t InlineCapacity>
+void to_json(json& j, SmallVector<T, InlineCapacity> const& values)
+{
+	j = json::array();
+	for (auto const& v : values)
+	{
+		j.push_back(v);
+	}
+}
+template<typename T, size_t InlineCapacity>
+void from_json(json const& j, SmallVector<T, InlineCapacity>& values)
+{
+	values.clear();
+	values.reserve(j.size());
+	for (auto const& o : j)
+	{
+		values.push_back(o.get<T>());
+	}
+}
+
 } // namespace utils
 
 /* UniqueIdentifier conversion */
@@ -110,6 +110,25 @@ public:
 	using AecpCommandResultHandler = std::function<void(la::avdecc::protocol::Aecpdu const* const response, la::avdecc::protocol::ProtocolInterface::Error const error)>;
 	using AcmpCommandResultHandler = std::function<void(la::avdecc::protocol::Acmpdu const* const response, la::avdecc::protocol::ProtocolInterface::Error const error)>;
 
+	/** Bounds of the adaptive AECP congestion control (number of inflight commands and retransmission timeout, adapted for each target entity) */
+	struct AecpCongestionControlParameters
+	{
+		std::size_t minInflightCommands{ 1u }; /**< Lower bound of the window of inflight commands (must be at least 1) */
+		std::size_t initialInflightCommands{ 10u }; /**< Initial window of inflight commands, before any response or timeout (must be within the bounds) */
+		std::size_t maxInflightCommands{ 32u }; /**< Upper bound of the window of inflight commands */
+		std::chrono::milliseconds minTimeout{ 250u }; /**< Lower bound of the retransmission timeout, also used as initial timeout (IEEE1722.1-2013 Clause 9.2.1) */
+		std::chrono::milliseconds maxTimeout{ 2000u }; /**< Upper bound of the retransmission timeout */
+	};
+
+	/** Current state of the adaptive AECP congestion control for a target entity */
+	struct AecpCongestionControlStatistics
+	{
+		double inflightWindow{ 0.0 }; /**< Current window of inflight commands (only the integral part is used) */
+		std::chrono::microseconds smoothedResponseTime{ 0u }; /**< Smoothed response time (SRTT), 0 until a valid sample has been measured */
+		std::chrono::microseconds responseTimeVariation{ 0u }; /**< Response time variation (RTTVAR) */
+		std::chrono::milliseconds timeout{ 0u }; /**< Current retransmission timeout */
+	};
+
 	/** Interface definition for ProtocolInterface events observation */
 	class Observer : public la::avdecc::utils::Observer<ProtocolInterface>
 	{
@@ -270,6 +289,14 @@ public:
 	/** Sets automatic discovery delay. 0 (default) for no automatic discovery. */
 	virtual Error setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) const noexcept = 0;
 
+	/* ************************************************************ */
+	/* Command entry points                                         */
+	/* ************************************************************ */
+	/** Sets the bounds of the adaptive AECP congestion control. Returns InvalidParameters if the bounds are not consistent. */
+	virtual Error setAecpCongestionControlParameters(AecpCongestionControlParameters const& parameters) const noexcept = 0;
+	/** Gets the current state of the adaptive AECP congestion control for the specified target entity. Returns UnknownRemoteEntity if no command has been sent to this entity yet. */
+	virtual Error getAecpCongestionControlStatistics(UniqueIdentifier const targetEntityID, AecpCongestionControlStatistics& statistics) const noexcept = 0;
+
 	/* ************************************************************ */
 	/* Sending entry points                                         */
 	/* ************************************************************ */
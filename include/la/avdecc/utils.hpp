@@ -29,6 +29,8 @@
 #include "internals/uniqueIdentifier.hpp"
 
 #include <type_traits>
+#include <algorithm>
+#include <array>
 #include <tuple>
 #include <iterator>
 #include <functional>
@@ -43,6 +45,8 @@
 #include <set>
 #include <vector>
 #include <mutex>
+#include <initializer_list>
+#include <cstdint>
 
 #if !defined(__GNUC__) || __GNUC__ >= 10 /* <version> is not present in earier versions of gcc (not sure which version exactly, using 10 here) */
 #	include <version>
@@ -781,6 +785,578 @@ private:
 	underlying_value_type _value{};
 };
 
+/**
+* @brief Sorted set of unique values stored in a contiguous array.
+* @details Drop-in replacement for std::set (same ordering semantics) meant for small collections that rarely change once filled.
+*          Up to InlineCapacity values are stored inline (no allocation), larger collections move to a single heap allocated buffer.
+*          Lookup is a binary search, insertion and removal shift the following values.
+*          Iterators (and references) are invalidated by any modification.
+*/
+template<typename T, size_t InlineCapacity, typename Compare = std::less<T>>
+class FlatSet final
+{
+	static_assert(InlineCapacity > 0, "InlineCapacity must be greater than 0");
+	static_assert(std::is_default_constructible_v<T>, "T must be default constructible");
+
+public:
+	using key_type = T;
+	using value_type = T;
+	using key_compare = Compare;
+	using value_compare = Compare;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type const&;
+	using const_reference = value_type const&;
+	using pointer = value_type const*;
+	using const_pointer = value_type const*;
+	using iterator = value_type const*; // Like std::set, values cannot be modified through iterators
+	using const_iterator = value_type const*;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	static constexpr size_type inline_capacity = InlineCapacity;
+
+	FlatSet() noexcept = default;
+
+	FlatSet(std::initializer_list<value_type> values)
+	{
+		insert(values.begin(), values.end());
+	}
+
+	template<class InputIt>
+	FlatSet(InputIt first, InputIt last)
+	{
+		insert(first, last);
+	}
+
+	/* Iterators */
+	const_iterator begin() const noexcept
+	{
+		return data();
+	}
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+	const_iterator end() const noexcept
+	{
+		return data() + size();
+	}
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return const_reverse_iterator{ end() };
+	}
+	const_reverse_iterator rend() const noexcept
+	{
+		return const_reverse_iterator{ begin() };
+	}
+
+	/* Capacity */
+	bool empty() const noexcept
+	{
+		return size() == 0u;
+	}
+	size_type size() const noexcept
+	{
+		return _onHeap ? _heap.size() : _inlineSize;
+	}
+	size_type capacity() const noexcept
+	{
+		return _onHeap ? _heap.capacity() : InlineCapacity;
+	}
+	/** Returns true if the values are stored inline (no heap allocation) */
+	bool isInline() const noexcept
+	{
+		return !_onHeap;
+	}
+	void reserve(size_type const count)
+	{
+		if (count > capacity())
+		{
+			moveToHeap(count);
+		}
+	}
+
+	/* Modifiers */
+	void clear() noexcept
+	{
+		_heap = {};
+		_inlineSize = 0u;
+		_onHeap = false;
+	}
+
+	std::pair<iterator, bool> insert(value_type const& value)
+	{
+		auto const it = lower_bound(value);
+		if (it != end() && !Compare{}(value, *it))
+		{
+			return { it, false };
+		}
+		return { insertAt(static_cast<size_type>(it - begin()), value), true };
+	}
+
+	/** Inserts the value, using hint as a suggestion as to where to start the search (for std::inserter compatibility) */
+	iterator insert(const_iterator const hint, value_type const& value)
+	{
+		// Fast path when values are inserted in order
+		if ((hint == end() || Compare{}(value, *hint)) && (hint == begin() || Compare{}(*(hint - 1), value)))
+		{
+			return insertAt(static_cast<size_type>(hint - begin()), value);
+		}
+		return insert(value).first;
+	}
+
+	template<class InputIt>
+	void insert(InputIt first, InputIt last)
+	{
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			reserve(size() + static_cast<size_type>(std::distance(first, last)));
+		}
+		for (; first != last; ++first)
+		{
+			insert(end(), *first);
+		}
+	}
+
+	void insert(std::initializer_list<value_type> values)
+	{
+		insert(values.begin(), values.end());
+	}
+
+	template<typename... Args>
+	std::pair<iterator, bool> emplace(Args&&... args)
+	{
+		return insert(value_type{ std::forward<Args>(args)... });
+	}
+
+	iterator erase(const_iterator const pos)
+	{
+		auto const index = static_cast<size_type>(pos - begin());
+		if (_onHeap)
+		{
+			_heap.erase(_heap.begin() + index);
+		}
+		else
+		{
+			std::move(_inline.begin() + index + 1, _inline.begin() + _inlineSize, _inline.begin() + index);
+			--_inlineSize;
+		}
+		return begin() + index;
+	}
+
+	size_type erase(key_type const& key)
+	{
+		auto const it = find(key);
+		if (it == end())
+		{
+			return 0u;
+		}
+		erase(it);
+		return 1u;
+	}
+
+	/* Lookup */
+	size_type count(key_type const& key) const noexcept
+	{
+		return find(key) != end() ? 1u : 0u;
+	}
+	bool contains(key_type const& key) const noexcept
+	{
+		return find(key) != end();
+	}
+	const_iterator find(key_type const& key) const noexcept
+	{
+		auto const it = lower_bound(key);
+		if (it != end() && !Compare{}(key, *it))
+		{
+			return it;
+		}
+		return end();
+	}
+	const_iterator lower_bound(key_type const& key) const noexcept
+	{
+		return std::lower_bound(begin(), end(), key, Compare{});
+	}
+	const_iterator upper_bound(key_type const& key) const noexcept
+	{
+		return std::upper_bound(begin(), end(), key, Compare{});
+	}
+
+	/* Comparison */
+	bool operator==(FlatSet const& other) const noexcept
+	{
+		return std::equal(begin(), end(), other.begin(), other.end());
+	}
+	bool operator!=(FlatSet const& other) const noexcept
+	{
+		return !operator==(other);
+	}
+	bool operator<(FlatSet const& other) const noexcept
+	{
+		return std::lexicographical_compare(begin(), end(), other.begin(), other.end(), Compare{});
+	}
+
+	// Defaulted compiler auto-generated methods
+	FlatSet(FlatSet&&) = default;
+	FlatSet(FlatSet const&) = default;
+	FlatSet& operator=(FlatSet const&) = default;
+	FlatSet& operator=(FlatSet&&) = default;
+
+private:
+	value_type const* data() const noexcept
+	{
+		return _onHeap ? _heap.data() : _inline.data();
+	}
+
+	iterator insertAt(size_type const index, value_type const& value)
+	{
+		if (!_onHeap && _inlineSize == InlineCapacity)
+		{
+			moveToHeap(InlineCapacity * 2u);
+		}
+		if (_onHeap)
+		{
+			return &*_heap.insert(_heap.begin() + index, value);
+		}
+		std::move_backward(_inline.begin() + index, _inline.begin() + _inlineSize, _inline.begin() + _inlineSize + 1);
+		_inline[index] = value;
+		++_inlineSize;
+		return _inline.data() + index;
+	}
+
+	void moveToHeap(size_type const newCapacity)
+	{
+		if (_onHeap)
+		{
+			_heap.reserve(newCapacity);
+			return;
+		}
+		auto heap = std::vector<value_type>{};
+		heap.reserve(newCapacity);
+		heap.insert(heap.end(), _inline.begin(), _inline.begin() + _inlineSize);
+		_heap = std::move(heap);
+		_inlineSize = 0u;
+		_onHeap = true;
+	}
+
+	std::array<value_type, InlineCapacity> _inline{};
+	std::vector<value_type> _heap{};
+	std::uint16_t _inlineSize{ 0u };
+	bool _onHeap{ false };
+};
+
+/**
+* @brief Sequence container stored in a contiguous array, with inline storage for small collections.
+* @details Drop-in replacement for std::vector meant for collections that usually hold a few values.
+*          Up to InlineCapacity values are stored inline (no allocation), larger collections move to a single heap allocated buffer.
+*          Iterators (and references) are invalidated by any modification that changes the size.
+*/
+template<typename T, size_t InlineCapacity>
+class SmallVector final
+{
+	static_assert(InlineCapacity > 0, "InlineCapacity must be greater than 0");
+	static_assert(std::is_default_constructible_v<T>, "T must be default constructible");
+
+public:
+	using value_type = T;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type&;
+	using const_reference = value_type const&;
+	using pointer = value_type*;
+	using const_pointer = value_type const*;
+	using iterator = value_type*;
+	using const_iterator = value_type const*;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	static constexpr size_type inline_capacity = InlineCapacity;
+
+	SmallVector() noexcept = default;
+
+	SmallVector(std::initializer_list<value_type> values)
+	{
+		assign(values.begin(), values.end());
+	}
+
+	template<class InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+	SmallVector(InputIt first, InputIt last)
+	{
+		assign(first, last);
+	}
+
+	explicit SmallVector(size_type const count, value_type const& value = value_type{})
+	{
+		resize(count, value);
+	}
+
+	template<class InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+	void assign(InputIt first, InputIt last)
+	{
+		clear();
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		{
+			reserve(static_cast<size_type>(std::distance(first, last)));
+		}
+		for (; first != last; ++first)
+		{
+			push_back(*first);
+		}
+	}
+
+	/* Element access */
+	reference operator[](size_type const pos) noexcept
+	{
+		return data()[pos];
+	}
+	const_reference operator[](size_type const pos) const noexcept
+	{
+		return data()[pos];
+	}
+	reference at(size_type const pos)
+	{
+		if (pos >= size())
+		{
+			throw std::out_of_range("SmallVector::at() out of range");
+		}
+		return data()[pos];
+	}
+	const_reference at(size_type const pos) const
+	{
+		if (pos >= size())
+		{
+			throw std::out_of_range("SmallVector::at() out of range");
+		}
+		return data()[pos];
+	}
+	reference front() noexcept
+	{
+		return *begin();
+	}
+	const_reference front() const noexcept
+	{
+		return *begin();
+	}
+	reference back() noexcept
+	{
+		return *(end() - 1);
+	}
+	const_reference back() const noexcept
+	{
+		return *(end() - 1);
+	}
+	pointer data() noexcept
+	{
+		return _onHeap ? _heap.data() : _inline.data();
+	}
+	const_pointer data() const noexcept
+	{
+		return _onHeap ? _heap.data() : _inline.data();
+	}
+
+	/* Iterators */
+	iterator begin() noexcept
+	{
+		return data();
+	}
+	const_iterator begin() const noexcept
+	{
+		return data();
+	}
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+	iterator end() noexcept
+	{
+		return data() + size();
+	}
+	const_iterator end() const noexcept
+	{
+		return data() + size();
+	}
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+	reverse_iterator rbegin() noexcept
+	{
+		return reverse_iterator{ end() };
+	}
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return const_reverse_iterator{ end() };
+	}
+	reverse_iterator rend() noexcept
+	{
+		return reverse_iterator{ begin() };
+	}
+	const_reverse_iterator rend() const noexcept
+	{
+		return const_reverse_iterator{ begin() };
+	}
+
+	/* Capacity */
+	bool empty() const noexcept
+	{
+		return size() == 0u;
+	}
+	size_type size() const noexcept
+	{
+		return _onHeap ? _heap.size() : _inlineSize;
+	}
+	size_type capacity() const noexcept
+	{
+		return _onHeap ? _heap.capacity() : InlineCapacity;
+	}
+	/** Returns true if the values are stored inline (no heap allocation) */
+	bool isInline() const noexcept
+	{
+		return !_onHeap;
+	}
+	void reserve(size_type const count)
+	{
+		if (count > capacity())
+		{
+			moveToHeap(count);
+		}
+	}
+
+	/* Modifiers */
+	void clear() noexcept
+	{
+		_heap = {};
+		std::fill(_inline.begin(), _inline.begin() + _inlineSize, value_type{});
+		_inlineSize = 0u;
+		_onHeap = false;
+	}
+
+	void push_back(value_type const& value)
+	{
+		emplace_back(value);
+	}
+
+	void push_back(value_type&& value)
+	{
+		emplace_back(std::move(value));
+	}
+
+	template<typename... Args>
+	reference emplace_back(Args&&... args)
+	{
+		if (!_onHeap && _inlineSize == InlineCapacity)
+		{
+			// Build the new element before relocating the existing ones, as the arguments might refer to one of them (like std::vector does)
+			auto value = value_type{ std::forward<Args>(args)... };
+			moveToHeap(InlineCapacity * 2u);
+			return _heap.emplace_back(std::move(value));
+		}
+		if (_onHeap)
+		{
+			return _heap.emplace_back(std::forward<Args>(args)...);
+		}
+		auto& value = _inline[_inlineSize];
+		value = value_type{ std::forward<Args>(args)... };
+		++_inlineSize;
+		return value;
+	}
+
+	void pop_back() noexcept
+	{
+		if (_onHeap)
+		{
+			_heap.pop_back();
+		}
+		else
+		{
+			--_inlineSize;
+			_inline[_inlineSize] = value_type{};
+		}
+	}
+
+	void resize(size_type const count, value_type const& value = value_type{})
+	{
+		if (count > capacity())
+		{
+			// Copy the value before relocating the existing elements, as it might refer to one of them
+			auto const valueCopy = value;
+			moveToHeap(count);
+			_heap.resize(count, valueCopy);
+			return;
+		}
+		if (_onHeap)
+		{
+			_heap.resize(count, value);
+			return;
+		}
+		while (_inlineSize > count)
+		{
+			pop_back();
+		}
+		while (_inlineSize < count)
+		{
+			_inline[_inlineSize] = value;
+			++_inlineSize;
+		}
+	}
+
+	iterator erase(const_iterator const pos)
+	{
+		auto const index = static_cast<size_type>(pos - begin());
+		if (_onHeap)
+		{
+			_heap.erase(_heap.begin() + index);
+		}
+		else
+		{
+			std::move(_inline.begin() + index + 1, _inline.begin() + _inlineSize, _inline.begin() + index);
+			pop_back();
+		}
+		return begin() + index;
+	}
+
+	/* Comparison */
+	bool operator==(SmallVector const& other) const noexcept
+	{
+		return std::equal(begin(), end(), other.begin(), other.end());
+	}
+	bool operator!=(SmallVector const& other) const noexcept
+	{
+		return !operator==(other);
+	}
+
+	// Defaulted compiler auto-generated methods
+	SmallVector(SmallVector&&) = default;
+	SmallVector(SmallVector const&) = default;
+	SmallVector& operator=(SmallVector const&) = default;
+	SmallVector& operator=(SmallVector&&) = default;
+
+private:
+	void moveToHeap(size_type const newCapacity)
+	{
+		if (_onHeap)
+		{
+			_heap.reserve(newCapacity);
+			return;
+		}
+		auto heap = std::vector<value_type>{};
+		heap.reserve(newCapacity);
+		heap.insert(heap.end(), std::make_move_iterator(_inline.begin()), std::make_move_iterator(_inline.begin() + _inlineSize));
+		std::fill(_inline.begin(), _inline.begin() + _inlineSize, value_type{});
+		_heap = std::move(heap);
+		_inlineSize = 0u;
+		_onHeap = true;
+	}
+
+	std::array<value_type, InlineCapacity> _inline{};
+	std::vector<value_type> _heap{};
+	std::uint16_t _inlineSize{ 0u };
+	bool _onHeap{ false };
+};
+
 } // namespace utils
 } // namespace avdecc
 } // namespace la
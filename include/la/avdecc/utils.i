@@ -127,6 +127,52 @@ private:
 #endif
 }
 
+template<typename T, size_t InlineCapacity, typename Compare = std::less<T>>
+class FlatSet final
+{
+public:
+	using value_type = T;
+
+	FlatSet() noexcept = default;
+	bool empty() const noexcept;
+	size_t size() const noexcept;
+	void clear() noexcept;
+	size_t count(T const& key) const noexcept;
+	bool contains(T const& key) const noexcept;
+	%rename("isEqual") operator==(FlatSet const& other) const noexcept;
+	bool operator==(FlatSet const& other) const noexcept;
+	%rename("isDifferent") operator!=(FlatSet const& other) const noexcept;
+	bool operator!=(FlatSet const& other) const noexcept;
+};
+
+// Extend the class
+%extend FlatSet
+{
+	void add(T const& value)
+	{
+		$self->insert(value);
+	}
+	bool remove(T const& value)
+	{
+		return $self->erase(value) != 0u;
+	}
+	T getAt(size_t const index) const
+	{
+		if (index >= $self->size())
+		{
+			throw std::out_of_range("FlatSet index out of range");
+		}
+		return *($self->begin() + index);
+	}
+#if defined(SWIGCSHARP)
+	// Provide a more native Equals() method
+	bool Equals(FlatSet const& other) const noexcept
+	{
+		return *$self == other;
+	}
+#endif
+}
+
 // Forward declare Subject template class
 template<class Derived, class Mut>
 class Subject;
@@ -0,0 +1,604 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controller_c.cpp
+* @author Christophe Calmejane
+* @brief C bindings for la::avdecc::controller::Controller.
+*/
+
+#include <la/avdecc/controller/avdeccController.hpp>
+#include "la/avdecc/controller/avdeccController.h"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// The views directly borrow the model containers, make sure the memory layouts are identical
+static_assert(sizeof(la::avdecc::entity::model::StreamFormat) == sizeof(avdecc_entity_model_stream_format_t) && std::is_standard_layout_v<la::avdecc::entity::model::StreamFormat>, "StreamFormat layout must match avdecc_entity_model_stream_format_t");
+static_assert(sizeof(la::avdecc::entity::model::SamplingRate) == sizeof(avdecc_entity_model_sampling_rate_t) && std::is_standard_layout_v<la::avdecc::entity::model::SamplingRate>, "SamplingRate layout must match avdecc_entity_model_sampling_rate_t");
+static_assert(sizeof(la::avdecc::entity::model::AudioMapping) == sizeof(avdecc_entity_model_audio_mapping_t) && offsetof(la::avdecc::entity::model::AudioMapping, streamIndex) == offsetof(avdecc_entity_model_audio_mapping_t, stream_index) && offsetof(la::avdecc::entity::model::AudioMapping, streamChannel) == offsetof(avdecc_entity_model_audio_mapping_t, stream_channel) && offsetof(la::avdecc::entity::model::AudioMapping, clusterOffset) == offsetof(avdecc_entity_model_audio_mapping_t, cluster_offset) && offsetof(la::avdecc::entity::model::AudioMapping, clusterChannel) == offsetof(avdecc_entity_model_audio_mapping_t, cluster_channel), "AudioMapping layout must match avdecc_entity_model_audio_mapping_t");
+
+/* ************************************************************************** */
+/* Controller::Observer Bindings                                              */
+/* ************************************************************************** */
+/** Owns the Controller and queues its notifications as flat events, to be delivered in batches by LA_AVDECC_Controller_dispatchEvents */
+class ControllerWrapper final : public la::avdecc::controller::Controller::DefaultedObserver
+{
+public:
+	static constexpr auto MaxPendingEvents = size_t{ 16384u };
+
+	ControllerWrapper(la::avdecc::controller::Controller::UniquePointer&& controller)
+		: _controller{ std::move(controller) }
+	{
+		_controller->registerObserver(this);
+	}
+
+	~ControllerWrapper() noexcept
+	{
+		_controller->unregisterObserver(this);
+	}
+
+	la::avdecc::controller::Controller& getController() noexcept
+	{
+		return *_controller;
+	}
+
+	void dispatchEvents(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_controller_events_cb const onEvents) noexcept
+	{
+		// Only one dispatcher at a time, so the dispatched events buffer can be reused
+		auto const dispatchLock = std::lock_guard{ _dispatchLock };
+
+		_dispatchedEvents.clear();
+		{
+			auto const lg = std::lock_guard{ _lock };
+			if (_eventsLost)
+			{
+				_pendingEvents.push_back(avdecc_controller_event_t{ static_cast<avdecc_controller_event_type_t>(avdecc_controller_event_type_events_lost), la::avdecc::UniqueIdentifier::getNullUniqueIdentifier(), static_cast<avdecc_entity_model_descriptor_type_t>(la::avdecc::entity::model::DescriptorType::Invalid), 0u });
+				_eventsLost = false;
+			}
+			// Swap the buffers (no allocation once both buffers reached their working size)
+			_pendingEvents.swap(_dispatchedEvents);
+		}
+
+		if (!_dispatchedEvents.empty())
+		{
+			la::avdecc::utils::invokeProtectedHandler(onEvents, handle, _dispatchedEvents.data(), _dispatchedEvents.size());
+		}
+	}
+
+	// Deleted compiler auto-generated methods
+	ControllerWrapper(ControllerWrapper&&) = delete;
+	ControllerWrapper(ControllerWrapper const&) = delete;
+	ControllerWrapper& operator=(ControllerWrapper const&) = delete;
+	ControllerWrapper& operator=(ControllerWrapper&&) = delete;
+
+private:
+	void pushEvent(avdecc_controller_event_type_e const eventType, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::DescriptorType const descriptorType = la::avdecc::entity::model::DescriptorType::Entity, la::avdecc::entity::model::DescriptorIndex const descriptorIndex = 0u) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (_pendingEvents.size() >= MaxPendingEvents)
+		{
+			_eventsLost = true;
+			return;
+		}
+		try
+		{
+			_pendingEvents.push_back(avdecc_controller_event_t{ static_cast<avdecc_controller_event_type_t>(eventType), entity->getEntity().getEntityID(), static_cast<avdecc_entity_model_descriptor_type_t>(descriptorType), descriptorIndex });
+		}
+		catch (...)
+		{
+			_eventsLost = true;
+		}
+	}
+
+	// la::avdecc::controller::Controller::Observer overrides
+	// Discovery notifications (ADP)
+	virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_entity_online, entity);
+	}
+	virtual void onEntityOffline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_entity_offline, entity);
+	}
+	virtual void onEntityCapabilitiesChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_entity_capabilities_changed, entity);
+	}
+	virtual void onEntityAssociationIDChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_entity_association_id_changed, entity);
+	}
+
+	// Global entity notifications
+	virtual void onUnsolicitedRegistrationChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, bool const /*isSubscribed*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_unsolicited_registration_changed, entity);
+	}
+	virtual void onCompatibilityFlagsChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::ControlledEntity::CompatibilityFlags const /*compatibilityFlags*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_compatibility_flags_changed, entity);
+	}
+
+	// Connection notifications (ACMP)
+	virtual void onStreamInputConnectionChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamInputConnectionInfo const& /*info*/, bool const /*changedByOther*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_input_connection_changed, entity, la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex);
+	}
+	virtual void onStreamOutputConnectionsChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamConnections const& /*connections*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_output_connections_changed, entity, la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex);
+	}
+
+	// Entity model notifications (unsolicited AECP or changes this controller sent)
+	virtual void onAcquireStateChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::model::AcquireState const /*acquireState*/, la::avdecc::UniqueIdentifier const /*owningEntity*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_acquire_state_changed, entity);
+	}
+	virtual void onLockStateChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::model::LockState const /*lockState*/, la::avdecc::UniqueIdentifier const /*lockingEntity*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_lock_state_changed, entity);
+	}
+	virtual void onStreamInputFormatChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamFormat const /*streamFormat*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_input_format_changed, entity, la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex);
+	}
+	virtual void onStreamOutputFormatChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamFormat const /*streamFormat*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_output_format_changed, entity, la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex);
+	}
+	virtual void onEntityNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvdeccFixedString const& /*entityName*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_entity_name_changed, entity);
+	}
+	virtual void onEntityGroupNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvdeccFixedString const& /*entityGroupName*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_entity_group_name_changed, entity);
+	}
+	virtual void onAudioUnitSamplingRateChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AudioUnitIndex const audioUnitIndex, la::avdecc::entity::model::SamplingRate const /*samplingRate*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_audio_unit_sampling_rate_changed, entity, la::avdecc::entity::model::DescriptorType::AudioUnit, audioUnitIndex);
+	}
+	virtual void onClockSourceChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::ClockSourceIndex const /*clockSourceIndex*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_clock_source_changed, entity, la::avdecc::entity::model::DescriptorType::ClockDomain, clockDomainIndex);
+	}
+	virtual void onControlValuesChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ControlIndex const controlIndex, la::avdecc::entity::model::ControlValues const& /*controlValues*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_control_values_changed, entity, la::avdecc::entity::model::DescriptorType::Control, controlIndex);
+	}
+	virtual void onStreamInputStarted(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_input_running_changed, entity, la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex);
+	}
+	virtual void onStreamOutputStarted(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_output_running_changed, entity, la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex);
+	}
+	virtual void onStreamInputStopped(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_input_running_changed, entity, la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex);
+	}
+	virtual void onStreamOutputStopped(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_output_running_changed, entity, la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex);
+	}
+	virtual void onAvbInterfaceLinkStatusChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::controller::ControlledEntity::InterfaceLinkStatus const /*linkStatus*/) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_avb_interface_link_status_changed, entity, la::avdecc::entity::model::DescriptorType::AvbInterface, avbInterfaceIndex);
+	}
+	virtual void onStreamPortInputAudioMappingsChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamPortIndex const streamPortIndex) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_port_input_audio_mappings_changed, entity, la::avdecc::entity::model::DescriptorType::StreamPortInput, streamPortIndex);
+	}
+	virtual void onStreamPortOutputAudioMappingsChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamPortIndex const streamPortIndex) noexcept override
+	{
+		pushEvent(avdecc_controller_event_type_stream_port_output_audio_mappings_changed, entity, la::avdecc::entity::model::DescriptorType::StreamPortOutput, streamPortIndex);
+	}
+
+	// Private members
+	la::avdecc::controller::Controller::UniquePointer _controller{ nullptr, nullptr };
+	std::mutex _lock{}; // Protects _pendingEvents and _eventsLost
+	std::mutex _dispatchLock{}; // Protects _dispatchedEvents
+	std::vector<avdecc_controller_event_t> _pendingEvents{};
+	std::vector<avdecc_controller_event_t> _dispatchedEvents{};
+	bool _eventsLost{ false };
+};
+
+/* ************************************************************************** */
+/* Views helpers                                                              */
+/* ************************************************************************** */
+static avdecc_controller_string_view_t make_string_view(la::avdecc::entity::model::AvdeccFixedString const& str) noexcept
+{
+	auto const* const data = str.data();
+	// AvdeccFixedString is not NULL terminated when it's full
+	return avdecc_controller_string_view_t{ data, static_cast<size_t>(std::find(data, data + str.size(), '\0') - data) };
+}
+
+static avdecc_controller_error_t convertControlledEntityException(la::avdecc::controller::ControlledEntity::Exception const& e) noexcept
+{
+	switch (e.getType())
+	{
+		case la::avdecc::controller::ControlledEntity::Exception::Type::NotSupported:
+		case la::avdecc::controller::ControlledEntity::Exception::Type::EnumerationError:
+			return static_cast<avdecc_controller_error_t>(avdecc_controller_error_not_supported);
+		case la::avdecc::controller::ControlledEntity::Exception::Type::InvalidConfigurationIndex:
+		case la::avdecc::controller::ControlledEntity::Exception::Type::InvalidDescriptorIndex:
+			return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_descriptor_index);
+		default:
+			return static_cast<avdecc_controller_error_t>(avdecc_controller_error_internal_error);
+	}
+}
+
+static void fill_stream_view(la::avdecc::controller::model::StreamNode const& node, la::avdecc::entity::model::StreamNodeDynamicModel const& dynamicModel, avdecc_controller_stream_view_t& view) noexcept
+{
+	view.object_name = make_string_view(dynamicModel.objectName);
+	view.clock_domain_index = node.staticModel.clockDomainIndex;
+	view.stream_flags = static_cast<avdecc_entity_stream_flags_t>(node.staticModel.streamFlags.value());
+	view.avb_interface_index = node.staticModel.avbInterfaceIndex;
+	view.current_format = dynamicModel.streamFormat.getValue();
+	view.formats = reinterpret_cast<avdecc_entity_model_stream_format_t const*>(node.staticModel.formats.begin()); // FlatSet iterators are pointers to its contiguous storage
+	view.formats_count = node.staticModel.formats.size();
+	view.is_running_valid = static_cast<avdecc_bool_t>(dynamicModel.isStreamRunning.has_value());
+	view.is_running = static_cast<avdecc_bool_t>(dynamicModel.isStreamRunning.value_or(false));
+	view.connection_state = static_cast<avdecc_controller_stream_input_connection_state_t>(avdecc_controller_stream_input_connection_state_not_connected);
+	view.connected_talker = avdecc_entity_model_stream_identification_t{ la::avdecc::UniqueIdentifier::getNullUniqueIdentifier(), 0u };
+}
+
+/* ************************************************************************** */
+/* Controller APIs                                                            */
+/* ************************************************************************** */
+static la::avdecc::bindings::HandleManager<ControllerWrapper*> s_ControllerManager{};
+static std::map<LA_AVDECC_CONTROLLER_HANDLE const, void*> s_ControllerApplicationDataMap{};
+static std::mutex s_ControllerApplicationDataLock{}; // Protects s_ControllerApplicationDataMap
+static la::avdecc::bindings::HandleManager<la::avdecc::controller::ControlledEntityGuard*> s_ControlledEntityGuardManager{};
+static std::mutex s_ControlledEntityGuardLock{}; // Protects s_ControlledEntityGuardManager, as different threads may each hold their own guards (a guard itself must be released by the thread that retrieved it)
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_create(avdecc_protocol_interface_type_t const protocolInterfaceType, avdecc_const_string_t networkInterfaceID, unsigned short const progID, avdecc_unique_identifier_t const entityModelID, avdecc_const_string_t preferedLocale, avdecc_const_string_t executorName, LA_AVDECC_CONTROLLER_HANDLE* const createdControllerHandle)
+{
+	if (networkInterfaceID == nullptr || preferedLocale == nullptr || createdControllerHandle == nullptr)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_parameters);
+	}
+
+	try
+	{
+		auto const executor = executorName != nullptr ? std::optional<std::string>{ executorName } : std::nullopt;
+		auto controller = la::avdecc::controller::Controller::create(static_cast<la::avdecc::protocol::ProtocolInterface::Type>(protocolInterfaceType), std::string{ networkInterfaceID }, progID, la::avdecc::UniqueIdentifier{ entityModelID }, std::string{ preferedLocale }, nullptr, executor, nullptr);
+		*createdControllerHandle = s_ControllerManager.createObject(std::move(controller));
+	}
+	catch (la::avdecc::controller::Controller::Exception const& e)
+	{
+		return static_cast<avdecc_controller_error_t>(e.getError());
+	}
+	catch (...)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_internal_error);
+	}
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_destroy(LA_AVDECC_CONTROLLER_HANDLE const handle)
+{
+	if (!s_ControllerManager.contains(handle))
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_controller_handle);
+	}
+
+	{
+		auto const lg = std::lock_guard{ s_ControllerApplicationDataLock };
+		s_ControllerApplicationDataMap.erase(handle);
+	}
+
+	// Destroy object, which will sync until async operations are complete
+	s_ControllerManager.destroyObject(handle);
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_setApplicationData(LA_AVDECC_CONTROLLER_HANDLE const handle, void* applicationData)
+{
+	if (!s_ControllerManager.contains(handle))
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_controller_handle);
+	}
+
+	{
+		auto const lg = std::lock_guard{ s_ControllerApplicationDataLock };
+		s_ControllerApplicationDataMap[handle] = applicationData;
+	}
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+LA_AVDECC_BINDINGS_C_API void* LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_getApplicationData(LA_AVDECC_CONTROLLER_HANDLE const handle)
+{
+	auto const lg = std::lock_guard{ s_ControllerApplicationDataLock };
+	if (auto const it = s_ControllerApplicationDataMap.find(handle); it != s_ControllerApplicationDataMap.end())
+	{
+		return it->second;
+	}
+	return nullptr;
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_discoverRemoteEntities(LA_AVDECC_CONTROLLER_HANDLE const handle)
+{
+	try
+	{
+		auto& obj = s_ControllerManager.getObject(handle);
+
+		obj.getController().discoverRemoteEntities();
+	}
+	catch (...)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_controller_handle);
+	}
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_discoverRemoteEntity(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_unique_identifier_t const entityID)
+{
+	try
+	{
+		auto& obj = s_ControllerManager.getObject(handle);
+
+		obj.getController().discoverRemoteEntity(la::avdecc::UniqueIdentifier{ entityID });
+	}
+	catch (...)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_controller_handle);
+	}
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_dispatchEvents(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_controller_events_cb const onEvents)
+{
+	try
+	{
+		auto& obj = s_ControllerManager.getObject(handle);
+
+		obj.dispatchEvents(handle, onEvents);
+	}
+	catch (...)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_controller_handle);
+	}
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+/* ************************************************************************** */
+/* ControlledEntityGuard APIs                                                 */
+/* ************************************************************************** */
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_Controller_getControlledEntityGuard(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_unique_identifier_t const entityID, LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE* const guardHandle)
+{
+	if (guardHandle == nullptr)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_parameters);
+	}
+
+	try
+	{
+		auto& obj = s_ControllerManager.getObject(handle);
+
+		auto guard = obj.getController().getControlledEntityGuard(la::avdecc::UniqueIdentifier{ entityID });
+		if (!guard)
+		{
+			return static_cast<avdecc_controller_error_t>(avdecc_controller_error_unknown_entity);
+		}
+
+		auto const lg = std::lock_guard{ s_ControlledEntityGuardLock };
+		*guardHandle = s_ControlledEntityGuardManager.createObject(std::move(guard));
+	}
+	catch (...)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_controller_handle);
+	}
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_release(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle)
+{
+	auto const lg = std::lock_guard{ s_ControlledEntityGuardLock };
+
+	if (!s_ControlledEntityGuardManager.contains(guardHandle))
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_guard_handle);
+	}
+
+	s_ControlledEntityGuardManager.destroyObject(guardHandle);
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+/** Calls the handler with the guarded ControlledEntity, converting the errors */
+template<typename Handler>
+static avdecc_controller_error_t withGuardedEntity(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, Handler&& handler) noexcept
+{
+	auto const* entity = static_cast<la::avdecc::controller::ControlledEntity const*>(nullptr);
+	{
+		auto const lg = std::lock_guard{ s_ControlledEntityGuardLock };
+
+		if (!s_ControlledEntityGuardManager.contains(guardHandle))
+		{
+			return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_guard_handle);
+		}
+		entity = s_ControlledEntityGuardManager.getObject(guardHandle).get();
+	}
+
+	try
+	{
+		handler(*entity);
+	}
+	catch (la::avdecc::controller::ControlledEntity::Exception const& e)
+	{
+		return convertControlledEntityException(e);
+	}
+	catch (...)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_internal_error);
+	}
+
+	return static_cast<avdecc_controller_error_t>(avdecc_controller_error_no_error);
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getEntityView(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_controller_entity_view_p const view)
+{
+	if (view == nullptr)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_parameters);
+	}
+
+	return withGuardedEntity(guardHandle,
+		[view](la::avdecc::controller::ControlledEntity const& entity)
+		{
+			auto const& e = entity.getEntity();
+			*view = avdecc_controller_entity_view_t{};
+			view->entity_id = e.getEntityID();
+			view->entity_model_id = e.getEntityModelID();
+			view->entity_capabilities = static_cast<avdecc_entity_entity_capabilities_t>(e.getEntityCapabilities().value());
+			view->talker_capabilities = static_cast<avdecc_entity_talker_capabilities_t>(e.getTalkerCapabilities().value());
+			view->listener_capabilities = static_cast<avdecc_entity_listener_capabilities_t>(e.getListenerCapabilities().value());
+			view->is_acquired = static_cast<avdecc_bool_t>(entity.isAcquired());
+			view->is_acquired_by_other = static_cast<avdecc_bool_t>(entity.isAcquiredByOther());
+			view->is_locked = static_cast<avdecc_bool_t>(entity.isLocked());
+			view->is_locked_by_other = static_cast<avdecc_bool_t>(entity.isLockedByOther());
+			view->is_subscribed_to_unsolicited_notifications = static_cast<avdecc_bool_t>(entity.isSubscribedToUnsolicitedNotifications());
+
+			// AEM part of the view
+			if (!e.getEntityCapabilities().test(la::avdecc::entity::EntityCapability::AemSupported) || entity.gotFatalEnumerationError() || !entity.hasAnyConfiguration())
+			{
+				return;
+			}
+			auto const& entityNode = entity.getEntityNode();
+			auto const& configurationNode = entity.getCurrentConfigurationNode();
+			view->is_aem_supported = static_cast<avdecc_bool_t>(avdecc_bool_true);
+			view->current_configuration = entityNode.dynamicModel.currentConfiguration;
+			view->entity_name = make_string_view(entityNode.dynamicModel.entityName);
+			view->group_name = make_string_view(entityNode.dynamicModel.groupName);
+			view->firmware_version = make_string_view(entityNode.dynamicModel.firmwareVersion);
+			view->serial_number = make_string_view(entityNode.dynamicModel.serialNumber);
+			view->audio_units_count = static_cast<unsigned short>(configurationNode.audioUnits.size());
+			view->stream_inputs_count = static_cast<unsigned short>(configurationNode.streamInputs.size());
+			view->stream_outputs_count = static_cast<unsigned short>(configurationNode.streamOutputs.size());
+		});
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getAudioUnitView(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const audioUnitIndex, avdecc_controller_audio_unit_view_p const view)
+{
+	if (view == nullptr)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_parameters);
+	}
+
+	return withGuardedEntity(guardHandle,
+		[audioUnitIndex, view](la::avdecc::controller::ControlledEntity const& entity)
+		{
+			auto const& node = entity.getAudioUnitNode(entity.getCurrentConfigurationIndex(), audioUnitIndex);
+			view->object_name = make_string_view(node.dynamicModel.objectName);
+			view->clock_domain_index = node.staticModel.clockDomainIndex;
+			view->number_of_stream_input_ports = node.staticModel.numberOfStreamInputPorts;
+			view->base_stream_input_port = node.staticModel.baseStreamInputPort;
+			view->number_of_stream_output_ports = node.staticModel.numberOfStreamOutputPorts;
+			view->base_stream_output_port = node.staticModel.baseStreamOutputPort;
+			view->current_sampling_rate = node.dynamicModel.currentSamplingRate.getValue();
+			view->sampling_rates = reinterpret_cast<avdecc_entity_model_sampling_rate_t const*>(node.staticModel.samplingRates.begin()); // FlatSet iterators are pointers to its contiguous storage
+			view->sampling_rates_count = node.staticModel.samplingRates.size();
+		});
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getStreamInputView(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const streamIndex, avdecc_controller_stream_view_p const view)
+{
+	if (view == nullptr)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_parameters);
+	}
+
+	return withGuardedEntity(guardHandle,
+		[streamIndex, view](la::avdecc::controller::ControlledEntity const& entity)
+		{
+			auto const& node = entity.getStreamInputNode(entity.getCurrentConfigurationIndex(), streamIndex);
+			fill_stream_view(node, node.dynamicModel, *view);
+			auto const& connectionInfo = node.dynamicModel.connectionInfo;
+			view->connection_state = static_cast<avdecc_controller_stream_input_connection_state_t>(connectionInfo.state);
+			if (connectionInfo.state != la::avdecc::entity::model::StreamInputConnectionInfo::State::NotConnected)
+			{
+				view->connected_talker = avdecc_entity_model_stream_identification_t{ connectionInfo.talkerStream.entityID, connectionInfo.talkerStream.streamIndex };
+			}
+		});
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getStreamOutputView(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const streamIndex, avdecc_controller_stream_view_p const view)
+{
+	if (view == nullptr)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_parameters);
+	}
+
+	return withGuardedEntity(guardHandle,
+		[streamIndex, view](la::avdecc::controller::ControlledEntity const& entity)
+		{
+			auto const& node = entity.getStreamOutputNode(entity.getCurrentConfigurationIndex(), streamIndex);
+			fill_stream_view(node, node.dynamicModel, *view);
+		});
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getStreamPortInputAudioMappings(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const streamPortIndex, avdecc_entity_model_audio_mapping_cp* const mappings, size_t* const mappingsCount)
+{
+	if (mappings == nullptr || mappingsCount == nullptr)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_parameters);
+	}
+
+	return withGuardedEntity(guardHandle,
+		[streamPortIndex, mappings, mappingsCount](la::avdecc::controller::ControlledEntity const& entity)
+		{
+			auto const& audioMap = entity.getStreamPortInputNode(entity.getCurrentConfigurationIndex(), streamPortIndex).dynamicModel.dynamicAudioMap;
+			*mappings = reinterpret_cast<avdecc_entity_model_audio_mapping_cp>(audioMap.data());
+			*mappingsCount = audioMap.size();
+		});
+}
+
+LA_AVDECC_BINDINGS_C_API avdecc_controller_error_t LA_AVDECC_BINDINGS_C_CALL_CONVENTION LA_AVDECC_ControlledEntityGuard_getStreamPortOutputAudioMappings(LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE const guardHandle, avdecc_entity_model_descriptor_index_t const streamPortIndex, avdecc_entity_model_audio_mapping_cp* const mappings, size_t* const mappingsCount)
+{
+	if (mappings == nullptr || mappingsCount == nullptr)
+	{
+		return static_cast<avdecc_controller_error_t>(avdecc_controller_error_invalid_parameters);
+	}
+
+	return withGuardedEntity(guardHandle,
+		[streamPortIndex, mappings, mappingsCount](la::avdecc::controller::ControlledEntity const& entity)
+		{
+			auto const& audioMap = entity.getStreamPortOutputNode(entity.getCurrentConfigurationIndex(), streamPortIndex).dynamicModel.dynamicAudioMap;
+			*mappings = reinterpret_cast<avdecc_entity_model_audio_mapping_cp>(audioMap.data());
+			*mappingsCount = audioMap.size();
+		});
+}
@@ -86,29 +86,11 @@ private:
 	/* **** AECP notifications **** */
 	virtual void onAecpCommand(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
 	{
-		static auto const s_Dispatch = std::unordered_map<la::avdecc::protocol::AecpMessageType, std::function<void(Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu)>, la::avdecc::protocol::AecpMessageType::Hash>{
-			{ la::avdecc::protocol::AecpMessageType::AemCommand,
-				[](Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu)
-				{
-					auto aecp = la::avdecc::bindings::fromCppToC::make_aem_aecpdu(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu));
-					la::avdecc::utils::invokeProtectedHandler(obs->_observer->onAecpAemCommand, obs->_handle, &aecp);
-				} },
-			{ la::avdecc::protocol::AecpMessageType::AddressAccessCommand,
-				[](Observer* const /*obs*/, la::avdecc::protocol::Aecpdu const& /*aecpdu*/)
-				{
-					//
-				} },
-			{ la::avdecc::protocol::AecpMessageType::VendorUniqueResponse,
-				[](Observer* const /*obs*/, la::avdecc::protocol::Aecpdu const& /*aecpdu*/)
-				{
-					//
-				} },
-		};
-
-		auto const& it = s_Dispatch.find(aecpdu.getMessageType());
-		if (it != s_Dispatch.end())
+		// Only AEM commands are forwarded (AddressAccess and VendorUnique are not supported by the bindings yet)
+		if (aecpdu.getMessageType() == la::avdecc::protocol::AecpMessageType::AemCommand)
 		{
-			it->second(this, aecpdu);
+			auto aecp = la::avdecc::bindings::fromCppToC::make_aem_aecpdu(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu));
+			la::avdecc::utils::invokeProtectedHandler(_observer->onAecpAemCommand, _handle, &aecp);
 		}
 	}
 	virtual void onAecpAemUnsolicitedResponse(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::AemAecpdu const& aecpdu) noexcept override
@@ -142,29 +124,16 @@ private:
 	}
 	virtual void onAecpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
 	{
-		static auto const s_Dispatch = std::unordered_map<la::avdecc::protocol::AecpMessageType, std::function<void(Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu)>, la::avdecc::protocol::AecpMessageType::Hash>{
-			{ la::avdecc::protocol::AecpMessageType::AemCommand,
-				[](Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu)
-				{
-					auto aecp = la::avdecc::bindings::fromCppToC::make_aem_aecpdu(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu));
-					la::avdecc::utils::invokeProtectedHandler(obs->_observer->onAemAecpduReceived, obs->_handle, &aecp);
-				} },
-			{ la::avdecc::protocol::AecpMessageType::AddressAccessCommand,
-				[](Observer* const /*obs*/, la::avdecc::protocol::Aecpdu const& /*aecpdu*/)
-				{
-					//
-				} },
-			{ la::avdecc::protocol::AecpMessageType::VendorUniqueResponse,
-				[](Observer* const obs, la::avdecc::protocol::Aecpdu const& /*aecpdu*/)
-				{
-					la::avdecc::utils::invokeProtectedHandler(obs->_observer->onMvuAecpduReceived, obs->_handle, nullptr); // TODO: Create correct VU
-				} },
-		};
-
-		auto const& it = s_Dispatch.find(aecpdu.getMessageType());
-		if (it != s_Dispatch.end())
+		// AddressAccess messages are not supported by the bindings yet
+		auto const messageType = aecpdu.getMessageType();
+		if (messageType == la::avdecc::protocol::AecpMessageType::AemCommand)
+		{
+			auto aecp = la::avdecc::bindings::fromCppToC::make_aem_aecpdu(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu));
+			la::avdecc::utils::invokeProtectedHandler(_observer->onAemAecpduReceived, _handle, &aecp);
+		}
+		else if (messageType == la::avdecc::protocol::AecpMessageType::VendorUniqueResponse)
 		{
-			it->second(this, aecpdu);
+			la::avdecc::utils::invokeProtectedHandler(_observer->onMvuAecpduReceived, _handle, nullptr); // TODO: Create correct VU
 		}
 	}
 	virtual void onAcmpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Acmpdu const& acmpdu) noexcept override
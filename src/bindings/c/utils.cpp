@@ -547,7 +547,7 @@ avdecc_entity_model_audio_unit_descriptor_t make_audio_unit_descriptor(entity::m
 	return d;
 }
 
-std::vector<avdecc_entity_model_sampling_rate_t> make_sampling_rates(std::set<entity::model::SamplingRate> const& samplingRates) noexcept
+std::vector<avdecc_entity_model_sampling_rate_t> make_sampling_rates(entity::model::SamplingRates const& samplingRates) noexcept
 {
 	auto rates = std::vector<avdecc_entity_model_sampling_rate_t>{};
 
@@ -601,7 +601,7 @@ avdecc_entity_model_stream_descriptor_t make_stream_descriptor(entity::model::St
 	return d;
 }
 
-std::vector<avdecc_entity_model_stream_format_t> make_stream_formats(std::set<entity::model::StreamFormat> const& streamFormats) noexcept
+std::vector<avdecc_entity_model_stream_format_t> make_stream_formats(entity::model::StreamFormats const& streamFormats) noexcept
 {
 	auto formats = std::vector<avdecc_entity_model_stream_format_t>{};
 
@@ -628,7 +628,7 @@ std::vector<avdecc_entity_model_stream_format_t*> make_stream_formats_pointer(st
 	return formats;
 }
 
-std::vector<avdecc_entity_model_descriptor_index_t> make_redundant_stream_indexes(std::set<entity::model::StreamIndex> const& streamIndexes) noexcept
+std::vector<avdecc_entity_model_descriptor_index_t> make_redundant_stream_indexes(entity::model::RedundantStreams const& streamIndexes) noexcept
 {
 	auto indexes = std::vector<avdecc_entity_model_descriptor_index_t>{};
 
@@ -141,12 +141,12 @@ avdecc_entity_model_configuration_descriptor_t make_configuration_descriptor(ent
 std::vector<avdecc_entity_model_descriptors_count_t> make_descriptors_count(std::unordered_map<entity::model::DescriptorType, std::uint16_t, utils::EnumClassHash> const& counts) noexcept;
 std::vector<avdecc_entity_model_descriptors_count_p> make_descriptors_count_pointer(std::vector<avdecc_entity_model_descriptors_count_t>& counts) noexcept;
 avdecc_entity_model_audio_unit_descriptor_t make_audio_unit_descriptor(entity::model::AudioUnitDescriptor const& descriptor) noexcept;
-std::vector<avdecc_entity_model_sampling_rate_t> make_sampling_rates(std::set<entity::model::SamplingRate> const& samplingRates) noexcept;
+std::vector<avdecc_entity_model_sampling_rate_t> make_sampling_rates(entity::model::SamplingRates const& samplingRates) noexcept;
 std::vector<avdecc_entity_model_sampling_rate_t*> make_sampling_rates_pointer(std::vector<avdecc_entity_model_sampling_rate_t>& samplingRates) noexcept;
 avdecc_entity_model_stream_descriptor_t make_stream_descriptor(entity::model::StreamDescriptor const& descriptor) noexcept;
-std::vector<avdecc_entity_model_stream_format_t> make_stream_formats(std::set<entity::model::StreamFormat> const& streamFormats) noexcept;
+std::vector<avdecc_entity_model_stream_format_t> make_stream_formats(entity::model::StreamFormats const& streamFormats) noexcept;
 std::vector<avdecc_entity_model_stream_format_t*> make_stream_formats_pointer(std::vector<avdecc_entity_model_stream_format_t>& streamFormats) noexcept;
-std::vector<avdecc_entity_model_descriptor_index_t> make_redundant_stream_indexes(std::set<entity::model::StreamIndex> const& streamIndexes) noexcept;
+std::vector<avdecc_entity_model_descriptor_index_t> make_redundant_stream_indexes(entity::model::RedundantStreams const& streamIndexes) noexcept;
 std::vector<avdecc_entity_model_descriptor_index_t*> make_redundant_stream_indexes_pointer(std::vector<avdecc_entity_model_descriptor_index_t>& streamIndexes) noexcept;
 avdecc_entity_model_jack_descriptor_t make_jack_descriptor(entity::model::JackDescriptor const& descriptor) noexcept;
 avdecc_entity_model_avb_interface_descriptor_t make_avb_interface_descriptor(entity::model::AvbInterfaceDescriptor const& descriptor) noexcept;
@@ -0,0 +1,110 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccBatchCommandsContext.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/controller/avdeccController.hpp"
+
+#include <la/avdecc/utils.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Shared bookkeeping of a batch of commands.
+* @details Collects the result of each command of the batch and calls the completion handler once, when the last result is set. Thread-safe.
+*/
+class BatchCommandsContext final
+{
+public:
+	using SharedPointer = std::shared_ptr<BatchCommandsContext>;
+
+	BatchCommandsContext(std::size_t const commandsCount, Controller::BatchCommandsHandler const& handler) noexcept
+		: _results(commandsCount)
+		, _remaining{ commandsCount }
+		, _handler{ handler }
+	{
+	}
+
+	void setAemResult(std::size_t const commandIndex, entity::ControllerEntity::AemCommandStatus const status) noexcept
+	{
+		auto result = Controller::BatchCommandResult{};
+		result.aemStatus = status;
+		setResult(commandIndex, result);
+	}
+
+	void setControlResult(std::size_t const commandIndex, entity::ControllerEntity::ControlStatus const status) noexcept
+	{
+		auto result = Controller::BatchCommandResult{};
+		result.controlStatus = status;
+		setResult(commandIndex, result);
+	}
+
+	/** Sets the result of a command, calling the handler (without holding the lock) once all the commands have a result */
+	void setResult(std::size_t const commandIndex, Controller::BatchCommandResult const& result) noexcept
+	{
+		auto isComplete = false;
+		{
+			auto const lg = std::lock_guard{ _lock };
+
+			_results[commandIndex] = result;
+			if (!result.isSuccess())
+			{
+				++_failedCount;
+			}
+			--_remaining;
+			isComplete = _remaining == 0u;
+		}
+
+		// Results are no longer modified once complete, the handler can be called without the lock
+		if (isComplete)
+		{
+			utils::invokeProtectedHandler(_handler, _results, _failedCount);
+		}
+	}
+
+	// Deleted compiler auto-generated methods
+	BatchCommandsContext(BatchCommandsContext&&) = delete;
+	BatchCommandsContext(BatchCommandsContext const&) = delete;
+	BatchCommandsContext& operator=(BatchCommandsContext const&) = delete;
+	BatchCommandsContext& operator=(BatchCommandsContext&&) = delete;
+
+private:
+	std::mutex _lock{};
+	Controller::BatchCommandResults _results{};
+	std::size_t _remaining{ 0u };
+	std::size_t _failedCount{ 0u };
+	Controller::BatchCommandsHandler _handler{};
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,344 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccControlValuesStreams.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/controller/avdeccController.hpp"
+
+#include <la/avdecc/internals/entityModelTypes.hpp>
+#include <la/avdecc/internals/serialization.hpp>
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+#include <la/avdecc/memoryBuffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Subscription to the values of a control, storing the samples in a lock-free single-producer/single-consumer ring.
+* @details push is only called by the producer (the networking thread), pop by the consumer.
+*/
+class ControlValuesSubscriptionImpl final : public Controller::ControlValuesSubscription
+{
+public:
+	ControlValuesSubscriptionImpl(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex, std::uint16_t const decimation, std::uint16_t const ringCapacity)
+		: _entityID{ entityID }
+		, _controlIndex{ controlIndex }
+		, _decimation{ std::max(decimation, std::uint16_t{ 1u }) }
+		, _ring(roundUpToPowerOf2(ringCapacity))
+	{
+	}
+
+	virtual UniqueIdentifier getEntityID() const noexcept override
+	{
+		return _entityID;
+	}
+
+	virtual entity::model::ControlIndex getControlIndex() const noexcept override
+	{
+		return _controlIndex;
+	}
+
+	virtual bool pop(Sample& sample) noexcept override
+	{
+		auto const head = _head.load(std::memory_order_relaxed);
+		if (head == _tail.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+		sample = _ring[head & (_ring.size() - 1u)];
+		_head.store(head + 1u, std::memory_order_release);
+		return true;
+	}
+
+	virtual std::uint64_t getDroppedSamplesCount() const noexcept override
+	{
+		return _droppedSamples.load(std::memory_order_relaxed);
+	}
+
+	/** Pushes a new sample (producer side), unless it is skipped by the decimation. Returns false if the ring is full. */
+	bool push(Sample const& sample) noexcept
+	{
+		// Decimation
+		if (++_decimationCounter < _decimation)
+		{
+			return true;
+		}
+		_decimationCounter = 0u;
+
+		auto const tail = _tail.load(std::memory_order_relaxed);
+		if (tail - _head.load(std::memory_order_acquire) == _ring.size())
+		{
+			_droppedSamples.fetch_add(1u, std::memory_order_relaxed);
+			return false;
+		}
+		_ring[tail & (_ring.size() - 1u)] = sample;
+		_tail.store(tail + 1u, std::memory_order_release);
+		return true;
+	}
+
+private:
+	static std::size_t roundUpToPowerOf2(std::uint16_t const value) noexcept
+	{
+		auto result = std::size_t{ 1u };
+		while (result < value)
+		{
+			result <<= 1;
+		}
+		return result;
+	}
+
+	UniqueIdentifier const _entityID{};
+	entity::model::ControlIndex const _controlIndex{ 0u };
+	std::uint16_t const _decimation{ 1u };
+	std::uint16_t _decimationCounter{ 0u }; // Only accessed by the producer
+	std::vector<Sample> _ring{};
+	std::atomic<std::size_t> _head{ 0u }; // Next sample to pop, written by the consumer
+	std::atomic<std::size_t> _tail{ 0u }; // Next sample to push, written by the producer
+	std::atomic<std::uint64_t> _droppedSamples{ 0u };
+};
+
+/**
+* @brief Registry of the control values subscriptions of all entities.
+* @details Subscriptions can be added and removed from any thread, samples are decoded and dispatched from the networking thread. Thread-safe.
+*          Modifications are made on a copy of the streams which is then published, so dispatching never waits for (nor takes) the registry lock.
+*/
+class ControlValuesStreams final
+{
+public:
+	using SubscriptionPointer = std::shared_ptr<ControlValuesSubscriptionImpl>;
+
+	/** Returns true if the values of the specified type can be streamed (numeric LINEAR and ARRAY values) */
+	static constexpr bool isStreamable(entity::model::ControlValueType::Type const valueType) noexcept
+	{
+		return (valueType >= entity::model::ControlValueType::Type::ControlLinearInt8 && valueType <= entity::model::ControlValueType::Type::ControlLinearDouble) || (valueType >= entity::model::ControlValueType::Type::ControlArrayInt8 && valueType <= entity::model::ControlValueType::Type::ControlArrayDouble);
+	}
+
+	void addSubscription(SubscriptionPointer const& subscription, entity::model::ControlValueType::Type const valueType, std::uint16_t const numberOfValues)
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto streams = copyStreams();
+		auto& stream = streams[Key{ subscription->getEntityID(), subscription->getControlIndex() }];
+		stream.valueType = valueType;
+		stream.numberOfValues = numberOfValues;
+		stream.subscriptions.push_back(subscription);
+		publishStreams(std::move(streams));
+	}
+
+	void removeSubscription(Controller::ControlValuesSubscription const* const subscription) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto streams = copyStreams();
+		if (auto const it = streams.find(Key{ subscription->getEntityID(), subscription->getControlIndex() }); it != streams.end())
+		{
+			auto& subscriptions = it->second.subscriptions;
+			subscriptions.erase(std::remove_if(subscriptions.begin(), subscriptions.end(),
+														[subscription](auto const& s)
+														{
+															return s.get() == subscription;
+														}),
+				subscriptions.end());
+			if (subscriptions.empty())
+			{
+				streams.erase(it);
+			}
+			publishStreams(std::move(streams));
+		}
+	}
+
+	/** Drops all the subscriptions of the specified entity (its model is no longer valid, the value types and number of values they were created with might have changed) */
+	void removeEntity(UniqueIdentifier const entityID) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto streams = copyStreams();
+		auto const first = streams.lower_bound(Key{ entityID, 0u });
+		auto last = first;
+		while (last != streams.end() && last->first.entityID == entityID)
+		{
+			++last;
+		}
+		if (first != last)
+		{
+			streams.erase(first, last);
+			publishStreams(std::move(streams));
+		}
+	}
+
+	/** Decodes the values and pushes them to all the subscriptions of the control. Returns false if the control has no subscription (or if the values cannot be decoded), in which case the caller should process them normally. */
+	bool dispatch(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex, MemoryBuffer const& packedControlValues) noexcept
+	{
+		// Fast path when nobody is streaming
+		if (!_hasSubscriptions.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		// Take a reference on the currently published streams, they are never modified once published
+		auto const streams = std::atomic_load_explicit(&_streams, std::memory_order_acquire);
+		if (!streams)
+		{
+			return false;
+		}
+
+		auto const it = streams->find(Key{ entityID, controlIndex });
+		if (it == streams->end())
+		{
+			return false;
+		}
+
+		auto const& stream = it->second;
+		auto sample = Controller::ControlValuesSubscription::Sample{};
+		if (!decodeValues(stream.valueType, stream.numberOfValues, packedControlValues, sample))
+		{
+			return false;
+		}
+		sample.timestamp = std::chrono::steady_clock::now();
+		for (auto const& subscription : stream.subscriptions)
+		{
+			subscription->push(sample);
+		}
+		return true;
+	}
+
+	/** Decodes the packed dynamic values of a streamable control into the sample */
+	static bool decodeValues(entity::model::ControlValueType::Type const valueType, std::uint16_t const numberOfValues, MemoryBuffer const& packedControlValues, Controller::ControlValuesSubscription::Sample& sample) noexcept
+	{
+		switch (valueType)
+		{
+			case entity::model::ControlValueType::Type::ControlLinearInt8:
+			case entity::model::ControlValueType::Type::ControlArrayInt8:
+				return decodeValues<std::int8_t>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearUInt8:
+			case entity::model::ControlValueType::Type::ControlArrayUInt8:
+				return decodeValues<std::uint8_t>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearInt16:
+			case entity::model::ControlValueType::Type::ControlArrayInt16:
+				return decodeValues<std::int16_t>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearUInt16:
+			case entity::model::ControlValueType::Type::ControlArrayUInt16:
+				return decodeValues<std::uint16_t>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearInt32:
+			case entity::model::ControlValueType::Type::ControlArrayInt32:
+				return decodeValues<std::int32_t>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearUInt32:
+			case entity::model::ControlValueType::Type::ControlArrayUInt32:
+				return decodeValues<std::uint32_t>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearInt64:
+			case entity::model::ControlValueType::Type::ControlArrayInt64:
+				return decodeValues<std::int64_t>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearUInt64:
+			case entity::model::ControlValueType::Type::ControlArrayUInt64:
+				return decodeValues<std::uint64_t>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearFloat:
+			case entity::model::ControlValueType::Type::ControlArrayFloat:
+				return decodeValues<float>(numberOfValues, packedControlValues, sample);
+			case entity::model::ControlValueType::Type::ControlLinearDouble:
+			case entity::model::ControlValueType::Type::ControlArrayDouble:
+				return decodeValues<double>(numberOfValues, packedControlValues, sample);
+			default:
+				return false;
+		}
+	}
+
+private:
+	struct Key
+	{
+		UniqueIdentifier entityID{};
+		entity::model::ControlIndex controlIndex{ 0u };
+
+		bool operator<(Key const& other) const noexcept
+		{
+			return (entityID.getValue() < other.entityID.getValue()) || (entityID == other.entityID && controlIndex < other.controlIndex);
+		}
+	};
+
+	struct Stream
+	{
+		entity::model::ControlValueType::Type valueType{ entity::model::ControlValueType::Type::Expansion };
+		std::uint16_t numberOfValues{ 0u };
+		std::vector<SubscriptionPointer> subscriptions{};
+	};
+
+	using Streams = std::map<Key, Stream>;
+
+	/** Returns a modifiable copy of the published streams. _lock must be held */
+	Streams copyStreams() const
+	{
+		if (auto const streams = std::atomic_load_explicit(&_streams, std::memory_order_relaxed))
+		{
+			return *streams;
+		}
+		return {};
+	}
+
+	/** Publishes the new streams for the networking thread. _lock must be held */
+	void publishStreams(Streams&& streams) noexcept
+	{
+		auto const hasSubscriptions = !streams.empty();
+		std::atomic_store_explicit(&_streams, hasSubscriptions ? std::make_shared<Streams const>(std::move(streams)) : std::shared_ptr<Streams const>{}, std::memory_order_release);
+		_hasSubscriptions.store(hasSubscriptions, std::memory_order_release);
+	}
+
+	template<typename ValueType>
+	static bool decodeValues(std::uint16_t const numberOfValues, MemoryBuffer const& packedControlValues, Controller::ControlValuesSubscription::Sample& sample) noexcept
+	{
+		// Linear and Array dynamic values are both packed as numberOfValues consecutive values
+		if (packedControlValues.size() < numberOfValues * sizeof(ValueType))
+		{
+			return false;
+		}
+		auto des = Deserializer{ packedControlValues.data(), packedControlValues.size() };
+		auto const count = std::min(numberOfValues, static_cast<std::uint16_t>(Controller::ControlValuesSubscription::MaxValues));
+		for (auto i = std::uint16_t{ 0u }; i < count; ++i)
+		{
+			auto value = ValueType{};
+			des >> value;
+			sample.values[i] = static_cast<double>(value);
+		}
+		sample.valuesCount = count;
+		return true;
+	}
+
+	std::mutex _lock{}; // Serializes the modifications, never held while calling user code nor while dispatching
+	std::atomic_bool _hasSubscriptions{ false };
+	std::shared_ptr<Streams const> _streams{}; // Published streams, only accessed through std::atomic_load/std::atomic_store
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
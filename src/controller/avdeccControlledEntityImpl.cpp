@@ -57,6 +57,11 @@ static constexpr std::uint16_t MaxQueryDescriptorDynamicInfoRetryCount = 2;
 static constexpr std::uint16_t QueryRetryMillisecondDelay = 500;
 static entity::model::AvdeccFixedString s_noLocalizationString{};
 
+static inline ControlledEntityImpl::DescriptorKey makeDescriptorKey(entity::model::DescriptorType descriptorType, entity::model::DescriptorIndex descriptorIndex)
+{
+	return (utils::to_integral(descriptorType) << (sizeof(descriptorIndex) * 8)) + descriptorIndex;
+}
+
 /** Returns the common part of the two strings, with excess spaces removed. */
 static std::string getCommonString(std::string const& lhs, std::string const& rhs) noexcept
 {
@@ -97,6 +102,61 @@ ControlledEntityImpl::ControlledEntityImpl(entity::Entity const& entity, LockInf
 	_treeModelAccess = std::make_unique<TreeModelAccessTraverseStrategy>(this);
 }
 
+ControlledEntityImpl::ControlledEntityImpl(ControlledEntityImpl const& source, std::shared_ptr<model::EntityNode const> const& entityNode, LockInformation::SharedPointer const& sharedLock) noexcept
+	: _sharedLock(sharedLock)
+	, _isVirtual(source._isVirtual)
+	, _identifyControlIndex(source._identifyControlIndex)
+	, _compatibilityFlags(source._compatibilityFlags)
+	, _isMilanRedundant(source._isMilanRedundant)
+	, _gotFatalEnumerateError(source._gotFatalEnumerateError)
+	, _isGetDynamicInfoSupported(source._isGetDynamicInfoSupported)
+	, _isSubscribedToUnsolicitedNotifications(source._isSubscribedToUnsolicitedNotifications)
+	, _areUnsolicitedNotificationsSupported(source._areUnsolicitedNotificationsSupported)
+	, _advertised(source._advertised)
+	, _avbInterfaceLinkStatus(source._avbInterfaceLinkStatus)
+	, _acquireState(source._acquireState)
+	, _owningControllerID(source._owningControllerID)
+	, _lockState(source._lockState)
+	, _lockingControllerID(source._lockingControllerID)
+	, _milanInfo(source._milanInfo)
+	, _entity(source._entity)
+	, _sharedEntityNode(entityNode)
+	, _redundantPrimaryStreamInputs(source._redundantPrimaryStreamInputs)
+	, _redundantPrimaryStreamOutputs(source._redundantPrimaryStreamOutputs)
+	, _redundantSecondaryStreamInputs(source._redundantSecondaryStreamInputs)
+	, _redundantSecondaryStreamOutputs(source._redundantSecondaryStreamOutputs)
+	, _aecpRetryCounter(source._aecpRetryCounter)
+	, _aecpTimeoutCounter(source._aecpTimeoutCounter)
+	, _aecpUnexpectedResponseCounter(source._aecpUnexpectedResponseCounter)
+	, _aecpResponsesCount(source._aecpResponsesCount)
+	, _aecpResponseTimeSum(source._aecpResponseTimeSum)
+	, _aecpResponseAverageTime(source._aecpResponseAverageTime)
+	, _aemAecpUnsolicitedCounter(source._aemAecpUnsolicitedCounter)
+	, _aemAecpUnsolicitedLossCounter(source._aemAecpUnsolicitedLossCounter)
+	, _enumerationTime(source._enumerationTime)
+	, _diagnostics(source._diagnostics)
+{
+	AVDECC_ASSERT(source._sharedLock->_lockedCount > 0, "ControlledEntity should be locked");
+
+	// Always traverse the shared tree (the cached strategy of the source references its own tree)
+	_treeModelAccess = std::make_unique<TreeModelAccessTraverseStrategy>(this);
+}
+
+std::shared_ptr<ControlledEntityImpl> ControlledEntityImpl::createSnapshot() noexcept
+{
+	AVDECC_ASSERT(_sharedLock->_lockedCount > 0, "ControlledEntity should be locked");
+
+	// Only copy the model if it was modified since the previous snapshot, otherwise share the immutable copy with it
+	if (!_snapshotEntityNode || _isEntityNodeModified)
+	{
+		_snapshotEntityNode = std::make_shared<model::EntityNode const>(_entityNode);
+		_isEntityNodeModified = false;
+	}
+
+	// The snapshot has its own lock, it is never modified so it never contends with the shared lock of the live entities
+	return std::make_shared<ControlledEntityImpl>(*this, _snapshotEntityNode, std::make_shared<LockInformation>());
+}
+
 // ControlledEntity overrides
 // Getters
 bool ControlledEntityImpl::isVirtual() const noexcept
@@ -237,12 +297,13 @@ std::optional<entity::model::ControlIndex> ControlledEntityImpl::getIdentifyCont
 
 bool ControlledEntityImpl::isEntityModelValidForCaching() const noexcept
 {
-	if (_gotFatalEnumerateError || _entityNode.configurations.empty())
+	auto const& entityNode = getRootEntityNode();
+	if (_gotFatalEnumerateError || entityNode.configurations.empty())
 	{
 		return false;
 	}
 
-	return std::get<0>(isEntityModelComplete(_entityNode, static_cast<std::uint16_t>(_entityNode.configurations.size())));
+	return std::get<0>(isEntityModelComplete(entityNode, static_cast<std::uint16_t>(entityNode.configurations.size())));
 }
 
 bool ControlledEntityImpl::isIdentifying() const noexcept
@@ -266,7 +327,7 @@ bool ControlledEntityImpl::isIdentifying() const noexcept
 
 					if (values.size() == 1)
 					{
-						auto const dynamicValues = values.getValues<entity::model::LinearValues<entity::model::LinearValueDynamic<std::uint8_t>>>(); // We have to store the copy or it will go out of scope
+						auto const& dynamicValues = values.getValues<entity::model::LinearValues<entity::model::LinearValueDynamic<std::uint8_t>>>();
 						auto const& value = dynamicValues.getValues()[0];
 						if (value.currentValue == 0)
 						{
@@ -294,7 +355,7 @@ bool ControlledEntityImpl::isIdentifying() const noexcept
 
 bool ControlledEntityImpl::hasAnyConfiguration() const noexcept
 {
-	return !_entityNode.configurations.empty();
+	return !getRootEntityNode().configurations.empty();
 }
 
 entity::model::ConfigurationIndex ControlledEntityImpl::getCurrentConfigurationIndex() const
@@ -651,6 +712,22 @@ std::chrono::milliseconds const& ControlledEntityImpl::getEnumerationTime() cons
 	return _enumerationTime;
 }
 
+// Counters history
+std::optional<ControlledEntity::CounterHistoryStatistics> ControlledEntityImpl::getAvbInterfaceCounterHistoryStatistics(entity::model::AvbInterfaceIndex const avbInterfaceIndex, entity::AvbInterfaceCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept
+{
+	return getCounterHistoryStatistics(entity::model::DescriptorType::AvbInterface, avbInterfaceIndex, utils::to_integral(counter), window);
+}
+
+std::optional<ControlledEntity::CounterHistoryStatistics> ControlledEntityImpl::getStreamInputCounterHistoryStatistics(entity::model::StreamIndex const streamIndex, entity::StreamInputCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept
+{
+	return getCounterHistoryStatistics(entity::model::DescriptorType::StreamInput, streamIndex, utils::to_integral(counter), window);
+}
+
+std::optional<ControlledEntity::CounterHistoryStatistics> ControlledEntityImpl::getStreamOutputCounterHistoryStatistics(entity::model::StreamIndex const streamIndex, entity::StreamOutputCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept
+{
+	return getCounterHistoryStatistics(entity::model::DescriptorType::StreamOutput, streamIndex, utils::to_integral(counter), window);
+}
+
 // Diagnostics
 ControlledEntity::Diagnostics const& ControlledEntityImpl::getDiagnostics() const noexcept
 {
@@ -988,13 +1065,15 @@ void ControlledEntityImpl::unlock() noexcept
 
 TreeModelAccessStrategy& ControlledEntityImpl::getModelAccessStrategy() noexcept
 {
+	// The model might be modified through the returned strategy, the next snapshot will have to copy it
+	_isEntityNodeModified = true;
 	return *_treeModelAccess;
 }
 
 // Non-const Node getters
 model::EntityNode* ControlledEntityImpl::getEntityNode(TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	return _treeModelAccess->getEntityNode(notFoundBehavior);
+	return getModelAccessStrategy().getEntityNode(notFoundBehavior);
 }
 
 std::optional<entity::model::ConfigurationIndex> ControlledEntityImpl::getCurrentConfigurationIndex(TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
@@ -1019,12 +1098,12 @@ model::ConfigurationNode* ControlledEntityImpl::getCurrentConfigurationNode(Tree
 
 model::ConfigurationNode* ControlledEntityImpl::getConfigurationNode(entity::model::ConfigurationIndex const configurationIndex, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	return _treeModelAccess->getConfigurationNode(configurationIndex, notFoundBehavior);
+	return getModelAccessStrategy().getConfigurationNode(configurationIndex, notFoundBehavior);
 }
 
 entity::model::EntityCounters* ControlledEntityImpl::getEntityCounters(TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	auto* const dynamicModel = _treeModelAccess->getEntityNodeDynamicModel(notFoundBehavior);
+	auto* const dynamicModel = getModelAccessStrategy().getEntityNodeDynamicModel(notFoundBehavior);
 	if (dynamicModel)
 	{
 		// Create counters if they don't exist yet
@@ -1042,7 +1121,7 @@ entity::model::AvbInterfaceCounters* ControlledEntityImpl::getAvbInterfaceCounte
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getAvbInterfaceNodeDynamicModel(*currentConfigurationIndexOpt, avbInterfaceIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getAvbInterfaceNodeDynamicModel(*currentConfigurationIndexOpt, avbInterfaceIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			// Create counters if they don't exist yet
@@ -1061,7 +1140,7 @@ entity::model::ClockDomainCounters* ControlledEntityImpl::getClockDomainCounters
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getClockDomainNodeDynamicModel(*currentConfigurationIndexOpt, clockDomainIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getClockDomainNodeDynamicModel(*currentConfigurationIndexOpt, clockDomainIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			// Create counters if they don't exist yet
@@ -1080,7 +1159,7 @@ entity::model::StreamInputCounters* ControlledEntityImpl::getStreamInputCounters
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamInputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamInputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			// Create counters if they don't exist yet
@@ -1099,7 +1178,7 @@ entity::model::StreamOutputCounters* ControlledEntityImpl::getStreamOutputCounte
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			// Create counters if they don't exist yet
@@ -1116,7 +1195,7 @@ entity::model::StreamOutputCounters* ControlledEntityImpl::getStreamOutputCounte
 // Setters of the DescriptorDynamic info, default constructing if not existing
 void ControlledEntityImpl::setEntityName(entity::model::AvdeccFixedString const& name, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	auto* const dynamicModel = _treeModelAccess->getEntityNodeDynamicModel(notFoundBehavior);
+	auto* const dynamicModel = getModelAccessStrategy().getEntityNodeDynamicModel(notFoundBehavior);
 	if (dynamicModel)
 	{
 		dynamicModel->entityName = name;
@@ -1125,7 +1204,7 @@ void ControlledEntityImpl::setEntityName(entity::model::AvdeccFixedString const&
 
 void ControlledEntityImpl::setEntityGroupName(entity::model::AvdeccFixedString const& name, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	auto* const dynamicModel = _treeModelAccess->getEntityNodeDynamicModel(notFoundBehavior);
+	auto* const dynamicModel = getModelAccessStrategy().getEntityNodeDynamicModel(notFoundBehavior);
 	if (dynamicModel)
 	{
 		dynamicModel->groupName = name;
@@ -1134,7 +1213,7 @@ void ControlledEntityImpl::setEntityGroupName(entity::model::AvdeccFixedString c
 
 void ControlledEntityImpl::setCurrentConfiguration(entity::model::ConfigurationIndex const configurationIndex, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	auto* const entityNode = _treeModelAccess->getEntityNode(notFoundBehavior);
+	auto* const entityNode = getModelAccessStrategy().getEntityNode(notFoundBehavior);
 	if (entityNode)
 	{
 		if (entityNode->dynamicModel.currentConfiguration != configurationIndex)
@@ -1152,7 +1231,7 @@ void ControlledEntityImpl::setCurrentConfiguration(entity::model::ConfigurationI
 
 void ControlledEntityImpl::setConfigurationName(entity::model::ConfigurationIndex const configurationIndex, entity::model::AvdeccFixedString const& name, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	auto* const dynamicModel = _treeModelAccess->getConfigurationNodeDynamicModel(configurationIndex, notFoundBehavior);
+	auto* const dynamicModel = getModelAccessStrategy().getConfigurationNodeDynamicModel(configurationIndex, notFoundBehavior);
 	if (dynamicModel)
 	{
 		dynamicModel->objectName = name;
@@ -1164,7 +1243,7 @@ void ControlledEntityImpl::setSamplingRate(entity::model::AudioUnitIndex const a
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getAudioUnitNodeDynamicModel(*currentConfigurationIndexOpt, audioUnitIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getAudioUnitNodeDynamicModel(*currentConfigurationIndexOpt, audioUnitIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			dynamicModel->currentSamplingRate = samplingRate;
@@ -1177,7 +1256,7 @@ entity::model::StreamInputConnectionInfo ControlledEntityImpl::setStreamInputCon
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamInputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamInputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			// Save previous StreamInputConnectionInfo
@@ -1197,7 +1276,7 @@ void ControlledEntityImpl::clearStreamOutputConnections(entity::model::StreamInd
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			dynamicModel->connections.clear();
@@ -1210,7 +1289,7 @@ bool ControlledEntityImpl::addStreamOutputConnection(entity::model::StreamIndex
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			auto const result = dynamicModel->connections.insert(listenerStream);
@@ -1225,7 +1304,7 @@ bool ControlledEntityImpl::delStreamOutputConnection(entity::model::StreamIndex
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			return dynamicModel->connections.erase(listenerStream) > 0;
@@ -1239,7 +1318,7 @@ entity::model::AvbInterfaceInfo ControlledEntityImpl::setAvbInterfaceInfo(entity
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getAvbInterfaceNodeDynamicModel(*currentConfigurationIndexOpt, avbInterfaceIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getAvbInterfaceNodeDynamicModel(*currentConfigurationIndexOpt, avbInterfaceIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			// Save previous AvbInfo
@@ -1259,7 +1338,7 @@ entity::model::AsPath ControlledEntityImpl::setAsPath(entity::model::AvbInterfac
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getAvbInterfaceNodeDynamicModel(*currentConfigurationIndexOpt, avbInterfaceIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getAvbInterfaceNodeDynamicModel(*currentConfigurationIndexOpt, avbInterfaceIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			// Save previous AsPath
@@ -1276,7 +1355,7 @@ entity::model::AsPath ControlledEntityImpl::setAsPath(entity::model::AvbInterfac
 
 void ControlledEntityImpl::setSelectedLocaleStringsIndexesRange(entity::model::ConfigurationIndex const configurationIndex, entity::model::StringsIndex const baseIndex, entity::model::StringsIndex const countIndexes, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	auto* const dynamicModel = _treeModelAccess->getConfigurationNodeDynamicModel(configurationIndex, notFoundBehavior);
+	auto* const dynamicModel = getModelAccessStrategy().getConfigurationNodeDynamicModel(configurationIndex, notFoundBehavior);
 	if (dynamicModel)
 	{
 		dynamicModel->selectedLocaleBaseIndex = baseIndex;
@@ -1289,7 +1368,7 @@ void ControlledEntityImpl::clearStreamPortInputAudioMappings(entity::model::Stre
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamPortInputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamPortInputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			dynamicModel->dynamicAudioMap.clear();
@@ -1347,7 +1426,7 @@ void ControlledEntityImpl::addStreamPortInputAudioMappings(entity::model::Stream
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamPortInputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamPortInputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			auto& dynamicMap = dynamicModel->dynamicAudioMap;
@@ -1373,7 +1452,7 @@ void ControlledEntityImpl::removeStreamPortInputAudioMappings(entity::model::Str
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamPortInputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamPortInputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			auto& dynamicMap = dynamicModel->dynamicAudioMap;
@@ -1405,7 +1484,7 @@ void ControlledEntityImpl::clearStreamPortOutputAudioMappings(entity::model::Str
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamPortOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamPortOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			dynamicModel->dynamicAudioMap.clear();
@@ -1418,7 +1497,7 @@ void ControlledEntityImpl::addStreamPortOutputAudioMappings(entity::model::Strea
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamPortOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamPortOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			auto& dynamicMap = dynamicModel->dynamicAudioMap;
@@ -1451,7 +1530,7 @@ void ControlledEntityImpl::removeStreamPortOutputAudioMappings(entity::model::St
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getStreamPortOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getStreamPortOutputNodeDynamicModel(*currentConfigurationIndexOpt, streamPortIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			auto& dynamicMap = dynamicModel->dynamicAudioMap;
@@ -1483,7 +1562,7 @@ void ControlledEntityImpl::setClockSource(entity::model::ClockDomainIndex const
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getClockDomainNodeDynamicModel(*currentConfigurationIndexOpt, clockDomainIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getClockDomainNodeDynamicModel(*currentConfigurationIndexOpt, clockDomainIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			dynamicModel->clockSourceIndex = clockSourceIndex;
@@ -1496,7 +1575,7 @@ void ControlledEntityImpl::setControlValues(entity::model::ControlIndex const co
 	auto const currentConfigurationIndexOpt = getCurrentConfigurationIndex(notFoundBehavior);
 	if (currentConfigurationIndexOpt)
 	{
-		auto* const dynamicModel = _treeModelAccess->getControlNodeDynamicModel(*currentConfigurationIndexOpt, controlIndex, notFoundBehavior);
+		auto* const dynamicModel = getModelAccessStrategy().getControlNodeDynamicModel(*currentConfigurationIndexOpt, controlIndex, notFoundBehavior);
 		if (dynamicModel)
 		{
 			dynamicModel->values = controlValues;
@@ -1506,7 +1585,7 @@ void ControlledEntityImpl::setControlValues(entity::model::ControlIndex const co
 
 void ControlledEntityImpl::setMemoryObjectLength(entity::model::ConfigurationIndex const configurationIndex, entity::model::MemoryObjectIndex const memoryObjectIndex, std::uint64_t const length, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 {
-	auto* const dynamicModel = _treeModelAccess->getMemoryObjectNodeDynamicModel(configurationIndex, memoryObjectIndex, notFoundBehavior);
+	auto* const dynamicModel = getModelAccessStrategy().getMemoryObjectNodeDynamicModel(configurationIndex, memoryObjectIndex, notFoundBehavior);
 	if (dynamicModel)
 	{
 		dynamicModel->length = length;
@@ -1609,6 +1688,41 @@ void ControlledEntityImpl::setDiagnostics(Diagnostics const& diags) noexcept
 	_diagnostics = diags;
 }
 
+// Counters history
+void ControlledEntityImpl::recordCountersSample(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::DescriptorCounterValidFlag const validCounters, entity::model::DescriptorCounters const& counters, CountersHistoryBudget::SharedPointer const& budget) noexcept
+{
+	auto const key = makeDescriptorKey(descriptorType, descriptorIndex);
+
+	// History disabled
+	if (!budget)
+	{
+		_countersHistory.erase(key);
+		return;
+	}
+
+	auto& history = _countersHistory[key];
+	// Create the history if needed, or recreate it if the budget changed since its creation
+	if (!history || history->getBudget() != budget)
+	{
+		// Release the previous history before reserving a new one from the budget
+		history.reset();
+		history = CountersHistory::create(budget);
+		if (!history)
+		{
+			// Budget exhausted, don't keep an empty entry
+			_countersHistory.erase(key);
+			return;
+		}
+	}
+
+	history->record(CountersHistory::Clock::now(), validCounters, counters);
+}
+
+void ControlledEntityImpl::clearCountersHistory() noexcept
+{
+	_countersHistory.clear();
+}
+
 // Setters of the Model from AEM Descriptors (including DescriptorDynamic info)
 bool ControlledEntityImpl::setCachedEntityNode(model::EntityNode&& cachedNode, entity::model::EntityDescriptor const& descriptor, bool const forAllConfiguration) noexcept
 {
@@ -1643,6 +1757,7 @@ bool ControlledEntityImpl::setCachedEntityNode(model::EntityNode&& cachedNode, e
 
 	// Ok the static information from EntityDescriptor are identical, we cannot check more than this so we have to assume it's correct, copy the whole model
 	_entityNode = std::move(cachedNode);
+	_isEntityNodeModified = true;
 
 	// Success, switch to Cached Model Strategy
 	switchToCachedTreeModelAccessStrategy();
@@ -1655,6 +1770,8 @@ bool ControlledEntityImpl::setCachedEntityNode(model::EntityNode&& cachedNode, e
 
 void ControlledEntityImpl::setEntityDescriptor(entity::model::EntityDescriptor const& descriptor) noexcept
 {
+	_isEntityNodeModified = true;
+
 	if (!AVDECC_ASSERT_WITH_RET(!_advertised, "EntityDescriptor should never be set twice on an entity. Only the dynamic part should be set again."))
 	{
 		// Wipe everything and set as enumeration error
@@ -1687,7 +1804,7 @@ void ControlledEntityImpl::setEntityDescriptor(entity::model::EntityDescriptor c
 void ControlledEntityImpl::setConfigurationDescriptor(entity::model::ConfigurationDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex) noexcept
 {
 	// Get or create a new ConfigurationNode for this entity
-	auto* const node = _treeModelAccess->getConfigurationNode(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getConfigurationNode(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1699,7 +1816,7 @@ void ControlledEntityImpl::setConfigurationDescriptor(entity::model::Configurati
 
 	// Copy dynamic model
 	{
-		auto const* const entityDynamicModel = _treeModelAccess->getEntityNodeDynamicModel(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+		auto const* const entityDynamicModel = getModelAccessStrategy().getEntityNodeDynamicModel(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
 		if (!AVDECC_ASSERT_WITH_RET(!!entityDynamicModel, "Should not be null, parent descriptor expected to be created before this one"))
 		{
 			return;
@@ -1714,7 +1831,7 @@ void ControlledEntityImpl::setConfigurationDescriptor(entity::model::Configurati
 void ControlledEntityImpl::setAudioUnitDescriptor(entity::model::AudioUnitDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::AudioUnitIndex const audioUnitIndex) noexcept
 {
 	// Get or create a new AudioUnitNode for this entity
-	auto* const node = _treeModelAccess->getAudioUnitNode(configurationIndex, audioUnitIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getAudioUnitNode(configurationIndex, audioUnitIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1769,7 +1886,7 @@ void ControlledEntityImpl::setAudioUnitDescriptor(entity::model::AudioUnitDescri
 void ControlledEntityImpl::setStreamInputDescriptor(entity::model::StreamDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::StreamIndex const streamIndex) noexcept
 {
 	// Get or create a new StreamInputNode for this entity
-	auto* const node = _treeModelAccess->getStreamInputNode(configurationIndex, streamIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getStreamInputNode(configurationIndex, streamIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1807,7 +1924,7 @@ void ControlledEntityImpl::setStreamInputDescriptor(entity::model::StreamDescrip
 void ControlledEntityImpl::setStreamOutputDescriptor(entity::model::StreamDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::StreamIndex const streamIndex) noexcept
 {
 	// Get or create a new StreamOutputNode for this entity
-	auto* const node = _treeModelAccess->getStreamOutputNode(configurationIndex, streamIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getStreamOutputNode(configurationIndex, streamIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1844,7 +1961,7 @@ void ControlledEntityImpl::setStreamOutputDescriptor(entity::model::StreamDescri
 void ControlledEntityImpl::setJackInputDescriptor(entity::model::JackDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::JackIndex const jackIndex) noexcept
 {
 	// Get or create a new JackInputNode for this entity
-	auto* const node = _treeModelAccess->getJackInputNode(configurationIndex, jackIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getJackInputNode(configurationIndex, jackIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1868,7 +1985,7 @@ void ControlledEntityImpl::setJackInputDescriptor(entity::model::JackDescriptor
 void ControlledEntityImpl::setJackOutputDescriptor(entity::model::JackDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::JackIndex const jackIndex) noexcept
 {
 	// Get or create a new JackOutputNode for this entity
-	auto* const node = _treeModelAccess->getJackOutputNode(configurationIndex, jackIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getJackOutputNode(configurationIndex, jackIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1892,7 +2009,7 @@ void ControlledEntityImpl::setJackOutputDescriptor(entity::model::JackDescriptor
 void ControlledEntityImpl::setAvbInterfaceDescriptor(entity::model::AvbInterfaceDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::AvbInterfaceIndex const interfaceIndex) noexcept
 {
 	// Get or create a new AvbInterfaceNode for this entity
-	auto* const node = _treeModelAccess->getAvbInterfaceNode(configurationIndex, interfaceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getAvbInterfaceNode(configurationIndex, interfaceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1926,7 +2043,7 @@ void ControlledEntityImpl::setAvbInterfaceDescriptor(entity::model::AvbInterface
 void ControlledEntityImpl::setClockSourceDescriptor(entity::model::ClockSourceDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::ClockSourceIndex const clockIndex) noexcept
 {
 	// Get or create a new ClockSourceNode for this entity
-	auto* const node = _treeModelAccess->getClockSourceNode(configurationIndex, clockIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getClockSourceNode(configurationIndex, clockIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1952,7 +2069,7 @@ void ControlledEntityImpl::setClockSourceDescriptor(entity::model::ClockSourceDe
 void ControlledEntityImpl::setMemoryObjectDescriptor(entity::model::MemoryObjectDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::MemoryObjectIndex const memoryObjectIndex) noexcept
 {
 	// Get or create a new MemoryObjectNode for this entity
-	auto* const node = _treeModelAccess->getMemoryObjectNode(configurationIndex, memoryObjectIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getMemoryObjectNode(configurationIndex, memoryObjectIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1978,7 +2095,7 @@ void ControlledEntityImpl::setMemoryObjectDescriptor(entity::model::MemoryObject
 void ControlledEntityImpl::setLocaleDescriptor(entity::model::LocaleDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::LocaleIndex const localeIndex) noexcept
 {
 	// Get or create a new LocaleNode for this entity
-	auto* const node = _treeModelAccess->getLocaleNode(configurationIndex, localeIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getLocaleNode(configurationIndex, localeIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -1993,7 +2110,7 @@ void ControlledEntityImpl::setLocaleDescriptor(entity::model::LocaleDescriptor c
 void ControlledEntityImpl::setStringsDescriptor(entity::model::StringsDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::StringsIndex const stringsIndex) noexcept
 {
 	// Get or create a new StringsNode for this entity
-	auto* const node = _treeModelAccess->getStringsNode(configurationIndex, stringsIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getStringsNode(configurationIndex, stringsIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2002,7 +2119,7 @@ void ControlledEntityImpl::setStringsDescriptor(entity::model::StringsDescriptor
 		m.strings = descriptor.strings;
 	}
 
-	auto const* const configDynamicModel = _treeModelAccess->getConfigurationNodeDynamicModel(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+	auto const* const configDynamicModel = getModelAccessStrategy().getConfigurationNodeDynamicModel(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
 	if (!AVDECC_ASSERT_WITH_RET(!!configDynamicModel, "Should not be null, parent descriptor expected to be created before this one"))
 	{
 		return;
@@ -2016,7 +2133,7 @@ void ControlledEntityImpl::setStringsDescriptor(entity::model::StringsDescriptor
 
 void ControlledEntityImpl::setLocalizedStrings(entity::model::ConfigurationIndex const configurationIndex, entity::model::StringsIndex const relativeStringsIndex, entity::model::AvdeccFixedStrings const& strings) noexcept
 {
-	auto* const configDynamicModel = _treeModelAccess->getConfigurationNodeDynamicModel(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+	auto* const configDynamicModel = getModelAccessStrategy().getConfigurationNodeDynamicModel(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
 	if (!AVDECC_ASSERT_WITH_RET(!!configDynamicModel, "Should not be null, parent descriptor expected to be created before this one"))
 	{
 		return;
@@ -2032,7 +2149,7 @@ void ControlledEntityImpl::setLocalizedStrings(entity::model::ConfigurationIndex
 void ControlledEntityImpl::setStreamPortInputDescriptor(entity::model::StreamPortDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::StreamPortIndex const streamPortIndex) noexcept
 {
 	// Get or create a new StreamPortInputNode for this entity
-	auto* const node = _treeModelAccess->getStreamPortInputNode(configurationIndex, streamPortIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getStreamPortInputNode(configurationIndex, streamPortIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2055,7 +2172,7 @@ void ControlledEntityImpl::setStreamPortInputDescriptor(entity::model::StreamPor
 void ControlledEntityImpl::setStreamPortOutputDescriptor(entity::model::StreamPortDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::StreamPortIndex const streamPortIndex) noexcept
 {
 	// Get or create a new StreamPortOutputNode for this entity
-	auto* const node = _treeModelAccess->getStreamPortOutputNode(configurationIndex, streamPortIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getStreamPortOutputNode(configurationIndex, streamPortIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2078,7 +2195,7 @@ void ControlledEntityImpl::setStreamPortOutputDescriptor(entity::model::StreamPo
 void ControlledEntityImpl::setAudioClusterDescriptor(entity::model::AudioClusterDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::ClusterIndex const clusterIndex) noexcept
 {
 	// Get or create a new AudioClusterNode for this entity
-	auto* const node = _treeModelAccess->getAudioClusterNode(configurationIndex, clusterIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getAudioClusterNode(configurationIndex, clusterIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2105,7 +2222,7 @@ void ControlledEntityImpl::setAudioClusterDescriptor(entity::model::AudioCluster
 void ControlledEntityImpl::setAudioMapDescriptor(entity::model::AudioMapDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::MapIndex const mapIndex) noexcept
 {
 	// Get or create a new AudioMapNode for this entity
-	auto* const node = _treeModelAccess->getAudioMapNode(configurationIndex, mapIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getAudioMapNode(configurationIndex, mapIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2118,7 +2235,7 @@ void ControlledEntityImpl::setAudioMapDescriptor(entity::model::AudioMapDescript
 void ControlledEntityImpl::setControlDescriptor(entity::model::ControlDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::ControlIndex const controlIndex) noexcept
 {
 	// Get or create a new ControlNode for this entity
-	auto* const node = _treeModelAccess->getControlNode(configurationIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getControlNode(configurationIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2151,7 +2268,7 @@ void ControlledEntityImpl::setControlDescriptor(entity::model::ControlDescriptor
 void ControlledEntityImpl::setClockDomainDescriptor(entity::model::ClockDomainDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::ClockDomainIndex const clockDomainIndex) noexcept
 {
 	// Get or create a new ClockDomainNode for this entity
-	auto* const node = _treeModelAccess->getClockDomainNode(configurationIndex, clockDomainIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getClockDomainNode(configurationIndex, clockDomainIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2173,7 +2290,7 @@ void ControlledEntityImpl::setClockDomainDescriptor(entity::model::ClockDomainDe
 void ControlledEntityImpl::setTimingDescriptor(entity::model::TimingDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::TimingIndex const timingIndex) noexcept
 {
 	// Get or create a new TimingNode for this entity
-	auto* const node = _treeModelAccess->getTimingNode(configurationIndex, timingIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getTimingNode(configurationIndex, timingIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2195,7 +2312,7 @@ void ControlledEntityImpl::setTimingDescriptor(entity::model::TimingDescriptor c
 void ControlledEntityImpl::setPtpInstanceDescriptor(entity::model::PtpInstanceDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::PtpInstanceIndex const ptpInstanceIndex) noexcept
 {
 	// Get or create a new PtpInstanceNode for this entity
-	auto* const node = _treeModelAccess->getPtpInstanceNode(configurationIndex, ptpInstanceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getPtpInstanceNode(configurationIndex, ptpInstanceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2221,7 +2338,7 @@ void ControlledEntityImpl::setPtpInstanceDescriptor(entity::model::PtpInstanceDe
 void ControlledEntityImpl::setPtpPortDescriptor(entity::model::PtpPortDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::PtpPortIndex const ptpPortIndex) noexcept
 {
 	// Get or create a new PtpPortNode for this entity
-	auto* const node = _treeModelAccess->getPtpPortNode(configurationIndex, ptpPortIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+	auto* const node = getModelAccessStrategy().getPtpPortNode(configurationIndex, ptpPortIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 	AVDECC_ASSERT(!!node, "Should not be null, should be default constructed");
 
 	// Copy static model
@@ -2371,6 +2488,11 @@ std::pair<bool, std::chrono::milliseconds> ControlledEntityImpl::getRegisterUnso
 	return std::make_pair(true, std::chrono::milliseconds{ QueryRetryMillisecondDelay });
 }
 
+void ControlledEntityImpl::resetRegisterUnsolRetryTimer() noexcept
+{
+	_registerUnsolRetryCount = 0u;
+}
+
 // Expected GetDynamicInfo query methods
 bool ControlledEntityImpl::checkAndClearExpectedGetDynamicInfo(std::uint16_t const packetID) noexcept
 {
@@ -2458,11 +2580,6 @@ std::pair<bool, std::chrono::milliseconds> ControlledEntityImpl::getQueryMilanIn
 }
 
 // Expected descriptor query methods
-static inline ControlledEntityImpl::DescriptorKey makeDescriptorKey(entity::model::DescriptorType descriptorType, entity::model::DescriptorIndex descriptorIndex)
-{
-	return (utils::to_integral(descriptorType) << (sizeof(descriptorIndex) * 8)) + descriptorIndex;
-}
-
 bool ControlledEntityImpl::checkAndClearExpectedDescriptor(entity::model::ConfigurationIndex const configurationIndex, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex) noexcept
 {
 	AVDECC_ASSERT(_sharedLock->_lockedCount > 0, "ControlledEntity should be locked");
@@ -2503,6 +2620,15 @@ bool ControlledEntityImpl::gotAllExpectedDescriptors() const noexcept
 	return true;
 }
 
+bool ControlledEntityImpl::gotAllExpectedDescriptors(entity::model::ConfigurationIndex const configurationIndex) const noexcept
+{
+	AVDECC_ASSERT(_sharedLock->_lockedCount > 0, "ControlledEntity should be locked");
+
+	auto const confIt = _expectedDescriptors.find(configurationIndex);
+
+	return confIt == _expectedDescriptors.end() || confIt->second.empty();
+}
+
 std::pair<bool, std::chrono::milliseconds> ControlledEntityImpl::getQueryDescriptorRetryTimer() noexcept
 {
 	++_queryDescriptorRetryCount;
@@ -2652,6 +2778,23 @@ void ControlledEntityImpl::setIgnoreCachedEntityModel() noexcept
 	_ignoreCachedEntityModel = true;
 }
 
+void ControlledEntityImpl::setRecentEntityModel(model::EntityNode&& entityNode, entity::model::EntityDescriptor const& descriptor) noexcept
+{
+	_recentEntityModel = std::make_pair(std::move(entityNode), descriptor);
+}
+
+std::optional<std::pair<model::EntityNode, entity::model::EntityDescriptor>> ControlledEntityImpl::takeRecentEntityModel() noexcept
+{
+	auto recentEntityModel = std::move(_recentEntityModel);
+	_recentEntityModel = std::nullopt;
+	return recentEntityModel;
+}
+
+bool ControlledEntityImpl::hasRecentEntityModel() const noexcept
+{
+	return _recentEntityModel.has_value();
+}
+
 ControlledEntityImpl::EnumerationSteps ControlledEntityImpl::getEnumerationSteps() const noexcept
 {
 	return _enumerationSteps;
@@ -2795,6 +2938,11 @@ bool ControlledEntityImpl::hasLostUnsolicitedNotification(protocol::AecpSequence
 	return unmatched;
 }
 
+void ControlledEntityImpl::resetExpectedSequenceID() noexcept
+{
+	_expectedSequenceID = std::nullopt;
+}
+
 // Static methods
 std::string ControlledEntityImpl::dynamicInfoTypeToString(DynamicInfoType const dynamicInfoType) noexcept
 {
@@ -2894,6 +3042,17 @@ void ControlledEntityImpl::onEntityModelEnumerated() noexcept
 	switchToCachedTreeModelAccessStrategy();
 }
 
+void ControlledEntityImpl::onConfigurationStaticModelLoaded(entity::model::ConfigurationIndex const configurationIndex) noexcept
+{
+	// Build virtual nodes and run checks on the newly retrieved configuration, as done for all configurations when the entity was fully loaded
+	auto* const configurationNode = getModelAccessStrategy().getConfigurationNode(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+	if (configurationNode)
+	{
+		buildVirtualNodes(*configurationNode);
+		fixStreamPortMappings(*configurationNode);
+	}
+}
+
 void ControlledEntityImpl::onEntityFullyLoaded() noexcept
 {
 	auto const& e = getEntity();
@@ -2907,7 +3066,7 @@ void ControlledEntityImpl::onEntityFullyLoaded() noexcept
 	if (isAemSupported)
 	{
 		// Build all virtual nodes (eg. RedundantStreams, ...), run some checks (fix mappings, ...)
-		auto* entityNode = _treeModelAccess->getEntityNode(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+		auto* entityNode = getModelAccessStrategy().getEntityNode(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
 		if (entityNode)
 		{
 			for (auto& configKV : entityNode->configurations)
@@ -3349,14 +3508,14 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 	try
 	{
 		// Build root node (EntityNode)
-		auto* const entityNode = _treeModelAccess->getEntityNode(TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+		auto* const entityNode = getModelAccessStrategy().getEntityNode(TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 		entityNode->staticModel = entityTree.staticModel;
 		entityNode->dynamicModel = entityTree.dynamicModel;
 
 		// Build configuration nodes (ConfigurationNode)
 		for (auto& [configIndex, configTree] : entityTree.configurationTrees)
 		{
-			auto* const configNode = _treeModelAccess->getConfigurationNode(configIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+			auto* const configNode = getModelAccessStrategy().getConfigurationNode(configIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 			configNode->staticModel = configTree.staticModel;
 			configNode->dynamicModel = configTree.dynamicModel;
 
@@ -3369,7 +3528,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build clock sources (ClockSourceNode)
 				for (auto& [sourceIndex, sourceModel] : configTree.clockSourceModels)
 				{
-					auto* const sourceNode = _treeModelAccess->getClockSourceNode(configIndex, sourceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const sourceNode = getModelAccessStrategy().getClockSourceNode(configIndex, sourceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					sourceNode->staticModel = sourceModel.staticModel;
 					sourceNode->dynamicModel = sourceModel.dynamicModel;
 				}
@@ -3377,7 +3536,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build memory objects (MemoryObjectNode)
 				for (auto& [memoryObjectIndex, memoryObjectModel] : configTree.memoryObjectModels)
 				{
-					auto* const memoryObjectNode = _treeModelAccess->getMemoryObjectNode(configIndex, memoryObjectIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const memoryObjectNode = getModelAccessStrategy().getMemoryObjectNode(configIndex, memoryObjectIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					memoryObjectNode->staticModel = memoryObjectModel.staticModel;
 					memoryObjectNode->dynamicModel = memoryObjectModel.dynamicModel;
 				}
@@ -3385,13 +3544,13 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build locales (LocaleNode)
 				for (auto const& [localeIndex, localeTree] : configTree.localeTrees)
 				{
-					auto* const localeNode = _treeModelAccess->getLocaleNode(configIndex, localeIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const localeNode = getModelAccessStrategy().getLocaleNode(configIndex, localeIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					localeNode->staticModel = localeTree.staticModel;
 
 					// Build strings (StringsNode)
 					for (auto const& [stringsIndex, stringsModel] : localeTree.stringsModels)
 					{
-						auto* const stringsNode = _treeModelAccess->getStringsNode(configIndex, stringsIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+						auto* const stringsNode = getModelAccessStrategy().getStringsNode(configIndex, stringsIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 						stringsNode->staticModel = stringsModel.staticModel;
 					}
 				}
@@ -3399,7 +3558,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build controls (ControlNode)
 				for (auto& [controlIndex, controlModel] : configTree.controlModels)
 				{
-					auto* const controlNode = _treeModelAccess->getControlNode(configIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const controlNode = getModelAccessStrategy().getControlNode(configIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					controlNode->staticModel = controlModel.staticModel;
 					controlNode->dynamicModel = controlModel.dynamicModel;
 				}
@@ -3407,7 +3566,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build clock domains (ClockDomainNode)
 				for (auto& [domainIndex, domainModel] : configTree.clockDomainModels)
 				{
-					auto* const domainNode = _treeModelAccess->getClockDomainNode(configIndex, domainIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const domainNode = getModelAccessStrategy().getClockDomainNode(configIndex, domainIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					domainNode->staticModel = domainModel.staticModel;
 					domainNode->dynamicModel = domainModel.dynamicModel;
 				}
@@ -3415,7 +3574,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build timings (TimingNode)
 				for (auto& [timingIndex, timingModel] : configTree.timingModels)
 				{
-					auto* const timingNode = _treeModelAccess->getTimingNode(configIndex, timingIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const timingNode = getModelAccessStrategy().getTimingNode(configIndex, timingIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					timingNode->staticModel = timingModel.staticModel;
 					timingNode->dynamicModel = timingModel.dynamicModel;
 				}
@@ -3426,7 +3585,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build audio units (AudioUnitNode)
 				for (auto& [audioUnitIndex, audioUnitTree] : configTree.audioUnitTrees)
 				{
-					auto* const audioUnitNode = _treeModelAccess->getAudioUnitNode(configIndex, audioUnitIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const audioUnitNode = getModelAccessStrategy().getAudioUnitNode(configIndex, audioUnitIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					audioUnitNode->staticModel = audioUnitTree.staticModel;
 					audioUnitNode->dynamicModel = audioUnitTree.dynamicModel;
 
@@ -3438,7 +3597,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 						// Build controls (ControlNode)
 						for (auto const& [controlIndex, controlTree] : audioUnitTree.controlModels)
 						{
-							auto* const controlNode = _treeModelAccess->getControlNode(configIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+							auto* const controlNode = getModelAccessStrategy().getControlNode(configIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 							controlNode->staticModel = controlTree.staticModel;
 							controlNode->dynamicModel = controlTree.dynamicModel;
 						}
@@ -3464,7 +3623,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build avb interfaces (AvbInterfaceNode)
 				for (auto& [interfaceIndex, interfaceModel] : configTree.avbInterfaceModels)
 				{
-					auto* const interfaceNode = _treeModelAccess->getAvbInterfaceNode(configIndex, interfaceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const interfaceNode = getModelAccessStrategy().getAvbInterfaceNode(configIndex, interfaceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					interfaceNode->staticModel = interfaceModel.staticModel;
 					interfaceNode->dynamicModel = interfaceModel.dynamicModel;
 #pragma message("TODO: Add Controls (AvbInterface children) - 1722.1-2021")
@@ -3473,7 +3632,7 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 				// Build ptp instances (PtpInstanceNode)
 				for (auto& [ptpInstanceIndex, ptpInstanceTree] : configTree.ptpInstanceTrees)
 				{
-					auto* const ptpInstanceNode = _treeModelAccess->getPtpInstanceNode(configIndex, ptpInstanceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+					auto* const ptpInstanceNode = getModelAccessStrategy().getPtpInstanceNode(configIndex, ptpInstanceIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 					ptpInstanceNode->staticModel = ptpInstanceTree.staticModel;
 					ptpInstanceNode->dynamicModel = ptpInstanceTree.dynamicModel;
 
@@ -3483,14 +3642,14 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 					// Build controls (ControlNode)
 					for (auto const& [controlIndex, controlTree] : ptpInstanceTree.controlModels)
 					{
-						auto* const controlNode = _treeModelAccess->getControlNode(configIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+						auto* const controlNode = getModelAccessStrategy().getControlNode(configIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 						controlNode->staticModel = controlTree.staticModel;
 						controlNode->dynamicModel = controlTree.dynamicModel;
 					}
 					// Build ptp ports (PtpPortNode)
 					for (auto const& [ptpPortIndex, ptpPortTree] : ptpInstanceTree.ptpPortModels)
 					{
-						auto* const ptpPortNode = _treeModelAccess->getPtpPortNode(configIndex, ptpPortIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
+						auto* const ptpPortNode = getModelAccessStrategy().getPtpPortNode(configIndex, ptpPortIndex, TreeModelAccessStrategy::NotFoundBehavior::DefaultConstruct);
 						ptpPortNode->staticModel = ptpPortTree.staticModel;
 						ptpPortNode->dynamicModel = ptpPortTree.dynamicModel;
 					}
@@ -4184,6 +4343,27 @@ void ControlledEntityImpl::switchToCachedTreeModelAccessStrategy() noexcept
 	}
 }
 
+std::optional<ControlledEntity::CounterHistoryStatistics> ControlledEntityImpl::getCounterHistoryStatistics(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::DescriptorCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept
+{
+	// Counter must be exactly one bit
+	if (counter == 0u || (counter & (counter - 1u)) != 0u)
+	{
+		return std::nullopt;
+	}
+
+	if (auto const historyIt = _countersHistory.find(makeDescriptorKey(descriptorType, descriptorIndex)); historyIt != _countersHistory.end())
+	{
+		auto position = std::size_t{ 0u };
+		while ((counter >> position) != 1u)
+		{
+			++position;
+		}
+		return historyIt->second->getStatistics(position, window);
+	}
+
+	return std::nullopt;
+}
+
 std::tuple<bool, entity::model::ConfigurationIndex> ControlledEntityImpl::isEntityModelComplete(model::EntityNode const& entityNode, std::uint16_t const configurationsCount) const noexcept
 {
 	if (configurationsCount != entityNode.configurations.size())
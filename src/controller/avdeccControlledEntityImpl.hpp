@@ -25,6 +25,7 @@
 #pragma once
 
 #include "treeModelAccessStrategy.hpp"
+#include "avdeccCountersHistory.hpp"
 
 #include <la/avdecc/internals/entityModelTree.hpp>
 
@@ -190,6 +191,9 @@ public:
 	/** Constructor */
 	ControlledEntityImpl(la::avdecc::entity::Entity const& entity, LockInformation::SharedPointer const& sharedLock, bool const isVirtual) noexcept;
 
+	/** Snapshot constructor, copying the state of the source entity (which must be locked) and using the specified immutable model. Enumeration bookkeeping and counters history are not copied. */
+	ControlledEntityImpl(ControlledEntityImpl const& source, std::shared_ptr<model::EntityNode const> const& entityNode, LockInformation::SharedPointer const& sharedLock) noexcept;
+
 	// ControlledEntity overrides
 	// Getters
 	virtual bool isVirtual() const noexcept override;
@@ -274,10 +278,15 @@ public:
 	virtual std::uint64_t getAemAecpUnsolicitedLossCounter() const noexcept override;
 	virtual std::chrono::milliseconds const& getEnumerationTime() const noexcept override;
 
+	// Counters history
+	virtual std::optional<CounterHistoryStatistics> getAvbInterfaceCounterHistoryStatistics(entity::model::AvbInterfaceIndex const avbInterfaceIndex, entity::AvbInterfaceCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept override;
+	virtual std::optional<CounterHistoryStatistics> getStreamInputCounterHistoryStatistics(entity::model::StreamIndex const streamIndex, entity::StreamInputCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept override;
+	virtual std::optional<CounterHistoryStatistics> getStreamOutputCounterHistoryStatistics(entity::model::StreamIndex const streamIndex, entity::StreamOutputCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept override;
+
 	// Diagnostics
 	virtual Diagnostics const& getDiagnostics() const noexcept override;
 
-	TreeModelAccessStrategy& getModelAccessStrategy() noexcept;
+	TreeModelAccessStrategy& getModelAccessStrategy() noexcept; // Flags the model as modified
 
 	// Non-const Node getters. Behavior in case of error is dictated by the passed NotFoundBehavior
 	model::EntityNode* getEntityNode(TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior);
@@ -298,7 +307,7 @@ public:
 	template<typename TreeModelAccessPointer, typename DescriptorIndexType>
 	void setObjectName(entity::model::ConfigurationIndex const configurationIndex, DescriptorIndexType const index, TreeModelAccessPointer TreeModelAccessStrategy::*Pointer, entity::model::AvdeccFixedString const& name, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
 	{
-		auto* const dynamicModel = ((*_treeModelAccess).*Pointer)(configurationIndex, index, notFoundBehavior);
+		auto* const dynamicModel = (getModelAccessStrategy().*Pointer)(configurationIndex, index, notFoundBehavior);
 		if (dynamicModel)
 		{
 			dynamicModel->objectName = name;
@@ -343,6 +352,10 @@ public:
 	// Setters of the Diagnostics
 	void setDiagnostics(Diagnostics const& diags) noexcept;
 
+	// Counters history
+	void recordCountersSample(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::DescriptorCounterValidFlag const validCounters, entity::model::DescriptorCounters const& counters, CountersHistoryBudget::SharedPointer const& budget) noexcept; // Records a new sample in the history of the descriptor, using the specified budget (history is cleared if budget is nullptr or changed)
+	void clearCountersHistory() noexcept;
+
 	// Setters of the Model from AEM Descriptors (including DescriptorDynamic info)
 	bool setCachedEntityNode(model::EntityNode&& cachedNode, entity::model::EntityDescriptor const& descriptor, bool const forAllConfiguration) noexcept; // Returns true if the cached EntityNode is accepted (and set) for this entity
 	void setEntityDescriptor(entity::model::EntityDescriptor const& descriptor) noexcept;
@@ -396,6 +409,7 @@ public:
 	void setRegisterUnsolExpected() noexcept;
 	bool gotExpectedRegisterUnsol() const noexcept;
 	std::pair<bool, std::chrono::milliseconds> getRegisterUnsolRetryTimer() noexcept;
+	void resetRegisterUnsolRetryTimer() noexcept;
 
 	// Expected Milan info query methods
 	bool checkAndClearExpectedMilanInfo(MilanInfoType const milanInfoType) noexcept;
@@ -407,6 +421,7 @@ public:
 	bool checkAndClearExpectedDescriptor(entity::model::ConfigurationIndex const configurationIndex, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex) noexcept;
 	void setDescriptorExpected(entity::model::ConfigurationIndex const configurationIndex, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex) noexcept;
 	bool gotAllExpectedDescriptors() const noexcept;
+	bool gotAllExpectedDescriptors(entity::model::ConfigurationIndex const configurationIndex) const noexcept;
 	std::pair<bool, std::chrono::milliseconds> getQueryDescriptorRetryTimer() noexcept;
 
 	// Expected dynamic info query methods
@@ -427,6 +442,9 @@ public:
 	void setIdentifyControlIndex(entity::model::ControlIndex const identifyControlIndex) noexcept;
 	bool shouldIgnoreCachedEntityModel() const noexcept;
 	void setIgnoreCachedEntityModel() noexcept;
+	void setRecentEntityModel(model::EntityNode&& entityNode, entity::model::EntityDescriptor const& descriptor) noexcept; // Static model from a previous enumeration, to be validated against the CONFIGURATION descriptor of the device before being used
+	std::optional<std::pair<model::EntityNode, entity::model::EntityDescriptor>> takeRecentEntityModel() noexcept;
+	bool hasRecentEntityModel() const noexcept;
 	EnumerationSteps getEnumerationSteps() const noexcept;
 	void setEnumerationSteps(EnumerationSteps const steps) noexcept;
 	void addEnumerationStep(EnumerationStep const step) noexcept;
@@ -447,8 +465,10 @@ public:
 	bool isRedundantSecondaryStreamOutput(entity::model::StreamIndex const streamIndex) const noexcept; // True for a Redundant Secondary Stream (false for Primary and non-redundant streams)
 	Diagnostics& getDiagnostics() noexcept;
 	bool hasLostUnsolicitedNotification(protocol::AecpSequenceID const sequenceID) noexcept;
+	void resetExpectedSequenceID() noexcept; // Next received unsolicited notification will be accepted as the start of a new sequence
 	entity::model::EntityTree const& getEntityModelTree() const noexcept;
 	void buildEntityModelGraph(entity::model::EntityTree const& entityTree) noexcept;
+	std::shared_ptr<ControlledEntityImpl> createSnapshot() noexcept; // Creates an immutable snapshot of the entity (which must be locked). The model is only copied if it was modified since the previous snapshot, otherwise it is shared with it
 
 	// Static methods
 	static std::string dynamicInfoTypeToString(DynamicInfoType const dynamicInfoType) noexcept;
@@ -457,6 +477,7 @@ public:
 	// Controller restricted methods
 	void onEntityModelEnumerated() noexcept; // To be called when the entity model has been fully retrieved
 	void onEntityFullyLoaded() noexcept; // To be called when the entity has been fully loaded and is ready to be shared
+	void onConfigurationStaticModelLoaded(entity::model::ConfigurationIndex const configurationIndex) noexcept; // To be called when the static model of a configuration has been retrieved after the entity was fully loaded
 
 	// Compiler auto-generated methods
 	ControlledEntityImpl(ControlledEntityImpl&&) = delete;
@@ -469,6 +490,20 @@ protected:
 
 private:
 	// Private methods
+	/** Returns the root of the model: the immutable model shared with other snapshots for a snapshot, the entity's own model otherwise */
+	model::EntityNode* getRootEntityNode() noexcept
+	{
+		if (_sharedEntityNode)
+		{
+			// A snapshot is only accessed through its const methods, which never modify the model
+			return const_cast<model::EntityNode*>(_sharedEntityNode.get());
+		}
+		return &_entityNode;
+	}
+	model::EntityNode const& getRootEntityNode() const noexcept
+	{
+		return _sharedEntityNode ? *_sharedEntityNode : _entityNode;
+	}
 	void switchToCachedTreeModelAccessStrategy() noexcept;
 	std::tuple<bool, entity::model::ConfigurationIndex> isEntityModelComplete(model::EntityNode const& entityNode, std::uint16_t const configurationsCount) const noexcept;
 	void buildVirtualNodes(model::ConfigurationNode& configNode) noexcept;
@@ -476,6 +511,7 @@ private:
 	void addOrFixStreamPortInputMapping(entity::model::AudioMappings& mappings, entity::model::AudioMapping const& mapping) const noexcept;
 	void fixStreamPortInputMappings(std::map<entity::model::StreamPortIndex, model::StreamPortInputNode>& streamPorts) noexcept;
 	void fixStreamPortMappings(model::ConfigurationNode& configNode) noexcept;
+	std::optional<CounterHistoryStatistics> getCounterHistoryStatistics(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::DescriptorCounterValidFlag const counter, std::chrono::milliseconds const window) const noexcept;
 #ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
 	void buildRedundancyNodes(model::ConfigurationNode& configNode) noexcept;
 #endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
@@ -484,6 +520,7 @@ private:
 	LockInformation::SharedPointer _sharedLock{ nullptr };
 	bool const _isVirtual{ false };
 	bool _ignoreCachedEntityModel{ false };
+	std::optional<std::pair<model::EntityNode, entity::model::EntityDescriptor>> _recentEntityModel{ std::nullopt }; // Static model from a previous enumeration (and the ENTITY descriptor just retrieved), pending validation
 	std::optional<entity::model::ControlIndex> _identifyControlIndex{ std::nullopt };
 	std::uint16_t _checkDynamicInfoSupportedRetryCount{ 0u };
 	std::uint16_t _queryGetDynamicInfoRetryCount{ 0u };
@@ -520,6 +557,9 @@ private:
 	// Entity Model
 	//entity::model::EntityTree _entityTree{}; // Tree of the model as represented by the AVDECC protocol
 	model::EntityNode _entityNode{}; // Model as represented by the ControlledEntity (tree of references to the model::EntityStaticTree and model::EntityDynamicTree)
+	bool _isEntityNodeModified{ false }; // Has _entityNode been modified since _snapshotEntityNode was copied
+	std::shared_ptr<model::EntityNode const> _snapshotEntityNode{ nullptr }; // Immutable copy of _entityNode, shared by all the snapshots created since its last modification
+	std::shared_ptr<model::EntityNode const> _sharedEntityNode{ nullptr }; // Snapshot only: immutable model shared with other snapshots, used instead of _entityNode
 	// Entity Model Tree Access Strategy
 	friend class TreeModelAccessTraverseStrategy;
 	friend class TreeModelAccessCacheStrategy;
@@ -542,6 +582,8 @@ private:
 	std::uint64_t _aemAecpUnsolicitedLossCounter{ 0ull };
 	std::chrono::time_point<std::chrono::steady_clock> _enumerationStartTime{}; // Intermediate variable used by _enumerationTime
 	std::chrono::milliseconds _enumerationTime{};
+	// Counters history
+	std::unordered_map<DescriptorKey, CountersHistory::UniquePointer> _countersHistory{};
 	// Diagnostics
 	Diagnostics _diagnostics{};
 };
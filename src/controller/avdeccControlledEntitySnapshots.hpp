@@ -0,0 +1,171 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccControlledEntitySnapshots.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "avdeccControlledEntityImpl.hpp"
+
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Latest immutable snapshot of each advertised ControlledEntity.
+* @details The entities modified since the last publication are collected by the controller, and a new snapshot of each of them is published at once by the networking thread.
+*          A new snapshot only copies the entity model if it was modified, otherwise the model is shared with the previous snapshots of the entity.
+*          Readers never take any lock on the entities, the published snapshots are loaded with std::atomic_load and never modified. Thread-safe.
+*/
+class ControlledEntitySnapshots final
+{
+public:
+	using SharedControlledEntityImpl = std::shared_ptr<ControlledEntityImpl>;
+
+	ControlledEntitySnapshots() noexcept = default;
+
+	/** Adds a newly advertised entity, with its first snapshot */
+	void addEntity(UniqueIdentifier const entityID, SharedConstControlledEntity&& snapshot) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto entities = copyEntities();
+		entities[entityID] = std::make_shared<SharedConstControlledEntity>(std::move(snapshot));
+		publishEntities(std::move(entities));
+	}
+
+	/** Removes an unadvertised entity. Snapshots already returned to the readers remain valid */
+	void removeEntity(UniqueIdentifier const entityID) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto entities = copyEntities();
+		if (entities.erase(entityID) != 0u)
+		{
+			publishEntities(std::move(entities));
+		}
+	}
+
+	/** Removes all the entities */
+	void clear() noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		_modifiedEntities.clear();
+		publishEntities({});
+	}
+
+	/** Returns the latest published snapshot of an entity (nullptr if the entity is not advertised). Never blocks on the entities lock */
+	SharedConstControlledEntity getSnapshot(UniqueIdentifier const entityID) const noexcept
+	{
+		// Take a reference on the currently published entities, they are never modified once published
+		auto const entities = std::atomic_load_explicit(&_entities, std::memory_order_acquire);
+
+		auto const it = entities->find(entityID);
+		if (it == entities->end())
+		{
+			return {};
+		}
+		return std::atomic_load_explicit(it->second.get(), std::memory_order_acquire);
+	}
+
+	/** Flags an advertised entity as modified. Returns true if the caller has to schedule a call to publishModifiedEntities (no publication pending yet) */
+	bool setEntityModified(SharedControlledEntityImpl const& entity) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (std::find(_modifiedEntities.begin(), _modifiedEntities.end(), entity) == _modifiedEntities.end())
+		{
+			_modifiedEntities.push_back(entity);
+		}
+
+		return std::exchange(_isPublicationPending, true) == false;
+	}
+
+	/** Publishes a new snapshot of each entity modified since the last publication. To be called from the networking thread */
+	void publishModifiedEntities() noexcept
+	{
+		auto modifiedEntities = decltype(_modifiedEntities){};
+		auto entities = std::shared_ptr<Entities const>{};
+		{
+			auto const lg = std::lock_guard{ _lock };
+
+			modifiedEntities.swap(_modifiedEntities);
+			_isPublicationPending = false;
+			entities = std::atomic_load_explicit(&_entities, std::memory_order_relaxed);
+		}
+
+		for (auto const& entity : modifiedEntities)
+		{
+			auto const lg = std::lock_guard{ *entity };
+
+			// Entity might have been unadvertised in the meantime
+			auto const it = entities->find(entity->getEntity().getEntityID());
+			if (it != entities->end())
+			{
+				std::atomic_store_explicit(it->second.get(), SharedConstControlledEntity{ entity->createSnapshot() }, std::memory_order_release);
+			}
+		}
+	}
+
+	// Deleted compiler auto-generated methods
+	ControlledEntitySnapshots(ControlledEntitySnapshots const&) = delete;
+	ControlledEntitySnapshots(ControlledEntitySnapshots&&) = delete;
+	ControlledEntitySnapshots& operator=(ControlledEntitySnapshots const&) = delete;
+	ControlledEntitySnapshots& operator=(ControlledEntitySnapshots&&) = delete;
+
+private:
+	using Entities = std::unordered_map<UniqueIdentifier, std::shared_ptr<SharedConstControlledEntity>, UniqueIdentifier::hash>; // Latest snapshot of each entity, only accessed through std::atomic_load/std::atomic_store
+
+	/** Returns a modifiable copy of the published entities. _lock must be held */
+	Entities copyEntities() const
+	{
+		return *std::atomic_load_explicit(&_entities, std::memory_order_relaxed);
+	}
+
+	/** Publishes the new entities for the readers. _lock must be held */
+	void publishEntities(Entities&& entities) noexcept
+	{
+		std::atomic_store_explicit(&_entities, std::make_shared<Entities const>(std::move(entities)), std::memory_order_release);
+	}
+
+	std::mutex _lock{}; // Serializes the modifications, never held while reading the snapshots nor while locking an entity
+	std::vector<SharedControlledEntityImpl> _modifiedEntities{}; // Entities modified since the last publication, protected by _lock
+	bool _isPublicationPending{ false }; // Protected by _lock
+	std::shared_ptr<Entities const> _entities{ std::make_shared<Entities const>() }; // Published entities, only accessed through std::atomic_load/std::atomic_store
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
@@ -1179,37 +1179,27 @@ void ControllerImpl::updateClockSource(ControlledEntityImpl& controlledEntity, e
 		// Lock to protect _controlledEntities
 		auto const lg = std::lock_guard{ _lock };
 
-		for (auto& [eid, entity] : _controlledEntities)
-		{
-			if (entity->wasAdvertised() && entity->getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported) && entity->hasAnyConfiguration())
+		forEachMediaClockChainWithEntity(entityID,
+			[this, entityID](ControlledEntityImpl& entity, model::ClockDomainNode& clockDomainNode)
 			{
-				auto* const configNode = entity->getCurrentConfigurationNode(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
-				if (configNode != nullptr)
+				// Check if the chain has a node on that clock source changed entity
+				for (auto nodeIt = clockDomainNode.mediaClockChain.begin(); nodeIt != clockDomainNode.mediaClockChain.end(); ++nodeIt)
 				{
-					for (auto& clockDomainKV : configNode->clockDomains)
+					if (nodeIt->entityID == entityID)
 					{
-						auto& clockDomainNode = clockDomainKV.second;
-						// Check if the chain has a node on that clock source changed entity
-						for (auto nodeIt = clockDomainNode.mediaClockChain.begin(); nodeIt != clockDomainNode.mediaClockChain.end(); ++nodeIt)
-						{
-							if (nodeIt->entityID == entityID)
-							{
-								// Save the domain/stream indexes, we'll continue from it
-								auto const continueDomainIndex = nodeIt->clockDomainIndex;
-								auto const continueStreamOutputIndex = nodeIt->streamOutputIndex;
+						// Save the domain/stream indexes, we'll continue from it
+						auto const continueDomainIndex = nodeIt->clockDomainIndex;
+						auto const continueStreamOutputIndex = nodeIt->streamOutputIndex;
 
-								// Remove this node and all following nodes
-								clockDomainNode.mediaClockChain.erase(nodeIt, clockDomainNode.mediaClockChain.end());
+						// Remove this node and all following nodes
+						clockDomainNode.mediaClockChain.erase(nodeIt, clockDomainNode.mediaClockChain.end());
 
-								// Update the chain starting from this entity
-								computeAndUpdateMediaClockChain(*entity, clockDomainNode, entityID, continueDomainIndex, continueStreamOutputIndex, {});
-								break;
-							}
-						}
+						// Update the chain starting from this entity
+						computeAndUpdateMediaClockChain(entity, clockDomainNode, entityID, continueDomainIndex, continueStreamOutputIndex, {});
+						break;
 					}
 				}
-			}
-		}
+			});
 	}
 }
 
@@ -1504,13 +1494,10 @@ void ControllerImpl::updateEntityCounters(ControlledEntityImpl& controlledEntity
 	if (entityCounters)
 	{
 		// Update (or set) counters
-		for (auto counter : validCounters)
-		{
-			(*entityCounters)[counter] = counters[validCounters.getPosition(counter)];
-		}
+		entityCounters->update(validCounters, counters);
 
-		// Entity was advertised to the user, notify observers
-		if (controlledEntity.wasAdvertised())
+		// Entity was advertised to the user and some counters changed, notify observers
+		if (controlledEntity.wasAdvertised() && !entityCounters->getChangedCounters().empty())
 		{
 			notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityCountersChanged, this, &controlledEntity, *entityCounters);
 		}
@@ -1526,10 +1513,10 @@ void ControllerImpl::updateAvbInterfaceCounters(ControlledEntityImpl& controlled
 	if (avbInterfaceCounters)
 	{
 		// Update (or set) counters
-		for (auto counter : validCounters)
-		{
-			(*avbInterfaceCounters)[counter] = counters[validCounters.getPosition(counter)];
-		}
+		avbInterfaceCounters->update(validCounters, counters);
+
+		// Record counters history
+		controlledEntity.recordCountersSample(entity::model::DescriptorType::AvbInterface, avbInterfaceIndex, validCounters.value(), counters, _countersHistoryBudget);
 
 		// Check for link status update
 		checkAvbInterfaceLinkStatus(this, controlledEntity, avbInterfaceIndex, *avbInterfaceCounters);
@@ -1548,8 +1535,8 @@ void ControllerImpl::updateAvbInterfaceCounters(ControlledEntityImpl& controlled
 			}
 		}
 
-		// Entity was advertised to the user, notify observers
-		if (controlledEntity.wasAdvertised())
+		// Entity was advertised to the user and some counters changed, notify observers
+		if (controlledEntity.wasAdvertised() && !avbInterfaceCounters->getChangedCounters().empty())
 		{
 			notifyObserversMethod<Controller::Observer>(&Controller::Observer::onAvbInterfaceCountersChanged, this, &controlledEntity, avbInterfaceIndex, *avbInterfaceCounters);
 		}
@@ -1565,10 +1552,7 @@ void ControllerImpl::updateClockDomainCounters(ControlledEntityImpl& controlledE
 	if (clockDomainCounters)
 	{
 		// Update (or set) counters
-		for (auto counter : validCounters)
-		{
-			(*clockDomainCounters)[counter] = counters[validCounters.getPosition(counter)];
-		}
+		clockDomainCounters->update(validCounters, counters);
 
 		// If Milan device, validate counters values
 		if (controlledEntity.getCompatibilityFlags().test(ControlledEntity::CompatibilityFlag::Milan))
@@ -1584,8 +1568,8 @@ void ControllerImpl::updateClockDomainCounters(ControlledEntityImpl& controlledE
 			}
 		}
 
-		// Entity was advertised to the user, notify observers
-		if (controlledEntity.wasAdvertised())
+		// Entity was advertised to the user and some counters changed, notify observers
+		if (controlledEntity.wasAdvertised() && !clockDomainCounters->getChangedCounters().empty())
 		{
 			notifyObserversMethod<Controller::Observer>(&Controller::Observer::onClockDomainCountersChanged, this, &controlledEntity, clockDomainIndex, *clockDomainCounters);
 		}
@@ -1601,10 +1585,10 @@ void ControllerImpl::updateStreamInputCounters(ControlledEntityImpl& controlledE
 	if (streamCounters)
 	{
 		// Update (or set) counters
-		for (auto counter : validCounters)
-		{
-			(*streamCounters)[counter] = counters[validCounters.getPosition(counter)];
-		}
+		streamCounters->update(validCounters, counters);
+
+		// Record counters history
+		controlledEntity.recordCountersSample(entity::model::DescriptorType::StreamInput, streamIndex, validCounters.value(), counters, _countersHistoryBudget);
 
 		// If Milan device, validate counters values
 		if (controlledEntity.getCompatibilityFlags().test(ControlledEntity::CompatibilityFlag::Milan))
@@ -1620,8 +1604,8 @@ void ControllerImpl::updateStreamInputCounters(ControlledEntityImpl& controlledE
 			}
 		}
 
-		// Entity was advertised to the user, notify observers
-		if (controlledEntity.wasAdvertised())
+		// Entity was advertised to the user and some counters changed, notify observers
+		if (controlledEntity.wasAdvertised() && !streamCounters->getChangedCounters().empty())
 		{
 			notifyObserversMethod<Controller::Observer>(&Controller::Observer::onStreamInputCountersChanged, this, &controlledEntity, streamIndex, *streamCounters);
 		}
@@ -1637,10 +1621,10 @@ void ControllerImpl::updateStreamOutputCounters(ControlledEntityImpl& controlled
 	if (streamCounters)
 	{
 		// Update (or set) counters
-		for (auto counter : validCounters)
-		{
-			(*streamCounters)[counter] = counters[validCounters.getPosition(counter)];
-		}
+		streamCounters->update(validCounters, counters);
+
+		// Record counters history
+		controlledEntity.recordCountersSample(entity::model::DescriptorType::StreamOutput, streamIndex, validCounters.value(), counters, _countersHistoryBudget);
 
 		// If Milan device, validate counters values
 		if (controlledEntity.getCompatibilityFlags().test(ControlledEntity::CompatibilityFlag::Milan))
@@ -1656,8 +1640,8 @@ void ControllerImpl::updateStreamOutputCounters(ControlledEntityImpl& controlled
 			}
 		}
 
-		// Entity was advertised to the user, notify observers
-		if (controlledEntity.wasAdvertised())
+		// Entity was advertised to the user and some counters changed, notify observers
+		if (controlledEntity.wasAdvertised() && !streamCounters->getChangedCounters().empty())
 		{
 			notifyObserversMethod<Controller::Observer>(&Controller::Observer::onStreamOutputCountersChanged, this, &controlledEntity, streamIndex, *streamCounters);
 		}
@@ -1890,6 +1874,20 @@ void ControllerImpl::updateStreamInputLatency(ControlledEntityImpl& controlledEn
 	}
 }
 
+void ControllerImpl::onControlledEntityGuardReleased(SharedControlledEntityImpl const& entity) const noexcept
+{
+	// Only advertised entities have snapshots, schedule a single publication on the network thread for all the entities modified until it runs
+	if (entity->wasAdvertised() && !_shouldTerminate && _controlledEntitySnapshots.setEntityModified(entity))
+	{
+		auto const exName = _endStation->getProtocolInterface()->getExecutorName();
+		ExecutorManager::getInstance().pushJob(exName,
+			[this]()
+			{
+				_controlledEntitySnapshots.publishModifiedEntities();
+			});
+	}
+}
+
 /* ************************************************************ */
 /* Private methods                                              */
 /* ************************************************************ */
@@ -1909,7 +1907,7 @@ std::optional<bool> ControllerImpl::getIdentifyControlValue(entity::model::Contr
 	{
 		if (values.size() == 1)
 		{
-			auto const dynamicValues = values.getValues<entity::model::LinearValues<entity::model::LinearValueDynamic<std::uint8_t>>>(); // We have to store the copy or it will go out of scope if using it directly in the range-based loop
+			auto const& dynamicValues = values.getValues<entity::model::LinearValues<entity::model::LinearValueDynamic<std::uint8_t>>>();
 			auto const& value = dynamicValues.getValues()[0];
 			if (value.currentValue == 0)
 			{
@@ -2856,6 +2854,15 @@ void ControllerImpl::getStaticModel(ControlledEntityImpl* const entity) noexcept
 	queryInformation(entity, 0, entity::model::DescriptorType::Entity, 0);
 }
 
+void ControllerImpl::getStaticModelConfigurations(ControlledEntityImpl* const entity, entity::model::EntityDescriptor const& descriptor) noexcept
+{
+	entity->setEntityDescriptor(descriptor);
+	for (auto index = entity::model::ConfigurationIndex(0u); index < descriptor.configurationsCount; ++index)
+	{
+		queryInformation(entity, index, entity::model::DescriptorType::Configuration, 0u);
+	}
+}
+
 void ControllerImpl::getDynamicInfo(ControlledEntityImpl* const entity) noexcept
 {
 	class DynamicInfoVisitor : public model::EntityModelVisitor
@@ -3619,6 +3626,342 @@ void ControllerImpl::flushPackedDynamicInfoQueries(ControlledEntityImpl* const e
 	}
 }
 
+void ControllerImpl::processScheduledEntities(std::vector<UniqueIdentifier> const& entityIDs, ScheduledEntityHandler const handler, std::function<bool()> const& canContinue) noexcept
+{
+	for (auto const& entityID : entityIDs)
+	{
+		if (_shouldTerminate || (canContinue && !canContinue()))
+		{
+			break;
+		}
+		(this->*handler)(entityID);
+	}
+}
+
+void ControllerImpl::runScheduledEntityJob(UniqueIdentifier const entityID, std::function<void(ControlledEntityImpl* const entity)>&& job) noexcept
+{
+	// Entity locks and ProtocolInterface are required by the jobs of the schedulers (sending queries, changing the enumeration steps), run them on the network executor
+	auto const exName = _endStation->getProtocolInterface()->getExecutorName();
+	ExecutorManager::getInstance().pushJob(exName,
+		[this, entityID, job = std::move(job)]()
+		{
+			auto const lg = std::lock_guard{ *_controller }; // Lock the Controller itself (thus, lock it's ProtocolInterface), since we are on the Networking Thread
+
+			// Take a "scoped locked" shared copy of the ControlledEntity (nullptr if the entity went offline in the meantime)
+			auto controlledEntity = getControlledEntityImplGuard(entityID);
+
+			job(controlledEntity.get());
+		});
+}
+
+void ControllerImpl::pollEntityCounters(UniqueIdentifier const entityID) noexcept
+{
+	// Build the list of counters to refresh (only descriptors for which we already got counters, others are either not supported or not yet enumerated)
+	auto dynamicInfoParameters = entity::controller::DynamicInfoParameters{};
+	auto usePackedDynamicInfo = false;
+	{
+		// Take a "scoped locked" shared copy of the ControlledEntity
+		auto controlledEntity = getControlledEntityImplGuard(entityID, true);
+
+		if (controlledEntity && !controlledEntity->isVirtual() && controlledEntity->getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported) && controlledEntity->hasAnyConfiguration())
+		{
+			auto& entity = *controlledEntity;
+			usePackedDynamicInfo = entity.isGetDynamicInfoSupported();
+
+			if (auto const* const entityNode = entity.getEntityNode(TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull); entityNode != nullptr && entityNode->dynamicModel.counters)
+			{
+				dynamicInfoParameters.emplace_back(entity::controller::DynamicInfoParameter{ entity::LocalEntity::AemCommandStatus::Success, protocol::AemCommandType::GetCounters, { entity::model::DescriptorType::Entity, entity::model::DescriptorIndex{ 0u } } });
+			}
+			if (auto const* const configNode = entity.getCurrentConfigurationNode(TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull); configNode != nullptr)
+			{
+				for (auto const& [avbInterfaceIndex, avbInterfaceNode] : configNode->avbInterfaces)
+				{
+					if (avbInterfaceNode.dynamicModel.counters)
+					{
+						dynamicInfoParameters.emplace_back(entity::controller::DynamicInfoParameter{ entity::LocalEntity::AemCommandStatus::Success, protocol::AemCommandType::GetCounters, { entity::model::DescriptorType::AvbInterface, avbInterfaceIndex } });
+					}
+				}
+				for (auto const& [clockDomainIndex, clockDomainNode] : configNode->clockDomains)
+				{
+					if (clockDomainNode.dynamicModel.counters)
+					{
+						dynamicInfoParameters.emplace_back(entity::controller::DynamicInfoParameter{ entity::LocalEntity::AemCommandStatus::Success, protocol::AemCommandType::GetCounters, { entity::model::DescriptorType::ClockDomain, clockDomainIndex } });
+					}
+				}
+				for (auto const& [streamIndex, streamInputNode] : configNode->streamInputs)
+				{
+					if (streamInputNode.dynamicModel.counters)
+					{
+						dynamicInfoParameters.emplace_back(entity::controller::DynamicInfoParameter{ entity::LocalEntity::AemCommandStatus::Success, protocol::AemCommandType::GetCounters, { entity::model::DescriptorType::StreamInput, streamIndex } });
+					}
+				}
+				for (auto const& [streamIndex, streamOutputNode] : configNode->streamOutputs)
+				{
+					if (streamOutputNode.dynamicModel.counters)
+					{
+						dynamicInfoParameters.emplace_back(entity::controller::DynamicInfoParameter{ entity::LocalEntity::AemCommandStatus::Success, protocol::AemCommandType::GetCounters, { entity::model::DescriptorType::StreamOutput, streamIndex } });
+					}
+				}
+			}
+		}
+	}
+
+	// Split the queries into packets (packing as much as possible when GET_DYNAMIC_INFO is supported, one command per descriptor otherwise)
+	auto packets = std::vector<entity::controller::DynamicInfoParameters>{};
+	if (usePackedDynamicInfo)
+	{
+		auto const responseSize = static_cast<size_t>(protocol::aemPayload::AecpAemGetCountersResponsePayloadSize + protocol::aemPayload::AecpAemGetDynamicInfoStructureHeaderSize);
+		auto currentSize = protocol::AemAecpdu::MaximumPayloadLength_17221; // Force a new packet for the first command
+		for (auto const& param : dynamicInfoParameters)
+		{
+			if ((currentSize + responseSize) > protocol::AemAecpdu::MaximumPayloadLength_17221)
+			{
+				packets.emplace_back();
+				currentSize = 0u;
+			}
+			packets.back().emplace_back(param);
+			currentSize += responseSize;
+		}
+	}
+	else
+	{
+		for (auto const& param : dynamicInfoParameters)
+		{
+			packets.emplace_back(entity::controller::DynamicInfoParameters{ param });
+		}
+	}
+
+	// Get the commands that fit in the global budget (the others will be sent in a next round), before sending so responses cannot be processed before the poll is started
+	auto const [firstPacket, packetsCount] = _countersPollingScheduler.startPoll(entityID, static_cast<std::uint16_t>(packets.size()));
+
+	// Never lock the ControlledEntities before calling the controller
+	for (auto packetIndex = size_t{ firstPacket }; packetIndex < size_t{ firstPacket } + packetsCount; ++packetIndex)
+	{
+		auto const& params = packets[packetIndex];
+		if (usePackedDynamicInfo)
+		{
+			_controllerProxy->getDynamicInfo(entityID, params,
+				[this](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::controller::DynamicInfoParameters const& resultParameters)
+				{
+					LOG_CONTROLLER_TRACE(entityID, "Polled getDynamicInfo (Counters): {}", entity::ControllerEntity::statusToString(status));
+					if (!!status)
+					{
+						// Take a "scoped locked" shared copy of the ControlledEntity
+						auto controlledEntity = getControlledEntityImplGuard(entityID, true);
+
+						if (controlledEntity)
+						{
+							updatePolledCounters(*controlledEntity, resultParameters);
+						}
+					}
+					_countersPollingScheduler.onPollResponse(entityID, !!status);
+				});
+			continue;
+		}
+
+		auto const& [st, commandType, arguments] = params.front();
+		auto const descriptorType = std::any_cast<entity::model::DescriptorType>(arguments.at(0));
+		auto const descriptorIndex = std::any_cast<entity::model::DescriptorIndex>(arguments.at(1));
+		switch (descriptorType)
+		{
+			case entity::model::DescriptorType::Entity:
+				_controllerProxy->getEntityCounters(entityID,
+					[this](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::EntityCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID, true))
+							{
+								updateEntityCounters(*controlledEntity, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+							}
+						}
+						_countersPollingScheduler.onPollResponse(entityID, !!status);
+					});
+				break;
+			case entity::model::DescriptorType::AvbInterface:
+				_controllerProxy->getAvbInterfaceCounters(entityID, descriptorIndex,
+					[this](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::AvbInterfaceIndex const avbInterfaceIndex, entity::AvbInterfaceCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID, true))
+							{
+								updateAvbInterfaceCounters(*controlledEntity, avbInterfaceIndex, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+							}
+						}
+						_countersPollingScheduler.onPollResponse(entityID, !!status);
+					});
+				break;
+			case entity::model::DescriptorType::ClockDomain:
+				_controllerProxy->getClockDomainCounters(entityID, descriptorIndex,
+					[this](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::ClockDomainIndex const clockDomainIndex, entity::ClockDomainCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID, true))
+							{
+								updateClockDomainCounters(*controlledEntity, clockDomainIndex, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+							}
+						}
+						_countersPollingScheduler.onPollResponse(entityID, !!status);
+					});
+				break;
+			case entity::model::DescriptorType::StreamInput:
+				_controllerProxy->getStreamInputCounters(entityID, descriptorIndex,
+					[this](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::StreamIndex const streamIndex, entity::StreamInputCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID, true))
+							{
+								updateStreamInputCounters(*controlledEntity, streamIndex, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+							}
+						}
+						_countersPollingScheduler.onPollResponse(entityID, !!status);
+					});
+				break;
+			case entity::model::DescriptorType::StreamOutput:
+				_controllerProxy->getStreamOutputCounters(entityID, descriptorIndex,
+					[this](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::StreamIndex const streamIndex, entity::StreamOutputCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID, true))
+							{
+								updateStreamOutputCounters(*controlledEntity, streamIndex, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+							}
+						}
+						_countersPollingScheduler.onPollResponse(entityID, !!status);
+					});
+				break;
+			default:
+				AVDECC_ASSERT(false, "Unhandled DescriptorType");
+				_countersPollingScheduler.onPollResponse(entityID, false);
+				break;
+		}
+	}
+}
+
+void ControllerImpl::resyncEntity(UniqueIdentifier const entityID) noexcept
+{
+	runScheduledEntityJob(entityID,
+		[this, entityID](ControlledEntityImpl* const controlledEntity)
+		{
+			// Entity went offline in the meantime
+			if (!controlledEntity)
+			{
+				_resyncScheduler.removeEntity(entityID);
+				return;
+			}
+
+			auto& entity = *controlledEntity;
+
+			// Entity is still being enumerated (or already resynchronizing), try again later
+			if (!entity.getEnumerationSteps().empty())
+			{
+				_resyncScheduler.onResyncPostponed(entityID);
+				return;
+			}
+
+			// Entity failed to enumerate, it will never be advertised
+			if (!entity.wasAdvertised())
+			{
+				_resyncScheduler.removeEntity(entityID);
+				return;
+			}
+
+			LOG_CONTROLLER_INFO(entityID, "Resynchronizing entity after unsolicited notification loss");
+
+			// The sequence is known to be broken, start a new one with the next received unsolicited notification (otherwise each following notification would be detected as a loss, and trigger another resync)
+			entity.resetExpectedSequenceID();
+
+			// Register again to unsolicited notifications (with its own retries, the ones used during enumeration might have been exhausted), then only refresh the dynamic part of the model (using packed GET_DYNAMIC_INFO if supported)
+			// The subscription state is kept while registering again, so observers are only notified if the registration fails
+			entity.resetRegisterUnsolRetryTimer();
+			entity.addEnumerationStep(ControlledEntityImpl::EnumerationStep::RegisterUnsol);
+			if (entity.hasAnyConfiguration())
+			{
+				entity.addEnumerationStep(ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo);
+			}
+			entity.addEnumerationStep(ControlledEntityImpl::EnumerationStep::GetDynamicInfo);
+			checkEnumerationSteps(&entity);
+		});
+}
+
+void ControllerImpl::updatePolledCounters(ControlledEntityImpl& controlledEntity, entity::controller::DynamicInfoParameters const& resultParameters) noexcept
+{
+	// Unlike enumeration, apply all successful sub-commands (a failed one will be retried on next poll)
+	try
+	{
+		for (auto const& [st, commandType, arguments] : resultParameters)
+		{
+			if (!st || commandType != protocol::AemCommandType::GetCounters)
+			{
+				continue;
+			}
+
+			auto const descriptorType = std::any_cast<entity::model::DescriptorType>(arguments.at(0));
+			auto const descriptorIndex = std::any_cast<entity::model::DescriptorIndex>(arguments.at(1));
+			auto const validFlag = std::any_cast<entity::model::DescriptorCounterValidFlag>(arguments.at(2));
+			auto const counters = std::any_cast<entity::model::DescriptorCounters>(arguments.at(3));
+
+			switch (descriptorType)
+			{
+				case entity::model::DescriptorType::Entity:
+				{
+					auto validCounters = entity::EntityCounterValidFlags{};
+					validCounters.assign(validFlag);
+					updateEntityCounters(controlledEntity, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+					break;
+				}
+				case entity::model::DescriptorType::AvbInterface:
+				{
+					auto validCounters = entity::AvbInterfaceCounterValidFlags{};
+					validCounters.assign(validFlag);
+					updateAvbInterfaceCounters(controlledEntity, descriptorIndex, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+					break;
+				}
+				case entity::model::DescriptorType::ClockDomain:
+				{
+					auto validCounters = entity::ClockDomainCounterValidFlags{};
+					validCounters.assign(validFlag);
+					updateClockDomainCounters(controlledEntity, descriptorIndex, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+					break;
+				}
+				case entity::model::DescriptorType::StreamInput:
+				{
+					auto validCounters = entity::StreamInputCounterValidFlags{};
+					validCounters.assign(validFlag);
+					updateStreamInputCounters(controlledEntity, descriptorIndex, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+					break;
+				}
+				case entity::model::DescriptorType::StreamOutput:
+				{
+					auto validCounters = entity::StreamOutputCounterValidFlags{};
+					validCounters.assign(validFlag);
+					updateStreamOutputCounters(controlledEntity, descriptorIndex, validCounters, counters, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+					break;
+				}
+				default:
+					break;
+			}
+		}
+	}
+	catch (std::bad_any_cast const&)
+	{
+		LOG_CONTROLLER_DEBUG(controlledEntity.getEntity().getEntityID(), "Polled getDynamicInfo (Counters): Invalid response argument");
+	}
+	catch (std::out_of_range const&)
+	{
+		LOG_CONTROLLER_DEBUG(controlledEntity.getEntity().getEntityID(), "Polled getDynamicInfo (Counters): Missing response argument");
+	}
+}
+
 class CreateCachedModelVisitor : public model::EntityModelVisitor
 {
 public:
@@ -3900,6 +4243,24 @@ private:
 };
 
 
+void ControllerImpl::startEntityStaticModel(UniqueIdentifier const entityID) noexcept
+{
+	runScheduledEntityJob(entityID,
+		[this, entityID](ControlledEntityImpl* const controlledEntity)
+		{
+			// Entity went offline in the meantime
+			if (!controlledEntity)
+			{
+				_enumerationScheduler.removeEntity(entityID);
+				return;
+			}
+
+			// Resume the enumeration where it was waiting
+			LOG_CONTROLLER_DEBUG(entityID, "Leaving the enumeration queue");
+			checkEnumerationSteps(controlledEntity);
+		});
+}
+
 void ControllerImpl::checkEnumerationSteps(ControlledEntityImpl* const controlledEntity) noexcept
 {
 	auto& entity = *controlledEntity;
@@ -3926,9 +4287,17 @@ void ControllerImpl::checkEnumerationSteps(ControlledEntityImpl* const controlle
 	// Then get the static AEM
 	if (steps.test(ControlledEntityImpl::EnumerationStep::GetStaticModel))
 	{
+		// Wait for our turn in the enumeration queue (startEntityStaticModel will be called)
+		if (!_enumerationScheduler.requestStaticModel(entity.getEntity().getEntityID()))
+		{
+			LOG_CONTROLLER_DEBUG(entity.getEntity().getEntityID(), "Waiting in the enumeration queue");
+			return;
+		}
 		getStaticModel(controlledEntity);
 		return;
 	}
+	// Static AEM retrieved, release the enumeration queue slot
+	_enumerationScheduler.onStaticModelCompleted(entity.getEntity().getEntityID());
 	// Notify the entity model has been fully enumerated
 	entity.onEntityModelEnumerated();
 	// Then get descriptors dynamic information (if AEM was cached)
@@ -3990,6 +4359,10 @@ void ControllerImpl::checkEnumerationSteps(ControlledEntityImpl* const controlle
 
 			// Advertise the entity
 			entity.setAdvertised(true);
+			_enumerationScheduler.onEntityUsable(entityID);
+
+			// Publish its first snapshot, before notifying observers so they can immediately get it
+			_controlledEntitySnapshots.addEntity(entityID, entity.createSnapshot());
 
 			// Notify it is online
 			notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityOnline, this, controlledEntity);
@@ -3998,6 +4371,83 @@ void ControllerImpl::checkEnumerationSteps(ControlledEntityImpl* const controlle
 			onPostAdvertiseEntity(entity);
 		}
 	}
+	// Already advertised entity, this was a resynchronization
+	else
+	{
+		_resyncScheduler.onResyncCompleted(entity.getEntity().getEntityID());
+	}
+}
+
+void ControllerImpl::checkStaticModelCompleted(ControlledEntityImpl* const entity, entity::model::ConfigurationIndex const configurationIndex) noexcept
+{
+	// Entity already advertised, the descriptors of this configuration were retrieved on demand
+	if (entity->wasAdvertised())
+	{
+		if (entity->gotAllExpectedDescriptors(configurationIndex))
+		{
+			entity->onConfigurationStaticModelLoaded(configurationIndex);
+			completeConfigurationStaticModelLoads(entity, entity->getEntity().getEntityID(), configurationIndex);
+		}
+		return;
+	}
+
+	// Got all expected descriptors
+	if (entity->gotAllExpectedDescriptors())
+	{
+		// Clear this enumeration step and check for next one
+		entity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
+		checkEnumerationSteps(entity);
+	}
+}
+
+void ControllerImpl::completeConfigurationStaticModelLoads(ControlledEntityImpl* const entity, UniqueIdentifier const entityID, std::optional<entity::model::ConfigurationIndex> const configurationIndex) noexcept
+{
+	auto const entityIt = _configurationStaticModelLoads.find(entityID);
+	if (entityIt == _configurationStaticModelLoads.end())
+	{
+		return;
+	}
+
+	// Move the completed loads out of the map, handlers might request another load
+	auto loads = std::decay_t<decltype(entityIt->second)>{};
+	if (configurationIndex)
+	{
+		if (auto const loadIt = entityIt->second.find(*configurationIndex); loadIt != entityIt->second.end())
+		{
+			loads.insert(entityIt->second.extract(loadIt));
+		}
+	}
+	else
+	{
+		loads = std::move(entityIt->second);
+		entityIt->second.clear();
+	}
+	if (entityIt->second.empty())
+	{
+		_configurationStaticModelLoads.erase(entityIt);
+	}
+
+	for (auto const& [index, load] : loads)
+	{
+		// No entity means it went offline
+		auto const status = entity ? load.status : entity::ControllerEntity::AemCommandStatus::UnknownEntity;
+		for (auto const& handler : load.handlers)
+		{
+			utils::invokeProtectedHandler(handler, entity, status);
+		}
+	}
+}
+
+void ControllerImpl::failConfigurationStaticModelLoad(UniqueIdentifier const entityID, entity::model::ConfigurationIndex const configurationIndex, entity::ControllerEntity::AemCommandStatus const status) noexcept
+{
+	if (auto const entityIt = _configurationStaticModelLoads.find(entityID); entityIt != _configurationStaticModelLoads.end())
+	{
+		// Only keep the first error
+		if (auto const loadIt = entityIt->second.find(configurationIndex); loadIt != entityIt->second.end() && !!loadIt->second.status)
+		{
+			loadIt->second.status = status;
+		}
+	}
 }
 
 entity::model::AudioMappings ControllerImpl::validateMappings(ControlledEntityImpl& controlledEntity, std::uint16_t const maxStreams, std::uint16_t const maxClusters, entity::model::AudioMappings const& mappings) const noexcept
@@ -4039,13 +4489,13 @@ bool ControllerImpl::validateIdentifyControl(ControlledEntityImpl& controlledEnt
 		auto const controlValueType = identifyControlNode.staticModel.controlValueType.getType();
 		if (controlValueType == entity::model::ControlValueType::Type::ControlLinearUInt8)
 		{
-			auto const staticValues = identifyControlNode.staticModel.values.getValues<entity::model::LinearValues<entity::model::LinearValueStatic<std::uint8_t>>>();
+			auto const& staticValues = identifyControlNode.staticModel.values.getValues<entity::model::LinearValues<entity::model::LinearValueStatic<std::uint8_t>>>();
 			if (staticValues.countValues() == 1)
 			{
 				auto const& staticValue = staticValues.getValues()[0];
 				if (staticValue.minimum == 0 && staticValue.maximum == 255 && staticValue.step == 255 && staticValue.unit.getMultiplier() == 0 && staticValue.unit.getUnit() == entity::model::ControlValueUnit::Unit::Unitless)
 				{
-					auto const dynamicValues = identifyControlNode.dynamicModel.values.getValues<entity::model::LinearValues<entity::model::LinearValueDynamic<std::uint8_t>>>();
+					auto const& dynamicValues = identifyControlNode.dynamicModel.values.getValues<entity::model::LinearValues<entity::model::LinearValueDynamic<std::uint8_t>>>();
 					if (dynamicValues.countValues() == 1)
 					{
 						auto const& dynamicValue = dynamicValues.getValues()[0];
@@ -4839,6 +5289,9 @@ void ControllerImpl::computeAndUpdateMediaClockChain(ControlledEntityImpl& contr
 		clockDomainNode.mediaClockChain.emplace_back(std::move(node));
 	}
 
+	// Update the reverse-dependency index with the entities this chain now goes through
+	_mediaClockChainsIndex.setChain({ controlledEntity.getEntity().getEntityID(), clockDomainNode.descriptorIndex }, clockDomainNode.mediaClockChain);
+
 	// Entity was advertised to the user, notify observers
 	if (controlledEntity.wasAdvertised())
 	{
@@ -4846,6 +5299,34 @@ void ControllerImpl::computeAndUpdateMediaClockChain(ControlledEntityImpl& contr
 	}
 }
 
+// _lock should be taken when calling this method
+void ControllerImpl::forEachMediaClockChainWithEntity(UniqueIdentifier const entityID, std::function<void(ControlledEntityImpl& entity, model::ClockDomainNode& clockDomainNode)> const& handler) const noexcept
+{
+	// Only visit the chains having a node on that entity (get a copy of the keys, the handler might update the chains)
+	for (auto const& [chainEntityID, clockDomainIndex] : _mediaClockChainsIndex.getChains(entityID))
+	{
+		auto const entityIt = _controlledEntities.find(chainEntityID);
+		if (entityIt == _controlledEntities.end())
+		{
+			continue;
+		}
+
+		auto& entity = *entityIt->second;
+		if (entity.wasAdvertised() && entity.getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported) && entity.hasAnyConfiguration())
+		{
+			auto* const configNode = entity.getCurrentConfigurationNode(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+			if (configNode != nullptr)
+			{
+				// The chain might be from a previous configuration of the entity
+				if (auto const clockDomainIt = configNode->clockDomains.find(clockDomainIndex); clockDomainIt != configNode->clockDomains.end())
+				{
+					handler(entity, clockDomainIt->second);
+				}
+			}
+		}
+	}
+}
+
 /** Actions to be done on the entity, just before advertising, which require looking at other already advertised entities (only for attached entities) */
 void ControllerImpl::onPreAdvertiseEntity(ControlledEntityImpl& controlledEntity) noexcept
 {
@@ -4870,64 +5351,67 @@ void ControllerImpl::onPreAdvertiseEntity(ControlledEntityImpl& controlledEntity
 			{
 				auto const& talkerConfigurationNode = controlledEntity.getCurrentConfigurationNode();
 
-				// Process all entities that are connected to any of our output streams
-				for (auto const& entityKV : _controlledEntities)
+				// Process all entities that are connected to any of our output streams (using the connections index, so we only visit the actual listeners)
+				for (auto const& [streamOutputIndex, streamOutputNode] : talkerConfigurationNode.streamOutputs)
 				{
-					auto const listenerEntityID = entityKV.first;
-					auto& listenerEntity = *(entityKV.second);
+					auto const talkerIdentification = entity::model::StreamIdentification{ entityID, streamOutputIndex };
 
-					// Don't process self, not yet advertised entities, nor different virtual/physical kind
-					if (listenerEntityID == entityID || !listenerEntity.wasAdvertised() || isVirtualEntity != listenerEntity.isVirtual())
+					for (auto const& listenerStream : _streamConnectionsIndex.getListeners(talkerIdentification))
 					{
-						continue;
-					}
+						auto const listenerEntityID = listenerStream.entityID;
+						auto const entityIt = _controlledEntities.find(listenerEntityID);
+						if (entityIt == _controlledEntities.end())
+						{
+							continue;
+						}
+						auto& listenerEntity = *(entityIt->second);
 
-					// We need the AEM to check for Listener connections
-					if (listenerEntity.getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported) && listenerEntity.hasAnyConfiguration())
-					{
-						try
+						// Don't process self, not yet advertised entities, nor different virtual/physical kind
+						if (listenerEntityID == entityID || !listenerEntity.wasAdvertised() || isVirtualEntity != listenerEntity.isVirtual())
 						{
-							auto const& configurationNode = listenerEntity.getCurrentConfigurationNode();
+							continue;
+						}
 
-							// Check each of this Listener's Input Streams
-							for (auto const& [streamIndex, streamInputNode] : configurationNode.streamInputs)
+						// We need the AEM to check for Listener connections
+						if (listenerEntity.getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported) && listenerEntity.hasAnyConfiguration())
+						{
+							try
 							{
-								// If the Stream is Connected
-								if (streamInputNode.dynamicModel.connectionInfo.state == entity::model::StreamInputConnectionInfo::State::Connected)
+								auto const& configurationNode = listenerEntity.getCurrentConfigurationNode();
+								auto const streamIndex = listenerStream.streamIndex;
+								auto const streamInputIt = configurationNode.streamInputs.find(streamIndex);
+								if (streamInputIt == configurationNode.streamInputs.end())
+								{
+									continue;
+								}
+								auto const& streamInputNode = streamInputIt->second;
+
+								// If the Stream is Connected to our talker
+								if (streamInputNode.dynamicModel.connectionInfo.state == entity::model::StreamInputConnectionInfo::State::Connected && streamInputNode.dynamicModel.connectionInfo.talkerStream == talkerIdentification)
 								{
-									// Check against all the Talker's Output Streams
-									for (auto const& [streamOutputIndex, streamOutputNode] : talkerConfigurationNode.streamOutputs)
+									// We want to build an accurate list of connections, based on the known listeners (already advertised only, the other ones will update once ready to advertise themselves)
 									{
-										auto const talkerIdentification = entity::model::StreamIdentification{ entityID, streamOutputIndex };
+										// Add this listener to our list of connected entities
+										controlledEntity.addStreamOutputConnection(streamOutputIndex, listenerStream, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+										// Do not trigger onStreamOutputConnectionsChanged notification, we are just about to advertise the entity
+									}
 
-										// Connected to our talker
-										if (streamInputNode.dynamicModel.connectionInfo.talkerStream == talkerIdentification)
+									// Check for Latency Error (if the Listener was advertised before this Talker, it couldn't check Talker's PresentationTime, so do it now)
+									// If we have StreamDynamicInfo data
+									if (streamOutputNode.dynamicModel.streamDynamicInfo && streamInputNode.dynamicModel.streamDynamicInfo)
+									{
+										// If we have a msrpAccumulatedLatency value
+										if ((*streamInputNode.dynamicModel.streamDynamicInfo).msrpAccumulatedLatency && (*streamOutputNode.dynamicModel.streamDynamicInfo).msrpAccumulatedLatency)
 										{
-											// We want to build an accurate list of connections, based on the known listeners (already advertised only, the other ones will update once ready to advertise themselves)
-											{
-												// Add this listener to our list of connected entities
-												controlledEntity.addStreamOutputConnection(streamOutputIndex, { listenerEntityID, streamIndex }, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
-												// Do not trigger onStreamOutputConnectionsChanged notification, we are just about to advertise the entity
-											}
-
-											// Check for Latency Error (if the Listener was advertised before this Talker, it couldn't check Talker's PresentationTime, so do it now)
-											// If we have StreamDynamicInfo data
-											if (streamOutputNode.dynamicModel.streamDynamicInfo && streamInputNode.dynamicModel.streamDynamicInfo)
-											{
-												// If we have a msrpAccumulatedLatency value
-												if ((*streamInputNode.dynamicModel.streamDynamicInfo).msrpAccumulatedLatency && (*streamOutputNode.dynamicModel.streamDynamicInfo).msrpAccumulatedLatency)
-												{
-													updateStreamInputLatency(listenerEntity, streamIndex, *(*streamInputNode.dynamicModel.streamDynamicInfo).msrpAccumulatedLatency > *(*streamOutputNode.dynamicModel.streamDynamicInfo).msrpAccumulatedLatency);
-												}
-											}
+											updateStreamInputLatency(listenerEntity, streamIndex, *(*streamInputNode.dynamicModel.streamDynamicInfo).msrpAccumulatedLatency > *(*streamOutputNode.dynamicModel.streamDynamicInfo).msrpAccumulatedLatency);
 										}
 									}
 								}
 							}
-						}
-						catch (...)
-						{
-							AVDECC_ASSERT(false, "Unexpected exception");
+							catch (...)
+							{
+								AVDECC_ASSERT(false, "Unexpected exception");
+							}
 						}
 					}
 				}
@@ -4952,6 +5436,9 @@ void ControllerImpl::onPreAdvertiseEntity(ControlledEntityImpl& controlledEntity
 				{
 					auto isOverLatency = false;
 
+					// Make sure the connections index is up-to-date (the connection state might not have been received through a notification, for virtual entities for example)
+					_streamConnectionsIndex.setListenerConnection({ entityID, streamIndex }, streamInputNode.dynamicModel.connectionInfo.talkerStream);
+
 					// If the Stream is Connected, search for the Talker we are connected to
 					if (streamInputNode.dynamicModel.connectionInfo.state == entity::model::StreamInputConnectionInfo::State::Connected)
 					{
@@ -5020,44 +5507,38 @@ void ControllerImpl::onPreAdvertiseEntity(ControlledEntityImpl& controlledEntity
 				}
 			}
 
-			// Process all other entities and update media clock if needed
-			for (auto& [eid, entity] : _controlledEntities)
-			{
-				if (eid != entityID && entity->wasAdvertised() && entity->getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported) && entity->hasAnyConfiguration())
+			// Process all other entities whose chain has a node on this entity and update media clock if needed
+			forEachMediaClockChainWithEntity(entityID,
+				[this, entityID](ControlledEntityImpl& entity, model::ClockDomainNode& clockDomainNode)
 				{
-					auto* const configNode = entity->getCurrentConfigurationNode(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
-					if (configNode != nullptr)
+					// Don't process self, already computed
+					if (entity.getEntity().getEntityID() == entityID)
 					{
-						for (auto& clockDomainKV : configNode->clockDomains)
+						return;
+					}
+
+					if (AVDECC_ASSERT_WITH_RET(!clockDomainNode.mediaClockChain.empty(), "At least one node should be in the chain"))
+					{
+						// Check if the chain is incomplete due to this entity being Offline
+						auto const& lastNode = clockDomainNode.mediaClockChain.back();
+						if (lastNode.entityID == entityID && AVDECC_ASSERT_WITH_RET(lastNode.status == model::MediaClockChainNode::Status::EntityOffline, "Newly discovered entity should be offline"))
 						{
-							auto& clockDomainNode = clockDomainKV.second;
+							// Save the domain/stream indexes, we'll continue from it
+							auto const continueDomainIndex = lastNode.clockDomainIndex;
+							auto const continueStreamOutputIndex = lastNode.streamOutputIndex;
+
+							// Remove that entity from the chain, it will be recomputed
+							clockDomainNode.mediaClockChain.pop_back();
 
 							// Get the domain index matching the StreamOutput of this entity
-							if (AVDECC_ASSERT_WITH_RET(!clockDomainNode.mediaClockChain.empty(), "At least one node should be in the chain"))
+							if (AVDECC_ASSERT_WITH_RET(!clockDomainNode.mediaClockChain.empty(), "At least one node should still be in the chain"))
 							{
-								// Check if the chain is incomplete due to this entity being Offline
-								auto const& lastNode = clockDomainNode.mediaClockChain.back();
-								if (lastNode.entityID == entityID && AVDECC_ASSERT_WITH_RET(lastNode.status == model::MediaClockChainNode::Status::EntityOffline, "Newly discovered entity should be offline"))
-								{
-									// Save the domain/stream indexes, we'll continue from it
-									auto const continueDomainIndex = lastNode.clockDomainIndex;
-									auto const continueStreamOutputIndex = lastNode.streamOutputIndex;
-
-									// Remove that entity from the chain, it will be recomputed
-									clockDomainNode.mediaClockChain.pop_back();
-
-									// Get the domain index matching the StreamOutput of this entity
-									if (AVDECC_ASSERT_WITH_RET(!clockDomainNode.mediaClockChain.empty(), "At least one node should still be in the chain"))
-									{
-										// Update the chain starting from this entity
-										computeAndUpdateMediaClockChain(*entity, clockDomainNode, entityID, continueDomainIndex, continueStreamOutputIndex, entityID);
-									}
-								}
+								// Update the chain starting from this entity
+								computeAndUpdateMediaClockChain(entity, clockDomainNode, entityID, continueDomainIndex, continueStreamOutputIndex, entityID);
 							}
 						}
 					}
-				}
-			}
+				});
 		}
 	}
 }
@@ -5074,6 +5555,12 @@ void ControllerImpl::onPostAdvertiseEntity(ControlledEntityImpl& controlledEntit
 			notifyObserversMethod<Controller::Observer>(&Controller::Observer::onIdentificationStarted, this, &controlledEntity);
 		}
 	}
+
+	// Schedule periodic counters refresh (virtual entities are not polled)
+	if (!isVirtualEntity && controlledEntity.getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported))
+	{
+		_countersPollingScheduler.addEntity(controlledEntity.getEntity().getEntityID());
+	}
 }
 
 void ControllerImpl::onPreUnadvertiseEntity(ControlledEntityImpl& controlledEntity) noexcept
@@ -5084,6 +5571,23 @@ void ControllerImpl::onPreUnadvertiseEntity(ControlledEntityImpl& controlledEnti
 	auto const hasAnyConfiguration = controlledEntity.hasAnyConfiguration();
 	auto const isVirtualEntity = controlledEntity.isVirtual();
 
+	// No longer refresh counters
+	_countersPollingScheduler.removeEntity(entityID);
+
+	// Cancel any pending resynchronization
+	_resyncScheduler.removeEntity(entityID);
+
+	// Fail all configurations still being retrieved on demand
+	completeConfigurationStaticModelLoads(nullptr, entityID, std::nullopt);
+
+	// Keep the static model, so it can be reused if the entity comes back online (or is refreshed) with the same EntityModelID (and an unchanged CONFIGURATION descriptor)
+	if (!isVirtualEntity && isAemSupported && hasAnyConfiguration && e.getEntityModelID() && !controlledEntity.gotFatalEnumerationError())
+	{
+		auto visitor = CreateCachedModelVisitor{};
+		controlledEntity.accept(&visitor, true);
+		_recentEntityModels.addEntityModel(entityID, e.getEntityModelID(), visitor.getModel());
+	}
+
 	// For a Listener, we want to inform all the talkers we are connected to, that we left
 	if (e.getListenerCapabilities().test(entity::ListenerCapability::Implemented) && isAemSupported && hasAnyConfiguration)
 	{
@@ -5123,37 +5627,27 @@ void ControllerImpl::onPreUnadvertiseEntity(ControlledEntityImpl& controlledEnti
 		// Lock to protect _controlledEntities
 		auto const lg = std::lock_guard{ _lock };
 
-		for (auto& [eid, entity] : _controlledEntities)
-		{
-			if (entity->wasAdvertised() && entity->getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported) && entity->hasAnyConfiguration())
+		forEachMediaClockChainWithEntity(entityID,
+			[this, entityID](ControlledEntityImpl& entity, model::ClockDomainNode& clockDomainNode)
 			{
-				auto* const configNode = entity->getCurrentConfigurationNode(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
-				if (configNode != nullptr)
+				// Check if the chain has a node on that departing entity
+				for (auto nodeIt = clockDomainNode.mediaClockChain.begin(); nodeIt != clockDomainNode.mediaClockChain.end(); ++nodeIt)
 				{
-					for (auto& clockDomainKV : configNode->clockDomains)
+					if (nodeIt->entityID == entityID)
 					{
-						auto& clockDomainNode = clockDomainKV.second;
-						// Check if the chain has a node on that departing entity
-						for (auto nodeIt = clockDomainNode.mediaClockChain.begin(); nodeIt != clockDomainNode.mediaClockChain.end(); ++nodeIt)
-						{
-							if (nodeIt->entityID == entityID)
-							{
-								// Save the domain/stream indexes, we'll continue from it
-								auto const continueDomainIndex = nodeIt->clockDomainIndex;
-								auto const continueStreamOutputIndex = nodeIt->streamOutputIndex;
+						// Save the domain/stream indexes, we'll continue from it
+						auto const continueDomainIndex = nodeIt->clockDomainIndex;
+						auto const continueStreamOutputIndex = nodeIt->streamOutputIndex;
 
-								// Remove this node and all following nodes
-								clockDomainNode.mediaClockChain.erase(nodeIt, clockDomainNode.mediaClockChain.end());
+						// Remove this node and all following nodes
+						clockDomainNode.mediaClockChain.erase(nodeIt, clockDomainNode.mediaClockChain.end());
 
-								// Update the chain starting from this entity
-								computeAndUpdateMediaClockChain(*entity, clockDomainNode, entityID, continueDomainIndex, continueStreamOutputIndex, {});
-								break;
-							}
-						}
+						// Update the chain starting from this entity
+						computeAndUpdateMediaClockChain(entity, clockDomainNode, entityID, continueDomainIndex, continueStreamOutputIndex, {});
+						break;
 					}
 				}
-			}
-		}
+			});
 	}
 }
 
@@ -5750,6 +6244,13 @@ bool ControllerImpl::processGetStaticModelFailureStatus(entity::ControllerEntity
 			return true;
 		}
 		case FailureAction::ErrorFatal:
+			// Entity already advertised (configuration retrieved on demand), only fail the retrieval instead of the whole entity
+			if (entity->wasAdvertised())
+			{
+				LOG_CONTROLLER_WARN(entityID, "Failed to retrieve descriptor of configuration {} on demand ({}): {}", configurationIndex, entity::model::descriptorTypeToString(descriptorType), entity::LocalEntity::statusToString(status));
+				failConfigurationStaticModelLoad(entityID, configurationIndex, status);
+				return true;
+			}
 			return false;
 		default:
 			return false;
@@ -6079,6 +6580,13 @@ bool ControllerImpl::processGetDescriptorDynamicInfoFailureStatus(entity::Contro
 		}
 	}
 
+	// Entity already advertised (resynchronization), its model is complete so just ignore this descriptor
+	if (fallbackStaticModelEnumeration && entity->wasAdvertised())
+	{
+		LOG_CONTROLLER_WARN(entityID, "Failed to resynchronize descriptor dynamic info ({}): {}", ControlledEntityImpl::descriptorDynamicInfoTypeToString(descriptorDynamicInfoType), entity::LocalEntity::statusToString(status));
+		return true;
+	}
+
 	if (fallbackStaticModelEnumeration)
 	{
 		// Failed to retrieve single DescriptorDynamicInformation, retrieve the corresponding descriptor instead if possible, otherwise switch back to full StaticModel enumeration
@@ -6258,6 +6766,13 @@ void ControllerImpl::handleListenerStreamStateNotification(entity::model::Stream
 			}
 			auto const previousInfo = listenerEntity->setStreamInputConnectionInformation(listenerStream.streamIndex, info, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
 
+			// Update the connections index
+			{
+				// Lock to protect _streamConnectionsIndex
+				auto const lg = std::lock_guard{ _lock };
+				_streamConnectionsIndex.setListenerConnection(listenerStream, info.talkerStream);
+			}
+
 			// Entity was advertised to the user, notify observers
 			if (listenerEntity->wasAdvertised() && previousInfo != info)
 			{
@@ -6352,22 +6867,8 @@ void ControllerImpl::handleListenerStreamStateNotification(entity::model::Stream
 
 					if (updateMediaClockChain)
 					{
-						// Update all entities for which the chain has a node with a connection to that stream
-						for (auto& [eid, entity] : _controlledEntities)
-						{
-							if (entity->wasAdvertised() && entity->getEntity().getEntityCapabilities().test(entity::EntityCapability::AemSupported) && entity->hasAnyConfiguration())
-							{
-								auto* const configNode = entity->getCurrentConfigurationNode(TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
-								if (configNode != nullptr)
-								{
-									for (auto& clockDomainKV : configNode->clockDomains)
-									{
-										auto& clockDomainNode = clockDomainKV.second;
-										updateMediaClockChain(*entity, clockDomainNode);
-									}
-								}
-							}
-						}
+						// Update all entities for which the chain has a node on that listener (only those can have a connection to that stream)
+						forEachMediaClockChainWithEntity(listenerStream.entityID, updateMediaClockChain);
 					}
 				}
 
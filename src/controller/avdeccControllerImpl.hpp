@@ -31,7 +31,16 @@
 #endif // ENABLE_AVDECC_FEATURE_JSON
 
 #include "avdeccControlledEntityImpl.hpp"
+#include "avdeccControlledEntitySnapshots.hpp"
 #include "avdeccControllerProxy.hpp"
+#include "avdeccControlValuesStreams.hpp"
+#include "avdeccBatchCommandsContext.hpp"
+#include "avdeccCountersPollingScheduler.hpp"
+#include "avdeccResyncScheduler.hpp"
+#include "avdeccRecentEntityModels.hpp"
+#include "avdeccEnumerationScheduler.hpp"
+#include "avdeccStreamConnectionsIndex.hpp"
+#include "avdeccMediaClockChainsIndex.hpp"
 
 #include <string>
 #include <unordered_map>
@@ -89,8 +98,21 @@ private:
 	virtual void disableEntityModelCache() noexcept override;
 	virtual void enableFullStaticEntityModelEnumeration() noexcept override;
 	virtual void disableFullStaticEntityModelEnumeration() noexcept override;
+	virtual void loadConfigurationStaticModel(UniqueIdentifier const targetEntityID, entity::model::ConfigurationIndex const configurationIndex, LoadConfigurationStaticModelHandler const& handler) noexcept override;
 	virtual void enableFastEnumeration() noexcept override;
 	virtual void disableFastEnumeration() noexcept override;
+	virtual void enableCountersHistory(std::uint16_t const samplesPerDescriptor, std::size_t const maxMemorySize) noexcept override;
+	virtual void disableCountersHistory() noexcept override;
+	virtual void enableCountersPolling(std::chrono::milliseconds const period, std::uint16_t const maxInflightCommands) noexcept override;
+	virtual void disableCountersPolling() noexcept override;
+	virtual void enableEnumerationScheduling(std::uint16_t const maxConcurrentEntities) noexcept override;
+	virtual void disableEnumerationScheduling() noexcept override;
+	virtual void setEnumerationPriority(UniqueIdentifier const entityID, std::optional<EnumerationPriority> const priority) noexcept override;
+	virtual EnumerationStatistics getEnumerationStatistics() const noexcept override;
+
+	/* Control values streaming */
+	virtual ControlValuesSubscription::SharedPointer subscribeToControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex, std::uint16_t const decimation, std::uint16_t const ringCapacity) noexcept override;
+	virtual void unsubscribeFromControlValues(ControlValuesSubscription::SharedPointer const& subscription) noexcept override;
 
 	/* Enumeration and Control Protocol (AECP) AEM */
 	virtual void acquireEntity(UniqueIdentifier const targetEntityID, bool const isPersistent, AcquireEntityHandler const& handler) const noexcept override;
@@ -153,7 +175,11 @@ private:
 	virtual void disconnectTalkerStream(entity::model::StreamIdentification const& talkerStream, entity::model::StreamIdentification const& listenerStream, DisconnectTalkerStreamHandler const& handler) const noexcept override;
 	virtual void getListenerStreamState(entity::model::StreamIdentification const& listenerStream, GetListenerStreamStateHandler const& handler) const noexcept override;
 
+	/* Batched commands */
+	virtual void executeBatchCommands(BatchCommands const& commands, BatchCommandsHandler const& handler) const noexcept override;
+
 	virtual ControlledEntityGuard getControlledEntityGuard(UniqueIdentifier const entityID) const noexcept override;
+	virtual SharedConstControlledEntity getControlledEntitySnapshot(UniqueIdentifier const entityID) const noexcept override;
 
 	virtual void requestExclusiveAccess(UniqueIdentifier const entityID, ExclusiveAccessToken::AccessType const type, RequestExclusiveAccessResultHandler&& handler) const noexcept override;
 
@@ -389,6 +415,7 @@ private:
 	static void updateRedundancyWarning(ControllerImpl const* const controller, ControlledEntityImpl& controlledEntity, bool const isWarning) noexcept;
 	static void updateControlCurrentValueOutOfBounds(ControllerImpl const* const controller, ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, bool const isOutOfBounds) noexcept;
 	void updateStreamInputLatency(ControlledEntityImpl& controlledEntity, entity::model::StreamIndex const streamIndex, bool const isOverLatency) const noexcept;
+	void onControlledEntityGuardReleased(SharedControlledEntityImpl const& entity) const noexcept;
 
 	/* ************************************************************ */
 	/* Private classes                                              */
@@ -467,9 +494,10 @@ private:
 		// Default constructor to allow creation of an empty Guard
 		ControlledEntityImplGuard() noexcept {}
 
-		ControlledEntityImplGuard(SharedControlledEntityImpl&& entity, bool const locked)
+		ControlledEntityImplGuard(SharedControlledEntityImpl&& entity, bool const locked, ControllerImpl const* const controller = nullptr)
 			: _controlledEntity(std::move(entity))
 			, _locked(locked)
+			, _controller(controller)
 		{
 			if (_controlledEntity && _locked)
 			{
@@ -496,6 +524,11 @@ private:
 		{
 			if (_controlledEntity && _locked)
 			{
+				// The entity might have been modified while locked, a new snapshot will have to be published
+				if (_controller)
+				{
+					_controller->onControlledEntityGuardReleased(_controlledEntity);
+				}
 				_controlledEntity->unlock();
 				_locked = false;
 			}
@@ -503,6 +536,7 @@ private:
 
 		SharedControlledEntityImpl _controlledEntity{ nullptr };
 		bool _locked{ false };
+		ControllerImpl const* _controller{ nullptr }; // Controller to notify when the guard is released (nullptr for entities not managed by a controller)
 	};
 
 	/** A guard around a ControlledEntityImpl that guarantees it won't be destroyed while the Guard is alive. All access to the underlying object is blocked. */
@@ -647,10 +681,21 @@ private:
 	void registerUnsol(ControlledEntityImpl* const entity) noexcept;
 	void unregisterUnsol(ControlledEntityImpl* const entity) noexcept;
 	void getStaticModel(ControlledEntityImpl* const entity) noexcept;
+	void getStaticModelConfigurations(ControlledEntityImpl* const entity, entity::model::EntityDescriptor const& descriptor) noexcept;
 	void getDynamicInfo(ControlledEntityImpl* const entity) noexcept;
 	void getDescriptorDynamicInfo(ControlledEntityImpl* const entity) noexcept;
 	void flushPackedDynamicInfoQueries(ControlledEntityImpl* const entity, entity::controller::DynamicInfoParameters const& dynamicInfoParameters, ControlledEntityImpl::EnumerationStep const step) noexcept;
+	using ScheduledEntityHandler = void (ControllerImpl::*)(UniqueIdentifier const entityID) noexcept;
+	void processScheduledEntities(std::vector<UniqueIdentifier> const& entityIDs, ScheduledEntityHandler const handler, std::function<bool()> const& canContinue = {}) noexcept;
+	void runScheduledEntityJob(UniqueIdentifier const entityID, std::function<void(ControlledEntityImpl* const entity)>&& job) noexcept;
+	void pollEntityCounters(UniqueIdentifier const entityID) noexcept;
+	void resyncEntity(UniqueIdentifier const entityID) noexcept;
+	void startEntityStaticModel(UniqueIdentifier const entityID) noexcept;
+	void updatePolledCounters(ControlledEntityImpl& controlledEntity, entity::controller::DynamicInfoParameters const& resultParameters) noexcept;
 	void checkEnumerationSteps(ControlledEntityImpl* const entity) noexcept;
+	void checkStaticModelCompleted(ControlledEntityImpl* const entity, entity::model::ConfigurationIndex const configurationIndex) noexcept;
+	void completeConfigurationStaticModelLoads(ControlledEntityImpl* const entity, UniqueIdentifier const entityID, std::optional<entity::model::ConfigurationIndex> const configurationIndex) noexcept;
+	void failConfigurationStaticModelLoad(UniqueIdentifier const entityID, entity::model::ConfigurationIndex const configurationIndex, entity::ControllerEntity::AemCommandStatus const status) noexcept;
 	template<entity::model::DescriptorType StreamPortType>
 	entity::model::AudioMappings validateMappings(ControlledEntityImpl& controlledEntity, entity::model::StreamPortIndex const streamPortIndex, entity::model::AudioMappings const& mappings) const noexcept
 	{
@@ -685,6 +730,7 @@ private:
 	static void validateEntityModel(ControlledEntityImpl& controlledEntity) noexcept;
 	static void validateEntity(ControlledEntityImpl& controlledEntity) noexcept;
 	void computeAndUpdateMediaClockChain(ControlledEntityImpl& controlledEntity, model::ClockDomainNode& clockDomainNode, UniqueIdentifier const continueFromEntityID, entity::model::ClockDomainIndex const continueFromEntityDomainIndex, std::optional<entity::model::StreamIndex> const continueFromStreamOutputIndex, UniqueIdentifier const beingAdvertisedEntity) const noexcept;
+	void forEachMediaClockChainWithEntity(UniqueIdentifier const entityID, std::function<void(ControlledEntityImpl& entity, model::ClockDomainNode& clockDomainNode)> const& handler) const noexcept;
 	void onPreAdvertiseEntity(ControlledEntityImpl& controlledEntity) noexcept;
 	void onPostAdvertiseEntity(ControlledEntityImpl& controlledEntity) noexcept;
 	void onPreUnadvertiseEntity(ControlledEntityImpl& controlledEntity) noexcept;
@@ -764,7 +810,7 @@ private:
 			}
 		}
 
-		return ControlledEntityImplGuard{ std::move(entity), locked };
+		return ControlledEntityImplGuard{ std::move(entity), locked, this };
 	}
 
 	/* ************************************************************ */
@@ -773,14 +819,29 @@ private:
 	mutable std::recursive_mutex _lock{}; // A mutex to protect all sensitive data members
 	ControlledEntityImpl::LockInformation::SharedPointer _entitiesSharedLockInformation{ std::make_shared<ControlledEntityImpl::LockInformation>() }; // The SharedLockInformation to be used by all managed ControlledEntities
 	std::unordered_map<UniqueIdentifier, SharedControlledEntityImpl, UniqueIdentifier::hash> _controlledEntities;
+	mutable ControlledEntitySnapshots _controlledEntitySnapshots{}; // Thread-safe (declared before _endStation, publication jobs might be flushed when it is destroyed)
 	EndStation::UniquePointer _endStation{ nullptr, nullptr };
 	entity::ControllerEntity* _controller{ nullptr };
 	std::unique_ptr<ControllerVirtualProxy> _controllerProxy{ nullptr };
 	std::string _preferedLocale{ "en-US" };
 	bool _fullStaticModelEnumeration{ false };
 	bool _enablePackedGetDynamicInfo{ false };
+	CountersHistoryBudget::SharedPointer _countersHistoryBudget{ nullptr }; // Only accessed from the networking thread
 	bool _shouldTerminate{ false };
 	DelayedQueries _delayedQueries{};
+	CountersPollingScheduler _countersPollingScheduler{}; // Thread-safe
+	ResyncScheduler _resyncScheduler{}; // Thread-safe
+	RecentEntityModels _recentEntityModels{}; // Only accessed from the networking thread
+	EnumerationScheduler _enumerationScheduler{}; // Thread-safe
+	struct ConfigurationStaticModelLoad
+	{
+		std::vector<LoadConfigurationStaticModelHandler> handlers{};
+		entity::ControllerEntity::AemCommandStatus status{ entity::ControllerEntity::AemCommandStatus::Success };
+	};
+	std::unordered_map<UniqueIdentifier, std::unordered_map<entity::model::ConfigurationIndex, ConfigurationStaticModelLoad>, UniqueIdentifier::hash> _configurationStaticModelLoads{}; // Only accessed from the networking thread
+	ControlValuesStreams _controlValuesStreams{}; // Thread-safe
+	mutable StreamConnectionsIndex _streamConnectionsIndex{}; // Index of all listener stream connections, protected by _lock
+	mutable MediaClockChainsIndex _mediaClockChainsIndex{}; // Entities traversed by each media clock chain, protected by _lock
 	std::unordered_map<UniqueIdentifier, std::chrono::time_point<std::chrono::system_clock>, UniqueIdentifier::hash> _entityIdentifications{}; // Holds Entity to Controller Identification Information
 	mutable std::unordered_map<UniqueIdentifier, ControllerIdentificationState, UniqueIdentifier::hash> _controllerIdentifications{}; // Holds Controller to Entity Identification Information
 	mutable std::unordered_map<UniqueIdentifier, std::set<ExclusiveAccessTokenImpl*>, UniqueIdentifier::hash> _exclusiveAccessTokens{};
@@ -78,7 +78,7 @@ void ControllerImpl::onEntityOnline(entity::controller::Interface const* const c
 
 	if (controlledEntity)
 	{
-		auto guardedEntity = ControlledEntityImplGuard{ std::move(controlledEntity), true };
+		auto guardedEntity = ControlledEntityImplGuard{ std::move(controlledEntity), true, this };
 
 		// New entity get everything we can from it
 		auto steps = ControlledEntityImpl::EnumerationSteps{};
@@ -107,6 +107,7 @@ void ControllerImpl::onEntityOnline(entity::controller::Interface const* const c
 
 		// Save the time we start enumeration
 		guardedEntity->setStartEnumerationTime(std::chrono::steady_clock::now());
+		_enumerationScheduler.onEntityDiscovered(entityID, entity.getTalkerCapabilities().test(entity::TalkerCapability::Implemented));
 
 		// Check first enumeration step
 		checkEnumerationSteps(guardedEntity.get());
@@ -155,8 +156,23 @@ void ControllerImpl::onEntityOffline(entity::controller::Interface const* const
 			controlledEntity = entityIt->second;
 			_controlledEntities.erase(entityIt);
 		}
+
+		// Remove the connections of the entity's listener streams
+		_streamConnectionsIndex.removeListenerEntity(entityID);
+
+		// Remove the media clock chains of the entity
+		_mediaClockChainsIndex.removeEntityChains(entityID);
 	}
 
+	// Leave the enumeration queue
+	_enumerationScheduler.removeEntity(entityID);
+
+	// Stop streaming the control values (also reached when the configuration changes, the controls might no longer be the same)
+	_controlValuesStreams.removeEntity(entityID);
+
+	// Stop publishing its snapshots (the ones already returned remain valid)
+	_controlledEntitySnapshots.removeEntity(entityID);
+
 	if (controlledEntity)
 	{
 		// Entity was advertised to the user, notify observers
@@ -639,6 +655,12 @@ void ControllerImpl::onClockSourceChanged(entity::controller::Interface const* c
 
 void ControllerImpl::onControlValuesChanged(entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex, MemoryBuffer const& packedControlValues) noexcept
 {
+	// Streamed controls (meters) bypass the model and the observers
+	if (_controlValuesStreams.dispatch(entityID, controlIndex, packedControlValues))
+	{
+		return;
+	}
+
 	// Take a "scoped locked" shared copy of the ControlledEntity
 	auto controlledEntity = getControlledEntityImplGuard(entityID);
 
@@ -723,6 +745,9 @@ void ControllerImpl::onAsPathChanged(entity::controller::Interface const* const
 
 void ControllerImpl::onEntityCountersChanged(entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::EntityCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters) noexcept
 {
+	// Entity sent unsolicited counters, no need to poll it for a while
+	_countersPollingScheduler.onUnsolicitedCounters(entityID);
+
 	// Take a "scoped locked" shared copy of the ControlledEntity
 	auto controlledEntity = getControlledEntityImplGuard(entityID);
 
@@ -735,6 +760,9 @@ void ControllerImpl::onEntityCountersChanged(entity::controller::Interface const
 
 void ControllerImpl::onAvbInterfaceCountersChanged(entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::model::AvbInterfaceIndex const avbInterfaceIndex, entity::AvbInterfaceCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters) noexcept
 {
+	// Entity sent unsolicited counters, no need to poll it for a while
+	_countersPollingScheduler.onUnsolicitedCounters(entityID);
+
 	// Take a "scoped locked" shared copy of the ControlledEntity
 	auto controlledEntity = getControlledEntityImplGuard(entityID);
 
@@ -747,6 +775,9 @@ void ControllerImpl::onAvbInterfaceCountersChanged(entity::controller::Interface
 
 void ControllerImpl::onClockDomainCountersChanged(entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::model::ClockDomainIndex const clockDomainIndex, entity::ClockDomainCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters) noexcept
 {
+	// Entity sent unsolicited counters, no need to poll it for a while
+	_countersPollingScheduler.onUnsolicitedCounters(entityID);
+
 	// Take a "scoped locked" shared copy of the ControlledEntity
 	auto controlledEntity = getControlledEntityImplGuard(entityID);
 
@@ -759,6 +790,9 @@ void ControllerImpl::onClockDomainCountersChanged(entity::controller::Interface
 
 void ControllerImpl::onStreamInputCountersChanged(entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::model::StreamIndex const streamIndex, entity::StreamInputCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters) noexcept
 {
+	// Entity sent unsolicited counters, no need to poll it for a while
+	_countersPollingScheduler.onUnsolicitedCounters(entityID);
+
 	// Take a "scoped locked" shared copy of the ControlledEntity
 	auto controlledEntity = getControlledEntityImplGuard(entityID);
 
@@ -771,6 +805,9 @@ void ControllerImpl::onStreamInputCountersChanged(entity::controller::Interface
 
 void ControllerImpl::onStreamOutputCountersChanged(entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::model::StreamIndex const streamIndex, entity::StreamOutputCounterValidFlags const validCounters, entity::model::DescriptorCounters const& counters) noexcept
 {
+	// Entity sent unsolicited counters, no need to poll it for a while
+	_countersPollingScheduler.onUnsolicitedCounters(entityID);
+
 	// Take a "scoped locked" shared copy of the ControlledEntity
 	auto controlledEntity = getControlledEntityImplGuard(entityID);
 
@@ -1004,14 +1041,8 @@ void ControllerImpl::onAemAecpUnsolicitedReceived(entity::controller::Interface
 				notifyObserversMethod<Controller::Observer>(&Controller::Observer::onAemAecpUnsolicitedLossCounterChanged, this, &entity, value);
 			}
 
-			// As part of #50 (for now), just unsubscribe from unsolicited notifications
-			{
-				// Immediately set as unsubscribed, we are already loosing packets we don't want to miss the response to our unsubscribe
-				updateUnsolicitedNotificationsSubscription(entity, false);
-
-				// Properly (try to) unregister from unsol
-				unregisterUnsol(&entity);
-			}
+			// Some state changes might have been missed, schedule a resynchronization of the dynamic model (coalesced and rate-limited by the scheduler)
+			_resyncScheduler.requestResync(entityID);
 		}
 
 		// Update statistics
@@ -608,15 +608,28 @@ void ControllerImpl::onRegisterUnsolicitedNotificationsResult(entity::controller
 			entity.setUnsolicitedNotificationsSupported(true); // Set to true by default, will be set to false if we get a failure status
 			if (!!status)
 			{
-				entity.setSubscribedToUnsolicitedNotifications(true);
+				updateUnsolicitedNotificationsSubscription(entity, true);
 			}
 			else
 			{
 				if (!processRegisterUnsolFailureStatus(status, &entity))
 				{
-					controlledEntity->setGetFatalEnumerationError();
-					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, &entity, QueryCommandError::RegisterUnsol);
-					return;
+					// Failed to register again during a resynchronization, the entity is still usable (only no longer subscribed), don't invalidate it
+					if (entity.wasAdvertised())
+					{
+						LOG_CONTROLLER_WARN(entityID, "Failed to register to unsolicited notifications during resynchronization: {}", entity::ControllerEntity::statusToString(status));
+					}
+					else
+					{
+						controlledEntity->setGetFatalEnumerationError();
+						notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, &entity, QueryCommandError::RegisterUnsol);
+						return;
+					}
+				}
+				// Not retrying, the entity is no longer subscribed (if it was before a resynchronization)
+				if (entity.gotExpectedRegisterUnsol())
+				{
+					updateUnsolicitedNotificationsSubscription(entity, false);
 				}
 			}
 
@@ -679,35 +692,53 @@ void ControllerImpl::onEntityDescriptorResult(entity::controller::Interface cons
 					entity.setIgnoreCachedEntityModel();
 				}
 
-				// Search in the AEM cache for the AEM of the active configuration (if not ignored)
+				// Search for the static model the entity had before going offline (or being refreshed), if it still advertises the same model
+				// Unlike the AEM cache, it is not trusted as is: the CONFIGURATION descriptor of the current configuration is retrieved first, and the model is only reused if it did not change
 				auto const entityModelID = descriptor.entityModelID;
-				auto cachedModel = std::optional<model::EntityNode>{ std::nullopt };
-				auto const& entityModelCache = EntityModelCache::getInstance();
-				// If AEM Cache is Enabled and the entity has an EntityModelID defined
-				if (!entity.shouldIgnoreCachedEntityModel() && entityModelCache.isCacheEnabled() && entityModelID)
+				if (!entity.shouldIgnoreCachedEntityModel() && entityModelID)
 				{
-					if (EntityModelCache::isValidEntityModelID(entityModelID))
-					{
-						cachedModel = entityModelCache.getCachedEntityModel(entityModelID);
-					}
-					else
+					auto recentModel = _recentEntityModels.takeEntityModel(entityID, entityModelID);
+					if (recentModel)
 					{
-						LOG_CONTROLLER_INFO(entityID, "AEM-CACHE: Ignoring invalid EntityModelID {} (invalid Vendor OUI-24)", utils::toHexString(entityModelID, true, false));
+						if (recentModel->configurations.size() != descriptor.configurationsCount || recentModel->staticModel.vendorNameString != descriptor.vendorNameString || recentModel->staticModel.modelNameString != descriptor.modelNameString)
+						{
+							LOG_CONTROLLER_INFO(entityID, "ENTITY descriptor changed since last enumeration, not reusing previous model");
+						}
+						else
+						{
+							entity.setRecentEntityModel(std::move(*recentModel), descriptor);
+							queryInformation(&entity, descriptor.currentConfiguration, entity::model::DescriptorType::Configuration, 0u);
+						}
 					}
 				}
 
-				// Already cached, no need to get the remaining of EnumerationSteps::GetStaticModel, proceed with EnumerationSteps::GetDescriptorDynamicInfo
-				if (cachedModel && entity.setCachedEntityNode(std::move(*cachedModel), descriptor, _fullStaticModelEnumeration))
-				{
-					LOG_CONTROLLER_INFO(entityID, "AEM-CACHE: Loaded model for EntityModelID {}", utils::toHexString(entityModelID, true, false));
-					entity.addEnumerationStep(ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo);
-				}
-				else
+				if (!entity.hasRecentEntityModel())
 				{
-					entity.setEntityDescriptor(descriptor);
-					for (auto index = entity::model::ConfigurationIndex(0u); index < descriptor.configurationsCount; ++index)
+					// Search in the AEM cache for the AEM of the active configuration (if not ignored)
+					// If AEM Cache is Enabled and the entity has an EntityModelID defined
+					auto const& entityModelCache = EntityModelCache::getInstance();
+					auto cachedModel = std::optional<model::EntityNode>{ std::nullopt };
+					if (!entity.shouldIgnoreCachedEntityModel() && entityModelCache.isCacheEnabled() && entityModelID)
 					{
-						queryInformation(&entity, index, entity::model::DescriptorType::Configuration, 0u);
+						if (EntityModelCache::isValidEntityModelID(entityModelID))
+						{
+							cachedModel = entityModelCache.getCachedEntityModel(entityModelID);
+						}
+						else
+						{
+							LOG_CONTROLLER_INFO(entityID, "AEM-CACHE: Ignoring invalid EntityModelID {} (invalid Vendor OUI-24)", utils::toHexString(entityModelID, true, false));
+						}
+					}
+
+					// Already cached, no need to get the remaining of EnumerationSteps::GetStaticModel, proceed with EnumerationSteps::GetDescriptorDynamicInfo
+					if (cachedModel && entity.setCachedEntityNode(std::move(*cachedModel), descriptor, _fullStaticModelEnumeration))
+					{
+						LOG_CONTROLLER_INFO(entityID, "AEM-CACHE: Loaded model for EntityModelID {}", utils::toHexString(entityModelID, true, false));
+						entity.addEnumerationStep(ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo);
+					}
+					else
+					{
+						getStaticModelConfigurations(&entity, descriptor);
 					}
 				}
 			}
@@ -742,14 +773,54 @@ void ControllerImpl::onConfigurationDescriptorResult(entity::controller::Interfa
 	{
 		if (controlledEntity->checkAndClearExpectedDescriptor(configurationIndex, entity::model::DescriptorType::Configuration, 0u))
 		{
+			// Static model from a previous enumeration pending validation (only the CONFIGURATION descriptor of the current configuration has been queried)
+			if (controlledEntity->hasRecentEntityModel())
+			{
+				if (!!status)
+				{
+					auto [entityNode, entityDescriptor] = *controlledEntity->takeRecentEntityModel();
+					auto const configurationNodeIt = entityNode.configurations.find(configurationIndex);
+					auto const isUnchanged = configurationNodeIt != entityNode.configurations.end() && configurationNodeIt->second.staticModel.localizedDescription == descriptor.localizedDescription && configurationNodeIt->second.staticModel.descriptorCounts == descriptor.descriptorCounts;
+					if (isUnchanged && controlledEntity->setCachedEntityNode(std::move(entityNode), entityDescriptor, _fullStaticModelEnumeration))
+					{
+						LOG_CONTROLLER_INFO(entityID, "Reusing model from previous enumeration for EntityModelID {}", utils::toHexString(entityDescriptor.entityModelID, true, false));
+						controlledEntity->addEnumerationStep(ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo);
+					}
+					else
+					{
+						LOG_CONTROLLER_INFO(entityID, "CONFIGURATION descriptor changed since last enumeration, not reusing previous model");
+						getStaticModelConfigurations(controlledEntity.get(), entityDescriptor);
+					}
+				}
+				else
+				{
+					if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::Configuration, 0u))
+					{
+						controlledEntity->setGetFatalEnumerationError();
+						notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ConfigurationDescriptor);
+						return;
+					}
+					// Not retrying, the previous model cannot be validated, retrieve the whole static model
+					if (controlledEntity->gotAllExpectedDescriptors())
+					{
+						auto const recentModel = controlledEntity->takeRecentEntityModel();
+						getStaticModelConfigurations(controlledEntity.get(), recentModel->second);
+					}
+				}
+
+				// Check if we got all expected descriptors
+				checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
+				return;
+			}
+
 			if (!!status)
 			{
 				try
 				{
 					controlledEntity->setConfigurationDescriptor(descriptor, configurationIndex);
 					auto const isCurrentConfiguration = configurationIndex == *controlledEntity->getCurrentConfigurationIndex(TreeModelAccessStrategy::NotFoundBehavior::Throw);
-					// Get full descriptors for active configuration or if _fullStaticModelEnumeration is set
-					if (isCurrentConfiguration || _fullStaticModelEnumeration)
+					// Get full descriptors for active configuration, if _fullStaticModelEnumeration is set, or if retrieved on demand (entity already advertised)
+					if (isCurrentConfiguration || _fullStaticModelEnumeration || controlledEntity->wasAdvertised())
 					{
 						// Get Locales as soon as possible
 						{
@@ -933,13 +1004,19 @@ void ControllerImpl::onConfigurationDescriptorResult(entity::controller::Interfa
 				}
 				catch (ControlledEntity::Exception const&)
 				{
-					controlledEntity->setGetFatalEnumerationError();
-					return;
+					// Entity already advertised (configuration retrieved on demand), only fail the retrieval instead of the whole entity
+					if (!controlledEntity->wasAdvertised())
+					{
+						controlledEntity->setGetFatalEnumerationError();
+						return;
+					}
+					LOG_CONTROLLER_WARN(entityID, "Invalid CONFIGURATION descriptor {} retrieved on demand", configurationIndex);
+					failConfigurationStaticModelLoad(entityID, configurationIndex, entity::ControllerEntity::AemCommandStatus::ProtocolError);
 				}
 			}
 			else
 			{
-				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), 0, entity::model::DescriptorType::Configuration, configurationIndex))
+				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::Configuration, 0u))
 				{
 					controlledEntity->setGetFatalEnumerationError();
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ConfigurationDescriptor);
@@ -947,13 +1024,8 @@ void ControllerImpl::onConfigurationDescriptorResult(entity::controller::Interfa
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1020,13 +1092,8 @@ void ControllerImpl::onAudioUnitDescriptorResult(entity::controller::Interface c
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1056,13 +1123,8 @@ void ControllerImpl::onStreamInputDescriptorResult(entity::controller::Interface
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1092,13 +1154,8 @@ void ControllerImpl::onStreamOutputDescriptorResult(entity::controller::Interfac
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1139,13 +1196,8 @@ void ControllerImpl::onJackInputDescriptorResult(entity::controller::Interface c
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1186,13 +1238,8 @@ void ControllerImpl::onJackOutputDescriptorResult(entity::controller::Interface
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1229,13 +1276,8 @@ void ControllerImpl::onAvbInterfaceDescriptorResult(entity::controller::Interfac
 							return;
 						}
 					}
-					// Got all expected descriptors
-					if (controlledEntity->gotAllExpectedDescriptors())
-					{
-						// Clear this enumeration step and check for next one
-						controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-						checkEnumerationSteps(controlledEntity.get());
-					}
+					// Check if we got all expected descriptors
+					checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 				}
 				break;
 			}
@@ -1298,13 +1340,8 @@ void ControllerImpl::onClockSourceDescriptorResult(entity::controller::Interface
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1342,13 +1379,8 @@ void ControllerImpl::onMemoryObjectDescriptorResult(entity::controller::Interfac
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1403,13 +1435,8 @@ void ControllerImpl::onLocaleDescriptorResult(entity::controller::Interface cons
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1439,13 +1466,8 @@ void ControllerImpl::onStringsDescriptorResult(entity::controller::Interface con
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1505,13 +1527,8 @@ void ControllerImpl::onStreamPortInputDescriptorResult(entity::controller::Inter
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1571,13 +1588,8 @@ void ControllerImpl::onStreamPortOutputDescriptorResult(entity::controller::Inte
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1607,13 +1619,8 @@ void ControllerImpl::onAudioClusterDescriptorResult(entity::controller::Interfac
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1643,13 +1650,8 @@ void ControllerImpl::onAudioMapDescriptorResult(entity::controller::Interface co
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1679,13 +1681,8 @@ void ControllerImpl::onControlDescriptorResult(entity::controller::Interface con
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1715,13 +1712,8 @@ void ControllerImpl::onClockDomainDescriptorResult(entity::controller::Interface
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1751,13 +1743,8 @@ void ControllerImpl::onTimingDescriptorResult(entity::controller::Interface cons
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1808,13 +1795,8 @@ void ControllerImpl::onPtpInstanceDescriptorResult(entity::controller::Interface
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
@@ -1844,13 +1826,8 @@ void ControllerImpl::onPtpPortDescriptorResult(entity::controller::Interface con
 				}
 			}
 
-			// Got all expected descriptors
-			if (controlledEntity->gotAllExpectedDescriptors())
-			{
-				// Clear this enumeration step and check for next one
-				controlledEntity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::GetStaticModel);
-				checkEnumerationSteps(controlledEntity.get());
-			}
+			// Check if we got all expected descriptors
+			checkStaticModelCompleted(controlledEntity.get(), configurationIndex);
 		}
 	}
 }
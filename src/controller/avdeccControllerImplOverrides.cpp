@@ -42,9 +42,13 @@
 #include <cstdlib> // free / malloc
 #include <cstring> // strerror
 #include <cerrno> // errno
+#include <cstdio> // remove / rename
 #include <unordered_set>
 #include <set>
 #include <fstream>
+#include <algorithm>
+#include <array>
+#include <vector>
 #include <mutex>
 #include <memory>
 
@@ -209,6 +213,22 @@ ControllerImpl::ControllerImpl(protocol::ProtocolInterface::Type const protocolI
 					controllerIdentificationsStopped.clear();
 				}
 
+				// Scheduled entities (schedulers are thread-safe, no need to lock)
+				{
+					// Counters refresh, as long as there is some budget left
+					processScheduledEntities(_countersPollingScheduler.getEntitiesToPoll(), &ControllerImpl::pollEntityCounters,
+						[this]()
+						{
+							return _countersPollingScheduler.hasAvailableBudget();
+						});
+
+					// Queued entities that can now retrieve their static model
+					processScheduledEntities(_enumerationScheduler.getEntitiesToStart(), &ControllerImpl::startEntityStaticModel);
+
+					// Resynchronization of entities that lost unsolicited notifications
+					processScheduledEntities(_resyncScheduler.getEntitiesToResync(), &ControllerImpl::resyncEntity);
+				}
+
 				// Delayed Queries
 				{
 					// Check all delayed queries if we need to send any of them, and copy them so we can send outside the loop
@@ -339,6 +359,9 @@ ControllerImpl::~ControllerImpl()
 		exclusiveAccessTokens = std::move(_exclusiveAccessTokens);
 	}
 
+	// Stop publishing snapshots
+	_controlledEntitySnapshots.clear();
+
 	// Notify all entities they are going offline
 	for (auto const& entityKV : controlledEntities)
 	{
@@ -459,6 +482,54 @@ void ControllerImpl::disableFullStaticEntityModelEnumeration() noexcept
 	_fullStaticModelEnumeration = false;
 }
 
+void ControllerImpl::loadConfigurationStaticModel(UniqueIdentifier const targetEntityID, entity::model::ConfigurationIndex const configurationIndex, LoadConfigurationStaticModelHandler const& handler) noexcept
+{
+	// Entity locks and ProtocolInterface are required to send the queries, do it on the network executor
+	auto const exName = _endStation->getProtocolInterface()->getExecutorName();
+	ExecutorManager::getInstance().pushJob(exName,
+		[this, targetEntityID, configurationIndex, handler]()
+		{
+			auto const lg = std::lock_guard{ *_controller }; // Lock the Controller itself (thus, lock it's ProtocolInterface), since we are on the Networking Thread
+
+			// Take a "scoped locked" shared copy of the ControlledEntity
+			auto controlledEntity = getControlledEntityImplGuard(targetEntityID, true);
+
+			if (!controlledEntity)
+			{
+				utils::invokeProtectedHandler(handler, nullptr, entity::ControllerEntity::AemCommandStatus::UnknownEntity);
+				return;
+			}
+
+			auto& entity = *controlledEntity;
+			auto const* const configurationNode = entity.getModelAccessStrategy().getConfigurationNode(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+			if (!configurationNode)
+			{
+				utils::invokeProtectedHandler(handler, &entity, entity::ControllerEntity::AemCommandStatus::NoSuchDescriptor);
+				return;
+			}
+
+			// Already complete (current configuration, full enumeration, or previously retrieved)
+			if (EntityModelCache::isModelValidForConfiguration(*configurationNode))
+			{
+				utils::invokeProtectedHandler(handler, &entity, entity::ControllerEntity::AemCommandStatus::Success);
+				return;
+			}
+
+			// Already being retrieved, only add the handler
+			auto& loads = _configurationStaticModelLoads[targetEntityID];
+			auto const [loadIt, inserted] = loads.try_emplace(configurationIndex);
+			loadIt->second.handlers.push_back(handler);
+			if (!inserted)
+			{
+				return;
+			}
+
+			// Read the configuration descriptor again, its result will query all the descriptors of the configuration
+			LOG_CONTROLLER_INFO(targetEntityID, "Retrieving static model of configuration {} on demand", configurationIndex);
+			queryInformation(&entity, configurationIndex, entity::model::DescriptorType::Configuration, 0u);
+		});
+}
+
 void ControllerImpl::enableFastEnumeration() noexcept
 {
 	_enablePackedGetDynamicInfo = true;
@@ -469,6 +540,132 @@ void ControllerImpl::disableFastEnumeration() noexcept
 	_enablePackedGetDynamicInfo = false;
 }
 
+void ControllerImpl::enableCountersHistory(std::uint16_t const samplesPerDescriptor, std::size_t const maxMemorySize) noexcept
+{
+	auto budget = std::make_shared<CountersHistoryBudget>(samplesPerDescriptor, maxMemorySize);
+
+	// Change the budget using the network executor, histories using the previous budget will be recreated on their next sample
+	auto const exName = _endStation->getProtocolInterface()->getExecutorName();
+	ExecutorManager::getInstance().pushJob(exName,
+		[this, budget = std::move(budget)]() mutable
+		{
+			auto const lg = std::lock_guard{ *_controller }; // Lock the Controller itself (thus, lock it's ProtocolInterface), since we are on the Networking Thread
+
+			_countersHistoryBudget = std::move(budget);
+		});
+	LOG_CONTROLLER_INFO(_controller->getEntityID(), "Counters history Enabled ({} samples per descriptor, {} bytes max)", samplesPerDescriptor, maxMemorySize);
+}
+
+void ControllerImpl::disableCountersHistory() noexcept
+{
+	// Release all histories using the network executor
+	auto const exName = _endStation->getProtocolInterface()->getExecutorName();
+	ExecutorManager::getInstance().pushJob(exName,
+		[this]()
+		{
+			auto const lg = std::lock_guard{ *_controller }; // Lock the Controller itself (thus, lock it's ProtocolInterface), since we are on the Networking Thread
+
+			_countersHistoryBudget.reset();
+
+			{
+				// Lock to protect _controlledEntities
+				auto const lg = std::lock_guard{ _lock };
+
+				for (auto& [eid, entity] : _controlledEntities)
+				{
+					entity->clearCountersHistory();
+				}
+			}
+		});
+	LOG_CONTROLLER_INFO(_controller->getEntityID(), "Counters history Disabled");
+}
+
+void ControllerImpl::enableCountersPolling(std::chrono::milliseconds const period, std::uint16_t const maxInflightCommands) noexcept
+{
+	_countersPollingScheduler.enable(period, maxInflightCommands);
+	LOG_CONTROLLER_INFO(_controller->getEntityID(), "Counters polling Enabled ({} ms period, {} inflight commands max)", period.count(), maxInflightCommands);
+}
+
+void ControllerImpl::disableCountersPolling() noexcept
+{
+	_countersPollingScheduler.disable();
+	LOG_CONTROLLER_INFO(_controller->getEntityID(), "Counters polling Disabled");
+}
+
+void ControllerImpl::enableEnumerationScheduling(std::uint16_t const maxConcurrentEntities) noexcept
+{
+	_enumerationScheduler.enable(maxConcurrentEntities);
+	LOG_CONTROLLER_INFO(_controller->getEntityID(), "Enumeration scheduling Enabled ({} concurrent entities max)", maxConcurrentEntities);
+}
+
+void ControllerImpl::disableEnumerationScheduling() noexcept
+{
+	_enumerationScheduler.disable();
+	LOG_CONTROLLER_INFO(_controller->getEntityID(), "Enumeration scheduling Disabled");
+}
+
+void ControllerImpl::setEnumerationPriority(UniqueIdentifier const entityID, std::optional<EnumerationPriority> const priority) noexcept
+{
+	_enumerationScheduler.setPriority(entityID, priority);
+}
+
+Controller::EnumerationStatistics ControllerImpl::getEnumerationStatistics() const noexcept
+{
+	return _enumerationScheduler.getStatistics();
+}
+
+/* Control values streaming */
+Controller::ControlValuesSubscription::SharedPointer ControllerImpl::subscribeToControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex, std::uint16_t const decimation, std::uint16_t const ringCapacity) noexcept
+{
+	// Take a "scoped locked" shared copy of the ControlledEntity
+	auto controlledEntity = getControlledEntityImplGuard(entityID);
+
+	if (!controlledEntity)
+	{
+		return nullptr;
+	}
+
+	auto const currentConfigurationIndexOpt = controlledEntity->getCurrentConfigurationIndex(TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+	if (!currentConfigurationIndexOpt)
+	{
+		return nullptr;
+	}
+
+	auto const* const controlStaticModel = controlledEntity->getModelAccessStrategy().getControlNodeStaticModel(*currentConfigurationIndexOpt, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+	if (!controlStaticModel)
+	{
+		return nullptr;
+	}
+
+	auto const controlValueType = controlStaticModel->controlValueType.getType();
+	if (!ControlValuesStreams::isStreamable(controlValueType))
+	{
+		LOG_CONTROLLER_WARN(entityID, "Cannot subscribe to ControlIndex {}: values of type {} cannot be streamed", controlIndex, entity::model::controlValueTypeToString(controlValueType));
+		return nullptr;
+	}
+
+	try
+	{
+		auto subscription = std::make_shared<ControlValuesSubscriptionImpl>(entityID, controlIndex, decimation, ringCapacity);
+		_controlValuesStreams.addSubscription(subscription, controlValueType, controlStaticModel->numberOfValues);
+		LOG_CONTROLLER_DEBUG(entityID, "Subscribed to ControlIndex {} values (decimation={} ringCapacity={})", controlIndex, decimation, ringCapacity);
+		return subscription;
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+void ControllerImpl::unsubscribeFromControlValues(ControlValuesSubscription::SharedPointer const& subscription) noexcept
+{
+	if (subscription)
+	{
+		_controlValuesStreams.removeSubscription(subscription.get());
+		LOG_CONTROLLER_DEBUG(subscription->getEntityID(), "Unsubscribed from ControlIndex {} values", subscription->getControlIndex());
+	}
+}
+
 
 /* Enumeration and Control Protocol (AECP) */
 void ControllerImpl::acquireEntity(UniqueIdentifier const targetEntityID, bool const isPersistent, AcquireEntityHandler const& handler) const noexcept
@@ -2863,6 +3060,225 @@ void ControllerImpl::getListenerStreamState(entity::model::StreamIdentification
 	}
 }
 
+void ControllerImpl::executeBatchCommands(BatchCommands const& commands, BatchCommandsHandler const& handler) const noexcept
+{
+	if (commands.empty())
+	{
+		utils::invokeProtectedHandler(handler, BatchCommandResults{}, std::size_t{ 0u });
+		return;
+	}
+
+	LOG_CONTROLLER_TRACE(UniqueIdentifier::getNullUniqueIdentifier(), "User executeBatchCommands ({} commands)", commands.size());
+
+	auto const context = std::make_shared<BatchCommandsContext>(commands.size(), handler);
+
+	// Get a shared copy of all the targeted ControlledEntities (in a single pass), so they stay alive while in the scope
+	auto entities = std::unordered_map<UniqueIdentifier, SharedControlledEntityImpl, UniqueIdentifier::hash>{};
+	{
+		// Lock to protect _controlledEntities
+		auto const lg = std::lock_guard{ _lock };
+
+		for (auto const& command : commands)
+		{
+			if (auto const entityIt = _controlledEntities.find(command.targetEntityID); entityIt != _controlledEntities.end() && entityIt->second->wasAdvertised())
+			{
+				entities.emplace(command.targetEntityID, entityIt->second);
+			}
+		}
+	}
+
+	// Validate all the commands against the model (in a single pass), rejected commands are not sent
+	auto validCommands = std::vector<std::size_t>{};
+	validCommands.reserve(commands.size());
+	// Rejected commands are only completed once the ControlledEntities are unlocked (completing the last command calls the user handler)
+	auto rejectedCommands = std::vector<std::pair<std::size_t, BatchCommandResult>>{};
+	auto const rejectCommand = [&rejectedCommands](std::size_t const commandIndex, bool const isACMP, entity::ControllerEntity::AemCommandStatus const aemStatus, entity::ControllerEntity::ControlStatus const controlStatus)
+	{
+		auto result = BatchCommandResult{};
+		if (isACMP)
+		{
+			result.controlStatus = controlStatus;
+		}
+		else
+		{
+			result.aemStatus = aemStatus;
+		}
+		rejectedCommands.emplace_back(commandIndex, result);
+	};
+	{
+		// Lock all the ControlledEntities at once (they share the same lock)
+		auto const lg = std::lock_guard{ *_entitiesSharedLockInformation };
+
+		for (auto commandIndex = std::size_t{ 0u }; commandIndex < commands.size(); ++commandIndex)
+		{
+			auto const& command = commands[commandIndex];
+			auto const isACMP = command.type == BatchCommand::Type::ConnectStream;
+
+			auto const entityIt = entities.find(command.targetEntityID);
+			if (entityIt == entities.end())
+			{
+				rejectCommand(commandIndex, isACMP, entity::ControllerEntity::AemCommandStatus::UnknownEntity, entity::ControllerEntity::ControlStatus::UnknownEntity);
+				continue;
+			}
+
+			try
+			{
+				auto const& controlledEntity = *entityIt->second;
+				// Only validate the descriptor if the entity has a model, otherwise let the entity reply
+				if (controlledEntity.hasAnyConfiguration())
+				{
+					auto const configurationIndex = controlledEntity.getCurrentConfigurationIndex();
+					switch (command.type)
+					{
+						case BatchCommand::Type::SetStreamInputFormat:
+						case BatchCommand::Type::ConnectStream:
+							static_cast<void>(controlledEntity.getStreamInputNode(configurationIndex, command.descriptorIndex));
+							break;
+						case BatchCommand::Type::SetStreamOutputFormat:
+							static_cast<void>(controlledEntity.getStreamOutputNode(configurationIndex, command.descriptorIndex));
+							break;
+						case BatchCommand::Type::SetAudioUnitSamplingRate:
+							static_cast<void>(controlledEntity.getAudioUnitNode(configurationIndex, command.descriptorIndex));
+							break;
+						case BatchCommand::Type::SetClockSource:
+							static_cast<void>(controlledEntity.getClockDomainNode(configurationIndex, command.descriptorIndex));
+							break;
+						case BatchCommand::Type::SetControlValues:
+							static_cast<void>(controlledEntity.getControlNode(configurationIndex, command.descriptorIndex));
+							break;
+						default:
+							AVDECC_ASSERT(false, "Unhandled BatchCommand::Type");
+							break;
+					}
+				}
+				validCommands.push_back(commandIndex);
+			}
+			catch (ControlledEntity::Exception const& e)
+			{
+				if (e.getType() == ControlledEntity::Exception::Type::InvalidDescriptorIndex || e.getType() == ControlledEntity::Exception::Type::InvalidConfigurationIndex)
+				{
+					rejectCommand(commandIndex, isACMP, entity::ControllerEntity::AemCommandStatus::NoSuchDescriptor, entity::ControllerEntity::ControlStatus::ListenerUnknownID);
+				}
+				else
+				{
+					validCommands.push_back(commandIndex);
+				}
+			}
+		}
+	}
+
+	// Complete the rejected commands, now that the ControlledEntities are unlocked
+	for (auto const& [commandIndex, result] : rejectedCommands)
+	{
+		context->setResult(commandIndex, result);
+	}
+
+	// Enqueue all the valid commands (each target entity is paced by the CommandStateMachine)
+	auto const guard = ControlledEntityUnlockerGuard{ *this }; // Always temporarily unlock the ControlledEntities before calling the controller
+	for (auto const commandIndex : validCommands)
+	{
+		auto const& command = commands[commandIndex];
+		switch (command.type)
+		{
+			case BatchCommand::Type::SetStreamInputFormat:
+				_controllerProxy->setStreamInputFormat(command.targetEntityID, command.descriptorIndex, command.streamFormat,
+					[this, context, commandIndex](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::StreamIndex const streamIndex, entity::model::StreamFormat const streamFormat)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID))
+							{
+								updateStreamInputFormat(*controlledEntity, streamIndex, streamFormat, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+							}
+						}
+						context->setAemResult(commandIndex, status);
+					});
+				break;
+			case BatchCommand::Type::SetStreamOutputFormat:
+				_controllerProxy->setStreamOutputFormat(command.targetEntityID, command.descriptorIndex, command.streamFormat,
+					[this, context, commandIndex](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::StreamIndex const streamIndex, entity::model::StreamFormat const streamFormat)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID))
+							{
+								updateStreamOutputFormat(*controlledEntity, streamIndex, streamFormat, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+							}
+						}
+						context->setAemResult(commandIndex, status);
+					});
+				break;
+			case BatchCommand::Type::SetAudioUnitSamplingRate:
+				_controllerProxy->setAudioUnitSamplingRate(command.targetEntityID, command.descriptorIndex, command.samplingRate,
+					[this, context, commandIndex](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::AudioUnitIndex const audioUnitIndex, entity::model::SamplingRate const samplingRate)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID))
+							{
+								updateAudioUnitSamplingRate(*controlledEntity, audioUnitIndex, samplingRate, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+							}
+						}
+						context->setAemResult(commandIndex, status);
+					});
+				break;
+			case BatchCommand::Type::SetClockSource:
+				_controllerProxy->setClockSource(command.targetEntityID, command.descriptorIndex, command.clockSourceIndex,
+					[this, context, commandIndex](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::ClockDomainIndex const clockDomainIndex, entity::model::ClockSourceIndex const clockSourceIndex)
+					{
+						if (!!status)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID))
+							{
+								updateClockSource(*controlledEntity, clockDomainIndex, clockSourceIndex, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+							}
+						}
+						context->setAemResult(commandIndex, status);
+					});
+				break;
+			case BatchCommand::Type::SetControlValues:
+				_controllerProxy->setControlValues(command.targetEntityID, command.descriptorIndex, command.controlValues,
+					[this, context, commandIndex](entity::controller::Interface const* const /*controller*/, UniqueIdentifier const entityID, entity::ControllerEntity::AemCommandStatus const status, entity::model::ControlIndex const controlIndex, MemoryBuffer const& packedControlValues)
+					{
+						auto st = status;
+						if (!!st)
+						{
+							// Take a "scoped locked" shared copy of the ControlledEntity
+							if (auto controlledEntity = getControlledEntityImplGuard(entityID))
+							{
+								if (!updateControlValues(*controlledEntity, controlIndex, packedControlValues, TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull))
+								{
+									st = entity::ControllerEntity::AemCommandStatus::ProtocolError;
+								}
+							}
+						}
+						context->setAemResult(commandIndex, st);
+					});
+				break;
+			case BatchCommand::Type::ConnectStream:
+				_controllerProxy->connectStream(command.talkerStream, entity::model::StreamIdentification{ command.targetEntityID, command.descriptorIndex },
+					[this, context, commandIndex](entity::controller::Interface const* const /*controller*/, entity::model::StreamIdentification const& talkerStream, entity::model::StreamIdentification const& listenerStream, std::uint16_t const /*connectionCount*/, entity::ConnectionFlags const flags, entity::ControllerEntity::ControlStatus const status)
+					{
+						if (!!status)
+						{
+							// Do not trust the connectionCount value to determine if the listener is connected, but rather use the fact there was no error in the command
+							handleListenerStreamStateNotification(talkerStream, listenerStream, true, flags, false);
+						}
+						context->setControlResult(commandIndex, status);
+					});
+				break;
+			default:
+				AVDECC_ASSERT(false, "Unhandled BatchCommand::Type");
+				context->setAemResult(commandIndex, entity::ControllerEntity::AemCommandStatus::InternalError);
+				break;
+		}
+	}
+}
+
 ControlledEntityGuard ControllerImpl::getControlledEntityGuard(UniqueIdentifier const entityID) const noexcept
 {
 	// Take a "scoped locked" shared copy of the ControlledEntity
@@ -2874,6 +3290,12 @@ ControlledEntityGuard ControllerImpl::getControlledEntityGuard(UniqueIdentifier
 	return {};
 }
 
+SharedConstControlledEntity ControllerImpl::getControlledEntitySnapshot(UniqueIdentifier const entityID) const noexcept
+{
+	// Latest snapshot published by the network thread, never takes the entities lock
+	return _controlledEntitySnapshots.getSnapshot(entityID);
+}
+
 void ControllerImpl::requestExclusiveAccess(UniqueIdentifier const entityID, ExclusiveAccessToken::AccessType const type, RequestExclusiveAccessResultHandler&& handler) const noexcept
 {
 	// Helper lambda
@@ -2945,40 +3367,91 @@ std::tuple<avdecc::jsonSerializer::SerializationError, std::string> ControllerIm
 
 #else // ENABLE_AVDECC_FEATURE_JSON
 
-	// Create the object
-	auto object = json{};
+	// Take a shared copy of all known entities, sorted by EntityID (only lock to protect _controlledEntities while copying, the entities are serialized afterwards)
+	auto entities = std::vector<SharedControlledEntityImpl>{};
+	{
+		// Lock to protect _controlledEntities
+		auto const lg = std::lock_guard{ _lock };
+
+		entities.reserve(_controlledEntities.size());
+		for (auto const& entityIt : _controlledEntities)
+		{
+			entities.push_back(entityIt.second);
+		}
+	}
+	std::sort(entities.begin(), entities.end(),
+		[](auto const& lhs, auto const& rhs)
+		{
+			return lhs->getEntity().getEntityID() < rhs->getEntity().getEntityID();
+		});
 
-	// Dump information of the dump itself
-	object[jsonSerializer::keyName::Controller_DumpVersion] = jsonSerializer::keyValue::Controller_DumpVersion;
-	object[jsonSerializer::keyName::Controller_Informative_DumpSource] = dumpSource;
+	// The dump is written to a temporary file first, and only replaces the output file once complete (never leaving a truncated dump behind)
+	auto const tempFilePath = utils::filePathFromUTF8String(filePath + ".tmp");
 
-	// Lock to protect _controlledEntities
-	std::lock_guard<decltype(_lock)> const lg(_lock);
+	// Try to open the temporary output file
+	auto const mode = std::ios::binary | std::ios::out;
+	auto ofs = std::ofstream{ tempFilePath, mode }; // We always want to read as 'binary', we don't want the cr/lf shit to alter the size of our allocated buffer (all modern code should handle both lf and cr/lf)
 
-	// Define a comparator operator for ControlledEntities as we want to dump entities ordered by EntityID
-	auto const entityComparator = [](ControlledEntityImpl const* const& lhs, ControlledEntityImpl const* const& rhs)
+	// Failed to open file to writting
+	if (!ofs.is_open())
 	{
-		return lhs->getEntity().getEntityID() < rhs->getEntity().getEntityID();
+		return { avdecc::jsonSerializer::SerializationError::AccessDenied, std::strerror(errno) };
+	}
+
+	auto const discardTempFile = [&ofs, &tempFilePath]()
+	{
+		ofs.close();
+#ifdef LA_AVDECC_USES_STD_FILESYSTEM
+		auto ec = std::error_code{};
+		std::filesystem::remove(tempFilePath, ec);
+#else // !LA_AVDECC_USES_STD_FILESYSTEM
+		std::remove(tempFilePath.c_str());
+#endif // LA_AVDECC_USES_STD_FILESYSTEM
 	};
-	auto entities = std::set<ControlledEntityImpl const*, decltype(entityComparator)>{ entityComparator };
 
-	// Process all known entities and add them to a sorted set
-	for (auto const& entityIt : _controlledEntities)
+	// The dump is streamed to the file, one entity at a time, without building the whole object (keys are written in the same order than a json object would)
+	auto const isBinaryFormat = flags.test(entity::model::jsonSerializer::Flag::BinaryFormat);
+	auto entitiesCountPosition = std::ofstream::pos_type{};
+	if (isBinaryFormat)
+	{
+		ofs.put(static_cast<char>(0x83)); // fixmap with 3 elements
+		json::to_msgpack(json(jsonSerializer::keyName::Controller_Informative_DumpSource), ofs);
+		json::to_msgpack(json(dumpSource), ofs);
+		json::to_msgpack(json(jsonSerializer::keyName::Controller_DumpVersion), ofs);
+		json::to_msgpack(json(jsonSerializer::keyValue::Controller_DumpVersion), ofs);
+		json::to_msgpack(json(jsonSerializer::keyName::Controller_Entities), ofs);
+		ofs.put(static_cast<char>(0xdd)); // array32, the count is written once all entities have been serialized
+		entitiesCountPosition = ofs.tellp();
+		ofs.write("\0\0\0\0", 4);
+	}
+	else
 	{
-		entities.insert(entityIt.second.get());
+		ofs << "{\n";
+		ofs << "    " << json(jsonSerializer::keyName::Controller_Informative_DumpSource).dump() << ": " << json(dumpSource).dump(-1, ' ', false, json::error_handler_t::replace) << ",\n";
+		ofs << "    " << json(jsonSerializer::keyName::Controller_DumpVersion).dump() << ": " << json(jsonSerializer::keyValue::Controller_DumpVersion).dump() << ",\n";
+		ofs << "    " << json(jsonSerializer::keyName::Controller_Entities).dump() << ": [";
 	}
 
 	auto error = avdecc::jsonSerializer::SerializationError::NoError;
 	auto errorText = std::string{};
+	auto entitiesCount = std::uint32_t{ 0u };
 	// Serialize all known entities, sorted by EntityID
-	for (auto const* const entity : entities)
+	for (auto& sharedEntity : entities)
 	{
-		// Try to serialize
-		try
+		auto entityObject = json{};
+
+		// Only hold the shared entities lock while taking a snapshot of the entity (the model is only copied if modified since the previous snapshot), its snapshot has its own lock (never contended)
+		auto snapshot = SharedControlledEntityImpl{};
 		{
-			auto const entityObject = jsonSerializer::createJsonObject(*entity, flags);
+			auto entity = ControlledEntityImplGuard{ std::move(sharedEntity), true };
+			snapshot = entity->createSnapshot();
+		}
 
-			object[jsonSerializer::keyName::Controller_Entities].push_back(entityObject);
+		// Try to serialize the snapshot
+		try
+		{
+			auto const entity = ControlledEntityImplGuard{ std::move(snapshot), true };
+			entityObject = jsonSerializer::createJsonObject(*entity, flags);
 		}
 		catch (avdecc::jsonSerializer::SerializationException const& e)
 		{
@@ -2988,30 +3461,71 @@ std::tuple<avdecc::jsonSerializer::SerializationError, std::string> ControllerIm
 				errorText = e.what();
 				continue;
 			}
+			discardTempFile();
 			return { e.getError(), e.what() };
 		}
+
+		// Write the snapshot
+		if (isBinaryFormat)
+		{
+			json::to_msgpack(entityObject, ofs);
+		}
+		else
+		{
+			// Indent the entity object to its level in the dump (json strings cannot contain a raw new line)
+			auto const indentation = std::string{ "\n        " };
+			auto const entityText = entityObject.dump(4, ' ', false, json::error_handler_t::replace);
+			ofs << (entitiesCount == 0u ? "" : ",") << indentation;
+			auto lineStart = std::string::size_type{ 0u };
+			for (auto lineEnd = entityText.find('\n'); lineEnd != std::string::npos; lineEnd = entityText.find('\n', lineStart))
+			{
+				ofs.write(entityText.data() + lineStart, lineEnd - lineStart);
+				ofs << indentation;
+				lineStart = lineEnd + 1;
+			}
+			ofs.write(entityText.data() + lineStart, entityText.size() - lineStart);
+		}
+		++entitiesCount;
 	}
 
-	// Try to open the output file
-	auto const mode = std::ios::binary | std::ios::out;
-	auto ofs = std::ofstream{ utils::filePathFromUTF8String(filePath), mode }; // We always want to read as 'binary', we don't want the cr/lf shit to alter the size of our allocated buffer (all modern code should handle both lf and cr/lf)
+	// Finalize the dump
+	if (isBinaryFormat)
+	{
+		ofs.seekp(entitiesCountPosition);
+		auto const count = std::array<char, 4>{ static_cast<char>(entitiesCount >> 24), static_cast<char>(entitiesCount >> 16), static_cast<char>(entitiesCount >> 8), static_cast<char>(entitiesCount) };
+		ofs.write(count.data(), count.size());
+	}
+	else
+	{
+		ofs << (entitiesCount == 0u ? "]" : "\n    ]") << "\n}" << std::endl;
+	}
 
-	// Failed to open file to writting
-	if (!ofs.is_open())
+	// Failed to write the whole dump
+	ofs.close();
+	if (!ofs)
 	{
-		return { avdecc::jsonSerializer::SerializationError::AccessDenied, std::strerror(errno) };
+		auto const writeError = std::string{ std::strerror(errno) };
+		discardTempFile();
+		return { avdecc::jsonSerializer::SerializationError::AccessDenied, writeError };
 	}
 
-	// Everything is fine, write the JSON object to disk
-	if (flags.test(entity::model::jsonSerializer::Flag::BinaryFormat))
+	// Replace the output file with the complete dump
+#ifdef LA_AVDECC_USES_STD_FILESYSTEM
+	auto ec = std::error_code{};
+	std::filesystem::rename(tempFilePath, utils::filePathFromUTF8String(filePath), ec);
+	if (ec)
 	{
-		auto const binary = json::to_msgpack(object);
-		ofs.write(reinterpret_cast<char const*>(binary.data()), binary.size() * sizeof(decltype(binary)::value_type));
+		discardTempFile();
+		return { avdecc::jsonSerializer::SerializationError::AccessDenied, ec.message() };
 	}
-	else
+#else // !LA_AVDECC_USES_STD_FILESYSTEM
+	if (std::rename(tempFilePath.c_str(), filePath.c_str()) != 0)
 	{
-		ofs << std::setw(4) << object << std::endl;
+		auto const renameError = std::string{ std::strerror(errno) };
+		discardTempFile();
+		return { avdecc::jsonSerializer::SerializationError::AccessDenied, renameError };
 	}
+#endif // LA_AVDECC_USES_STD_FILESYSTEM
 
 	return { error, errorText };
 #endif // ENABLE_AVDECC_FEATURE_JSON
@@ -3025,7 +3539,7 @@ std::tuple<avdecc::jsonSerializer::SerializationError, std::string> ControllerIm
 #else // ENABLE_AVDECC_FEATURE_JSON
 
 	// Take a "scoped locked" shared copy of the ControlledEntity
-	auto const entity = getControlledEntityImplGuard(entityID, true);
+	auto entity = getControlledEntityImplGuard(entityID, true);
 	if (!entity)
 	{
 		return { avdecc::jsonSerializer::SerializationError::UnknownEntity, "Entity offline" };
@@ -3037,6 +3551,9 @@ std::tuple<avdecc::jsonSerializer::SerializationError, std::string> ControllerIm
 		// Try to serialize
 		auto object = jsonSerializer::createJsonObject(*entity, flags);
 
+		// Snapshot taken, no need to keep the entity locked while writing to disk
+		entity.reset();
+
 		// Add informative metadata to the object before serialization
 		object[jsonSerializer::keyName::Controller_Informative_DumpSource] = dumpSource;
 
@@ -3301,7 +3818,7 @@ void ControllerImpl::setEntityCounters(UniqueIdentifier const targetEntityID, en
 		auto validCounters = entity::EntityCounterValidFlags{};
 		auto descriptorCounters = entity::model::DescriptorCounters{};
 
-		for (auto const [flag, counter] : counters)
+		for (auto const& [flag, counter] : counters)
 		{
 			validCounters.set(flag);
 			descriptorCounters[validCounters.getPosition(flag)] = counter;
@@ -3322,7 +3839,7 @@ void ControllerImpl::setAvbInterfaceCounters(UniqueIdentifier const targetEntity
 		auto validCounters = entity::AvbInterfaceCounterValidFlags{};
 		auto descriptorCounters = entity::model::DescriptorCounters{};
 
-		for (auto const [flag, counter] : counters)
+		for (auto const& [flag, counter] : counters)
 		{
 			validCounters.set(flag);
 			descriptorCounters[validCounters.getPosition(flag)] = counter;
@@ -3343,7 +3860,7 @@ void ControllerImpl::setClockDomainCounters(UniqueIdentifier const targetEntityI
 		auto validCounters = entity::ClockDomainCounterValidFlags{};
 		auto descriptorCounters = entity::model::DescriptorCounters{};
 
-		for (auto const [flag, counter] : counters)
+		for (auto const& [flag, counter] : counters)
 		{
 			validCounters.set(flag);
 			descriptorCounters[validCounters.getPosition(flag)] = counter;
@@ -3364,7 +3881,7 @@ void ControllerImpl::setStreamInputCounters(UniqueIdentifier const targetEntityI
 		auto validCounters = entity::StreamInputCounterValidFlags{};
 		auto descriptorCounters = entity::model::DescriptorCounters{};
 
-		for (auto const [flag, counter] : counters)
+		for (auto const& [flag, counter] : counters)
 		{
 			validCounters.set(flag);
 			descriptorCounters[validCounters.getPosition(flag)] = counter;
@@ -3385,7 +3902,7 @@ void ControllerImpl::setStreamOutputCounters(UniqueIdentifier const targetEntity
 		auto validCounters = entity::StreamOutputCounterValidFlags{};
 		auto descriptorCounters = entity::model::DescriptorCounters{};
 
-		for (auto const [flag, counter] : counters)
+		for (auto const& [flag, counter] : counters)
 		{
 			validCounters.set(flag);
 			descriptorCounters[validCounters.getPosition(flag)] = counter;
@@ -0,0 +1,366 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccCountersHistory.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include <la/avdecc/controller/internals/avdeccControlledEntity.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/** Memory budget shared by all the CountersHistory of a Controller */
+class CountersHistoryBudget final
+{
+public:
+	using SharedPointer = std::shared_ptr<CountersHistoryBudget>;
+
+	CountersHistoryBudget(std::uint16_t const samplesPerDescriptor, std::size_t const maxMemorySize) noexcept
+		: _samplesPerDescriptor{ samplesPerDescriptor }
+		, _maxMemorySize{ maxMemorySize }
+	{
+	}
+
+	std::uint16_t getSamplesPerDescriptor() const noexcept
+	{
+		return _samplesPerDescriptor;
+	}
+
+	std::size_t getMaxMemorySize() const noexcept
+	{
+		return _maxMemorySize;
+	}
+
+	std::size_t getUsedMemorySize() const noexcept
+	{
+		return _usedMemorySize;
+	}
+
+	/** Reserves the specified size from the budget. Returns false if it would exceed the maximum memory size */
+	bool reserve(std::size_t const size) noexcept
+	{
+		auto used = _usedMemorySize.load();
+		do
+		{
+			if (used + size > _maxMemorySize)
+			{
+				return false;
+			}
+		} while (!_usedMemorySize.compare_exchange_weak(used, used + size));
+		return true;
+	}
+
+	void release(std::size_t const size) noexcept
+	{
+		_usedMemorySize -= size;
+	}
+
+	// Deleted compiler auto-generated methods
+	CountersHistoryBudget(CountersHistoryBudget&&) = delete;
+	CountersHistoryBudget(CountersHistoryBudget const&) = delete;
+	CountersHistoryBudget& operator=(CountersHistoryBudget const&) = delete;
+	CountersHistoryBudget& operator=(CountersHistoryBudget&&) = delete;
+
+private:
+	std::uint16_t const _samplesPerDescriptor{ 0u };
+	std::size_t const _maxMemorySize{ 0u };
+	std::atomic<std::size_t> _usedMemorySize{ 0u };
+};
+
+/**
+* @brief Bounded history of timestamped counters samples for a single descriptor.
+* @details Only the counters that changed since the previous sample are stored with each sample (most counters of a descriptor rarely change),
+*          in a ring of values shared by all the samples. The values of the counters before the oldest sample are kept apart, so the value of any
+*          counter at any sample can be rebuilt. When either the samples or the values ring is full, the oldest samples are dropped.
+*/
+class CountersHistory final
+{
+public:
+	using UniquePointer = std::unique_ptr<CountersHistory>;
+	using Clock = std::chrono::steady_clock;
+
+	/** Average number of changed counters per sample the values ring is sized for (a sample never needs more than all the counters) */
+	static constexpr auto AverageChangedCountersPerSample = std::size_t{ 4u };
+
+	struct Sample
+	{
+		Clock::time_point timestamp{};
+		entity::model::DescriptorCounterValidFlag validCounters{ 0u };
+		entity::model::DescriptorCounterValidFlag changedCounters{ 0u }; // Counters stored in the values ring for this sample (in ascending position order)
+		std::uint32_t valuesOffset{ 0u }; // Position of the first value of this sample in the values ring
+	};
+
+	/** Returns the memory size required by a CountersHistory with the specified capacity */
+	static constexpr std::size_t getMemorySize(std::uint16_t const capacity) noexcept
+	{
+		return sizeof(CountersHistory) + capacity * sizeof(Sample) + getValuesCapacity(capacity) * sizeof(entity::model::DescriptorCounter);
+	}
+
+	/** Creates a new CountersHistory using the samples count defined by the budget. Returns nullptr if the budget has been exhausted */
+	static UniquePointer create(CountersHistoryBudget::SharedPointer const& budget) noexcept
+	{
+		if (!budget || budget->getSamplesPerDescriptor() < 2u)
+		{
+			return nullptr;
+		}
+		if (!budget->reserve(getMemorySize(budget->getSamplesPerDescriptor())))
+		{
+			return nullptr;
+		}
+		try
+		{
+			return UniquePointer{ new CountersHistory{ budget } };
+		}
+		catch (...)
+		{
+			budget->release(getMemorySize(budget->getSamplesPerDescriptor()));
+			return nullptr;
+		}
+	}
+
+	~CountersHistory() noexcept
+	{
+		_budget->release(getMemorySize(static_cast<std::uint16_t>(_samples.size())));
+	}
+
+	CountersHistoryBudget::SharedPointer const& getBudget() const noexcept
+	{
+		return _budget;
+	}
+
+	std::size_t size() const noexcept
+	{
+		return _count;
+	}
+
+	/** Returns the number of counter values currently stored (only the changed counters of each sample) */
+	std::size_t getStoredValuesCount() const noexcept
+	{
+		return _valuesCount;
+	}
+
+	/** Records a new sample, dropping the oldest ones if the history is full */
+	void record(Clock::time_point const timestamp, entity::model::DescriptorCounterValidFlag const validCounters, entity::model::DescriptorCounters const& counters) noexcept
+	{
+		// Find the counters that changed since the previous sample (newly valid counters are considered changed)
+		auto changed = entity::model::DescriptorCounterValidFlag{ 0u };
+		for (auto position = std::size_t{ 0u }; position < MaxCounters; ++position)
+		{
+			auto const mask = static_cast<entity::model::DescriptorCounterValidFlag>(1u) << position;
+			if ((validCounters & mask) != 0u && ((_currentValid & mask) == 0u || _currentValues[position] != counters[position]))
+			{
+				changed |= mask;
+			}
+		}
+		auto const changedCount = countBits(changed);
+
+		// Make room for the new sample
+		while (_count == _samples.size() || _valuesCount + changedCount > _values.size())
+		{
+			dropOldest();
+		}
+
+		// Store the changed values
+		auto const valuesOffset = (_valuesHead + _valuesCount) % _values.size();
+		for (auto position = std::size_t{ 0u }; position < MaxCounters; ++position)
+		{
+			if ((changed & (static_cast<entity::model::DescriptorCounterValidFlag>(1u) << position)) != 0u)
+			{
+				_values[(_valuesHead + _valuesCount) % _values.size()] = counters[position];
+				++_valuesCount;
+				_currentValues[position] = counters[position];
+			}
+		}
+		_currentValid |= validCounters;
+
+		auto& sample = _samples[(_head + _count) % _samples.size()];
+		sample.timestamp = timestamp;
+		sample.validCounters = validCounters;
+		sample.changedCounters = changed;
+		sample.valuesOffset = static_cast<std::uint32_t>(valuesOffset);
+		++_count;
+	}
+
+	/**
+	* @brief Computes the statistics of a counter over a sliding window.
+	* @details The window ends at the most recent sample and starts at the oldest sample no older than the specified duration.
+	*          The start of the window is found with a binary search over the samples, the value of the counter at that sample by walking back to its previous change.
+	* @param[in] position The bit position of the counter.
+	* @param[in] window The duration of the window.
+	* @return The statistics, or std::nullopt if less than 2 samples with the counter valid are in the window.
+	*/
+	std::optional<ControlledEntity::CounterHistoryStatistics> getStatistics(std::size_t const position, std::chrono::milliseconds const window) const noexcept
+	{
+		if (_count < 2u || position >= MaxCounters)
+		{
+			return std::nullopt;
+		}
+
+		auto const mask = static_cast<entity::model::DescriptorCounterValidFlag>(1u) << position;
+		auto const& newest = at(_count - 1u);
+		if ((newest.validCounters & mask) == 0u)
+		{
+			return std::nullopt;
+		}
+
+		// Find the oldest sample in the window (timestamps are monotonic)
+		auto const windowStart = newest.timestamp - window;
+		auto low = std::size_t{ 0u };
+		auto high = _count - 1u;
+		while (low < high)
+		{
+			auto const middle = low + (high - low) / 2u;
+			if (at(middle).timestamp < windowStart)
+			{
+				low = middle + 1u;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+
+		// Skip samples where the counter was not valid
+		while (low < _count - 1u && (at(low).validCounters & mask) == 0u)
+		{
+			++low;
+		}
+		if (low >= _count - 1u)
+		{
+			return std::nullopt;
+		}
+
+		auto const& oldest = at(low);
+		auto statistics = ControlledEntity::CounterHistoryStatistics{};
+		statistics.delta = static_cast<entity::model::DescriptorCounter>(_currentValues[position] - getValue(low, position)); // Unsigned arithmetic handles counter wrap around
+		statistics.duration = std::chrono::duration_cast<std::chrono::milliseconds>(newest.timestamp - oldest.timestamp);
+		statistics.samplesCount = _count - low;
+		auto const seconds = std::chrono::duration<double>(newest.timestamp - oldest.timestamp).count();
+		if (seconds > 0.0)
+		{
+			statistics.ratePerSecond = static_cast<double>(statistics.delta) / seconds;
+		}
+		return statistics;
+	}
+
+	// Deleted compiler auto-generated methods
+	CountersHistory(CountersHistory&&) = delete;
+	CountersHistory(CountersHistory const&) = delete;
+	CountersHistory& operator=(CountersHistory const&) = delete;
+	CountersHistory& operator=(CountersHistory&&) = delete;
+
+private:
+	static constexpr auto MaxCounters = std::tuple_size_v<entity::model::DescriptorCounters>;
+
+	static constexpr std::size_t getValuesCapacity(std::uint16_t const capacity) noexcept
+	{
+		return std::max(capacity * AverageChangedCountersPerSample, MaxCounters);
+	}
+
+	static std::size_t countBits(entity::model::DescriptorCounterValidFlag value) noexcept
+	{
+		auto count = std::size_t{ 0u };
+		while (value != 0u)
+		{
+			value &= value - 1u;
+			++count;
+		}
+		return count;
+	}
+
+	CountersHistory(CountersHistoryBudget::SharedPointer const& budget)
+		: _budget{ budget }
+		, _samples(budget->getSamplesPerDescriptor())
+		, _values(getValuesCapacity(budget->getSamplesPerDescriptor()))
+	{
+	}
+
+	/** Returns the sample at the specified logical index (0 being the oldest) */
+	Sample const& at(std::size_t const index) const noexcept
+	{
+		return _samples[(_head + index) % _samples.size()];
+	}
+
+	/** Returns the value of a counter (valid at that sample) at the specified logical index */
+	entity::model::DescriptorCounter getValue(std::size_t const index, std::size_t const position) const noexcept
+	{
+		auto const mask = static_cast<entity::model::DescriptorCounterValidFlag>(1u) << position;
+		for (auto i = index + 1u; i > 0u; --i)
+		{
+			auto const& sample = at(i - 1u);
+			if ((sample.changedCounters & mask) != 0u)
+			{
+				return _values[(sample.valuesOffset + countBits(sample.changedCounters & (mask - 1u))) % _values.size()];
+			}
+		}
+		// Not changed since the oldest sample
+		return _baseValues[position];
+	}
+
+	/** Drops the oldest sample, keeping its values as the values before the oldest sample */
+	void dropOldest() noexcept
+	{
+		auto const& oldest = _samples[_head];
+		auto valueIndex = std::size_t{ oldest.valuesOffset };
+		for (auto position = std::size_t{ 0u }; position < MaxCounters; ++position)
+		{
+			if ((oldest.changedCounters & (static_cast<entity::model::DescriptorCounterValidFlag>(1u) << position)) != 0u)
+			{
+				_baseValues[position] = _values[valueIndex % _values.size()];
+				++valueIndex;
+			}
+		}
+		auto const droppedValues = countBits(oldest.changedCounters);
+		_valuesHead = (_valuesHead + droppedValues) % _values.size();
+		_valuesCount -= droppedValues;
+		_head = (_head + 1u) % _samples.size();
+		--_count;
+	}
+
+	CountersHistoryBudget::SharedPointer _budget{ nullptr };
+	std::vector<Sample> _samples{};
+	std::size_t _head{ 0u };
+	std::size_t _count{ 0u };
+	std::vector<entity::model::DescriptorCounter> _values{};
+	std::size_t _valuesHead{ 0u };
+	std::size_t _valuesCount{ 0u };
+	entity::model::DescriptorCounters _baseValues{}; // Values of the counters before the oldest sample
+	entity::model::DescriptorCounters _currentValues{}; // Values of the counters at the newest sample
+	entity::model::DescriptorCounterValidFlag _currentValid{ 0u };
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
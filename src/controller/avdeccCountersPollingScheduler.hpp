@@ -0,0 +1,356 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccCountersPollingScheduler.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Schedules the periodic refresh of the counters of the entities.
+* @details Only decides when an entity has to be polled, sending the queries is up to the caller.
+*          Each entity is polled at its own adaptive interval (never less than the configured period), randomly delayed (jitter) so that the load is spread over time.
+*          The interval grows with the observed response time of the entity and backs off in case of failure.
+*          Entities that recently sent unsolicited counters notifications are not polled.
+*          The number of inflight polling commands (for all entities) is limited to a global budget, the commands of an entity not fitting in the budget being sent in successive rounds. Thread-safe.
+*/
+class CountersPollingScheduler final
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	/** Range of polling commands that can be sent */
+	struct PollRange
+	{
+		std::uint16_t first{ 0u }; /** Index of the first command to send */
+		std::uint16_t count{ 0u }; /** Number of commands to send */
+	};
+
+	static constexpr auto MaxIntervalFactor = 8u; /** Maximum interval, relative to the configured period */
+	static constexpr auto ResponseTimeFactor = 20u; /** Minimum interval, relative to the average response time of the entity (so polling uses at most 5% of the entity AECP time) */
+	static constexpr auto JitterRatio = 0.1; /** Random delay added to each interval, relative to the interval */
+
+	CountersPollingScheduler(std::uint32_t const seed = std::random_device{}()) noexcept
+		: _randomGenerator{ seed }
+	{
+	}
+
+	bool isEnabled() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _period.count() != 0;
+	}
+
+	std::chrono::milliseconds getPeriod() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _period;
+	}
+
+	/** Enables the scheduler. All known entities are rescheduled. */
+	void enable(std::chrono::milliseconds const period, std::uint16_t const maxInflightCommands, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		_period = std::max(period, std::chrono::milliseconds{ 1 });
+		_maxInflightCommands = std::max(maxInflightCommands, std::uint16_t{ 1u });
+		for (auto& [entityID, state] : _entities)
+		{
+			state.interval = _period;
+			state.nextPollTime = now + randomDelay(_period);
+		}
+	}
+
+	/** Disables the scheduler. Known entities are kept so they are scheduled again if the scheduler is re-enabled. */
+	void disable() noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		_period = std::chrono::milliseconds{ 0 };
+	}
+
+	/** Adds an entity to be polled, first poll being randomly delayed within a period */
+	void addEntity(UniqueIdentifier const entityID, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto& state = _entities[entityID];
+		state = EntityState{};
+		state.interval = _period;
+		state.nextPollTime = now + randomDelay(_period);
+	}
+
+	/** Removes an entity, releasing its inflight commands from the budget */
+	void removeEntity(UniqueIdentifier const entityID) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end())
+		{
+			releaseInflight(it->second.inflightCommands);
+			_entities.erase(it);
+		}
+	}
+
+	/** Notifies that the entity sent unsolicited counters, meaning it does not need to be polled for a while */
+	void onUnsolicitedCounters(UniqueIdentifier const entityID, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end())
+		{
+			it->second.lastUnsolicitedTime = now;
+		}
+	}
+
+	/** Returns the entities that are due for a poll (oldest due first), if there is some budget left. The caller must then call startPoll for each returned entity. */
+	std::vector<UniqueIdentifier> getEntitiesToPoll(Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto entities = std::vector<std::pair<Clock::time_point, UniqueIdentifier>>{};
+		if (_period.count() == 0 || _inflightCommands >= _maxInflightCommands)
+		{
+			return {};
+		}
+
+		for (auto& [entityID, state] : _entities)
+		{
+			if (state.inflightCommands != 0u || now < state.nextPollTime)
+			{
+				continue;
+			}
+			// Entity recently sent unsolicited counters, no need to poll it (unless it is in the middle of a poll cycle)
+			if (state.nextCommand == 0u && state.lastUnsolicitedTime && (now - *state.lastUnsolicitedTime) < state.interval)
+			{
+				state.nextPollTime = *state.lastUnsolicitedTime + state.interval + randomDelay(state.interval * JitterRatio);
+				continue;
+			}
+			entities.emplace_back(state.nextPollTime, entityID);
+		}
+
+		std::sort(entities.begin(), entities.end(),
+			[](auto const& lhs, auto const& rhs)
+			{
+				return lhs.first < rhs.first;
+			});
+
+		auto result = std::vector<UniqueIdentifier>{};
+		result.reserve(entities.size());
+		for (auto const& [dueTime, entityID] : entities)
+		{
+			result.push_back(entityID);
+		}
+		return result;
+	}
+
+	/** Returns true if some polling commands can be sent without exceeding the global budget */
+	bool hasAvailableBudget() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _inflightCommands < _maxInflightCommands;
+	}
+
+	/**
+	* @brief Starts (or continues) a poll of the entity, within the limits of the global budget.
+	* @details The caller passes the number of commands required to poll all the counters of the entity, and gets the range of these commands it can send now.
+	*          If the whole range does not fit in the budget, the remaining commands are sent in a next round as soon as the previous ones are answered and some budget is available.
+	*          If commandsCount is 0 the entity is simply rescheduled. If the returned range is empty, nothing can be sent now and the entity stays due.
+	* @param[in] entityID The entity to poll.
+	* @param[in] commandsCount The total number of commands required to poll all the counters of the entity.
+	* @param[in] now The current time.
+	* @return The range of commands that can be sent (index of the first command, and number of commands).
+	*/
+	PollRange startPoll(UniqueIdentifier const entityID, std::uint16_t const commandsCount, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto const it = _entities.find(entityID);
+		if (it == _entities.end())
+		{
+			return {};
+		}
+
+		auto& state = it->second;
+		if (commandsCount == 0u)
+		{
+			state.nextCommand = 0u;
+			reschedule(state, now);
+			return {};
+		}
+		if (state.inflightCommands != 0u || _inflightCommands >= _maxInflightCommands)
+		{
+			return {};
+		}
+
+		// The list of counters might have changed since the previous round, start over
+		if (state.nextCommand >= commandsCount)
+		{
+			state.nextCommand = 0u;
+		}
+
+		auto const range = PollRange{ state.nextCommand, static_cast<std::uint16_t>(std::min<std::uint32_t>(commandsCount - state.nextCommand, _maxInflightCommands - _inflightCommands)) };
+		state.nextCommand = (range.first + range.count) < commandsCount ? static_cast<std::uint16_t>(range.first + range.count) : std::uint16_t{ 0u };
+		state.inflightCommands = range.count;
+		state.pollStartTime = now;
+		state.pollFailed = false;
+		_inflightCommands += range.count;
+
+		return range;
+	}
+
+	/** Notifies that a response (or a failure) has been received for a polling command */
+	void onPollResponse(UniqueIdentifier const entityID, bool const success, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end())
+		{
+			auto& state = it->second;
+			if (state.inflightCommands == 0u)
+			{
+				return;
+			}
+			--state.inflightCommands;
+			releaseInflight(1u);
+			state.pollFailed |= !success;
+
+			// All responses received, adapt the interval and schedule next poll
+			if (state.inflightCommands == 0u)
+			{
+				auto const responseTime = std::chrono::duration_cast<std::chrono::milliseconds>(now - state.pollStartTime);
+				state.averageResponseTime = state.averageResponseTime.count() == 0 ? responseTime : (state.averageResponseTime * 3 + responseTime) / 4;
+
+				auto const maxInterval = _period * MaxIntervalFactor;
+				if (state.pollFailed)
+				{
+					// Back off (and abandon the current poll cycle)
+					state.interval = std::min(state.interval * 2, maxInterval);
+					state.nextCommand = 0u;
+				}
+				else
+				{
+					state.interval = std::clamp(std::chrono::milliseconds{ state.averageResponseTime * ResponseTimeFactor }, _period, maxInterval);
+				}
+
+				// Some commands of the poll cycle did not fit in the budget, they are due right away
+				if (state.nextCommand != 0u)
+				{
+					state.nextPollTime = now;
+				}
+				else
+				{
+					reschedule(state, now);
+				}
+			}
+		}
+	}
+
+	std::chrono::milliseconds getInterval(UniqueIdentifier const entityID) const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end())
+		{
+			return it->second.interval;
+		}
+		return std::chrono::milliseconds{ 0 };
+	}
+
+	std::uint32_t getInflightCommands() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _inflightCommands;
+	}
+
+	// Deleted compiler auto-generated methods
+	CountersPollingScheduler(CountersPollingScheduler&&) = delete;
+	CountersPollingScheduler(CountersPollingScheduler const&) = delete;
+	CountersPollingScheduler& operator=(CountersPollingScheduler const&) = delete;
+	CountersPollingScheduler& operator=(CountersPollingScheduler&&) = delete;
+
+private:
+	struct EntityState
+	{
+		Clock::time_point nextPollTime{};
+		Clock::time_point pollStartTime{};
+		std::optional<Clock::time_point> lastUnsolicitedTime{ std::nullopt };
+		std::chrono::milliseconds interval{};
+		std::chrono::milliseconds averageResponseTime{};
+		std::uint16_t inflightCommands{ 0u };
+		std::uint16_t nextCommand{ 0u }; // Index of the first command not sent yet in the current poll cycle (0 if the cycle is complete)
+		bool pollFailed{ false };
+	};
+
+	template<class Duration>
+	std::chrono::milliseconds randomDelay(Duration const& maxDelay) noexcept
+	{
+		auto const maxMs = std::chrono::duration_cast<std::chrono::milliseconds>(maxDelay).count();
+		if (maxMs <= 0)
+		{
+			return std::chrono::milliseconds{ 0 };
+		}
+		return std::chrono::milliseconds{ std::uniform_int_distribution<std::chrono::milliseconds::rep>{ 0, maxMs }(_randomGenerator) };
+	}
+
+	void reschedule(EntityState& state, Clock::time_point const now) noexcept
+	{
+		state.nextPollTime = now + state.interval + randomDelay(state.interval * JitterRatio);
+	}
+
+	void releaseInflight(std::uint32_t const count) noexcept
+	{
+		_inflightCommands -= std::min(_inflightCommands, count);
+	}
+
+	mutable std::mutex _lock{};
+	std::unordered_map<UniqueIdentifier, EntityState, UniqueIdentifier::hash> _entities{};
+	std::mt19937 _randomGenerator;
+	std::chrono::milliseconds _period{ 0 };
+	std::uint16_t _maxInflightCommands{ 1u };
+	std::uint32_t _inflightCommands{ 0u };
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,361 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+/**
+* @file avdeccEnumerationScheduler.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/controller/avdeccController.hpp"
+
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Schedules the retrieval of the static model of the entities being enumerated.
+* @details Only decides when an entity can start retrieving its static model (the most expensive enumeration step), sending the queries is up to the caller.
+*          When enabled, the number of entities retrieving their static model at the same time (for all entities) is limited to a global budget, the others waiting in a queue ordered by priority then discovery order.
+*          When disabled, entities are not queued nor counted in the budget.
+*          Also measures the time between the discovery of the entities and them being usable (fully enumerated). Thread-safe.
+*/
+class EnumerationScheduler final
+{
+public:
+	using Clock = std::chrono::steady_clock;
+	using Priority = Controller::EnumerationPriority;
+
+	static constexpr auto Timeout = std::chrono::seconds{ 60 }; /** Delay after which an entity still retrieving its static model no longer counts in the budget */
+
+	EnumerationScheduler() noexcept = default;
+
+	bool isEnabled() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _maxConcurrentEntities != 0u;
+	}
+
+	/** Enables the scheduler, at most maxConcurrentEntities entities retrieving their static model at the same time. Entities that started while disabled do not count in the budget. */
+	void enable(std::uint16_t const maxConcurrentEntities) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		_maxConcurrentEntities = std::max(maxConcurrentEntities, std::uint16_t{ 1u });
+	}
+
+	/** Disables the scheduler. Waiting entities are all returned by the next call to getEntitiesToStart. */
+	void disable() noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		_maxConcurrentEntities = 0u;
+	}
+
+	/** Sets the priority of an entity, known or not yet discovered. If not set, the default priority is Talker or Default depending on the entity capabilities. */
+	void setPriority(UniqueIdentifier const entityID, std::optional<Priority> const priority) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (priority)
+		{
+			_priorities[entityID] = *priority;
+		}
+		else
+		{
+			_priorities.erase(entityID);
+		}
+
+		// Move the entity in the queue if it is waiting
+		if (auto const it = _entities.find(entityID); it != _entities.end() && it->second.waitingPriority)
+		{
+			auto& state = it->second;
+			_waitingEntities.erase(WaitingKey{ *state.waitingPriority, state.sequence, entityID });
+			state.waitingPriority = getPriority(entityID, state);
+			_waitingEntities.insert(WaitingKey{ *state.waitingPriority, state.sequence, entityID });
+		}
+	}
+
+	/** Notifies an entity has been discovered and starts its enumeration */
+	void onEntityDiscovered(UniqueIdentifier const entityID, bool const isTalker, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto& state = _entities[entityID];
+		release(entityID, state);
+		state = EntityState{};
+		state.discoveryTime = now;
+		state.sequence = _nextSequence++;
+		state.isTalker = isTalker;
+
+		if (!_firstDiscoveryTime)
+		{
+			_firstDiscoveryTime = now;
+		}
+	}
+
+	/** Requests to start retrieving the static model of an entity. Returns true if it can start right away, otherwise the entity is queued until returned by getEntitiesToStart. */
+	bool requestStaticModel(UniqueIdentifier const entityID, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto const [it, inserted] = _entities.try_emplace(entityID);
+		auto& state = it->second;
+		if (inserted)
+		{
+			state.discoveryTime = now;
+			state.sequence = _nextSequence++;
+		}
+
+		// Already allowed to start
+		if (state.startTime)
+		{
+			return true;
+		}
+
+		// Not scheduling, start right away without counting in the budget
+		if (_maxConcurrentEntities == 0u)
+		{
+			release(entityID, state);
+			return true;
+		}
+
+		// Already waiting
+		if (state.waitingPriority)
+		{
+			return false;
+		}
+
+		// Only start right away if there is room in the budget and no other entity is before it in the queue
+		auto const key = WaitingKey{ getPriority(entityID, state), state.sequence, entityID };
+		if ((_waitingEntities.empty() || key < *_waitingEntities.begin()) && countInProgress(now) < _maxConcurrentEntities)
+		{
+			start(entityID, state, now);
+			return true;
+		}
+
+		state.waitingPriority = key.priority;
+		_waitingEntities.insert(key);
+		return false;
+	}
+
+	/** Returns the queued entities that can now start retrieving their static model, in priority order. Returned entities are considered in progress until onStaticModelCompleted is called. */
+	std::vector<UniqueIdentifier> getEntitiesToStart(Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto entities = std::vector<UniqueIdentifier>{};
+		if (_waitingEntities.empty())
+		{
+			return entities;
+		}
+
+		auto inProgress = countInProgress(now);
+		while (!_waitingEntities.empty() && (_maxConcurrentEntities == 0u || inProgress < _maxConcurrentEntities))
+		{
+			auto const entityID = _waitingEntities.begin()->entityID;
+			_waitingEntities.erase(_waitingEntities.begin());
+
+			auto& state = _entities[entityID];
+			state.waitingPriority = std::nullopt;
+			if (_maxConcurrentEntities != 0u)
+			{
+				start(entityID, state, now);
+				++inProgress;
+			}
+			entities.push_back(entityID);
+		}
+
+		return entities;
+	}
+
+	/** Notifies the entity got its static model, releasing it from the budget */
+	void onStaticModelCompleted(UniqueIdentifier const entityID) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end())
+		{
+			release(entityID, it->second);
+		}
+	}
+
+	/** Notifies the entity is fully enumerated and usable, updating the statistics */
+	void onEntityUsable(UniqueIdentifier const entityID, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end())
+		{
+			auto const timeToUsable = std::chrono::duration_cast<std::chrono::milliseconds>(now - it->second.discoveryTime);
+			if (!_statistics.timeToFirstUsableEntity && _firstDiscoveryTime)
+			{
+				_statistics.timeToFirstUsableEntity = std::chrono::duration_cast<std::chrono::milliseconds>(now - *_firstDiscoveryTime);
+			}
+			++_statistics.usableEntities;
+			_totalTimeToUsable += timeToUsable;
+			_statistics.averageTimeToUsable = _totalTimeToUsable / _statistics.usableEntities;
+			_statistics.maxTimeToUsable = std::max(_statistics.maxTimeToUsable, timeToUsable);
+
+			release(entityID, it->second);
+			_entities.erase(it);
+		}
+	}
+
+	/** Removes an entity, releasing it from the budget (its priority is kept) */
+	void removeEntity(UniqueIdentifier const entityID) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end())
+		{
+			release(entityID, it->second);
+			_entities.erase(it);
+		}
+	}
+
+	Controller::EnumerationStatistics getStatistics(Clock::time_point const now = Clock::now()) const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto statistics = _statistics;
+		statistics.waitingEntities = static_cast<std::uint32_t>(_waitingEntities.size());
+		// Entities stuck for too long no longer count (only scanning the entities in the budget)
+		statistics.enumeratingEntities = static_cast<std::uint32_t>(std::count_if(_inProgressEntities.begin(), _inProgressEntities.end(),
+			[now](auto const& key)
+			{
+				return (now - key.startTime) < Timeout;
+			}));
+		return statistics;
+	}
+
+	// Deleted compiler auto-generated methods
+	EnumerationScheduler(EnumerationScheduler&&) = delete;
+	EnumerationScheduler(EnumerationScheduler const&) = delete;
+	EnumerationScheduler& operator=(EnumerationScheduler const&) = delete;
+	EnumerationScheduler& operator=(EnumerationScheduler&&) = delete;
+
+private:
+	struct EntityState
+	{
+		Clock::time_point discoveryTime{};
+		std::uint64_t sequence{ 0u }; // Discovery order
+		bool isTalker{ false };
+		std::optional<Priority> waitingPriority{ std::nullopt }; // Set while waiting in the queue
+		std::optional<Clock::time_point> startTime{ std::nullopt }; // Set while retrieving the static model (only when scheduled)
+	};
+	using Entities = std::unordered_map<UniqueIdentifier, EntityState, UniqueIdentifier::hash>;
+
+	/** Waiting queue, ordered by priority then discovery order */
+	struct WaitingKey
+	{
+		Priority priority{ Priority::Default };
+		std::uint64_t sequence{ 0u };
+		UniqueIdentifier entityID{};
+
+		bool operator<(WaitingKey const& other) const noexcept
+		{
+			return std::tie(priority, sequence) < std::tie(other.priority, other.sequence);
+		}
+	};
+
+	/** Entities counting in the budget, ordered by start time (so the expired ones are always first) */
+	struct InProgressKey
+	{
+		Clock::time_point startTime{};
+		UniqueIdentifier entityID{};
+
+		bool operator<(InProgressKey const& other) const noexcept
+		{
+			return std::tie(startTime, entityID) < std::tie(other.startTime, other.entityID);
+		}
+	};
+
+	Priority getPriority(UniqueIdentifier const entityID, EntityState const& state) const noexcept
+	{
+		if (auto const it = _priorities.find(entityID); it != _priorities.end())
+		{
+			return it->second;
+		}
+		return state.isTalker ? Priority::Talker : Priority::Default;
+	}
+
+	/** Returns the number of entities counting in the budget, forgetting about the ones stuck for too long (fatal enumeration error for example) */
+	std::uint32_t countInProgress(Clock::time_point const now) noexcept
+	{
+		while (!_inProgressEntities.empty() && (now - _inProgressEntities.begin()->startTime) >= Timeout)
+		{
+			_inProgressEntities.erase(_inProgressEntities.begin());
+		}
+		return static_cast<std::uint32_t>(_inProgressEntities.size());
+	}
+
+	void start(UniqueIdentifier const entityID, EntityState& state, Clock::time_point const now) noexcept
+	{
+		state.startTime = now;
+		_inProgressEntities.insert(InProgressKey{ now, entityID });
+	}
+
+	/** Removes the entity from the queue and from the budget */
+	void release(UniqueIdentifier const entityID, EntityState& state) noexcept
+	{
+		if (state.waitingPriority)
+		{
+			_waitingEntities.erase(WaitingKey{ *state.waitingPriority, state.sequence, entityID });
+			state.waitingPriority = std::nullopt;
+		}
+		if (state.startTime)
+		{
+			_inProgressEntities.erase(InProgressKey{ *state.startTime, entityID });
+			state.startTime = std::nullopt;
+		}
+	}
+
+	mutable std::mutex _lock{};
+	std::uint16_t _maxConcurrentEntities{ 0u }; // 0 when disabled
+	Entities _entities{};
+	std::set<WaitingKey> _waitingEntities{};
+	std::set<InProgressKey> _inProgressEntities{};
+	std::unordered_map<UniqueIdentifier, Priority, UniqueIdentifier::hash> _priorities{};
+	std::uint64_t _nextSequence{ 0u };
+	std::optional<Clock::time_point> _firstDiscoveryTime{ std::nullopt };
+	std::chrono::milliseconds _totalTimeToUsable{ 0 };
+	Controller::EnumerationStatistics _statistics{};
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
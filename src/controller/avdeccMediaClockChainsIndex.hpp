@@ -0,0 +1,142 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccMediaClockChainsIndex.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/controller/internals/avdeccControlledEntityModel.hpp"
+
+#include <la/avdecc/internals/entityModelTypes.hpp>
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Reverse-dependency index of the media clock chains.
+* @details Maps each entity to all the media clock chains (identified by the entity and clock domain owning the chain) that have a node on that entity,
+*          so that only the chains affected by a change on an entity have to be recomputed.
+*          Not thread-safe, the caller is responsible for locking.
+*/
+class MediaClockChainsIndex final
+{
+public:
+	struct ChainKey
+	{
+		UniqueIdentifier entityID{};
+		entity::model::ClockDomainIndex clockDomainIndex{ entity::model::getInvalidDescriptorIndex() };
+
+		constexpr bool operator<(ChainKey const& other) const noexcept
+		{
+			return (entityID.getValue() < other.entityID.getValue()) || (entityID == other.entityID && clockDomainIndex < other.clockDomainIndex);
+		}
+	};
+	using ChainKeys = std::set<ChainKey>;
+
+	/** Sets (or replaces) the nodes of the chain owned by the specified entity and clock domain */
+	void setChain(ChainKey const& key, model::MediaClockChain const& chain) noexcept
+	{
+		auto& entities = _chainToEntities[key];
+
+		// Remove the previous dependencies
+		for (auto const entityID : entities)
+		{
+			removeDependency(entityID, key);
+		}
+		entities.clear();
+
+		// Add the new ones
+		for (auto const& node : chain)
+		{
+			if (auto const [it, inserted] = _entityToChains[node.entityID].insert(key); inserted)
+			{
+				entities.push_back(node.entityID);
+			}
+		}
+	}
+
+	/** Returns a copy of the keys of all the chains that have a node on the specified entity */
+	ChainKeys getChains(UniqueIdentifier const entityID) const noexcept
+	{
+		if (auto const it = _entityToChains.find(entityID); it != _entityToChains.end())
+		{
+			return it->second;
+		}
+		return {};
+	}
+
+	/** Removes all the chains owned by the specified entity */
+	void removeEntityChains(UniqueIdentifier const entityID) noexcept
+	{
+		// Chains are ordered by EntityID first, all the chains of the entity are contiguous
+		auto it = _chainToEntities.lower_bound(ChainKey{ entityID, entity::model::ClockDomainIndex{ 0u } });
+		while (it != _chainToEntities.end() && it->first.entityID == entityID)
+		{
+			for (auto const dependencyID : it->second)
+			{
+				removeDependency(dependencyID, it->first);
+			}
+			it = _chainToEntities.erase(it);
+		}
+	}
+
+	/** Returns the number of indexed chains */
+	size_t size() const noexcept
+	{
+		return _chainToEntities.size();
+	}
+
+	void clear() noexcept
+	{
+		_chainToEntities.clear();
+		_entityToChains.clear();
+	}
+
+private:
+	void removeDependency(UniqueIdentifier const entityID, ChainKey const& key) noexcept
+	{
+		if (auto const it = _entityToChains.find(entityID); it != _entityToChains.end())
+		{
+			it->second.erase(key);
+			if (it->second.empty())
+			{
+				_entityToChains.erase(it);
+			}
+		}
+	}
+
+	std::map<ChainKey, std::vector<UniqueIdentifier>> _chainToEntities{}; // Ordered, so all the chains of an entity are contiguous
+	std::unordered_map<UniqueIdentifier, ChainKeys, UniqueIdentifier::hash> _entityToChains{};
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
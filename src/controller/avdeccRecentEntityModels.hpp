@@ -0,0 +1,142 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccRecentEntityModels.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/controller/internals/avdeccControlledEntityModel.hpp"
+
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Static models of the entities that recently went offline (or were refreshed).
+* @details Allows an entity coming back online with the same EntityModelID to reuse its previous static model instead of enumerating it again (once validated against the CONFIGURATION descriptor of its current configuration).
+*          Models are only kept for a limited time and for a limited number of entities. Not thread-safe, only accessed from the networking thread.
+*/
+class RecentEntityModels final
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr auto RetentionTime = std::chrono::seconds{ 60 }; /** Duration a model is kept after the entity went offline */
+	static constexpr auto MaxEntities = 256u; /** Maximum number of kept models (the oldest one is dropped first) */
+
+	RecentEntityModels() noexcept = default;
+
+	/** Keeps the static model of an entity that went offline */
+	void addEntityModel(UniqueIdentifier const entityID, UniqueIdentifier const entityModelID, model::EntityNode&& entityNode, Clock::time_point const now = Clock::now()) noexcept
+	{
+		removeExpired(now);
+
+		// Drop the oldest one if full
+		if (_models.size() >= MaxEntities && _models.count(entityID) == 0u)
+		{
+			auto oldestIt = _models.begin();
+			for (auto it = _models.begin(); it != _models.end(); ++it)
+			{
+				if (it->second.departureTime < oldestIt->second.departureTime)
+				{
+					oldestIt = it;
+				}
+			}
+			_models.erase(oldestIt);
+		}
+
+		_models[entityID] = Model{ entityModelID, std::move(entityNode), now };
+	}
+
+	/** Returns (and forgets) the model kept for the entity, if it has not expired and has the same EntityModelID */
+	std::optional<model::EntityNode> takeEntityModel(UniqueIdentifier const entityID, UniqueIdentifier const entityModelID, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const it = _models.find(entityID);
+		if (it == _models.end())
+		{
+			return std::nullopt;
+		}
+
+		auto model = std::move(it->second);
+		_models.erase(it);
+
+		if (model.entityModelID != entityModelID || (now - model.departureTime) >= RetentionTime)
+		{
+			return std::nullopt;
+		}
+		return std::move(model.entityNode);
+	}
+
+	void removeEntityModel(UniqueIdentifier const entityID) noexcept
+	{
+		_models.erase(entityID);
+	}
+
+	std::size_t getEntityModelsCount() const noexcept
+	{
+		return _models.size();
+	}
+
+	// Deleted compiler auto-generated methods
+	RecentEntityModels(RecentEntityModels&&) = delete;
+	RecentEntityModels(RecentEntityModels const&) = delete;
+	RecentEntityModels& operator=(RecentEntityModels const&) = delete;
+	RecentEntityModels& operator=(RecentEntityModels&&) = delete;
+
+private:
+	struct Model
+	{
+		UniqueIdentifier entityModelID{};
+		model::EntityNode entityNode{};
+		Clock::time_point departureTime{};
+	};
+
+	void removeExpired(Clock::time_point const now) noexcept
+	{
+		for (auto it = _models.begin(); it != _models.end();)
+		{
+			if ((now - it->second.departureTime) >= RetentionTime)
+			{
+				it = _models.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	std::unordered_map<UniqueIdentifier, Model, UniqueIdentifier::hash> _models{};
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,225 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccResyncScheduler.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Schedules the resynchronization of the entities that lost some unsolicited notifications.
+* @details Only decides when an entity has to be resynchronized, sending the queries is up to the caller.
+*          Requests for the same entity received within a short delay are coalesced, a request received while the entity is being resynchronized triggers another resynchronization once completed.
+*          The number of concurrent resynchronizations (for all entities) is limited, and successive resynchronizations are spaced so that a burst of losses does not flood the network. Thread-safe.
+*/
+class ResyncScheduler final
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr auto RequestDelay = std::chrono::milliseconds{ 100 }; /** Delay before a requested resynchronization is started (so successive losses are coalesced) */
+	static constexpr auto StartInterval = std::chrono::milliseconds{ 50 }; /** Minimum delay between two resynchronization starts */
+	static constexpr auto Timeout = std::chrono::seconds{ 30 }; /** Delay after which an uncompleted resynchronization no longer counts in the budget */
+	static constexpr auto MaxConcurrentResyncs = 2u; /** Maximum number of resynchronizations in progress */
+
+	ResyncScheduler() noexcept = default;
+
+	/** Requests the resynchronization of an entity */
+	void requestResync(UniqueIdentifier const entityID, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto const [it, inserted] = _entities.try_emplace(entityID);
+		auto& state = it->second;
+		if (state.startTime)
+		{
+			// Already in progress, the notifications lost from now on might not be covered
+			state.requestedAgain = true;
+		}
+		else if (inserted)
+		{
+			state.dueTime = now + RequestDelay;
+		}
+	}
+
+	/** Returns the entities that are due for a resynchronization, within the limits of the concurrent budget. Returned entities are considered in progress until onResyncCompleted (or onResyncPostponed) is called. */
+	std::vector<UniqueIdentifier> getEntitiesToResync(Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto entities = std::vector<UniqueIdentifier>{};
+		auto inProgress = 0u;
+		for (auto it = _entities.begin(); it != _entities.end();)
+		{
+			auto& state = it->second;
+			if (state.startTime)
+			{
+				// Expired, release it from the budget (and start it again if required)
+				if ((now - *state.startTime) >= Timeout)
+				{
+					if (!complete(state, now))
+					{
+						it = _entities.erase(it);
+						continue;
+					}
+				}
+				else
+				{
+					++inProgress;
+				}
+			}
+			++it;
+		}
+
+		while (inProgress < MaxConcurrentResyncs && now >= _nextStartTime)
+		{
+			// Oldest due request first
+			auto* nextState = static_cast<EntityState*>(nullptr);
+			auto nextEntityID = UniqueIdentifier{};
+			for (auto& [entityID, state] : _entities)
+			{
+				if (!state.startTime && state.dueTime <= now && (!nextState || state.dueTime < nextState->dueTime))
+				{
+					nextState = &state;
+					nextEntityID = entityID;
+				}
+			}
+			if (!nextState)
+			{
+				break;
+			}
+			nextState->startTime = now;
+			nextState->requestedAgain = false;
+			entities.push_back(nextEntityID);
+			++inProgress;
+			_nextStartTime = now + StartInterval;
+		}
+
+		return entities;
+	}
+
+	/** Notifies that the resynchronization of the entity is complete. The entity is scheduled again if it lost notifications in the meantime. */
+	void onResyncCompleted(UniqueIdentifier const entityID, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end() && it->second.startTime)
+		{
+			if (!complete(it->second, now))
+			{
+				_entities.erase(it);
+			}
+		}
+	}
+
+	/** Notifies that the resynchronization of the entity could not be started yet (entity still enumerating for example). It is scheduled again later. */
+	void onResyncPostponed(UniqueIdentifier const entityID, Clock::time_point const now = Clock::now()) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _entities.find(entityID); it != _entities.end())
+		{
+			auto& state = it->second;
+			state.startTime = std::nullopt;
+			state.dueTime = now + RequestDelay;
+		}
+	}
+
+	/** Removes an entity, cancelling any pending resynchronization */
+	void removeEntity(UniqueIdentifier const entityID) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		_entities.erase(entityID);
+	}
+
+	bool isResyncPending(UniqueIdentifier const entityID) const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _entities.count(entityID) != 0u;
+	}
+
+	std::uint32_t getResyncsInProgress() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		auto count = std::uint32_t{ 0u };
+		for (auto const& [entityID, state] : _entities)
+		{
+			if (state.startTime)
+			{
+				++count;
+			}
+		}
+		return count;
+	}
+
+	// Deleted compiler auto-generated methods
+	ResyncScheduler(ResyncScheduler&&) = delete;
+	ResyncScheduler(ResyncScheduler const&) = delete;
+	ResyncScheduler& operator=(ResyncScheduler const&) = delete;
+	ResyncScheduler& operator=(ResyncScheduler&&) = delete;
+
+private:
+	struct EntityState
+	{
+		Clock::time_point dueTime{};
+		std::optional<Clock::time_point> startTime{ std::nullopt }; // Set while in progress
+		bool requestedAgain{ false };
+	};
+
+	/** Ends the resynchronization in progress. Returns true if the entity has to be resynchronized again, false if it can be removed. */
+	static bool complete(EntityState& state, Clock::time_point const now) noexcept
+	{
+		state.startTime = std::nullopt;
+		if (state.requestedAgain)
+		{
+			state.requestedAgain = false;
+			state.dueTime = now + RequestDelay;
+			return true;
+		}
+		return false;
+	}
+
+	mutable std::mutex _lock{};
+	std::unordered_map<UniqueIdentifier, EntityState, UniqueIdentifier::hash> _entities{};
+	Clock::time_point _nextStartTime{};
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
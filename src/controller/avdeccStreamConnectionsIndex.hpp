@@ -0,0 +1,148 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccStreamConnectionsIndex.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include <la/avdecc/internals/entityModelTypes.hpp>
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
+#include <unordered_map>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Bidirectional index of the stream connections of all entities.
+* @details Maps each listener stream to the talker stream it is connected (or fast connecting) to, and each talker stream to all the listener streams connected to it,
+*          so that the connections of a stream can be retrieved without walking all the entities.
+*          Not thread-safe, the caller is responsible for locking.
+*/
+class StreamConnectionsIndex final
+{
+public:
+	using StreamIdentifications = std::set<entity::model::StreamIdentification>;
+
+	/** Sets the talker stream the listener stream is connected to (an empty talkerStream means the listener stream is not connected) */
+	void setListenerConnection(entity::model::StreamIdentification const& listenerStream, entity::model::StreamIdentification const& talkerStream) noexcept
+	{
+		// Remove the previous connection
+		if (auto const it = _listenerToTalker.find(listenerStream); it != _listenerToTalker.end())
+		{
+			if (it->second == talkerStream)
+			{
+				return;
+			}
+			removeTalkerListener(it->second, listenerStream);
+			_listenerToTalker.erase(it);
+		}
+
+		// Add the new one
+		if (talkerStream.entityID)
+		{
+			_listenerToTalker.emplace(listenerStream, talkerStream);
+			_talkerToListeners[talkerStream].insert(listenerStream);
+		}
+	}
+
+	/** Returns the talker stream the listener stream is connected to, if any */
+	std::optional<entity::model::StreamIdentification> getTalker(entity::model::StreamIdentification const& listenerStream) const noexcept
+	{
+		if (auto const it = _listenerToTalker.find(listenerStream); it != _listenerToTalker.end())
+		{
+			return it->second;
+		}
+		return std::nullopt;
+	}
+
+	/** Returns all the listener streams connected to the talker stream */
+	StreamIdentifications const& getListeners(entity::model::StreamIdentification const& talkerStream) const noexcept
+	{
+		static auto const s_Empty = StreamIdentifications{};
+
+		if (auto const it = _talkerToListeners.find(talkerStream); it != _talkerToListeners.end())
+		{
+			return it->second;
+		}
+		return s_Empty;
+	}
+
+	/** Removes all the connections of the listener streams of the specified entity (connections to the talker streams of the entity are kept, they are owned by the listeners) */
+	void removeListenerEntity(UniqueIdentifier const entityID) noexcept
+	{
+		// Listener streams are ordered by EntityID first, all the streams of the entity are contiguous
+		auto it = _listenerToTalker.lower_bound(entity::model::StreamIdentification{ entityID, entity::model::StreamIndex{ 0u } });
+		while (it != _listenerToTalker.end() && it->first.entityID == entityID)
+		{
+			removeTalkerListener(it->second, it->first);
+			it = _listenerToTalker.erase(it);
+		}
+	}
+
+	/** Returns the number of connected listener streams */
+	size_t size() const noexcept
+	{
+		return _listenerToTalker.size();
+	}
+
+	void clear() noexcept
+	{
+		_listenerToTalker.clear();
+		_talkerToListeners.clear();
+	}
+
+private:
+	struct StreamIdentificationHash
+	{
+		std::size_t operator()(entity::model::StreamIdentification const& stream) const noexcept
+		{
+			return UniqueIdentifier::hash{}(stream.entityID) ^ (std::hash<entity::model::StreamIndex>{}(stream.streamIndex) << 1);
+		}
+	};
+
+	void removeTalkerListener(entity::model::StreamIdentification const& talkerStream, entity::model::StreamIdentification const& listenerStream) noexcept
+	{
+		if (auto const it = _talkerToListeners.find(talkerStream); it != _talkerToListeners.end())
+		{
+			it->second.erase(listenerStream);
+			if (it->second.empty())
+			{
+				_talkerToListeners.erase(it);
+			}
+		}
+	}
+
+	std::map<entity::model::StreamIdentification, entity::model::StreamIdentification> _listenerToTalker{}; // Ordered, so all the streams of an entity are contiguous
+	std::unordered_map<entity::model::StreamIdentification, StreamIdentifications, StreamIdentificationHash> _talkerToListeners{};
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
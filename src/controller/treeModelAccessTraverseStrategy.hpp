@@ -66,7 +66,7 @@ private:
 			return nullptr;
 		}
 
-		return &_entity->_entityNode;
+		return _entity->getRootEntityNode();
 	}
 
 	virtual model::ConfigurationNode* getConfigurationNode(entity::model::ConfigurationIndex const configurationIndex, NotFoundBehavior const notFoundBehavior) override
@@ -0,0 +1,80 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file dispatchTable.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/utils.hpp"
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace la
+{
+namespace avdecc
+{
+namespace utils
+{
+/**
+* @brief Dispatch table of plain function pointers, directly indexed by a command or message type.
+* @details Protocol command and message types are small dense integers, so a lookup is a bounds check followed by an array access (no hashing nor std::function indirection).
+*          Size must be greater than the highest key of the table, lookups of keys out of range returning nullptr.
+*/
+template<typename KeyType, typename Handler, std::size_t Size>
+class DispatchTable final
+{
+public:
+	static_assert(std::is_integral_v<KeyType>, "KeyType must be an integral type");
+	static_assert(std::is_pointer_v<Handler> && std::is_function_v<std::remove_pointer_t<Handler>>, "Handler must be a plain function pointer");
+
+	using Entry = std::pair<KeyType, Handler>;
+
+	DispatchTable(std::initializer_list<Entry> const entries) noexcept
+	{
+		for (auto const& [key, handler] : entries)
+		{
+			auto const index = static_cast<std::size_t>(key);
+			if (AVDECC_ASSERT_WITH_RET(index < Size, "DispatchTable is too small for this key"))
+			{
+				_handlers[index] = handler;
+			}
+		}
+	}
+
+	/** Returns the handler for the specified key, or nullptr if there is none */
+	Handler find(KeyType const key) const noexcept
+	{
+		auto const index = static_cast<std::size_t>(key);
+		return index < Size ? _handlers[index] : nullptr;
+	}
+
+private:
+	std::array<Handler, Size> _handlers{};
+};
+
+} // namespace utils
+} // namespace avdecc
+} // namespace la
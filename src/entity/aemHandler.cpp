@@ -24,6 +24,7 @@
 
 #include "aemHandler.hpp"
 #include "entityImpl.hpp"
+#include "dispatchTable.hpp"
 #include "protocol/protocolAemPayloads.hpp"
 
 
@@ -74,7 +75,8 @@ void AemHandler::validateEntityModel(entity::model::EntityTree const* const enti
 
 bool AemHandler::onUnhandledAecpAemCommand(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem) const noexcept
 {
-	static std::unordered_map<protocol::AemCommandType::value_type, std::function<bool(protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem)>> s_Dispatch{
+	using Handler = bool (*)(protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem);
+	static auto const s_Dispatch = utils::DispatchTable<protocol::AemCommandType::value_type, Handler, 0x80>{
 		// Read Descriptor
 		{ protocol::AemCommandType::ReadDescriptor.getValue(),
 			[](protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem)
@@ -116,12 +118,12 @@ bool AemHandler::onUnhandledAecpAemCommand(protocol::ProtocolInterface* const pi
 			} },
 	};
 
-	auto const& it = s_Dispatch.find(aem.getCommandType().getValue());
-	if (it != s_Dispatch.end())
+	auto const handler = s_Dispatch.find(aem.getCommandType().getValue());
+	if (handler != nullptr)
 	{
 		try
 		{
-			return it->second(pi, *this, aem);
+			return handler(pi, *this, aem);
 		}
 		catch (NoSuchDescriptorException const&)
 		{
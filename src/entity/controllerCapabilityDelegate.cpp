@@ -29,6 +29,7 @@
 #include "la/avdecc/utils.hpp"
 
 #include "controllerCapabilityDelegate.hpp"
+#include "dispatchTable.hpp"
 #include "protocol/protocolAemPayloads.hpp"
 #include "protocol/protocolMvuPayloads.hpp"
 
@@ -1743,7 +1744,8 @@ void CapabilityDelegate::getMemoryObjectLength(UniqueIdentifier const targetEnti
 
 void CapabilityDelegate::getDynamicInfo(UniqueIdentifier const targetEntityID, DynamicInfoParameters const& parameters, Interface::GetDynamicInfoHandler const& handler) const noexcept
 {
-	static auto s_DynamicInfoDispatch = std::unordered_map<protocol::AemCommandType::value_type, std::function<void(UniqueIdentifier const targetEntityID, DynamicInfoParameter const& parameters, protocol::aemPayload::DynamicInfos& dynamicInfos)>>{
+	using DynamicInfoSerializer = void (*)(UniqueIdentifier const targetEntityID, DynamicInfoParameter const& parameters, protocol::aemPayload::DynamicInfos& dynamicInfos);
+	static auto const s_DynamicInfoDispatch = utils::DispatchTable<protocol::AemCommandType::value_type, DynamicInfoSerializer, 0x80>{
 		// Get Configuration
 		{ protocol::AemCommandType::GetConfiguration.getValue(),
 			[]([[maybe_unused]] UniqueIdentifier const targetEntityID, DynamicInfoParameter const& parameters, protocol::aemPayload::DynamicInfos& dynamicInfos)
@@ -1986,14 +1988,14 @@ void CapabilityDelegate::getDynamicInfo(UniqueIdentifier const targetEntityID, D
 		auto dynamicInfos = la::avdecc::protocol::aemPayload::DynamicInfos{};
 		for (auto const& dynInfo : parameters)
 		{
-			auto const& it = s_DynamicInfoDispatch.find(dynInfo.commandType.getValue());
-			if (it == s_DynamicInfoDispatch.end())
+			auto const serializer = s_DynamicInfoDispatch.find(dynInfo.commandType.getValue());
+			if (serializer == nullptr)
 			{
 				LOG_CONTROLLER_ENTITY_DEBUG(targetEntityID, "Failed to serialize getDynamicInfo: Unhandled command type {} ({})", std::string(dynInfo.commandType), utils::toHexString(dynInfo.commandType.getValue()));
 				utils::invokeProtectedHandler(errorCallback, LocalEntity::AemCommandStatus::ProtocolError);
 				return;
 			}
-			it->second(targetEntityID, dynInfo, dynamicInfos);
+			serializer(targetEntityID, dynInfo, dynamicInfos);
 #pragma message("TODO: Somehow, check for maximum payload size (both send AND recv")
 		}
 		auto const ser = protocol::aemPayload::serializeGetDynamicInfoCommand(dynamicInfos);
@@ -2509,7 +2511,8 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 		return;
 	}
 
-	static std::unordered_map<protocol::AemCommandType::value_type, std::function<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::AemCommandStatus const status, protocol::AemAecpdu const& aem, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback)>> s_Dispatch
+	using Handler = void (*)(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::AemCommandStatus const status, protocol::AemAecpdu const& aem, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback);
+	static auto const s_Dispatch = utils::DispatchTable<protocol::AemCommandType::value_type, Handler, 0x80>
 	{
 		// Acquire Entity
 		{ protocol::AemCommandType::AcquireEntity.getValue(), [](controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::AemCommandStatus const status, protocol::AemAecpdu const& aem, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback)
@@ -4015,7 +4018,8 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 				// Unpack responses if SUCCESS
 				if (status == LocalEntity::AemCommandStatus::Success)
 				{
-					static auto s_DynamicInfoDispatch = std::unordered_map<protocol::AemCommandType::value_type, std::function<DynamicInfoParameter::Parameters(UniqueIdentifier const targetID, entity::LocalEntity::AemCommandStatus const status, protocol::AemAecpdu::Payload const payload)>>{
+					using DynamicInfoDeserializer = DynamicInfoParameter::Parameters (*)(UniqueIdentifier const targetID, entity::LocalEntity::AemCommandStatus const status, protocol::AemAecpdu::Payload const payload);
+					static auto const s_DynamicInfoDispatch = utils::DispatchTable<protocol::AemCommandType::value_type, DynamicInfoDeserializer, 0x80>{
 						// Get Configuration
 						{ protocol::AemCommandType::GetConfiguration.getValue(),
 							[](UniqueIdentifier const /*targetID*/, entity::LocalEntity::AemCommandStatus const status, protocol::AemAecpdu::Payload const payload)
@@ -4434,14 +4438,14 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 
 					for (auto const& [dynamicInfoStatus, commandType, buffer] : dynamicInfos)
 					{
-						auto const& it = s_DynamicInfoDispatch.find(commandType.getValue());
-						if (it == s_DynamicInfoDispatch.end())
+						auto const deserializer = s_DynamicInfoDispatch.find(commandType.getValue());
+						if (deserializer == nullptr)
 						{
 							LOG_CONTROLLER_ENTITY_DEBUG(targetID, "Failed to deserialize getDynamicInfo: Unhandled command type {} ({})", std::string(commandType), utils::toHexString(commandType.getValue()));
 							throw std::invalid_argument("Failed to deserialize getDynamicInfo: Unhandled command type");
 						}
 						auto const st = entity::LocalEntity::AemCommandStatus{ dynamicInfoStatus.getValue() };
-						auto arguments = it->second(targetID, st, protocol::AemAecpdu::Payload{ buffer.data(), buffer.size() });
+						auto arguments = deserializer(targetID, st, protocol::AemAecpdu::Payload{ buffer.data(), buffer.size() });
 						parameters.emplace_back(DynamicInfoParameter{ st, commandType, std::move(arguments) });
 					}
 				}
@@ -4480,8 +4484,8 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 		},
 	};
 
-	auto const& it = s_Dispatch.find(responseCommandType.getValue());
-	if (it == s_Dispatch.end())
+	auto const handler = s_Dispatch.find(responseCommandType.getValue());
+	if (handler == nullptr)
 	{
 		// If this is an unsolicited notification, simply log we do not handle the message
 		if (aem.getUnsolicited())
@@ -4515,9 +4519,16 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 			utils::invokeProtectedHandler(onErrorCallback, st);
 		};
 
+		// Validate the payload size up front, so malformed responses (the most common ones) are rejected without throwing
+		if (!protocol::aemPayload::isValidResponsePayloadSize(responseCommandType, status, aem.getPayload()))
+		{
+			checkProcessInvalidNonSuccessResponse("Incorrect payload size");
+			return;
+		}
+
 		try
 		{
-			it->second(_controllerDelegate, &_controllerInterface, status, aem, answerCallback, protocolViolationCallback);
+			handler(_controllerDelegate, &_controllerInterface, status, aem, answerCallback, protocolViolationCallback);
 		}
 		catch (protocol::aemPayload::IncorrectPayloadSizeException const& e)
 		{
@@ -4570,7 +4581,8 @@ void CapabilityDelegate::processMvuAecpResponse(protocol::MvuCommandType const c
 		return;
 	}
 
-	static std::unordered_map<protocol::MvuCommandType::value_type, std::function<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::MvuCommandStatus const status, protocol::MvuAecpdu const& mvu, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback)>> s_Dispatch{
+	using Handler = void (*)(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::MvuCommandStatus const status, protocol::MvuAecpdu const& mvu, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback);
+	static auto const s_Dispatch = utils::DispatchTable<protocol::MvuCommandType::value_type, Handler, 0x10>{
 		// Get Milan Info
 		{ protocol::MvuCommandType::GetMilanInfo.getValue(),
 			[](controller::Delegate* const /*delegate*/, Interface const* const controllerInterface, LocalEntity::MvuCommandStatus const status, protocol::MvuAecpdu const& mvu, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback)
@@ -4589,8 +4601,8 @@ void CapabilityDelegate::processMvuAecpResponse(protocol::MvuCommandType const c
 			} },
 	};
 
-	auto const& it = s_Dispatch.find(responseCommandType.getValue());
-	if (it == s_Dispatch.end())
+	auto const handler = s_Dispatch.find(responseCommandType.getValue());
+	if (handler == nullptr)
 	{
 		// It's an expected response, this is an internal error since we sent a command and didn't implement the code to handle the response
 		LOG_CONTROLLER_ENTITY_ERROR(mvu.getTargetEntityID(), "Failed to process MVU response: Unhandled command type {} ({})", std::string(responseCommandType), utils::toHexString(responseCommandType.getValue()));
@@ -4600,7 +4612,7 @@ void CapabilityDelegate::processMvuAecpResponse(protocol::MvuCommandType const c
 	{
 		try
 		{
-			it->second(_controllerDelegate, &_controllerInterface, status, mvu, answerCallback, protocolViolationCallback);
+			handler(_controllerDelegate, &_controllerInterface, status, mvu, answerCallback, protocolViolationCallback);
 		}
 		catch ([[maybe_unused]] protocol::mvuPayload::IncorrectPayloadSizeException const& e)
 		{
@@ -4629,7 +4641,8 @@ void CapabilityDelegate::processAcmpResponse(protocol::Acmpdu const* const respo
 	auto const status = static_cast<LocalEntity::ControlStatus>(acmp.getStatus().getValue()); // We have to convert protocol status to our extended status
 	auto const protocolViolationCallback = std::bind(onErrorCallback, LocalEntity::ControlStatus::BaseProtocolViolation);
 
-	static std::unordered_map<protocol::AcmpMessageType::value_type, std::function<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::ControlStatus const status, protocol::Acmpdu const& acmp, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback, bool const sniffed)>> s_Dispatch{
+	using Handler = void (*)(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::ControlStatus const status, protocol::Acmpdu const& acmp, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback, bool const sniffed);
+	static auto const s_Dispatch = utils::DispatchTable<protocol::AcmpMessageType::value_type, Handler, 0x10>{
 		// Connect TX response
 		{ protocol::AcmpMessageType::ConnectTxResponse.getValue(),
 			[](controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::ControlStatus const status, protocol::Acmpdu const& acmp, LocalEntityImpl<>::AnswerCallback const& /*answerCallback*/, LocalEntityImpl<>::AnswerCallback::Callback const& /*protocolViolationCallback*/, bool const sniffed)
@@ -4739,8 +4752,8 @@ void CapabilityDelegate::processAcmpResponse(protocol::Acmpdu const* const respo
 			} },
 	};
 
-	auto const& it = s_Dispatch.find(acmp.getMessageType().getValue());
-	if (it == s_Dispatch.end())
+	auto const handler = s_Dispatch.find(acmp.getMessageType().getValue());
+	if (handler == nullptr)
 	{
 		// If this is a sniffed message, simply log we do not handle the message
 		if (sniffed)
@@ -4758,7 +4771,7 @@ void CapabilityDelegate::processAcmpResponse(protocol::Acmpdu const* const respo
 	{
 		try
 		{
-			it->second(_controllerDelegate, &_controllerInterface, status, acmp, answerCallback, protocolViolationCallback, sniffed);
+			handler(_controllerDelegate, &_controllerInterface, status, acmp, answerCallback, protocolViolationCallback, sniffed);
 		}
 		catch ([[maybe_unused]] std::exception const& e) // Mainly unpacking errors
 		{
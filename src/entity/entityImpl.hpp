@@ -32,6 +32,7 @@
 #include "la/avdecc/internals/protocolMvuAecpdu.hpp"
 
 #include "logHelper.hpp"
+#include "dispatchTable.hpp"
 
 #include <cstdint>
 #include <algorithm>
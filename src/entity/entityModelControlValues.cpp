@@ -25,6 +25,7 @@
 #include "la/avdecc/internals/serialization.hpp"
 
 #include "logHelper.hpp"
+#include "dispatchTable.hpp"
 #include "protocol/protocolAemControlValuesPayloads.hpp"
 
 namespace la
@@ -35,65 +36,68 @@ namespace entity
 {
 namespace model
 {
-static inline void createUnpackDynamicControlValuesDispatchTable(std::unordered_map<ControlValueType::Type, std::function<ControlValues(Deserializer&, std::uint16_t)>>& dispatchTable)
+/** Control values are dispatched on their ControlValueType::Type, all handled types being lower than ControlBodePlot */
+static constexpr auto ControlValuesDispatchTableSize = static_cast<std::size_t>(ControlValueType::Type::ControlBodePlot);
+
+using UnpackDynamicControlValuesHandler = ControlValues (*)(Deserializer&, std::uint16_t);
+using ValidateControlValuesHandler = std::tuple<ControlValuesValidationResult, std::string> (*)(ControlValues const&, ControlValues const&);
+
+template<ControlValueType::Type Type, typename Handler>
+static constexpr std::pair<ControlValueType::value_type, Handler> makeEntry(Handler const handler) noexcept
 {
-	/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
-	dispatchTable[ControlValueType::Type::ControlLinearInt8] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt8>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearUInt8] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt8>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearInt16] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt16>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearUInt16] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt16>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearInt32] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt32>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearUInt32] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt32>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearInt64] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt64>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearUInt64] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt64>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearFloat] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearFloat>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlLinearDouble] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearDouble>::unpackDynamicControlValues;
-
-	/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
-	dispatchTable[ControlValueType::Type::ControlSelectorInt8] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt8>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorUInt8] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt8>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorInt16] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt16>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorUInt16] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt16>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorInt32] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt32>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorUInt32] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt32>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorInt64] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt64>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorUInt64] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt64>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorFloat] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorFloat>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorDouble] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorDouble>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlSelectorString] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorString>::unpackDynamicControlValues;
-
-	/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
-	dispatchTable[ControlValueType::Type::ControlArrayInt8] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt8>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayUInt8] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt8>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayInt16] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt16>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayUInt16] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt16>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayInt32] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt32>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayUInt32] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt32>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayInt64] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt64>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayUInt64] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt64>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayFloat] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayFloat>::unpackDynamicControlValues;
-	dispatchTable[ControlValueType::Type::ControlArrayDouble] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayDouble>::unpackDynamicControlValues;
-
-	/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
-	dispatchTable[ControlValueType::Type::ControlUtf8] = protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlUtf8>::unpackDynamicControlValues;
+	return { static_cast<ControlValueType::value_type>(Type), handler };
 }
 
 std::optional<ControlValues> LA_AVDECC_CALL_CONVENTION unpackDynamicControlValues(MemoryBuffer const& packedControlValues, ControlValueType::Type const valueType, std::uint16_t const numberOfValues) noexcept
 {
-	static auto s_Dispatch = std::unordered_map<ControlValueType::Type, std::function<ControlValues(Deserializer&, std::uint16_t)>>{};
-
-	if (s_Dispatch.empty())
-	{
-		// Create the dispatch table
-		createUnpackDynamicControlValuesDispatchTable(s_Dispatch);
-	}
+	static auto const s_Dispatch = utils::DispatchTable<ControlValueType::value_type, UnpackDynamicControlValuesHandler, ControlValuesDispatchTableSize>{
+		/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
+		makeEntry<ControlValueType::Type::ControlLinearInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt8>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearUInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt8>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt16>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearUInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt16>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt32>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearUInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt32>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt64>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearUInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt64>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearFloat>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearFloat>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearDouble>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearDouble>::unpackDynamicControlValues),
+
+		/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
+		makeEntry<ControlValueType::Type::ControlSelectorInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt8>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorUInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt8>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt16>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorUInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt16>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt32>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorUInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt32>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt64>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorUInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt64>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorFloat>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorFloat>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorDouble>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorDouble>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorString>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorString>::unpackDynamicControlValues),
+
+		/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
+		makeEntry<ControlValueType::Type::ControlArrayInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt8>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayUInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt8>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt16>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayUInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt16>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt32>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayUInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt32>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt64>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayUInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt64>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayFloat>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayFloat>::unpackDynamicControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayDouble>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayDouble>::unpackDynamicControlValues),
+
+		/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
+		makeEntry<ControlValueType::Type::ControlUtf8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlUtf8>::unpackDynamicControlValues),
+	};
 
 	try
 	{
-		if (auto const& it = s_Dispatch.find(valueType); it != s_Dispatch.end())
+		if (auto const handler = s_Dispatch.find(static_cast<ControlValueType::value_type>(valueType)); handler != nullptr)
 		{
 			auto des = Deserializer{ packedControlValues };
-			return it->second(des, numberOfValues);
+			return handler(des, numberOfValues);
 		}
 		else
 		{
@@ -109,58 +113,49 @@ std::optional<ControlValues> LA_AVDECC_CALL_CONVENTION unpackDynamicControlValue
 	return {};
 }
 
-static inline void createValidateControlValuesDispatchTable(std::unordered_map<entity::model::ControlValueType::Type, std::function<std::tuple<ControlValuesValidationResult, std::string>(entity::model::ControlValues const&, entity::model::ControlValues const&)>>& dispatchTable)
-{
-	/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt8] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt8>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt8] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt8>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt16] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt16>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt16] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt16>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt32] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt32>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt32] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt32>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt64] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt64>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt64] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt64>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearFloat] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearFloat>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearDouble] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearDouble>::validateControlValues;
-
-	/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt8] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt8>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt8] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt8>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt16] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt16>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt16] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt16>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt32] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt32>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt32] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt32>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt64] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt64>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt64] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt64>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorFloat] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorFloat>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorDouble] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorDouble>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorString] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorString>::validateControlValues;
-
-	/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt8] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt8>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt8] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt8>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt16] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt16>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt16] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt16>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt32] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt32>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt32] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt32>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt64] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt64>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt64] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt64>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayFloat] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayFloat>::validateControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayDouble] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayDouble>::validateControlValues;
-
-	/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlUtf8] = protocol::aemPayload::control_values_payload_traits<entity::model::ControlValueType::Type::ControlUtf8>::validateControlValues;
-}
-
 std::tuple<ControlValuesValidationResult, std::string> LA_AVDECC_CALL_CONVENTION validateControlValues(ControlValues const& staticValues, ControlValues const& dynamicValues) noexcept
 {
-	static auto s_Dispatch = std::unordered_map<entity::model::ControlValueType::Type, std::function<std::tuple<ControlValuesValidationResult, std::string>(entity::model::ControlValues const&, entity::model::ControlValues const&)>>{};
-
-	if (s_Dispatch.empty())
-	{
-		// Create the dispatch table
-		createValidateControlValuesDispatchTable(s_Dispatch);
-	}
+	static auto const s_Dispatch = utils::DispatchTable<ControlValueType::value_type, ValidateControlValuesHandler, ControlValuesDispatchTableSize>{
+		/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
+		makeEntry<ControlValueType::Type::ControlLinearInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt8>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearUInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt8>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt16>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearUInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt16>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt32>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearUInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt32>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearInt64>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearUInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearUInt64>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearFloat>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearFloat>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlLinearDouble>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlLinearDouble>::validateControlValues),
+
+		/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
+		makeEntry<ControlValueType::Type::ControlSelectorInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt8>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorUInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt8>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt16>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorUInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt16>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt32>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorUInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt32>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorInt64>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorUInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorUInt64>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorFloat>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorFloat>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorDouble>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorDouble>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlSelectorString>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlSelectorString>::validateControlValues),
+
+		/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
+		makeEntry<ControlValueType::Type::ControlArrayInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt8>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayUInt8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt8>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt16>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayUInt16>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt16>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt32>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayUInt32>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt32>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayInt64>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayUInt64>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayUInt64>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayFloat>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayFloat>::validateControlValues),
+		makeEntry<ControlValueType::Type::ControlArrayDouble>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlArrayDouble>::validateControlValues),
+
+		/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
+		makeEntry<ControlValueType::Type::ControlUtf8>(&protocol::aemPayload::control_values_payload_traits<ControlValueType::Type::ControlUtf8>::validateControlValues),
+	};
 
 	if (!staticValues)
 	{
@@ -198,10 +193,10 @@ std::tuple<ControlValuesValidationResult, std::string> LA_AVDECC_CALL_CONVENTION
 		return std::make_tuple(ControlValuesValidationResult::StaticDynamicCountMismatch, "Values count does not match (" + std::to_string(staticValues.size()) + " static values, " + std::to_string(dynamicValues.size()) + " dynamic ones)");
 	}
 
-	auto const& it = s_Dispatch.find(valueType);
-	if (AVDECC_ASSERT_WITH_RET(it != s_Dispatch.end(), "validateControlValues not handled for this values type"))
+	auto const handler = s_Dispatch.find(static_cast<ControlValueType::value_type>(valueType));
+	if (AVDECC_ASSERT_WITH_RET(handler != nullptr, "validateControlValues not handled for this values type"))
 	{
-		return it->second(staticValues, dynamicValues);
+		return handler(staticValues, dynamicValues);
 	}
 
 	// In case we don't handle this kind of ControlType, just validate the values
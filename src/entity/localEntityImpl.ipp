@@ -153,7 +153,8 @@ void LocalEntityImpl<SuperClass>::onAecpCommand(protocol::ProtocolInterface* con
 	{
 		auto const& aem = static_cast<protocol::AemAecpdu const&>(aecpdu);
 
-		static std::unordered_map<protocol::AemCommandType::value_type, std::function<void(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem)>> s_Dispatch{
+		using Handler = void (*)(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem);
+		static auto const s_Dispatch = utils::DispatchTable<protocol::AemCommandType::value_type, Handler, 0x80>{
 			// Entity Available
 			{ protocol::AemCommandType::EntityAvailable.getValue(),
 				[](protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem)
@@ -163,10 +164,10 @@ void LocalEntityImpl<SuperClass>::onAecpCommand(protocol::ProtocolInterface* con
 				} },
 		};
 
-		auto const& it = s_Dispatch.find(aem.getCommandType().getValue());
-		if (it != s_Dispatch.end())
+		auto const handler = s_Dispatch.find(aem.getCommandType().getValue());
+		if (handler != nullptr)
 		{
-			invokeProtectedHandler(it->second, pi, aem);
+			invokeProtectedHandler(handler, pi, aem);
 			return;
 		}
 	}
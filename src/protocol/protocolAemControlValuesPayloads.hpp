@@ -122,7 +122,7 @@ struct LinearValuesPayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dyna
 
 	static void packDynamicControlValues(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ControlValues const& values)
 	{
-		auto const linearValues = values.getValues<DynamicValueType>(); // We have to store the copy or it will go out of scope if using it directly in the range-based loop
+		auto const& linearValues = values.getValues<DynamicValueType>();
 		for (auto const& val : linearValues.getValues())
 		{
 			ser << val.currentValue;
@@ -137,8 +137,8 @@ struct LinearValuesPayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dyna
 
 			auto pos = decltype(std::declval<decltype(staticValues)>().size()){ 0u };
 
-			auto const staticLinearValues = staticValues.getValues<StaticValueType>(); // We have to store the copy or it will go out of scope if using it directly in the range-based loop
-			auto const dynamicLinearValues = dynamicValues.getValues<DynamicValueType>(); // We have to store the copy or it will go out of scope
+			auto const& staticLinearValues = staticValues.getValues<StaticValueType>();
+			auto const& dynamicLinearValues = dynamicValues.getValues<DynamicValueType>();
 
 			for (auto const& staticValue : staticLinearValues.getValues())
 			{
@@ -392,7 +392,7 @@ struct ArrayValuesPayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dynam
 
 	static void packDynamicControlValues(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ControlValues const& values)
 	{
-		auto const arrayValues = values.getValues<DynamicValueType>(); // We have to store the copy or it will go out of scope if using it directly in the range-based loop
+		auto const& arrayValues = values.getValues<DynamicValueType>();
 		for (auto const& val : arrayValues.currentValues)
 		{
 			ser << val;
@@ -408,7 +408,7 @@ struct ArrayValuesPayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dynam
 			auto pos = decltype(std::declval<decltype(staticValues)>().size()){ 0u };
 
 			auto const& staticArrayValue = staticValues.getValues<StaticValueType>();
-			auto const dynamicArrayValues = dynamicValues.getValues<DynamicValueType>(); // We have to store the copy or it will go out of scope
+			auto const& dynamicArrayValues = dynamicValues.getValues<DynamicValueType>();
 
 			for (auto const& dynamicValue : dynamicArrayValues.currentValues)
 			{
@@ -562,8 +562,8 @@ struct control_values_payload_traits<entity::model::ControlValueType::Type::Cont
 		try
 		{
 			// Check for trailing NULL character
-			auto utf8Values = dynamicValues.getValues<entity::model::UTF8StringValueDynamic>();
-			auto constexpr nullCharacter = decltype(utf8Values)::value_type{ 0u };
+			auto const& utf8Values = dynamicValues.getValues<entity::model::UTF8StringValueDynamic>();
+			auto constexpr nullCharacter = entity::model::UTF8StringValueDynamic::value_type{ 0u };
 
 			auto foundNullChar = false;
 			for (auto const c : utf8Values.currentValue)
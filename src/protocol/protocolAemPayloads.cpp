@@ -27,6 +27,7 @@
 #include "protocolAemControlValuesPayloads.hpp"
 #include "protocolAemPayloads.hpp"
 #include "logHelper.hpp"
+#include "dispatchTable.hpp"
 
 namespace la
 {
@@ -39,7 +40,7 @@ namespace aemPayload
 /** Offset to be added/removed from Deserialization/Serialization buffer when computing 'offset' fields in various payload (required because the spec starts counting offset at 'descriptor_type' field, whilst our buffers start at 'configuration_index') */
 static constexpr auto PayloadBufferOffset = sizeof(entity::model::ConfigurationIndex) + sizeof(std::uint16_t);
 
-static inline void checkResponsePayload(AemAecpdu::Payload const& payload, entity::LocalEntity::AemCommandStatus const status, size_t const expectedPayloadCommandLength, size_t const expectedPayloadResponseLength)
+static inline bool isValidResponsePayload(AemAecpdu::Payload const& payload, entity::LocalEntity::AemCommandStatus const status, size_t const expectedPayloadCommandLength, size_t const expectedPayloadResponseLength) noexcept
 {
 	auto* const commandPayload = payload.first;
 	auto const commandPayloadLength = payload.second;
@@ -47,18 +48,18 @@ static inline void checkResponsePayload(AemAecpdu::Payload const& payload, entit
 	// If status is NotImplemented, we expect a reflected message (using Command length)
 	if (status == entity::LocalEntity::AemCommandStatus::NotImplemented)
 	{
-		if (commandPayloadLength != expectedPayloadCommandLength || (expectedPayloadCommandLength > 0 && commandPayload == nullptr)) // Malformed packet
-		{
-			throw IncorrectPayloadSizeException();
-		}
+		return commandPayloadLength == expectedPayloadCommandLength && (expectedPayloadCommandLength == 0 || commandPayload != nullptr);
 	}
-	else
+
+	// Otherwise we expect a valid response with all fields
+	return commandPayloadLength >= expectedPayloadResponseLength && (expectedPayloadResponseLength == 0 || commandPayload != nullptr);
+}
+
+static inline void checkResponsePayload(AemAecpdu::Payload const& payload, entity::LocalEntity::AemCommandStatus const status, size_t const expectedPayloadCommandLength, size_t const expectedPayloadResponseLength)
+{
+	if (!isValidResponsePayload(payload, status, expectedPayloadCommandLength, expectedPayloadResponseLength)) // Malformed packet
 	{
-		// Otherwise we expect a valid response with all fields
-		if (commandPayloadLength < expectedPayloadResponseLength || (expectedPayloadResponseLength > 0 && commandPayload == nullptr)) // Malformed packet
-		{
-			throw IncorrectPayloadSizeException();
-		}
+		throw IncorrectPayloadSizeException();
 	}
 }
 
@@ -912,58 +913,61 @@ entity::model::AudioMapDescriptor deserializeReadAudioMapDescriptorResponse(AemA
 	return audioMapDescriptor;
 }
 
-static inline void createUnpackFullControlValuesDispatchTable(std::unordered_map<entity::model::ControlValueType::Type, std::function<std::tuple<entity::model::ControlValues, entity::model::ControlValues>(Deserializer&, std::uint16_t)>>& dispatchTable)
-{
-	/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt8>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt8>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt16>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt16>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt32>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt32>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt64>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt64>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearFloat>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearDouble>::unpackFullControlValues;
-
-	/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt8>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt8>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt16>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt16>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt32>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt32>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt64>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt64>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorFloat>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorDouble>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorString] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorString>::unpackFullControlValues;
-
-	/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt8>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt8>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt16>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt16>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt32>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt32>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt64>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt64>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayFloat>::unpackFullControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayDouble>::unpackFullControlValues;
-
-	/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlUtf8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlUtf8>::unpackFullControlValues;
+/** Control values are dispatched on their ControlValueType::Type, all handled types being lower than ControlBodePlot */
+static constexpr auto ControlValuesDispatchTableSize = static_cast<std::size_t>(entity::model::ControlValueType::Type::ControlBodePlot);
+
+using UnpackFullControlValuesHandler = std::tuple<entity::model::ControlValues, entity::model::ControlValues> (*)(Deserializer&, std::uint16_t);
+using PackDynamicControlValuesHandler = void (*)(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>&, entity::model::ControlValues const&);
+
+template<entity::model::ControlValueType::Type Type, typename Handler>
+static constexpr std::pair<entity::model::ControlValueType::value_type, Handler> makeControlValuesEntry(Handler const handler) noexcept
+{
+	return { static_cast<entity::model::ControlValueType::value_type>(Type), handler };
 }
 
 entity::model::ControlDescriptor deserializeReadControlDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
-	static auto s_Dispatch = std::unordered_map<entity::model::ControlValueType::Type, std::function<std::tuple<entity::model::ControlValues, entity::model::ControlValues>(Deserializer&, std::uint16_t)>>{};
-
-	if (s_Dispatch.empty())
-	{
-		// Create the dispatch table
-		createUnpackFullControlValuesDispatchTable(s_Dispatch);
-	}
+	static auto const s_Dispatch = utils::DispatchTable<entity::model::ControlValueType::value_type, UnpackFullControlValuesHandler, ControlValuesDispatchTableSize>{
+		/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt8>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearUInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt8>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt16>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearUInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt16>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt32>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearUInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt32>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt64>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearUInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt64>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearFloat>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearFloat>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearDouble>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearDouble>::unpackFullControlValues),
+
+		/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt8>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorUInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt8>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt16>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorUInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt16>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt32>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorUInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt32>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt64>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorUInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt64>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorFloat>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorFloat>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorDouble>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorDouble>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorString>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorString>::unpackFullControlValues),
+
+		/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt8>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayUInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt8>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt16>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayUInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt16>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt32>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayUInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt32>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt64>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayUInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt64>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayFloat>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayFloat>::unpackFullControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayDouble>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayDouble>::unpackFullControlValues),
+
+		/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlUtf8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlUtf8>::unpackFullControlValues),
+	};
 
 	auto controlDescriptor = entity::model::ControlDescriptor{};
 
@@ -999,11 +1003,11 @@ entity::model::ControlDescriptor deserializeReadControlDescriptorResponse(AemAec
 
 		// Unpack Control Values based on ControlValueType
 		auto const valueType = controlDescriptor.controlValueType.getType();
-		if (auto const& it = s_Dispatch.find(valueType); it != s_Dispatch.end())
+		if (auto const unpacker = s_Dispatch.find(static_cast<entity::model::ControlValueType::value_type>(valueType)); unpacker != nullptr)
 		{
 			try
 			{
-				auto [valuesStatic, valuesDynamic] = it->second(des, controlDescriptor.numberOfValues);
+				auto [valuesStatic, valuesDynamic] = unpacker(des, controlDescriptor.numberOfValues);
 				controlDescriptor.valuesStatic = std::move(valuesStatic);
 				controlDescriptor.valuesDynamic = std::move(valuesDynamic);
 			}
@@ -1971,58 +1975,49 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** SET_CONTROL Command - IEEE1722.1-2013 Clause 7.4.25.1 */
-static inline void createPackDynamicControlValuesDispatchTable(std::unordered_map<entity::model::ControlValueType::Type, std::function<void(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>&, entity::model::ControlValues const&)>>& dispatchTable)
-{
-	/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt8>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt8>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt16>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt16>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt32>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt32>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt64>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt64>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearFloat>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlLinearDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearDouble>::packDynamicControlValues;
-
-	/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt8>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt8>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt16>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt16>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt32>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt32>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt64>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt64>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorFloat>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorDouble>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorString] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorString>::packDynamicControlValues;
-
-	/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt8>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt8>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt16>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt16>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt32>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt32>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt64>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt64>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayFloat>::packDynamicControlValues;
-	dispatchTable[entity::model::ControlValueType::Type::ControlArrayDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayDouble>::packDynamicControlValues;
-
-	/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
-	dispatchTable[entity::model::ControlValueType::Type::ControlUtf8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlUtf8>::packDynamicControlValues;
-}
-
 Serializer<AemAecpdu::MaximumSendPayloadBufferLength> serializeSetControlCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::ControlValues const& controlValues)
 {
-	static auto s_Dispatch = std::unordered_map<entity::model::ControlValueType::Type, std::function<void(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>&, entity::model::ControlValues const&)>>{};
-
-	if (s_Dispatch.empty())
-	{
-		// Create the dispatch table
-		createPackDynamicControlValuesDispatchTable(s_Dispatch);
-	}
+	static auto const s_Dispatch = utils::DispatchTable<entity::model::ControlValueType::value_type, PackDynamicControlValuesHandler, ControlValuesDispatchTableSize>{
+		/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt8>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearUInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt8>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt16>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearUInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt16>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt32>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearUInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt32>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt64>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearUInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt64>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearFloat>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearFloat>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlLinearDouble>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearDouble>::packDynamicControlValues),
+
+		/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt8>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorUInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt8>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt16>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorUInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt16>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt32>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorUInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt32>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt64>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorUInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt64>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorFloat>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorFloat>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorDouble>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorDouble>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlSelectorString>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorString>::packDynamicControlValues),
+
+		/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt8>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayUInt8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt8>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt16>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayUInt16>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt16>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt32>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayUInt32>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt32>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt64>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayUInt64>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt64>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayFloat>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayFloat>::packDynamicControlValues),
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlArrayDouble>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayDouble>::packDynamicControlValues),
+
+		/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
+		makeControlValuesEntry<entity::model::ControlValueType::Type::ControlUtf8>(&control_values_payload_traits<entity::model::ControlValueType::Type::ControlUtf8>::packDynamicControlValues),
+	};
 
 	Serializer<AemAecpdu::MaximumSendPayloadBufferLength> ser;
 	ser << descriptorType << descriptorIndex;
@@ -2031,9 +2026,9 @@ Serializer<AemAecpdu::MaximumSendPayloadBufferLength> serializeSetControlCommand
 	if (!controlValues.empty())
 	{
 		auto const valueType = controlValues.getType();
-		if (auto const& it = s_Dispatch.find(valueType); it != s_Dispatch.end())
+		if (auto const packer = s_Dispatch.find(static_cast<entity::model::ControlValueType::value_type>(valueType)); packer != nullptr)
 		{
-			it->second(ser, controlValues);
+			packer(ser, controlValues);
 		}
 		else
 		{
@@ -3201,6 +3196,70 @@ std::tuple<entity::model::DescriptorType, entity::model::StreamIndex, std::uint6
 	return deserializeSetMaxTransitTimeCommand(payload);
 }
 
+template<size_t ExpectedPayloadCommandLength, size_t ExpectedPayloadResponseLength>
+static bool validateResponsePayloadSize(entity::LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload) noexcept
+{
+	return isValidResponsePayload(payload, status, ExpectedPayloadCommandLength, ExpectedPayloadResponseLength);
+}
+
+/** Non-throwing payload size validation */
+bool isValidResponsePayloadSize(AemCommandType const commandType, entity::LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload) noexcept
+{
+	// Expected sizes (Command, Response), same as the ones checked by the deserialize*Response methods
+	using Validator = bool (*)(entity::LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload);
+	static auto const s_Validators = utils::DispatchTable<AemCommandType::value_type, Validator, 0x80>{
+		{ AemCommandType::AcquireEntity.getValue(), &validateResponsePayloadSize<AecpAemAcquireEntityCommandPayloadSize, AecpAemAcquireEntityResponsePayloadSize> },
+		{ AemCommandType::LockEntity.getValue(), &validateResponsePayloadSize<AecpAemLockEntityCommandPayloadSize, AecpAemLockEntityResponsePayloadSize> },
+		{ AemCommandType::ReadDescriptor.getValue(), &validateResponsePayloadSize<AecpAemReadDescriptorCommandPayloadSize, AecpAemReadCommonDescriptorResponsePayloadSize> },
+		{ AemCommandType::SetConfiguration.getValue(), &validateResponsePayloadSize<AecpAemSetConfigurationCommandPayloadSize, AecpAemSetConfigurationResponsePayloadSize> },
+		{ AemCommandType::GetConfiguration.getValue(), &validateResponsePayloadSize<AecpAemSetConfigurationCommandPayloadSize, AecpAemGetConfigurationResponsePayloadSize> },
+		{ AemCommandType::SetStreamFormat.getValue(), &validateResponsePayloadSize<AecpAemSetStreamFormatCommandPayloadSize, AecpAemSetStreamFormatResponsePayloadSize> },
+		{ AemCommandType::GetStreamFormat.getValue(), &validateResponsePayloadSize<AecpAemSetStreamFormatCommandPayloadSize, AecpAemGetStreamFormatResponsePayloadSize> },
+		{ AemCommandType::SetStreamInfo.getValue(), &validateResponsePayloadSize<AecpAemSetStreamInfoCommandPayloadSize, AecpAemSetStreamInfoResponsePayloadSize> },
+		{ AemCommandType::GetStreamInfo.getValue(), &validateResponsePayloadSize<AecpAemGetStreamInfoCommandPayloadSize, AecpAemGetStreamInfoResponsePayloadSize> },
+		{ AemCommandType::SetName.getValue(), &validateResponsePayloadSize<AecpAemSetNameCommandPayloadSize, AecpAemSetNameResponsePayloadSize> },
+		{ AemCommandType::GetName.getValue(), &validateResponsePayloadSize<AecpAemSetNameCommandPayloadSize, AecpAemGetNameResponsePayloadSize> },
+		{ AemCommandType::SetAssociationID.getValue(), &validateResponsePayloadSize<AecpAemSetAssociationIDCommandPayloadSize, AecpAemSetAssociationIDResponsePayloadSize> },
+		{ AemCommandType::GetAssociationID.getValue(), &validateResponsePayloadSize<AecpAemSetAssociationIDCommandPayloadSize, AecpAemGetAssociationIDResponsePayloadSize> },
+		{ AemCommandType::SetSamplingRate.getValue(), &validateResponsePayloadSize<AecpAemSetSamplingRateCommandPayloadSize, AecpAemSetSamplingRateResponsePayloadSize> },
+		{ AemCommandType::GetSamplingRate.getValue(), &validateResponsePayloadSize<AecpAemSetSamplingRateCommandPayloadSize, AecpAemGetSamplingRateResponsePayloadSize> },
+		{ AemCommandType::SetClockSource.getValue(), &validateResponsePayloadSize<AecpAemSetClockSourceCommandPayloadSize, AecpAemSetClockSourceResponsePayloadSize> },
+		{ AemCommandType::GetClockSource.getValue(), &validateResponsePayloadSize<AecpAemSetClockSourceCommandPayloadSize, AecpAemGetClockSourceResponsePayloadSize> },
+		{ AemCommandType::SetControl.getValue(), &validateResponsePayloadSize<AecpAemSetControlCommandPayloadMinSize, AecpAemSetControlResponsePayloadMinSize> },
+		{ AemCommandType::GetControl.getValue(), &validateResponsePayloadSize<AecpAemSetControlCommandPayloadMinSize, AecpAemGetControlResponsePayloadMinSize> },
+		{ AemCommandType::StartStreaming.getValue(), &validateResponsePayloadSize<AecpAemStartStreamingCommandPayloadSize, AecpAemStartStreamingResponsePayloadSize> },
+		{ AemCommandType::StopStreaming.getValue(), &validateResponsePayloadSize<AecpAemStartStreamingCommandPayloadSize, AecpAemStopStreamingResponsePayloadSize> },
+		{ AemCommandType::GetAvbInfo.getValue(), &validateResponsePayloadSize<AecpAemGetAvbInfoCommandPayloadSize, AecpAemGetAvbInfoResponsePayloadMinSize> },
+		{ AemCommandType::GetAsPath.getValue(), &validateResponsePayloadSize<AecpAemGetAsPathCommandPayloadSize, AecpAemGetAsPathResponsePayloadMinSize> },
+		{ AemCommandType::GetCounters.getValue(), &validateResponsePayloadSize<AecpAemGetCountersCommandPayloadSize, AecpAemGetCountersResponsePayloadSize> },
+		{ AemCommandType::Reboot.getValue(), &validateResponsePayloadSize<AecpAemRebootCommandPayloadSize, AecpAemRebootResponsePayloadSize> },
+		{ AemCommandType::GetAudioMap.getValue(), &validateResponsePayloadSize<AecpAemGetAudioMapCommandPayloadSize, AecpAemGetAudioMapResponsePayloadMinSize> },
+		{ AemCommandType::AddAudioMappings.getValue(), &validateResponsePayloadSize<AecpAemAddAudioMappingsCommandPayloadMinSize, AecpAemAddAudioMappingsResponsePayloadMinSize> },
+		{ AemCommandType::RemoveAudioMappings.getValue(), &validateResponsePayloadSize<AecpAemAddAudioMappingsCommandPayloadMinSize, AecpAemRemoveAudioMappingsResponsePayloadMinSize> },
+		{ AemCommandType::StartOperation.getValue(), &validateResponsePayloadSize<AecpAemStartOperationCommandPayloadMinSize, AecpAemStartOperationResponsePayloadMinSize> },
+		{ AemCommandType::AbortOperation.getValue(), &validateResponsePayloadSize<AecpAemAbortOperationCommandPayloadSize, AecpAemAbortOperationResponsePayloadSize> },
+		{ AemCommandType::SetMemoryObjectLength.getValue(), &validateResponsePayloadSize<AecpAemSetMemoryObjectLengthCommandPayloadSize, AecpAemSetMemoryObjectLengthResponsePayloadSize> },
+		{ AemCommandType::GetMemoryObjectLength.getValue(), &validateResponsePayloadSize<AecpAemSetMemoryObjectLengthCommandPayloadSize, AecpAemGetMemoryObjectLengthResponsePayloadSize> },
+		{ AemCommandType::GetDynamicInfo.getValue(), &validateResponsePayloadSize<AecpAemGetDynamicInfoCommandPayloadMinSize, AecpAemGetDynamicInfoResponsePayloadMinSize> },
+		{ AemCommandType::SetMaxTransitTime.getValue(), &validateResponsePayloadSize<AecpAemSetMaxTransitTimeCommandPayloadSize, AecpAemSetMaxTransitTimeResponsePayloadSize> },
+		{ AemCommandType::GetMaxTransitTime.getValue(), &validateResponsePayloadSize<AecpAemSetMaxTransitTimeCommandPayloadSize, AecpAemGetMaxTransitTimeResponsePayloadSize> },
+	};
+
+	// OPERATION_STATUS is an unsolicited only response, no reflected message is possible
+	if (commandType == AemCommandType::OperationStatus)
+	{
+		return payload.first != nullptr && payload.second >= AecpAemOperationStatusResponsePayloadSize;
+	}
+
+	if (auto const validator = s_Validators.find(commandType.getValue()); validator != nullptr)
+	{
+		return validator(status, payload);
+	}
+
+	// Unknown command, size cannot be validated
+	return true;
+}
+
 
 } // namespace aemPayload
 } // namespace protocol
@@ -469,6 +469,17 @@ std::tuple<entity::model::DescriptorType, entity::model::StreamIndex> deserializ
 Serializer<AecpAemGetMaxTransitTimeResponsePayloadSize> serializeGetMaxTransitTimeResponse(entity::model::DescriptorType const descriptorType, entity::model::StreamIndex const streamIndex, std::uint64_t const maxTransitTime);
 std::tuple<entity::model::DescriptorType, entity::model::StreamIndex, std::uint64_t> deserializeGetMaxTransitTimeResponse(entity::LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload);
 
+/**
+* @brief Validates the size of an AEM response payload without throwing.
+* @details Performs the same payload size checks as the deserialize*Response methods (reflected command size if status is NotImplemented, minimum response size otherwise),
+*          so malformed responses can be rejected up front without relying on exceptions. Unknown command types are considered valid.
+* @param[in] commandType The command type of the response.
+* @param[in] status The status of the response.
+* @param[in] payload The payload of the response.
+* @return True if the payload size is valid for the command type and status, false if the corresponding deserialize*Response method would throw an IncorrectPayloadSizeException.
+*/
+bool isValidResponsePayloadSize(AemCommandType const commandType, entity::LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload) noexcept;
+
 } // namespace aemPayload
 } // namespace protocol
 } // namespace avdecc
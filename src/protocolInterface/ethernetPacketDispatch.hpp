@@ -34,6 +34,7 @@
 
 #include "stateMachine/stateMachineManager.hpp"
 #include "logHelper.hpp"
+#include "dispatchTable.hpp"
 
 #include <cstdint>
 
@@ -55,12 +56,26 @@ public:
 
 	void dispatchAvdeccMessage(std::uint8_t const* const pkt_data, size_t const pkt_len, EtherLayer2 const& etherLayer2) const noexcept
 	{
-		try
+		// Not even enough bytes to read SubType and ControlData
+		if (pkt_len < 2)
+		{
+			LOG_PROTOCOL_INTERFACE_WARN(networkInterface::MacAddress{}, networkInterface::MacAddress{}, "ProtocolInterfacePCap: Packet dropped: Not enough data to deserialize");
+			return;
+		}
+
+		// Read Avtpdu SubType and ControlData (which is remapped to MessageType for all 1722.1 messages)
+		std::uint8_t const subType = pkt_data[0] & 0x7f;
+		std::uint8_t const controlData = pkt_data[1] & 0x7f;
+
+		// Validate the total length once, before deserializing, so truncated messages are dropped without throwing
+		if (pkt_len < getMinimumMessageLength(subType, controlData))
 		{
-			// Read Avtpdu SubType and ControlData (which is remapped to MessageType for all 1722.1 messages)
-			std::uint8_t const subType = pkt_data[0] & 0x7f;
-			std::uint8_t const controlData = pkt_data[1] & 0x7f;
+			LOG_PROTOCOL_INTERFACE_WARN(networkInterface::MacAddress{}, networkInterface::MacAddress{}, "ProtocolInterfacePCap: Packet dropped: Not enough data to deserialize");
+			return;
+		}
 
+		try
+		{
 			// Create a deserialization buffer
 			auto des = DeserializationBuffer(pkt_data, pkt_len);
 
@@ -80,11 +95,8 @@ public:
 					// Then deserialize Adp
 					deserialize<Adpdu>(&adp, des);
 
-					// Low level notification
-					_self->template notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAdpduReceived, _self, adp);
-
-					// Forward to our state machine
-					_stateMachineManager.processAdpdu(adp);
+					// Dispatch the fully parsed message
+					dispatchAdpdu(adp);
 					break;
 				}
 
@@ -93,28 +105,29 @@ public:
 				{
 					auto const messageType = static_cast<AecpMessageType>(controlData);
 
-					static std::unordered_map<AecpMessageType, std::function<Aecpdu::UniquePointer(BaseClass* const pi, EtherLayer2 const& etherLayer2, Deserializer& des, std::uint8_t const* const pkt_data, size_t const pkt_len)>, AecpMessageType::Hash> s_Dispatch{
-						{ AecpMessageType::AemCommand,
+					using Handler = Aecpdu::UniquePointer (*)(BaseClass* const pi, EtherLayer2 const& etherLayer2, Deserializer& des, std::uint8_t const* const pkt_data, size_t const pkt_len);
+					static auto const s_Dispatch = utils::DispatchTable<AecpMessageType::value_type, Handler, 0x10>{
+						{ AecpMessageType::AemCommand.getValue(),
 							[](BaseClass* const /*pi*/, EtherLayer2 const& /*etherLayer2*/, Deserializer& /*des*/, std::uint8_t const* const /*pkt_data*/, size_t const /*pkt_len*/)
 							{
 								return AemAecpdu::create(false);
 							} },
-						{ AecpMessageType::AemResponse,
+						{ AecpMessageType::AemResponse.getValue(),
 							[](BaseClass* const /*pi*/, EtherLayer2 const& /*etherLayer2*/, Deserializer& /*des*/, std::uint8_t const* const /*pkt_data*/, size_t const /*pkt_len*/)
 							{
 								return AemAecpdu::create(true);
 							} },
-						{ AecpMessageType::AddressAccessCommand,
+						{ AecpMessageType::AddressAccessCommand.getValue(),
 							[](BaseClass* const /*pi*/, EtherLayer2 const& /*etherLayer2*/, Deserializer& /*des*/, std::uint8_t const* const /*pkt_data*/, size_t const /*pkt_len*/)
 							{
 								return AaAecpdu::create(false);
 							} },
-						{ AecpMessageType::AddressAccessResponse,
+						{ AecpMessageType::AddressAccessResponse.getValue(),
 							[](BaseClass* const /*pi*/, EtherLayer2 const& /*etherLayer2*/, Deserializer& /*des*/, std::uint8_t const* const /*pkt_data*/, size_t const /*pkt_len*/)
 							{
 								return AaAecpdu::create(true);
 							} },
-						{ AecpMessageType::VendorUniqueCommand,
+						{ AecpMessageType::VendorUniqueCommand.getValue(),
 							[](BaseClass* const pi, EtherLayer2 const& etherLayer2, Deserializer& des, std::uint8_t const* const pkt_data, size_t const pkt_len)
 							{
 								// We have to retrieve the ProtocolID to dispatch
@@ -155,7 +168,7 @@ public:
 
 								return Aecpdu::UniquePointer{ nullptr, nullptr };
 							} },
-						{ AecpMessageType::VendorUniqueResponse,
+						{ AecpMessageType::VendorUniqueResponse.getValue(),
 							[](BaseClass* const pi, EtherLayer2 const& etherLayer2, Deserializer& des, std::uint8_t const* const pkt_data, size_t const pkt_len)
 							{
 								// We have to retrieve the ProtocolID to dispatch
@@ -205,12 +218,12 @@ public:
 							} },
 					};
 
-					auto const& it = s_Dispatch.find(messageType);
-					if (it == s_Dispatch.end())
+					auto const handler = s_Dispatch.find(messageType.getValue());
+					if (handler == nullptr)
 						return; // Unsupported AECP message type
 
 					// Create aecpdu frame based on message type
-					auto aecpdu = it->second(_self, etherLayer2, des, pkt_data, pkt_len);
+					auto aecpdu = handler(_self, etherLayer2, des, pkt_data, pkt_len);
 
 					if (aecpdu != nullptr)
 					{
@@ -242,11 +255,8 @@ public:
 					// Then deserialize Acmp
 					deserialize<Acmpdu>(&acmp, des);
 
-					// Low level notification
-					_self->template notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpduReceived, _self, acmp);
-
-					// Forward to our state machine
-					_stateMachineManager.processAcmpdu(acmp);
+					// Dispatch the fully parsed message
+					dispatchAcmpdu(acmp);
 					break;
 				}
 
@@ -270,7 +280,54 @@ public:
 		}
 	}
 
+	/** Dispatches an already parsed ADPDU (skipping deserialization) */
+	void dispatchAdpdu(Adpdu const& adpdu) const noexcept
+	{
+		// Low level notification
+		_self->template notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAdpduReceived, _self, adpdu);
+
+		// Forward to our state machine
+		_stateMachineManager.processAdpdu(adpdu);
+	}
+
+	/** Dispatches an already parsed ACMPDU (skipping deserialization) */
+	void dispatchAcmpdu(Acmpdu const& acmpdu) const noexcept
+	{
+		// Low level notification
+		_self->template notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpduReceived, _self, acmpdu);
+
+		// Forward to our state machine
+		_stateMachineManager.processAcmpdu(acmpdu);
+	}
+
 private:
+	/** Returns the minimum length (AVTP control header included) of a message, based on its SubType and ControlData */
+	static size_t getMinimumMessageLength(std::uint8_t const subType, std::uint8_t const controlData) noexcept
+	{
+		switch (subType)
+		{
+			case AvtpSubType_Adp:
+				return AvtpduControl::HeaderLength + Adpdu::Length;
+			case AvtpSubType_Acmp:
+				return AvtpduControl::HeaderLength + Acmpdu::Length;
+			case AvtpSubType_Aecp:
+			{
+				auto const messageType = AecpMessageType{ controlData };
+				if (messageType == AecpMessageType::AemCommand || messageType == AecpMessageType::AemResponse)
+				{
+					return AvtpduControl::HeaderLength + Aecpdu::HeaderLength + AemAecpdu::HeaderLength;
+				}
+				if (messageType == AecpMessageType::AddressAccessCommand || messageType == AecpMessageType::AddressAccessResponse)
+				{
+					return AvtpduControl::HeaderLength + Aecpdu::HeaderLength + AaAecpdu::HeaderLength;
+				}
+				return AvtpduControl::HeaderLength + Aecpdu::HeaderLength;
+			}
+			default:
+				return 0u;
+		}
+	}
+
 	static void deserializeAecpMessage(EtherLayer2 const& etherLayer2, Deserializer& des, Aecpdu& aecp)
 	{
 		// Fill EtherLayer2
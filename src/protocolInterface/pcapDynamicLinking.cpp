@@ -133,6 +133,8 @@ namespace avdecc
 namespace protocol
 {
 using open_live_t = pcap_t* (*)(const char*, int, int, int, char*);
+using open_offline_t = pcap_t* (*)(const char*, char*);
+using datalink_t = int (*)(pcap_t*);
 using fileno_t = int (*)(pcap_t*);
 using close_t = void (*)(pcap_t*);
 using compile_t = int (*)(pcap_t*, bpf_program*, const char*, int, bpf_u_int32);
@@ -147,6 +149,8 @@ struct PcapInterface::pImpl
 {
 	DL_HANDLE libraryHandle{ nullptr };
 	open_live_t open_live_ptr{ nullptr };
+	open_offline_t open_offline_ptr{ nullptr };
+	datalink_t datalink_ptr{ nullptr };
 	fileno_t fileno_ptr{ nullptr };
 	close_t close_ptr{ nullptr };
 	compile_t compile_ptr{ nullptr };
@@ -171,6 +175,8 @@ PcapInterface::PcapInterface()
 			version = lib_version_ptr();
 
 			_pImpl->open_live_ptr = reinterpret_cast<open_live_t>(DL_SYM(handle, "pcap_open_live"));
+			_pImpl->open_offline_ptr = reinterpret_cast<open_offline_t>(DL_SYM(handle, "pcap_open_offline"));
+			_pImpl->datalink_ptr = reinterpret_cast<datalink_t>(DL_SYM(handle, "pcap_datalink"));
 			_pImpl->fileno_ptr = reinterpret_cast<fileno_t>(DL_SYM(handle, "pcap_fileno"));
 			_pImpl->close_ptr = reinterpret_cast<close_t>(DL_SYM(handle, "pcap_close"));
 			_pImpl->compile_ptr = reinterpret_cast<compile_t>(DL_SYM(handle, "pcap_compile"));
@@ -181,7 +187,7 @@ PcapInterface::PcapInterface()
 			_pImpl->breakloop_ptr = reinterpret_cast<breakloop_t>(DL_SYM(handle, "pcap_breakloop"));
 			_pImpl->sendpacket_ptr = reinterpret_cast<sendpacket_t>(DL_SYM(handle, "pcap_sendpacket"));
 
-			foundAllFunctions = _pImpl->open_live_ptr && _pImpl->fileno_ptr && _pImpl->close_ptr && _pImpl->compile_ptr && _pImpl->setfilter_ptr && _pImpl->freecode_ptr && _pImpl->next_ex_ptr && _pImpl->loop_ptr && _pImpl->breakloop_ptr && _pImpl->sendpacket_ptr;
+			foundAllFunctions = _pImpl->open_live_ptr && _pImpl->open_offline_ptr && _pImpl->datalink_ptr && _pImpl->fileno_ptr && _pImpl->close_ptr && _pImpl->compile_ptr && _pImpl->setfilter_ptr && _pImpl->freecode_ptr && _pImpl->next_ex_ptr && _pImpl->loop_ptr && _pImpl->breakloop_ptr && _pImpl->sendpacket_ptr;
 		}
 
 		if (foundAllFunctions)
@@ -225,6 +231,18 @@ pcap_t* PcapInterface::open_live(const char* device, int snaplen, int promisc, i
 	return _pImpl->open_live_ptr(device, snaplen, promisc, to_ms, ebuf);
 }
 
+pcap_t* PcapInterface::open_offline(const char* fname, char* ebuf) const
+{
+	assert((_pImpl != nullptr) && (_pImpl->libraryHandle != nullptr) && (_pImpl->open_offline_ptr != nullptr));
+	return _pImpl->open_offline_ptr(fname, ebuf);
+}
+
+int PcapInterface::datalink(pcap_t* p) const
+{
+	assert((_pImpl != nullptr) && (_pImpl->libraryHandle != nullptr) && (_pImpl->datalink_ptr != nullptr));
+	return _pImpl->datalink_ptr(p);
+}
+
 int PcapInterface::fileno(pcap_t* p) const
 {
 	assert((_pImpl != nullptr) && (_pImpl->libraryHandle != nullptr) && (_pImpl->fileno_ptr != nullptr));
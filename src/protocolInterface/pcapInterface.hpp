@@ -41,6 +41,8 @@ public:
 
 	bool is_available() const;
 	pcap_t* open_live(const char*, int, int, int, char*) const;
+	pcap_t* open_offline(const char*, char*) const;
+	int datalink(pcap_t*) const;
 	int fileno(pcap_t*) const;
 	void close(pcap_t*) const;
 	int compile(pcap_t*, struct bpf_program*, const char*, int, bpf_u_int32) const;
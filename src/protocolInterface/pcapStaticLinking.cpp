@@ -42,6 +42,16 @@ pcap_t* PcapInterface::open_live(const char* device, int snaplen, int promisc, i
 	return pcap_open_live(device, snaplen, promisc, to_ms, ebuf);
 }
 
+pcap_t* PcapInterface::open_offline(const char* fname, char* ebuf) const
+{
+	return pcap_open_offline(fname, ebuf);
+}
+
+int PcapInterface::datalink(pcap_t* p) const
+{
+	return pcap_datalink(p);
+}
+
 int PcapInterface::fileno(pcap_t* p) const
 {
 	return pcap_fileno(p);
@@ -509,6 +509,18 @@ private:
 		return _stateMachineManager.setAutomaticDiscoveryDelay(delay);
 	}
 
+	virtual Error setAecpCongestionControlParameters(AecpCongestionControlParameters const& /*parameters*/) const noexcept override
+	{
+		// AECP commands are handled by the native API
+		return Error::MessageNotSupported;
+	}
+
+	virtual Error getAecpCongestionControlStatistics(UniqueIdentifier const /*targetEntityID*/, AecpCongestionControlStatistics& /*statistics*/) const noexcept override
+	{
+		// AECP commands are handled by the native API
+		return Error::MessageNotSupported;
+	}
+
 	virtual bool isDirectMessageSupported() const noexcept override
 	{
 		return false;
@@ -22,30 +22,19 @@
 * @author Christophe Calmejane
 */
 
-#include "la/avdecc/internals/serialization.hpp"
-#include "la/avdecc/internals/protocolAemAecpdu.hpp"
-#include "la/avdecc/internals/protocolAaAecpdu.hpp"
-#include "la/avdecc/watchDog.hpp"
 #include "la/avdecc/utils.hpp"
 #include "la/avdecc/executor.hpp"
 
-#include "stateMachine/stateMachineManager.hpp"
-#include "ethernetPacketDispatch.hpp"
+#include "protocolInterface_pcapCommon.hpp"
 #include "protocolInterface_pcap.hpp"
 #include "pcapInterface.hpp"
-#include "logHelper.hpp"
 
-#include <stdexcept>
 #include <sstream>
 #include <array>
 #include <thread>
 #include <string>
-#include <unordered_map>
 #include <functional>
 #include <memory>
-#include <chrono>
-#include <cstdlib>
-#include <ctime>
 #ifdef __linux__
 #	include <csignal>
 #endif // __linux__
@@ -56,7 +45,7 @@ namespace avdecc
 {
 namespace protocol
 {
-class ProtocolInterfacePcapImpl final : public ProtocolInterfacePcap, private stateMachine::ProtocolInterfaceDelegate, private stateMachine::AdvertiseStateMachine::Delegate, private stateMachine::DiscoveryStateMachine::Delegate, private stateMachine::CommandStateMachine::Delegate
+class ProtocolInterfacePcapImpl final : public ProtocolInterfacePcapCommon<ProtocolInterfacePcap>
 {
 public:
 	/* ************************************************************ */
@@ -64,7 +53,7 @@ public:
 	/* ************************************************************ */
 	/** Constructor */
 	ProtocolInterfacePcapImpl(std::string const& networkInterfaceID, std::string const& executorName)
-		: ProtocolInterfacePcap(networkInterfaceID, executorName)
+		: ProtocolInterfacePcapCommon<ProtocolInterfacePcap>(networkInterfaceID, executorName)
 	{
 		static constexpr int PCAP_BufferSize = 65536;
 		static constexpr int PCAP_PromiscMode = 1;
@@ -198,425 +187,38 @@ private:
 		_pcap.reset();
 	}
 
-	virtual UniqueIdentifier getDynamicEID() const noexcept override
-	{
-		auto eid = UniqueIdentifier::value_type{ 0u };
-		auto const& macAddress = getMacAddress();
-
-		eid += macAddress[0];
-		eid <<= 8;
-		eid += macAddress[1];
-		eid <<= 8;
-		eid += macAddress[2];
-		eid <<= 8;
-		eid += macAddress[3];
-		eid <<= 8;
-		eid += macAddress[4];
-		eid <<= 8;
-		eid += macAddress[5];
-		eid <<= 16;
-		std::srand(static_cast<unsigned int>(std::time(0)));
-		eid += static_cast<std::uint16_t>((std::rand() % 0xFFFD) + 1);
-
-		return UniqueIdentifier{ eid };
-	}
-
-	virtual void releaseDynamicEID(UniqueIdentifier const /*entityID*/) const noexcept override
-	{
-		// Nothing to do
-	}
-
-	virtual Error registerLocalEntity(entity::LocalEntity& entity) noexcept override
-	{
-		// Checks if entity has declared an InterfaceInformation matching this ProtocolInterface
-		auto const index = _stateMachineManager.getMatchingInterfaceIndex(entity);
-
-		if (index)
-		{
-			return _stateMachineManager.registerLocalEntity(entity);
-		}
-
-		return Error::InvalidParameters;
-	}
-
-	virtual Error unregisterLocalEntity(entity::LocalEntity& entity) noexcept override
-	{
-		return _stateMachineManager.unregisterLocalEntity(entity);
-	}
-
 	virtual Error injectRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept override
 	{
 		processRawPacket(std::move(packet));
 		return Error::NoError;
 	}
 
-	virtual Error setEntityNeedsAdvertise(entity::LocalEntity const& entity, entity::LocalEntity::AdvertiseFlags const /*flags*/) noexcept override
-	{
-		return _stateMachineManager.setEntityNeedsAdvertise(entity);
-	}
-
-	virtual Error enableEntityAdvertising(entity::LocalEntity& entity) noexcept override
-	{
-		return _stateMachineManager.enableEntityAdvertising(entity);
-	}
-
-	virtual Error disableEntityAdvertising(entity::LocalEntity const& entity) noexcept override
-	{
-		return _stateMachineManager.disableEntityAdvertising(entity);
-	}
-
-	virtual Error discoverRemoteEntities() const noexcept override
-	{
-		return discoverRemoteEntity(UniqueIdentifier::getNullUniqueIdentifier());
-	}
-
-	virtual Error discoverRemoteEntity(UniqueIdentifier const entityID) const noexcept override
-	{
-		auto const frame = stateMachine::Manager::makeDiscoveryMessage(getMacAddress(), entityID);
-		auto const err = sendMessage(frame);
-		if (!err)
-		{
-			_stateMachineManager.discoverMessageSent(); // Notify we are sending a discover message
-		}
-		return err;
-	}
-
-	virtual Error forgetRemoteEntity(UniqueIdentifier const entityID) const noexcept override
-	{
-		return _stateMachineManager.forgetRemoteEntity(entityID);
-	}
-
-	virtual Error setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) const noexcept override
-	{
-		return _stateMachineManager.setAutomaticDiscoveryDelay(delay);
-	}
-
-	virtual bool isDirectMessageSupported() const noexcept override
-	{
-		return true;
-	}
-
-	virtual Error sendAdpMessage(Adpdu const& adpdu) const noexcept override
-	{
-		// Directly send the message on the network
-		return sendMessage(adpdu);
-	}
-
-	virtual Error sendAecpMessage(Aecpdu const& aecpdu) const noexcept override
-	{
-		// Directly send the message on the network
-		return sendMessage(aecpdu);
-	}
-
-	virtual Error sendAcmpMessage(Acmpdu const& acmpdu) const noexcept override
-	{
-		// Directly send the message on the network
-		return sendMessage(acmpdu);
-	}
-
-	virtual Error sendAecpCommand(Aecpdu::UniquePointer&& aecpdu, AecpCommandResultHandler const& onResult) const noexcept override
-	{
-		auto const messageType = aecpdu->getMessageType();
-
-		if (!AVDECC_ASSERT_WITH_RET(!isAecpResponseMessageType(messageType), "Calling sendAecpCommand with a Response MessageType"))
-		{
-			return Error::MessageNotSupported;
-		}
-
-		// Special check for VendorUnique messages
-		if (messageType == AecpMessageType::VendorUniqueCommand)
-		{
-			auto& vuAecp = static_cast<VuAecpdu&>(*aecpdu);
-
-			auto const vuProtocolID = vuAecp.getProtocolIdentifier();
-			auto* vuDelegate = getVendorUniqueDelegate(vuProtocolID);
-
-			// No delegate, or the messages are not handled by the ControllerStateMachine
-			if (!vuDelegate || !vuDelegate->areHandledByControllerStateMachine(vuProtocolID))
-			{
-				return Error::MessageNotSupported;
-			}
-		}
-
-		// Command goes through the state machine to handle timeout, retry and response
-		return _stateMachineManager.sendAecpCommand(std::move(aecpdu), onResult);
-	}
-
-	virtual Error sendAecpResponse(Aecpdu::UniquePointer&& aecpdu) const noexcept override
-	{
-		auto const messageType = aecpdu->getMessageType();
-
-		if (!AVDECC_ASSERT_WITH_RET(isAecpResponseMessageType(messageType), "Calling sendAecpResponse with a Command MessageType"))
-		{
-			return Error::MessageNotSupported;
-		}
-
-		// Special check for VendorUnique messages
-		if (messageType == AecpMessageType::VendorUniqueResponse)
-		{
-			auto& vuAecp = static_cast<VuAecpdu&>(*aecpdu);
-
-			auto const vuProtocolID = vuAecp.getProtocolIdentifier();
-			auto* vuDelegate = getVendorUniqueDelegate(vuProtocolID);
-
-			// No delegate, or the messages are not handled by the ControllerStateMachine
-			if (!vuDelegate || !vuDelegate->areHandledByControllerStateMachine(vuProtocolID))
-			{
-				return Error::MessageNotSupported;
-			}
-		}
-
-		// Response can be directly sent
-		return sendMessage(static_cast<Aecpdu const&>(*aecpdu));
-	}
-
-	virtual Error sendAcmpCommand(Acmpdu::UniquePointer&& acmpdu, AcmpCommandResultHandler const& onResult) const noexcept override
-	{
-		// Command goes through the state machine to handle timeout, retry and response
-		return _stateMachineManager.sendAcmpCommand(std::move(acmpdu), onResult);
-	}
-
-	virtual Error sendAcmpResponse(Acmpdu::UniquePointer&& acmpdu) const noexcept override
-	{
-		// Response can be directly sent
-		return sendMessage(static_cast<Acmpdu const&>(*acmpdu));
-	}
-
-	virtual void lock() const noexcept override
-	{
-		_stateMachineManager.lock();
-	}
-
-	virtual void unlock() const noexcept override
-	{
-		_stateMachineManager.unlock();
-	}
-
-	virtual bool isSelfLocked() const noexcept override
-	{
-		return _stateMachineManager.isSelfLocked();
-	}
-
 	/* ************************************************************ */
-	/* stateMachine::ProtocolInterfaceDelegate overrides            */
+	/* ProtocolInterfacePcapCommon overrides                        */
 	/* ************************************************************ */
-	/* **** AECP notifications **** */
-	virtual void onAecpCommand(Aecpdu const& aecpdu) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpCommand, this, aecpdu);
-	}
-
-	/* **** ACMP notifications **** */
-	virtual void onAcmpCommand(Acmpdu const& acmpdu) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpCommand, this, acmpdu);
-	}
-
-	virtual void onAcmpResponse(Acmpdu const& acmpdu) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpResponse, this, acmpdu);
-	}
-
-	/* **** Sending methods **** */
-	virtual Error sendMessage(Adpdu const& adpdu) const noexcept override
+	virtual Error sendPacket(SerializationBuffer const& buffer) const noexcept override
 	{
-		try
-		{
-			// PCap transport requires the full frame to be built
-			SerializationBuffer buffer;
-
-			// Start with EtherLayer2
-			serialize<EtherLayer2>(adpdu, buffer);
-			// Then Avtp control
-			serialize<AvtpduControl>(adpdu, buffer);
-			// Then with Adp
-			serialize<Adpdu>(adpdu, buffer);
-
-			// Send the message
-			return sendPacket(buffer);
-		}
-		catch ([[maybe_unused]] std::exception const& e)
-		{
-			LOG_PROTOCOL_INTERFACE_DEBUG(adpdu.getSrcAddress(), adpdu.getDestAddress(), std::string("Failed to serialize ADPDU: ") + e.what());
-			return Error::InternalError;
-		}
-	}
+		auto length = buffer.size();
+		constexpr auto minimumSize = EthernetPayloadMinimumSize + EtherLayer2::HeaderLength;
 
-	virtual Error sendMessage(Aecpdu const& aecpdu) const noexcept override
-	{
-		try
-		{
-			// PCap transport requires the full frame to be built
-			SerializationBuffer buffer;
-
-			// Start with EtherLayer2
-			serialize<EtherLayer2>(aecpdu, buffer);
-			// Then Avtp control
-			serialize<AvtpduControl>(aecpdu, buffer);
-			// Then with Aecp
-			serialize<Aecpdu>(aecpdu, buffer);
-
-			// Send the message
-			return sendPacket(buffer);
-		}
-		catch ([[maybe_unused]] std::exception const& e)
-		{
-			LOG_PROTOCOL_INTERFACE_DEBUG(aecpdu.getSrcAddress(), aecpdu.getDestAddress(), std::string("Failed to serialize AECPDU: ") + e.what());
-			return Error::InternalError;
-		}
-	}
+		/* Check the buffer has enough bytes in it */
+		if (length < minimumSize)
+			length = minimumSize; // No need to resize nor pad the buffer, it has enough capacity and we don't care about the unused bytes. Simply increase the length of the data to send.
 
-	virtual Error sendMessage(Acmpdu const& acmpdu) const noexcept override
-	{
 		try
 		{
-			// PCap transport requires the full frame to be built
-			SerializationBuffer buffer;
-
-			// Start with EtherLayer2
-			serialize<EtherLayer2>(acmpdu, buffer);
-			// Then Avtp control
-			serialize<AvtpduControl>(acmpdu, buffer);
-			// Then with Acmp
-			serialize<Acmpdu>(acmpdu, buffer);
-
-			// Send the message
-			return sendPacket(buffer);
-		}
-		catch ([[maybe_unused]] std::exception const& e)
-		{
-			LOG_PROTOCOL_INTERFACE_DEBUG(acmpdu.getSrcAddress(), Acmpdu::Multicast_Mac_Address, "Failed to serialize ACMPDU: {}", e.what());
-			return Error::InternalError;
+			auto* const pcap = _pcap.get();
+			AVDECC_ASSERT(pcap, "Trying to send a message but pcapLibrary has been uninitialized");
+			if (pcap != nullptr)
+			{
+				if (_pcapLibrary.sendpacket(pcap, buffer.data(), static_cast<int>(length)) == 0)
+					return Error::NoError;
+			}
 		}
-	}
-
-	/* *** Other methods **** */
-	virtual std::uint32_t getVuAecpCommandTimeoutMsec(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept override
-	{
-		return getVuAecpCommandTimeout(protocolIdentifier, aecpdu);
-	}
-
-	/* ************************************************************ */
-	/* stateMachine::AdvertiseStateMachine::Delegate overrides      */
-	/* ************************************************************ */
-
-	/* ************************************************************ */
-	/* stateMachine::DiscoveryStateMachine::Delegate overrides      */
-	/* ************************************************************ */
-	virtual void onLocalEntityOnline(entity::Entity const& entity) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityOnline, this, entity);
-	}
-
-	virtual void onLocalEntityOffline(UniqueIdentifier const entityID) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityOffline, this, entityID);
-	}
-
-	virtual void onLocalEntityUpdated(entity::Entity const& entity) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityUpdated, this, entity);
-	}
-
-	virtual void onRemoteEntityOnline(entity::Entity const& entity) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityOnline, this, entity);
-	}
-
-	virtual void onRemoteEntityOffline(UniqueIdentifier const entityID) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityOffline, this, entityID);
-
-		// Notify the StateMachineManager
-		_stateMachineManager.onRemoteEntityOffline(entityID);
-	}
-
-	virtual void onRemoteEntityUpdated(entity::Entity const& entity) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityUpdated, this, entity);
-	}
-
-	/* ************************************************************ */
-	/* stateMachine::CommandStateMachine::Delegate overrides        */
-	/* ************************************************************ */
-	virtual void onAecpAemUnsolicitedResponse(AemAecpdu const& aecpdu) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpAemUnsolicitedResponse, this, aecpdu);
-	}
-
-	virtual void onAecpAemIdentifyNotification(AemAecpdu const& aecpdu) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpAemIdentifyNotification, this, aecpdu);
-	}
-	virtual void onAecpRetry(UniqueIdentifier const& entityID) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpRetry, this, entityID);
-	}
-	virtual void onAecpTimeout(UniqueIdentifier const& entityID) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpTimeout, this, entityID);
-	}
-	virtual void onAecpUnexpectedResponse(UniqueIdentifier const& entityID) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpUnexpectedResponse, this, entityID);
-	}
-	virtual void onAecpResponseTime(UniqueIdentifier const& entityID, std::chrono::milliseconds const& responseTime) noexcept override
-	{
-		// Notify observers
-		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpResponseTime, this, entityID, responseTime);
-	}
-
-	/* ************************************************************ */
-	/* la::avdecc::utils::Subject overrides                         */
-	/* ************************************************************ */
-	virtual void onObserverRegistered(observer_type* const observer) noexcept override
-	{
-		if (observer)
+		catch (...)
 		{
-			class DiscoveryDelegate final : public stateMachine::DiscoveryStateMachine::Delegate
-			{
-			public:
-				DiscoveryDelegate(ProtocolInterface& pi, ProtocolInterface::Observer& obs)
-					: _pi{ pi }
-					, _obs{ obs }
-				{
-				}
-
-			private:
-				virtual void onLocalEntityOnline(la::avdecc::entity::Entity const& entity) noexcept override
-				{
-					utils::invokeProtectedMethod(&ProtocolInterface::Observer::onLocalEntityOnline, &_obs, &_pi, entity);
-				}
-				virtual void onLocalEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
-				virtual void onLocalEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
-				virtual void onRemoteEntityOnline(la::avdecc::entity::Entity const& entity) noexcept override
-				{
-					utils::invokeProtectedMethod(&ProtocolInterface::Observer::onRemoteEntityOnline, &_obs, &_pi, entity);
-				}
-				virtual void onRemoteEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
-				virtual void onRemoteEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
-
-				ProtocolInterface& _pi;
-				ProtocolInterface::Observer& _obs;
-			};
-			auto discoveryDelegate = DiscoveryDelegate{ *this, static_cast<ProtocolInterface::Observer&>(*observer) };
-
-			_stateMachineManager.notifyDiscoveredEntities(discoveryDelegate);
 		}
+		return Error::TransportError;
 	}
 
 	/* ************************************************************ */
@@ -628,34 +230,7 @@ private:
 			[this, msg = std::move(packet)]()
 			{
 				// Packet received, process it
-				auto des = DeserializationBuffer(msg);
-				EtherLayer2 etherLayer2;
-				deserialize<EtherLayer2>(&etherLayer2, des);
-
-				// Don't ignore self mac, another entity might be on the computer
-
-				// Check ether type (shouldn't be needed, pcap filter is active)
-				std::uint16_t etherType = AVDECC_UNPACK_TYPE(*((std::uint16_t*)(msg.data() + 12)), std::uint16_t);
-				if (etherType != AvtpEtherType)
-				{
-					return;
-				}
-
-				std::uint8_t const* avtpdu = msg.data() + 14; // Start of AVB Transport Protocol
-				auto avtpdu_size = msg.size() - 14;
-				// Check AVTP control bit (meaning AVDECC packet)
-				std::uint8_t avtp_sub_type_control = avtpdu[0];
-				if ((avtp_sub_type_control & 0xF0) == 0)
-				{
-					return;
-				}
-
-				// Try to detect possible deadlock
-				{
-					_watchDog.registerWatch("avdecc::PCapInterface::dispatchAvdeccMessage::" + utils::toHexString(reinterpret_cast<size_t>(this)), std::chrono::milliseconds{ 1000u }, true);
-					_ethernetPacketDispatcher.dispatchAvdeccMessage(avtpdu, avtpdu_size, etherLayer2);
-					_watchDog.unregisterWatch("avdecc::PCapInterface::dispatchAvdeccMessage::" + utils::toHexString(reinterpret_cast<size_t>(this)), true);
-				}
+				dispatchRawPacket(msg);
 			});
 	}
 
@@ -668,42 +243,12 @@ private:
 		self->processRawPacket(std::move(pcapMessage));
 	}
 
-	Error sendPacket(SerializationBuffer const& buffer) const noexcept
-	{
-		auto length = buffer.size();
-		constexpr auto minimumSize = EthernetPayloadMinimumSize + EtherLayer2::HeaderLength;
-
-		/* Check the buffer has enough bytes in it */
-		if (length < minimumSize)
-			length = minimumSize; // No need to resize nor pad the buffer, it has enough capacity and we don't care about the unused bytes. Simply increase the length of the data to send.
-
-		try
-		{
-			auto* const pcap = _pcap.get();
-			AVDECC_ASSERT(pcap, "Trying to send a message but pcapLibrary has been uninitialized");
-			if (pcap != nullptr)
-			{
-				if (_pcapLibrary.sendpacket(pcap, buffer.data(), static_cast<int>(length)) == 0)
-					return Error::NoError;
-			}
-		}
-		catch (...)
-		{
-		}
-		return Error::TransportError;
-	}
-
 	// Private variables
-	watchDog::WatchDog::SharedPointer _watchDogSharedPointer{ watchDog::WatchDog::getInstance() };
-	watchDog::WatchDog& _watchDog{ *_watchDogSharedPointer };
 	PcapInterface _pcapLibrary;
 	std::unique_ptr<pcap_t, std::function<void(pcap_t*)>> _pcap{ nullptr, nullptr };
 	int _fd{ -1 };
 	bool _shouldTerminate{ false };
-	mutable stateMachine::Manager _stateMachineManager{ this, this, this, this, this };
 	std::thread _captureThread{};
-	friend class EthernetPacketDispatcher<ProtocolInterfacePcapImpl>;
-	EthernetPacketDispatcher<ProtocolInterfacePcapImpl> _ethernetPacketDispatcher{ this, _stateMachineManager };
 };
 
 ProtocolInterfacePcap::ProtocolInterfacePcap(std::string const& networkInterfaceID, std::string const& executorName)
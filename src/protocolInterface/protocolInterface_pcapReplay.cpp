@@ -0,0 +1,379 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_pcapReplay.cpp
+* @author Christophe Calmejane
+*/
+
+#include "la/avdecc/utils.hpp"
+#include "la/avdecc/executor.hpp"
+
+#include "protocolInterface_pcapCommon.hpp"
+#include "protocolInterface_pcapReplay.hpp"
+#include "pcapInterface.hpp"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <functional>
+#include <memory>
+#include <chrono>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+class ProtocolInterfacePcapReplayImpl final : public ProtocolInterfacePcapCommon<ProtocolInterfacePcapReplay>
+{
+public:
+
+	/* ************************************************************ */
+	/* Public APIs                                                  */
+	/* ************************************************************ */
+	/** Constructor */
+	ProtocolInterfacePcapReplayImpl(std::string const& captureFilePath, networkInterface::MacAddress const& macAddress, std::string const& executorName, ReplayMode const replayMode)
+		: ProtocolInterfacePcapCommon<ProtocolInterfacePcapReplay>(captureFilePath, macAddress, executorName)
+		, _replayMode{ replayMode }
+	{
+		// Should always be supported. Cannot create a PCapReplay ProtocolInterface if it's not supported.
+		AVDECC_ASSERT(isSupported(), "Should always be supported. Cannot create a PCapReplay ProtocolInterface if it's not supported");
+
+		// Open the capture file (pcap_open_offline handles both pcap and pcapng formats)
+		std::array<char, PCAP_ERRBUF_SIZE> errbuf;
+		auto pcap = _pcapLibrary.open_offline(captureFilePath.c_str(), errbuf.data());
+		if (pcap == nullptr)
+		{
+			throw Exception(Error::InterfaceNotFound, errbuf.data());
+		}
+
+		// Store our pcap handle in a unique_ptr so the PCap library will be cleaned upon destruction of 'this'
+		// _pcapLibrary (accessed through the capture of 'this') will still be valid during destruction since it was declared before _pcap (thus destroyed after it)
+		_pcap = { pcap, [this](pcap_t* pcap)
+			{
+				if (pcap != nullptr)
+				{
+					_pcapLibrary.close(pcap);
+				}
+			} };
+
+		// Only ethernet captures can be replayed
+		if (_pcapLibrary.datalink(pcap) != DLT_EN10MB)
+		{
+			throw Exception(Error::InvalidParameters, "Capture file does not contain ethernet frames");
+		}
+
+		// Start the state machines
+		_stateMachineManager.startStateMachines();
+	}
+
+	/** Destructor */
+	virtual ~ProtocolInterfacePcapReplayImpl() noexcept
+	{
+		shutdown();
+	}
+
+	/** Destroy method for COM-like interface */
+	virtual void destroy() noexcept override
+	{
+		delete this;
+	}
+
+	// Deleted compiler auto-generated methods
+	ProtocolInterfacePcapReplayImpl(ProtocolInterfacePcapReplayImpl&&) = delete;
+	ProtocolInterfacePcapReplayImpl(ProtocolInterfacePcapReplayImpl const&) = delete;
+	ProtocolInterfacePcapReplayImpl& operator=(ProtocolInterfacePcapReplayImpl const&) = delete;
+	ProtocolInterfacePcapReplayImpl& operator=(ProtocolInterfacePcapReplayImpl&&) = delete;
+
+private:
+	/* ************************************************************ */
+	/* ProtocolInterfacePcapReplay overrides                        */
+	/* ************************************************************ */
+	virtual bool startReplay() noexcept override
+	{
+		if (_replayStarted.exchange(true))
+		{
+			return false;
+		}
+
+		// Start the replay thread
+		_replayThread = std::thread(
+			[this]
+			{
+				utils::setCurrentThreadName("avdecc::PCapReplayInterface::Replay");
+				replayCaptureFile();
+			});
+
+		return true;
+	}
+
+	virtual bool waitForReplayCompleted(std::chrono::milliseconds const timeout) const noexcept override
+	{
+		auto lock = std::unique_lock{ _replayLock };
+		return _replayCondition.wait_for(lock, timeout,
+			[this]
+			{
+				return _replayCompleted;
+			});
+	}
+
+	virtual Statistics getStatistics() const noexcept override
+	{
+		auto statistics = Statistics{};
+
+		statistics.framesRead = _framesRead;
+		statistics.framesDispatched = _framesDispatched;
+		statistics.framesIgnored = _framesIgnored;
+		statistics.adpduSent = _adpduSent;
+		statistics.aecpduSent = _aecpduSent;
+		statistics.acmpduSent = _acmpduSent;
+		statistics.bytesSent = _bytesSent;
+
+		return statistics;
+	}
+
+	/* ************************************************************ */
+	/* ProtocolInterface overrides                                  */
+	/* ************************************************************ */
+	virtual void shutdown() noexcept override
+	{
+		// Stop the state machines
+		_stateMachineManager.stopStateMachines();
+
+		// Notify the thread we are shutting down (might be waiting for the next frame to be due)
+		{
+			auto const lg = std::lock_guard{ _replayLock };
+			_shouldTerminate = true;
+		}
+		_replayCondition.notify_all();
+
+		// Wait for the thread to complete its pending tasks
+		if (_replayThread.joinable())
+		{
+			_replayThread.join();
+		}
+
+		// Flush executor jobs
+		la::avdecc::ExecutorManager::getInstance().flush(getExecutorName());
+
+		// Release the pcapLibrary
+		_pcap.reset();
+	}
+
+	virtual Error injectRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept override
+	{
+		la::avdecc::ExecutorManager::getInstance().pushJob(getExecutorName(),
+			[this, msg = std::move(packet)]()
+			{
+				dispatchFrame(msg);
+			});
+		return Error::NoError;
+	}
+
+	/* ************************************************************ */
+	/* ProtocolInterfacePcapCommon overrides                        */
+	/* ************************************************************ */
+	virtual Error sendPacket(SerializationBuffer const& buffer) const noexcept override
+	{
+		// Count the message instead of sending it
+		switch (buffer.data()[EtherLayer2::HeaderLength] & 0x7f)
+		{
+			case AvtpSubType_Adp:
+				++_adpduSent;
+				break;
+			case AvtpSubType_Aecp:
+				++_aecpduSent;
+				break;
+			case AvtpSubType_Acmp:
+				++_acmpduSent;
+				break;
+			default:
+				break;
+		}
+
+		auto length = buffer.size();
+		constexpr auto minimumSize = EthernetPayloadMinimumSize + EtherLayer2::HeaderLength;
+
+		/* Account for the padding the PCap transport would have added */
+		if (length < minimumSize)
+			length = minimumSize;
+
+		_bytesSent += length;
+		return Error::NoError;
+	}
+
+	/* ************************************************************ */
+	/* Private methods                                              */
+	/* ************************************************************ */
+	void replayCaptureFile() noexcept
+	{
+		auto* const pcap = _pcap.get();
+		auto replayStartTime = std::chrono::steady_clock::time_point{};
+		auto firstFrameTime = std::chrono::microseconds{};
+		auto isFirstFrame = true;
+		auto result = 0;
+
+		while (!_shouldTerminate)
+		{
+			struct pcap_pkthdr* header{ nullptr };
+			u_char const* pkt_data{ nullptr };
+
+			// Read next frame (returns -2 when the end of the file is reached, -1 on error)
+			result = _pcapLibrary.next_ex(pcap, &header, &pkt_data);
+			if (result != 1)
+			{
+				break;
+			}
+			++_framesRead;
+
+			// Wait for the frame to be due
+			if (_replayMode == ReplayMode::OriginalTiming)
+			{
+				auto const frameTime = std::chrono::seconds{ header->ts.tv_sec } + std::chrono::microseconds{ header->ts.tv_usec };
+				if (isFirstFrame)
+				{
+					replayStartTime = std::chrono::steady_clock::now();
+					firstFrameTime = frameTime;
+					isFirstFrame = false;
+				}
+				else
+				{
+					auto lock = std::unique_lock{ _replayLock };
+					_replayCondition.wait_until(lock, replayStartTime + (frameTime - firstFrameTime),
+						[this]
+						{
+							return _shouldTerminate.load();
+						});
+				}
+			}
+
+			// Wait for the processing queue to dispatch some frames, so the whole capture file is not loaded in memory
+			if (_framesInFlight.load() >= MaxFramesInFlight)
+			{
+				auto lock = std::unique_lock{ _replayLock };
+				_replayCondition.wait(lock,
+					[this]
+					{
+						return _shouldTerminate.load() || _framesInFlight.load() < MaxFramesInFlight;
+					});
+				if (_shouldTerminate)
+				{
+					break;
+				}
+			}
+
+			// Make a copy of the pcap message and forward to the processing queue
+			++_framesInFlight;
+			la::avdecc::ExecutorManager::getInstance().pushJob(getExecutorName(),
+				[this, msg = la::avdecc::MemoryBuffer{ pkt_data, header->caplen }]()
+				{
+					dispatchFrame(msg);
+
+					// Wake up the replay thread if it is waiting for frames to be dispatched (the lock makes sure it cannot miss the notification)
+					if (_framesInFlight.fetch_sub(1u) == MaxFramesInFlight)
+					{
+						auto const lg = std::lock_guard{ _replayLock };
+						_replayCondition.notify_all();
+					}
+				});
+		}
+
+		// Notify observers if we failed to read the capture file
+		if (result == PCAP_ERROR && !_shouldTerminate)
+		{
+			notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onTransportError, this);
+		}
+
+		// The replay is completed once all the frames pushed to the processing queue have been dispatched
+		la::avdecc::ExecutorManager::getInstance().pushJob(getExecutorName(),
+			[this]()
+			{
+				{
+					auto const lg = std::lock_guard{ _replayLock };
+					_replayCompleted = true;
+				}
+				_replayCondition.notify_all();
+			});
+	}
+
+	/** Dispatches a frame to the protocol stack, updating the statistics */
+	void dispatchFrame(la::avdecc::MemoryBuffer const& msg) const noexcept
+	{
+		if (dispatchRawPacket(msg))
+		{
+			++_framesDispatched;
+		}
+		else
+		{
+			++_framesIgnored;
+		}
+	}
+
+	// Private variables
+	PcapInterface _pcapLibrary;
+	std::unique_ptr<pcap_t, std::function<void(pcap_t*)>> _pcap{ nullptr, nullptr };
+	ReplayMode const _replayMode{ ReplayMode::AsFastAsPossible };
+	std::atomic_bool _replayStarted{ false };
+	std::atomic_bool _shouldTerminate{ false }; // Set with _replayLock taken, so the replay thread cannot miss the wake up
+	bool _replayCompleted{ false }; // Protected by _replayLock
+	mutable std::mutex _replayLock{};
+	mutable std::condition_variable _replayCondition{};
+	mutable std::atomic<std::uint32_t> _framesInFlight{ 0u };
+	std::atomic<std::uint64_t> _framesRead{ 0u };
+	mutable std::atomic<std::uint64_t> _framesDispatched{ 0u };
+	mutable std::atomic<std::uint64_t> _framesIgnored{ 0u };
+	mutable std::atomic<std::uint64_t> _adpduSent{ 0u };
+	mutable std::atomic<std::uint64_t> _aecpduSent{ 0u };
+	mutable std::atomic<std::uint64_t> _acmpduSent{ 0u };
+	mutable std::atomic<std::uint64_t> _bytesSent{ 0u };
+	std::thread _replayThread{};
+};
+
+ProtocolInterfacePcapReplay::ProtocolInterfacePcapReplay(std::string const& captureFilePath, networkInterface::MacAddress const& macAddress, std::string const& executorName)
+	: ProtocolInterface(captureFilePath, macAddress, executorName)
+{
+}
+
+bool ProtocolInterfacePcapReplay::isSupported() noexcept
+{
+	try
+	{
+		PcapInterface pcapLibrary{};
+
+		return pcapLibrary.is_available();
+	}
+	catch (...)
+	{
+		return false;
+	}
+}
+
+ProtocolInterfacePcapReplay* ProtocolInterfacePcapReplay::createRawProtocolInterfacePcapReplay(std::string const& captureFilePath, networkInterface::MacAddress const& macAddress, std::string const& executorName, ReplayMode const replayMode)
+{
+	return new ProtocolInterfacePcapReplayImpl(captureFilePath, macAddress, executorName, replayMode);
+}
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,106 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_pcapReplay.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/protocolInterface.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+/**
+* @brief ProtocolInterface replaying a capture file.
+* @details Reads a .pcap/.pcapng capture file (through the pcap library) and feeds its AVDECC frames to the protocol stack
+*          as if they were received from the network, so a captured traffic burst can be reproduced (and profiled) offline.
+*          Nothing is ever sent on the network: the messages the stack would have sent are only counted (see #getStatistics).
+*/
+class ProtocolInterfacePcapReplay : public ProtocolInterface
+{
+public:
+	enum class ReplayMode
+	{
+		OriginalTiming = 0, /**< Frames are dispatched respecting the delays between them, as recorded in the capture file */
+		AsFastAsPossible = 1, /**< Frames are dispatched without any delay (the number of frames read ahead of the dispatch being bounded) */
+	};
+
+	struct Statistics
+	{
+		std::uint64_t framesRead{ 0u }; /**< Number of frames read from the capture file */
+		std::uint64_t framesDispatched{ 0u }; /**< Number of AVDECC frames dispatched to the protocol stack */
+		std::uint64_t framesIgnored{ 0u }; /**< Number of frames ignored (not AVDECC, or truncated) */
+		std::uint64_t adpduSent{ 0u }; /**< Number of ADPDUs the protocol stack would have sent */
+		std::uint64_t aecpduSent{ 0u }; /**< Number of AECPDUs the protocol stack would have sent */
+		std::uint64_t acmpduSent{ 0u }; /**< Number of ACMPDUs the protocol stack would have sent */
+		std::uint64_t bytesSent{ 0u }; /**< Number of bytes the protocol stack would have sent (full ethernet frames) */
+	};
+
+	/** Maximum number of frames read from the capture file and not yet dispatched to the protocol stack (the replay waits for the stack to catch up) */
+	static constexpr auto MaxFramesInFlight = std::uint32_t{ 256u };
+
+	/**
+	* @brief Factory method to create a new ProtocolInterfacePcapReplay.
+	* @details Creates a new ProtocolInterfacePcapReplay as a raw pointer. The replay does not start until #startReplay is called.
+	* @param[in] captureFilePath The path of the capture file to replay (also used as the ID of the network interface).
+	* @param[in] macAddress The MAC address associated with the interface. Cannot be all 0.
+	* @param[in] executorName The name of the executor to use to dispatch incoming messages.
+	* @param[in] replayMode The timing to use when replaying the frames.
+	* @return A new ProtocolInterfacePcapReplay as a raw pointer.
+	* @note Throws Exception if #captureFilePath cannot be opened or is not an ethernet capture.
+	*/
+	static ProtocolInterfacePcapReplay* createRawProtocolInterfacePcapReplay(std::string const& captureFilePath, networkInterface::MacAddress const& macAddress, std::string const& executorName, ReplayMode const replayMode);
+
+	/** Returns true if this ProtocolInterface is supported (runtime check) */
+	static bool isSupported() noexcept;
+
+	/** Destructor */
+	virtual ~ProtocolInterfacePcapReplay() noexcept = default;
+
+	/** Starts replaying the capture file. Observers and local entities should be registered before calling this method. Returns false if the replay was already started. */
+	virtual bool startReplay() noexcept = 0;
+
+	/** Waits for all the frames of the capture file to be processed by the protocol stack. Returns false if the replay is still running after #timeout. */
+	virtual bool waitForReplayCompleted(std::chrono::milliseconds const timeout) const noexcept = 0;
+
+	/** Returns the replay statistics */
+	virtual Statistics getStatistics() const noexcept = 0;
+
+	// Deleted compiler auto-generated methods
+	ProtocolInterfacePcapReplay(ProtocolInterfacePcapReplay&&) = delete;
+	ProtocolInterfacePcapReplay(ProtocolInterfacePcapReplay const&) = delete;
+	ProtocolInterfacePcapReplay& operator=(ProtocolInterfacePcapReplay const&) = delete;
+	ProtocolInterfacePcapReplay& operator=(ProtocolInterfacePcapReplay&&) = delete;
+
+protected:
+	ProtocolInterfacePcapReplay(std::string const& captureFilePath, networkInterface::MacAddress const& macAddress, std::string const& executorName);
+};
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -38,7 +38,8 @@
 #include <stdexcept>
 #include <thread>
 #include <condition_variable>
-#include <list>
+#include <vector>
+#include <algorithm>
 #include <mutex>
 #include <memory>
 #include <functional>
@@ -78,17 +79,146 @@ namespace avdecc
 {
 namespace protocol
 {
+/** Immutable ethernet frame, shared (without copy) by all the observers of a virtual interface */
+class VirtualFrame final
+{
+public:
+	using SharedPointer = std::shared_ptr<VirtualFrame const>;
+
+	/** Transport error frame */
+	VirtualFrame() noexcept = default;
+
+	/** Frame built from a serialized ethernet frame. The EtherLayer2 header is parsed once for all observers. */
+	VirtualFrame(SerializationBuffer const& buffer)
+		: _buffer{ buffer.data(), buffer.size() }
+	{
+		if (_buffer.size() > EtherLayer2::HeaderLength)
+		{
+			auto des = DeserializationBuffer(_buffer);
+			deserialize<EtherLayer2>(&_etherLayer2, des);
+
+			// Check ether type and AVTP control bit (meaning AVDECC packet)
+			auto const etherType = AVDECC_UNPACK_TYPE(*((std::uint16_t*)(_buffer.data() + 12)), std::uint16_t);
+			_isAvdecc = etherType == AvtpEtherType && (_buffer.data()[EtherLayer2::HeaderLength] & 0xF0) != 0;
+		}
+	}
+
+	bool isTransportError() const noexcept
+	{
+		return _buffer.empty();
+	}
+
+	bool isAvdecc() const noexcept
+	{
+		return _isAvdecc;
+	}
+
+	EtherLayer2 const& getEtherLayer2() const noexcept
+	{
+		return _etherLayer2;
+	}
+
+	std::uint8_t const* getAvtpdu() const noexcept
+	{
+		return _buffer.data() + EtherLayer2::HeaderLength;
+	}
+
+	size_t getAvtpduSize() const noexcept
+	{
+		return _buffer.size() - EtherLayer2::HeaderLength;
+	}
+
+	/** Pre-parsed ADPDU attached by the sender, if any */
+	Adpdu const* getAdpdu() const noexcept
+	{
+		return _adpdu.get();
+	}
+
+	/** Pre-parsed ACMPDU attached by the sender, if any */
+	Acmpdu const* getAcmpdu() const noexcept
+	{
+		return _acmpdu.get();
+	}
+
+	void setAdpdu(Adpdu::UniquePointer&& adpdu) noexcept
+	{
+		_adpdu = std::move(adpdu);
+	}
+
+	void setAcmpdu(Acmpdu::UniquePointer&& acmpdu) noexcept
+	{
+		_acmpdu = std::move(acmpdu);
+	}
+
+	// Deleted compiler auto-generated methods
+	VirtualFrame(VirtualFrame&&) = delete;
+	VirtualFrame(VirtualFrame const&) = delete;
+	VirtualFrame& operator=(VirtualFrame const&) = delete;
+	VirtualFrame& operator=(VirtualFrame&&) = delete;
+
+private:
+	MemoryBuffer _buffer{};
+	EtherLayer2 _etherLayer2{};
+	bool _isAvdecc{ false };
+	Adpdu::UniquePointer _adpdu{ nullptr, nullptr };
+	Acmpdu::UniquePointer _acmpdu{ nullptr, nullptr };
+};
+
+/** Ring of shared frames. Capacity is a power of 2 that only grows, so the steady state doesn't allocate. */
+class FrameRing final
+{
+public:
+	bool empty() const noexcept
+	{
+		return _count == 0u;
+	}
+
+	void push(VirtualFrame::SharedPointer&& frame)
+	{
+		if (_count == _frames.size())
+		{
+			grow();
+		}
+		_frames[(_head + _count) & (_frames.size() - 1u)] = std::move(frame);
+		++_count;
+	}
+
+	VirtualFrame::SharedPointer pop() noexcept
+	{
+		auto frame = std::move(_frames[_head]);
+		_head = (_head + 1u) & (_frames.size() - 1u);
+		--_count;
+		return frame;
+	}
+
+private:
+	void grow()
+	{
+		auto frames = std::vector<VirtualFrame::SharedPointer>(std::max(MinimumCapacity, _frames.size() * 2u));
+		for (auto i = size_t{ 0u }; i < _count; ++i)
+		{
+			frames[i] = std::move(_frames[(_head + i) & (_frames.size() - 1u)]);
+		}
+		_frames = std::move(frames);
+		_head = 0u;
+	}
+
+	static constexpr auto MinimumCapacity = size_t{ 64u };
+	std::vector<VirtualFrame::SharedPointer> _frames{};
+	size_t _head{ 0u };
+	size_t _count{ 0u };
+};
+
 class MessageDispatcher final
 {
 	using Subject = utils::TypedSubject<struct SubjectTag, std::mutex>;
-	using MessagesList = std::list<SerializationBuffer>;
 	struct Interface
 	{
 		std::atomic_bool shouldTerminate{ false };
 		std::mutex mutex;
 		std::thread dispatchThread{};
 		Subject observers{};
-		MessagesList messages{};
+		FrameRing frames{};
 		std::condition_variable cond{};
 
 		~Interface()
@@ -107,7 +237,7 @@ public:
 	class Observer : public utils::Observer<Subject>
 	{
 	public:
-		virtual void onMessage(SerializationBuffer const& message) noexcept = 0;
+		virtual void onFrame(VirtualFrame::SharedPointer const& frame) noexcept = 0;
 		virtual void onTransportError() noexcept = 0;
 	};
 
@@ -131,39 +261,43 @@ public:
 				[networkInterfaceID, intfc = intfc.get()]()
 				{
 					utils::setCurrentThreadName("avdecc::VirtualInterface." + networkInterfaceID + "::Capture");
+
+					// Declared outside the loop so its capacity is reused (no allocation in steady state)
+					auto framesToSend = std::vector<VirtualFrame::SharedPointer>{};
+
 					while (!intfc->shouldTerminate)
 					{
-						MessagesList messagesToSend{};
-
-						// Wait for one (or more) message to be available (while under the lock), or for shouldTerminate to be set
+						// Wait for one (or more) frame to be available (while under the lock), or for shouldTerminate to be set
 						{
 							std::unique_lock<decltype(intfc->mutex)> lock(intfc->mutex);
 
-							// Wait for message in the queue
+							// Wait for frame in the ring
 							intfc->cond.wait(lock,
 								[intfc]
 								{
-									return intfc->messages.size() > 0 || intfc->shouldTerminate;
+									return !intfc->frames.empty() || intfc->shouldTerminate;
 								});
 
-							// Empty the queue
-							while (!intfc->shouldTerminate && intfc->messages.size() > 0)
+							// Empty the ring
+							while (!intfc->shouldTerminate && !intfc->frames.empty())
 							{
-								// Pop a message from the queue
-								messagesToSend.push_back(std::move(intfc->messages.front()));
-								intfc->messages.pop_front();
+								// Pop a frame from the ring
+								framesToSend.push_back(intfc->frames.pop());
 
 								SEND_INSTRUMENTATION_NOTIFICATION("ProtocolInterfaceVirtual::onMessage::PostLock");
 							}
 						}
 
-						// Now we can send messages without locking
-						while (!intfc->shouldTerminate && messagesToSend.size() > 0)
+						// Now we can send frames without locking (all observers share the same immutable frame)
+						for (auto const& frame : framesToSend)
 						{
-							auto const& message = messagesToSend.front();
+							if (intfc->shouldTerminate)
+							{
+								break;
+							}
 
 							// Transport error
-							if (message.size() == 0)
+							if (frame->isTransportError())
 							{
 								intfc->observers.notifyObservers<Observer>(
 									[](auto* obs)
@@ -176,12 +310,12 @@ public:
 
 							// Notify registered observers
 							intfc->observers.notifyObservers<Observer>(
-								[&message](auto* obs)
+								[&frame](auto* obs)
 								{
-									obs->onMessage(message);
+									obs->onFrame(frame);
 								});
-							messagesToSend.pop_front();
 						}
+						framesToSend.clear();
 					}
 				});
 			auto result = _interfaces.emplace(std::make_pair(networkInterfaceID, std::move(intfc)));
@@ -229,7 +363,7 @@ public:
 		}
 	}
 
-	void push(std::string const& networkInterfaceID, SerializationBuffer message)
+	void push(std::string const& networkInterfaceID, VirtualFrame::SharedPointer&& frame)
 	{
 		std::lock_guard<decltype(_mutex)> const lg(_mutex);
 
@@ -239,12 +373,12 @@ public:
 		if (interfaceIt == _interfaces.end())
 			return;
 
-		// Add message to the queue
+		// Add frame to the ring
 		auto& intfc = *interfaceIt->second;
 
 		UNIQUE_LOCK(intfc.mutex, std::chrono::milliseconds(10), 100);
 
-		intfc.messages.push_back(std::move(message));
+		intfc.frames.push(std::move(frame));
 
 		// Notify the dispatch thread
 		intfc.cond.notify_all();
@@ -308,6 +442,8 @@ private:
 	virtual Error discoverRemoteEntity(UniqueIdentifier const entityID) const noexcept override;
 	virtual Error forgetRemoteEntity(UniqueIdentifier const entityID) const noexcept override;
 	virtual Error setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) const noexcept override;
+	virtual Error setAecpCongestionControlParameters(AecpCongestionControlParameters const& parameters) const noexcept override;
+	virtual Error getAecpCongestionControlStatistics(UniqueIdentifier const targetEntityID, AecpCongestionControlStatistics& statistics) const noexcept override;
 	virtual bool isDirectMessageSupported() const noexcept override;
 	virtual Error sendAdpMessage(Adpdu const& adpdu) const noexcept override;
 	virtual Error sendAecpMessage(Aecpdu const& aecpdu) const noexcept override;
@@ -324,6 +460,7 @@ private:
 	/* ProtocolInterfaceVirtual overrides                           */
 	/* ************************************************************ */
 	virtual void forceTransportError() const noexcept override;
+	virtual void setPreParsedPduDelivery(bool const enabled) noexcept override;
 
 	/* ************************************************************ */
 	/* stateMachine::ProtocolInterfaceDelegate overrides            */
@@ -363,7 +500,7 @@ private:
 	/* ************************************************************ */
 	/* MessageDispatcher::Observer overrides                        */
 	/* ************************************************************ */
-	virtual void onMessage(SerializationBuffer const& message) noexcept override;
+	virtual void onFrame(VirtualFrame::SharedPointer const& frame) noexcept override;
 	virtual void onTransportError() noexcept override;
 
 	/* ************************************************************ */
@@ -376,8 +513,10 @@ private:
 	/* ************************************************************ */
 	void processRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept;
 	Error sendPacket(SerializationBuffer const& buffer) const noexcept;
+	Error sendFrame(std::shared_ptr<VirtualFrame>&& frame) const noexcept;
 
 	// Private variables
+	std::atomic_bool _preParsedPduDelivery{ false };
 	mutable stateMachine::Manager _stateMachineManager{ this, this, this, this, this };
 	friend class EthernetPacketDispatcher<ProtocolInterfaceVirtualImpl>;
 	EthernetPacketDispatcher<ProtocolInterfaceVirtualImpl> _ethernetPacketDispatcher{ this, _stateMachineManager };
@@ -521,6 +660,16 @@ ProtocolInterface::Error ProtocolInterfaceVirtualImpl::setAutomaticDiscoveryDela
 	return _stateMachineManager.setAutomaticDiscoveryDelay(delay);
 }
 
+ProtocolInterface::Error ProtocolInterfaceVirtualImpl::setAecpCongestionControlParameters(AecpCongestionControlParameters const& parameters) const noexcept
+{
+	return _stateMachineManager.setAecpCongestionControlParameters(parameters);
+}
+
+ProtocolInterface::Error ProtocolInterfaceVirtualImpl::getAecpCongestionControlStatistics(UniqueIdentifier const targetEntityID, AecpCongestionControlStatistics& statistics) const noexcept
+{
+	return _stateMachineManager.getAecpCongestionControlStatistics(targetEntityID, statistics);
+}
+
 bool ProtocolInterfaceVirtualImpl::isDirectMessageSupported() const noexcept
 {
 	return true;
@@ -632,7 +781,12 @@ bool ProtocolInterfaceVirtualImpl::isSelfLocked() const noexcept
 /* ************************************************************ */
 void ProtocolInterfaceVirtualImpl::forceTransportError() const noexcept
 {
-	sendPacket({});
+	sendFrame(std::make_shared<VirtualFrame>());
+}
+
+void ProtocolInterfaceVirtualImpl::setPreParsedPduDelivery(bool const enabled) noexcept
+{
+	_preParsedPduDelivery = enabled;
 }
 
 /* ************************************************************ */
@@ -670,6 +824,14 @@ ProtocolInterface::Error ProtocolInterfaceVirtualImpl::sendMessage(Adpdu const&
 		// Then with Adp
 		serialize<Adpdu>(adpdu, buffer);
 
+		// Attach the already parsed PDU, so that the receivers don't have to deserialize it
+		if (_preParsedPduDelivery)
+		{
+			auto frame = std::make_shared<VirtualFrame>(buffer);
+			frame->setAdpdu(adpdu.copy());
+			return sendFrame(std::move(frame));
+		}
+
 		// Send the message
 		return sendPacket(buffer);
 	}
@@ -718,6 +880,14 @@ ProtocolInterface::Error ProtocolInterfaceVirtualImpl::sendMessage(Acmpdu const&
 		// Then with Acmp
 		serialize<Acmpdu>(acmpdu, buffer);
 
+		// Attach the already parsed PDU, so that the receivers don't have to deserialize it
+		if (_preParsedPduDelivery)
+		{
+			auto frame = std::make_shared<VirtualFrame>(buffer);
+			frame->setAcmpdu(acmpdu.copy());
+			return sendFrame(std::move(frame));
+		}
+
 		// Send the message
 		return sendPacket(buffer);
 	}
@@ -824,10 +994,33 @@ void ProtocolInterfaceVirtualImpl::onAecpResponseTime(UniqueIdentifier const& en
 /* ************************************************************ */
 /* MessageDispatcher::Observer overrides                        */
 /* ************************************************************ */
-void ProtocolInterfaceVirtualImpl::onMessage(SerializationBuffer const& message) noexcept
+void ProtocolInterfaceVirtualImpl::onFrame(VirtualFrame::SharedPointer const& frame) noexcept
 {
-	auto msg = la::avdecc::MemoryBuffer{ message.data(), message.size() };
-	processRawPacket(std::move(msg));
+	// Only accept message for my MacAddress or the broadcast address (using the EtherLayer2 header parsed once by the sender)
+	auto const& destAddress = frame->getEtherLayer2().getDestAddress();
+	if (!frame->isAvdecc() || (destAddress != getMacAddress() && destAddress != Multicast_Mac_Address && destAddress != Identify_Mac_Address))
+	{
+		return;
+	}
+
+	// Share the frame with the executor (no copy)
+	la::avdecc::ExecutorManager::getInstance().pushJob(getExecutorName(),
+		[this, frame]()
+		{
+			// Pre-parsed PDUs can be directly dispatched
+			if (auto const* const adpdu = frame->getAdpdu())
+			{
+				_ethernetPacketDispatcher.dispatchAdpdu(*adpdu);
+			}
+			else if (auto const* const acmpdu = frame->getAcmpdu())
+			{
+				_ethernetPacketDispatcher.dispatchAcmpdu(*acmpdu);
+			}
+			else
+			{
+				_ethernetPacketDispatcher.dispatchAvdeccMessage(frame->getAvtpdu(), frame->getAvtpduSize(), frame->getEtherLayer2());
+			}
+		});
 }
 void ProtocolInterfaceVirtualImpl::onTransportError() noexcept
 {
@@ -923,9 +1116,22 @@ ProtocolInterface::Error ProtocolInterfaceVirtualImpl::sendPacket(SerializationB
 
 	try
 	{
-		// Push the buffer to the message dispatcher
+		// Copy the buffer once, it will be shared by all the observers
+		return sendFrame(std::make_shared<VirtualFrame>(buffer));
+	}
+	catch (...)
+	{
+	}
+	return Error::TransportError;
+}
+
+ProtocolInterface::Error ProtocolInterfaceVirtualImpl::sendFrame(std::shared_ptr<VirtualFrame>&& frame) const noexcept
+{
+	try
+	{
+		// Push the frame to the message dispatcher
 		auto& dispatcher = MessageDispatcher::getInstance();
-		dispatcher.push(_networkInterfaceID, buffer);
+		dispatcher.push(_networkInterfaceID, std::move(frame));
 		return Error::NoError;
 	}
 	catch (...)
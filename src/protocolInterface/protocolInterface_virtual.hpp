@@ -55,6 +55,15 @@ public:
 	/** Force a transport error on the interface */
 	virtual void forceTransportError() const noexcept = 0;
 
+	/**
+	* @brief Enables the delivery of pre-parsed PDUs.
+	* @details When enabled, ADP and ACMP messages sent by this interface are attached (already parsed) to the frame shared with
+	*          all the other virtual interfaces, which directly dispatch them instead of deserializing the frame again.
+	*          Useful to keep large simulated networks cheap. Disabled by default.
+	* @param[in] enabled True to enable pre-parsed PDUs delivery.
+	*/
+	virtual void setPreParsedPduDelivery(bool const enabled) noexcept = 0;
+
 	// Deleted compiler auto-generated methods
 	ProtocolInterfaceVirtual(ProtocolInterfaceVirtual&&) = delete;
 	ProtocolInterfaceVirtual(ProtocolInterfaceVirtual const&) = delete;
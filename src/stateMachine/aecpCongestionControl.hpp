@@ -0,0 +1,155 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file aecpCongestionControl.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/protocolInterface.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+namespace stateMachine
+{
+/**
+* @brief Adaptive congestion control of the AECP commands sent to a target entity.
+* @details The window of inflight commands follows an AIMD scheme (additive increase of 1 per round trip on success, halved on timeout)
+*          and the retransmission timeout is computed from the response times as described in RFC 6298 (with exponential backoff on timeout),
+*          replacing the fixed AECP command timeout of IEEE1722.1-2013 Clause 9.2.1.
+*          Both are clamped to the bounds of the parameters, which are passed to each call so they can be changed at any time.
+*          Not thread-safe, the caller is responsible for locking.
+*/
+class AecpCongestionControl final
+{
+public:
+	using Parameters = ProtocolInterface::AecpCongestionControlParameters;
+	using Statistics = ProtocolInterface::AecpCongestionControlStatistics;
+	using Duration = std::chrono::microseconds;
+	using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+	/** Returns true if the parameters are consistent */
+	static constexpr bool isValid(Parameters const& parameters) noexcept
+	{
+		return parameters.minInflightCommands >= 1u && parameters.minInflightCommands <= parameters.initialInflightCommands && parameters.initialInflightCommands <= parameters.maxInflightCommands && parameters.minTimeout.count() > 0 && parameters.minTimeout <= parameters.maxTimeout;
+	}
+
+	/** Returns the maximum number of commands that can currently be inflight */
+	std::size_t getMaxInflightCommands(Parameters const& parameters) const noexcept
+	{
+		return static_cast<std::size_t>(getWindow(parameters));
+	}
+
+	/** Returns the current retransmission timeout */
+	std::chrono::milliseconds getTimeout(Parameters const& parameters) const noexcept
+	{
+		return std::clamp(std::chrono::ceil<std::chrono::milliseconds>(_timeout), parameters.minTimeout, parameters.maxTimeout);
+	}
+
+	/** Called when a response has been received. The response time must only be specified if it is a valid sample (Karn's algorithm: not for a retried command). */
+	void onResponse(Parameters const& parameters, std::optional<Duration> const responseTime) noexcept
+	{
+		// Additive increase: +1 for a whole window of responses
+		auto const window = getWindow(parameters);
+		_window = std::min(window + 1.0 / window, static_cast<double>(parameters.maxInflightCommands));
+
+		if (responseTime)
+		{
+			auto const sample = *responseTime;
+			if (!_hasResponseTimeSample)
+			{
+				// First measurement (RFC 6298 - 2.2)
+				_hasResponseTimeSample = true;
+				_smoothedResponseTime = sample;
+				_responseTimeVariation = sample / 2;
+			}
+			else
+			{
+				// Subsequent measurements (RFC 6298 - 2.3), with alpha = 1/8 and beta = 1/4
+				auto const delta = _smoothedResponseTime > sample ? _smoothedResponseTime - sample : sample - _smoothedResponseTime;
+				_responseTimeVariation = (_responseTimeVariation * 3 + delta) / 4;
+				_smoothedResponseTime = (_smoothedResponseTime * 7 + sample) / 8;
+			}
+			// Clock granularity is 1 msec
+			_timeout = _smoothedResponseTime + std::max<Duration>(std::chrono::milliseconds{ 1u }, _responseTimeVariation * 4);
+		}
+		_timeout = clampTimeout(parameters, _timeout);
+	}
+
+	/** Called when a command timed out. All the commands sent during the same round trip are considered part of the same congestion event, so the window is only decreased and the timer only backed off once for them. */
+	void onTimeout(Parameters const& parameters, TimePoint const& now) noexcept
+	{
+		if (now >= _nextDecreaseTime)
+		{
+			// Multiplicative decrease
+			_window = std::max(getWindow(parameters) / 2.0, static_cast<double>(parameters.minInflightCommands));
+
+			// Back off the timer (RFC 6298 - 5.5)
+			_timeout = clampTimeout(parameters, getTimeout(parameters) * 2);
+
+			// Timeouts of the commands sent before now belong to this congestion event
+			_nextDecreaseTime = now + getTimeout(parameters);
+		}
+	}
+
+	/** Returns the current state */
+	Statistics getStatistics(Parameters const& parameters) const noexcept
+	{
+		auto statistics = Statistics{};
+		statistics.inflightWindow = getWindow(parameters);
+		statistics.smoothedResponseTime = _smoothedResponseTime;
+		statistics.responseTimeVariation = _responseTimeVariation;
+		statistics.timeout = getTimeout(parameters);
+		return statistics;
+	}
+
+private:
+	double getWindow(Parameters const& parameters) const noexcept
+	{
+		return std::clamp(_window.value_or(static_cast<double>(parameters.initialInflightCommands)), static_cast<double>(parameters.minInflightCommands), static_cast<double>(parameters.maxInflightCommands));
+	}
+
+	static Duration clampTimeout(Parameters const& parameters, Duration const timeout) noexcept
+	{
+		return std::clamp<Duration>(timeout, parameters.minTimeout, parameters.maxTimeout);
+	}
+
+	std::optional<double> _window{ std::nullopt }; // Not set until the first response or timeout (so the initial window follows the parameters)
+	bool _hasResponseTimeSample{ false };
+	Duration _smoothedResponseTime{ 0u };
+	Duration _responseTimeVariation{ 0u };
+	Duration _timeout{ 0u }; // Clamped to the parameters when read, so the initial value is the minimum timeout
+	TimePoint _nextDecreaseTime{};
+};
+
+} // namespace stateMachine
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
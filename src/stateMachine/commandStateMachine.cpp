@@ -29,6 +29,7 @@
 #include "stateMachineManager.hpp"
 #include "logHelper.hpp"
 
+#include <array>
 #include <utility>
 #include <optional>
 
@@ -40,9 +41,6 @@ namespace protocol
 {
 namespace stateMachine
 {
-/* Aecp commands timeout - IEEE1722.1-2013 Clause 9.2.1 */
-static constexpr auto AecpAemCommandTimeoutMsec = 250u;
-static constexpr auto AecpAaCommandTimeoutMsec = 250u;
 /* Acmp commands timeout - IEEE1722.1-2013 Clause 8.2.2 */
 static constexpr auto AcmpConnectTxCommandTimeoutMsec = 2000u;
 static constexpr auto AcmpDisconnectTxCommandTimeoutMsec = 200u;
@@ -52,13 +50,40 @@ static constexpr auto AcmpDisconnectRxCommandTimeoutMsec = 500u;
 static constexpr auto AcmpGetRxStateCommandTimeoutMsec = 200u;
 static constexpr auto AcmpGetTxConnectionCommandTimeoutMsec = 200u;
 
-/* Default state machine parameters */
-static constexpr size_t DefaultMaxAecpInflightCommands = 10;
+/* Default state machine parameters (the number of AECP inflight commands is adapted by the congestion control) */
 static constexpr std::chrono::milliseconds DefaultAecpSendInterval{ 1u };
 static constexpr size_t DefaultMaxAcmpMulticastInflightCommands = 10;
 static constexpr size_t DefaultMaxAcmpUnicastInflightCommands = 10;
 static constexpr std::chrono::milliseconds DefaultAcmpMulticastSendInterval{ 1u };
 static constexpr std::chrono::milliseconds DefaultAcmpUnicastSendInterval{ 1u };
+/* Maximum time a queued AECP command can be delayed by commands of higher priority, before being sent in priority (indexed by AecpCommandPriority) */
+static constexpr std::array<std::chrono::milliseconds, CommandStateMachine::AecpCommandPrioritiesCount> AecpCommandStarvationDelays{ std::chrono::milliseconds{ 0u }, std::chrono::milliseconds{ 250u }, std::chrono::milliseconds{ 1000u } };
+
+/** Returns true if all the sub-commands of the specified GET_DYNAMIC_INFO command are GET_COUNTERS (IEEE1722.1-2021 Clause 7.4.76.1) */
+static bool isCountersOnlyDynamicInfoCommand(AemAecpdu const& aem) noexcept
+{
+	static constexpr auto SubCommandHeaderSize = size_t{ 8u }; // specific_command_length (2), reserved (2), status (1), reserved (1), command_type (2)
+
+	auto const [payload, payloadLength] = aem.getPayload();
+	auto const* const data = static_cast<std::uint8_t const*>(payload);
+	if (data == nullptr || payloadLength == 0u)
+	{
+		return false;
+	}
+
+	auto offset = size_t{ 0u };
+	while (offset + SubCommandHeaderSize <= payloadLength)
+	{
+		auto const specificCommandLength = static_cast<size_t>((data[offset] << 8) | data[offset + 1]);
+		auto const commandType = static_cast<AemCommandType::value_type>((data[offset + 6] << 8) | data[offset + 7]);
+		if (commandType != AemCommandType::GetCounters.getValue())
+		{
+			return false;
+		}
+		offset += SubCommandHeaderSize + specificCommandLength;
+	}
+	return offset == payloadLength;
+}
 
 /* ************************************************************ */
 /* Public methods                                               */
@@ -142,7 +167,10 @@ void CommandStateMachine::checkInflightCommandsTimeoutExpiracy() noexcept
 				if (now > command.timeoutTime)
 				{
 					auto error = ProtocolInterface::Error::NoError;
-					// Timeout expired, check if we retried yet
+					// Timeout expired, reduce the window and back off the timer
+					inflight.congestionControl.onTimeout(_aecpCongestionControlParameters, now);
+
+					// Check if we retried yet
 					if (!command.retried)
 					{
 						// Let's retry
@@ -155,7 +183,7 @@ void CommandStateMachine::checkInflightCommandsTimeoutExpiracy() noexcept
 						error = protocolInterface->sendMessage(static_cast<Aecpdu const&>(*command.command));
 
 						// Reset command timeout
-						resetAecpCommandTimeoutValue(command);
+						resetAecpCommandTimeoutValue(inflight, command);
 
 						// Statistics
 						utils::invokeProtectedMethod(&Delegate::onAecpRetry, _delegate, targetEntityID);
@@ -311,10 +339,15 @@ void CommandStateMachine::handleAecpResponse(Aecpdu const& aecpdu) noexcept
 					// Check for special cases where we should re-arm the timer
 					if (shouldRearmTimer(aecpdu))
 					{
-						resetAecpCommandTimeoutValue(info);
+						info.rearmed = true;
+						resetAecpCommandTimeoutValue(inflight, info);
 						return;
 					}
 
+					// Update the congestion control before the queue is checked (only using the response time of commands that were neither retried nor re-armed, as their response cannot be matched to a specific send)
+					auto const responseTime = std::chrono::duration_cast<AecpCongestionControl::Duration>(now - info.sendTime);
+					inflight.congestionControl.onResponse(_aecpCongestionControlParameters, (info.retried || info.rearmed) ? std::nullopt : std::make_optional(responseTime));
+
 					// Move the query (it will be deleted)
 					AecpCommandInfo aecpQuery = std::move(info);
 
@@ -414,8 +447,10 @@ ProtocolInterface::Error CommandStateMachine::sendAecpCommand(Aecpdu::UniquePoin
 		{
 			auto& inflight = commandEntityInfo.inflightAecpCommands[targetEntityID];
 
-			// Add the command to the queue (to send directly, in case there is something waiting in the queue)
-			commandEntityInfo.aecpCommandsQueue[targetEntityID].queuedCommands.push_back(std::move(command));
+			// Add the command to the queue matching its priority (to send directly, in case there is something waiting in the queue)
+			auto const priority = getAecpCommandPriority(*command.command);
+			command.queueTime = std::chrono::steady_clock::now();
+			commandEntityInfo.aecpCommandsQueue[targetEntityID].queuedCommands[static_cast<size_t>(priority)].push_back(std::move(command));
 
 			// Check the queue
 			checkQueue(protocolInterface, commandEntityInfo, targetEntityID, inflight, inflight.inflightCommands.end());
@@ -469,9 +504,123 @@ ProtocolInterface::Error CommandStateMachine::sendAcmpCommand(Acmpdu::UniquePoin
 	return ProtocolInterface::Error::NoError;
 }
 
+ProtocolInterface::Error CommandStateMachine::setAecpCongestionControlParameters(ProtocolInterface::AecpCongestionControlParameters const& parameters) noexcept
+{
+	if (!AecpCongestionControl::isValid(parameters))
+	{
+		return ProtocolInterface::Error::InvalidParameters;
+	}
+
+	// Lock
+	auto const lg = std::lock_guard{ *_manager };
+
+	// The congestion control of each target entity reads the parameters on each call, new bounds are immediately applied
+	_aecpCongestionControlParameters = parameters;
+
+	return ProtocolInterface::Error::NoError;
+}
+
+ProtocolInterface::Error CommandStateMachine::getAecpCongestionControlStatistics(UniqueIdentifier const& targetEntityID, ProtocolInterface::AecpCongestionControlStatistics& statistics) const noexcept
+{
+	// Lock
+	auto const lg = std::lock_guard{ *_manager };
+
+	// Return the state of the first local entity that sent commands to the target entity
+	for (auto const& [entityID, localEntityInfo] : _commandEntities)
+	{
+		if (auto const inflightIt = localEntityInfo.inflightAecpCommands.find(targetEntityID); inflightIt != localEntityInfo.inflightAecpCommands.end())
+		{
+			statistics = inflightIt->second.congestionControl.getStatistics(_aecpCongestionControlParameters);
+			return ProtocolInterface::Error::NoError;
+		}
+	}
+
+	return ProtocolInterface::Error::UnknownRemoteEntity;
+}
+
+CommandStateMachine::AecpCommandPriority CommandStateMachine::getAecpCommandPriority(Aecpdu const& aecpdu) noexcept
+{
+	// Only AEM commands are used to read the entity (other message types are always user initiated)
+	if (aecpdu.getMessageType() != AecpMessageType::AemCommand)
+	{
+		return AecpCommandPriority::Interactive;
+	}
+
+	// Priorities directly indexed by the AEM command type (all command types are lower than 0x80, defaulting to Interactive)
+	static auto const s_AemCommandPriorities = []()
+	{
+		auto priorities = std::array<AecpCommandPriority, 0x80>{};
+		priorities[AemCommandType::ReadDescriptor.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetConfiguration.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetStreamFormat.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetStreamInfo.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetName.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetAssociationID.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetSamplingRate.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetClockSource.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetControl.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::RegisterUnsolicitedNotification.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetAvbInfo.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetAsPath.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetAudioMap.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetMemoryObjectLength.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetDynamicInfo.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetMaxTransitTime.getValue()] = AecpCommandPriority::Enumeration;
+		priorities[AemCommandType::GetCounters.getValue()] = AecpCommandPriority::Background;
+		return priorities;
+	}();
+
+	auto const& aem = static_cast<AemAecpdu const&>(aecpdu);
+	auto const commandType = aem.getCommandType();
+	auto const commandTypeValue = static_cast<std::size_t>(commandType.getValue());
+	if (commandTypeValue >= s_AemCommandPriorities.size())
+	{
+		return AecpCommandPriority::Interactive;
+	}
+
+	// GET_DYNAMIC_INFO is used both by the enumeration and by the counters polling, the latter only querying counters
+	if (commandType == AemCommandType::GetDynamicInfo && isCountersOnlyDynamicInfoCommand(aem))
+	{
+		return AecpCommandPriority::Background;
+	}
+
+	return s_AemCommandPriorities[commandTypeValue];
+}
+
 /* ************************************************************ */
 /* Private methods                                              */
 /* ************************************************************ */
+std::list<CommandStateMachine::AecpCommandInfo>* CommandStateMachine::getNextAecpQueue(QueuedAecpInfo& queuedInfo, std::chrono::time_point<std::chrono::steady_clock> const& currentTime) noexcept
+{
+	auto* highestQueue = static_cast<std::list<AecpCommandInfo>*>(nullptr);
+	auto* starvedQueue = static_cast<std::list<AecpCommandInfo>*>(nullptr);
+
+	for (auto priority = size_t{ 0u }; priority < AecpCommandPrioritiesCount; ++priority)
+	{
+		auto& queue = queuedInfo.queuedCommands[priority];
+		if (queue.empty())
+		{
+			continue;
+		}
+
+		// Highest priority non-empty queue
+		if (highestQueue == nullptr)
+		{
+			highestQueue = &queue;
+			continue;
+		}
+
+		// Lower priority queue, check if its oldest command has been waiting for too long (serving the oldest starved command first)
+		auto const& queueTime = queue.front().queueTime;
+		if (hasExpired(currentTime, queueTime, AecpCommandStarvationDelays[priority]) && (starvedQueue == nullptr || queueTime < starvedQueue->front().queueTime))
+		{
+			starvedQueue = &queue;
+		}
+	}
+
+	return starvedQueue != nullptr ? starvedQueue : highestQueue;
+}
+
 bool CommandStateMachine::isAEMUnsolicitedResponse(Aecpdu const& aecpdu) const noexcept
 {
 	auto const messageType = aecpdu.getMessageType();
@@ -503,7 +652,7 @@ bool CommandStateMachine::shouldRearmTimer(Aecpdu const& aecpdu) const noexcept
 	return false;
 }
 
-void CommandStateMachine::resetAecpCommandTimeoutValue(AecpCommandInfo& command) const noexcept
+void CommandStateMachine::resetAecpCommandTimeoutValue(InflightAecpInfo const& inflight, AecpCommandInfo& command) const noexcept
 {
 	auto const messageType = command.command->getMessageType();
 	auto timeout = std::uint32_t{ 250u };
@@ -519,15 +668,10 @@ void CommandStateMachine::resetAecpCommandTimeoutValue(AecpCommandInfo& command)
 	}
 	else
 	{
-		static std::unordered_map<AecpMessageType, std::uint32_t, AecpMessageType::Hash> s_AecpCommandTimeoutMap{
-			{ AecpMessageType::AemCommand, AecpAemCommandTimeoutMsec },
-			{ AecpMessageType::AddressAccessCommand, AecpAaCommandTimeoutMsec },
-		};
-
-		auto const it = s_AecpCommandTimeoutMap.find(messageType);
-		if (AVDECC_ASSERT_WITH_RET(it != s_AecpCommandTimeoutMap.end(), "Timeout for AECP message not defined!"))
+		// AEM and AA commands use the adaptive retransmission timeout (the standard timeout being its default lower bound)
+		if (AVDECC_ASSERT_WITH_RET(messageType == AecpMessageType::AemCommand || messageType == AecpMessageType::AddressAccessCommand, "Timeout for AECP message not defined!"))
 		{
-			timeout = it->second;
+			timeout = static_cast<std::uint32_t>(inflight.congestionControl.getTimeout(_aecpCongestionControlParameters).count());
 		}
 	}
 
@@ -537,21 +681,25 @@ void CommandStateMachine::resetAecpCommandTimeoutValue(AecpCommandInfo& command)
 
 void CommandStateMachine::resetAcmpCommandTimeoutValue(AcmpCommandInfo& command) const noexcept
 {
-	static std::unordered_map<AcmpMessageType, std::uint32_t, AcmpMessageType::Hash> s_AcmpCommandTimeoutMap{
-		{ AcmpMessageType::ConnectTxCommand, AcmpConnectTxCommandTimeoutMsec },
-		{ AcmpMessageType::DisconnectTxCommand, AcmpDisconnectTxCommandTimeoutMsec },
-		{ AcmpMessageType::GetTxStateCommand, AcmpGetTxStateCommandTimeoutMsec },
-		{ AcmpMessageType::ConnectRxCommand, AcmpConnectRxCommandTimeoutMsec },
-		{ AcmpMessageType::DisconnectRxCommand, AcmpDisconnectRxCommandTimeoutMsec },
-		{ AcmpMessageType::GetRxStateCommand, AcmpGetRxStateCommandTimeoutMsec },
-		{ AcmpMessageType::GetTxConnectionCommand, AcmpGetTxConnectionCommandTimeoutMsec },
-	};
+	// Timeouts directly indexed by the ACMP message type (all message types are lower than 0x10, 0 meaning not a command)
+	static auto const s_AcmpCommandTimeouts = []()
+	{
+		auto timeouts = std::array<std::uint32_t, 0x10>{};
+		timeouts[AcmpMessageType::ConnectTxCommand.getValue()] = AcmpConnectTxCommandTimeoutMsec;
+		timeouts[AcmpMessageType::DisconnectTxCommand.getValue()] = AcmpDisconnectTxCommandTimeoutMsec;
+		timeouts[AcmpMessageType::GetTxStateCommand.getValue()] = AcmpGetTxStateCommandTimeoutMsec;
+		timeouts[AcmpMessageType::ConnectRxCommand.getValue()] = AcmpConnectRxCommandTimeoutMsec;
+		timeouts[AcmpMessageType::DisconnectRxCommand.getValue()] = AcmpDisconnectRxCommandTimeoutMsec;
+		timeouts[AcmpMessageType::GetRxStateCommand.getValue()] = AcmpGetRxStateCommandTimeoutMsec;
+		timeouts[AcmpMessageType::GetTxConnectionCommand.getValue()] = AcmpGetTxConnectionCommandTimeoutMsec;
+		return timeouts;
+	}();
 
 	std::uint32_t timeout{ 250u };
-	auto const it = s_AcmpCommandTimeoutMap.find(command.command->getMessageType());
-	if (AVDECC_ASSERT_WITH_RET(it != s_AcmpCommandTimeoutMap.end(), "Timeout for ACMP message not defined!"))
+	auto const messageType = static_cast<std::size_t>(command.command->getMessageType().getValue());
+	if (AVDECC_ASSERT_WITH_RET(messageType < s_AcmpCommandTimeouts.size() && s_AcmpCommandTimeouts[messageType] != 0u, "Timeout for ACMP message not defined!"))
 	{
-		timeout = it->second;
+		timeout = s_AcmpCommandTimeouts[messageType];
 	}
 
 	command.sendTime = std::chrono::steady_clock::now();
@@ -572,9 +720,9 @@ AcmpSequenceID CommandStateMachine::getNextAcmpSequenceID(CommandEntityInfo& inf
 	return nextID;
 }
 
-size_t CommandStateMachine::getMaxInflightAecpMessages(UniqueIdentifier const& /*entityID*/) const noexcept
+size_t CommandStateMachine::getMaxInflightAecpMessages(InflightAecpInfo const& inflight) const noexcept
 {
-	return DefaultMaxAecpInflightCommands;
+	return inflight.congestionControl.getMaxInflightCommands(_aecpCongestionControlParameters);
 }
 
 std::chrono::milliseconds CommandStateMachine::getAecpSendInterval(UniqueIdentifier const& /*entityID*/) const noexcept
@@ -27,8 +27,11 @@
 #include "la/avdecc/internals/entity.hpp"
 
 #include "protocolInterfaceDelegate.hpp"
+#include "aecpCongestionControl.hpp"
 
+#include <array>
 #include <chrono>
+#include <list>
 #include <unordered_map>
 
 namespace la
@@ -70,15 +73,31 @@ public:
 	void handleAcmpResponse(Acmpdu const& acmpdu) noexcept;
 	ProtocolInterface::Error sendAecpCommand(Aecpdu::UniquePointer&& aecpdu, ProtocolInterface::AecpCommandResultHandler const& onResult) noexcept;
 	ProtocolInterface::Error sendAcmpCommand(Acmpdu::UniquePointer&& acmpdu, ProtocolInterface::AcmpCommandResultHandler const& onResult) noexcept;
+	ProtocolInterface::Error setAecpCongestionControlParameters(ProtocolInterface::AecpCongestionControlParameters const& parameters) noexcept;
+	ProtocolInterface::Error getAecpCongestionControlStatistics(UniqueIdentifier const& targetEntityID, ProtocolInterface::AecpCongestionControlStatistics& statistics) const noexcept;
+
+	/** Priority classes of AECP commands. For a given target entity, queued commands of a higher priority class are sent first (lower classes being protected from starvation). */
+	enum class AecpCommandPriority : std::uint8_t
+	{
+		Interactive = 0, /**< Commands changing the state of the entity, or not used by the enumeration (user initiated) */
+		Enumeration = 1, /**< Commands reading the state or the model of the entity */
+		Background = 2, /**< Commands periodically refreshing the state of the entity (GET_COUNTERS, and GET_DYNAMIC_INFO only querying counters) */
+	};
+	static constexpr auto AecpCommandPrioritiesCount = size_t{ 3u };
+
+	/** Returns the priority class of the specified AECP command */
+	static AecpCommandPriority getAecpCommandPriority(Aecpdu const& aecpdu) noexcept;
 
 private:
 	// Private types
 	struct AecpCommandInfo
 	{
 		AecpSequenceID sequenceID{ 0 };
+		std::chrono::time_point<std::chrono::steady_clock> queueTime{};
 		std::chrono::time_point<std::chrono::steady_clock> sendTime{};
 		std::chrono::time_point<std::chrono::steady_clock> timeoutTime{};
 		bool retried{ false };
+		bool rearmed{ false }; // Timer re-armed by an IN_PROGRESS response, the response time is no longer a valid sample
 		Aecpdu::UniquePointer command{ nullptr, nullptr };
 		ProtocolInterface::AecpCommandResultHandler resultHandler{};
 
@@ -94,10 +113,11 @@ private:
 	{
 		std::chrono::time_point<std::chrono::steady_clock> lastSendTime{};
 		std::list<AecpCommandInfo> inflightCommands{};
+		AecpCongestionControl congestionControl{};
 	};
 	struct QueuedAecpInfo
 	{
-		std::list<AecpCommandInfo> queuedCommands{};
+		std::array<std::list<AecpCommandInfo>, AecpCommandPrioritiesCount> queuedCommands{}; // One FIFO per AecpCommandPriority
 	};
 	using InflightAecpCommands = std::unordered_map<UniqueIdentifier, InflightAecpInfo, UniqueIdentifier::hash>;
 	using AecpCommandsQueue = std::unordered_map<UniqueIdentifier, QueuedAecpInfo, UniqueIdentifier::hash>;
@@ -183,7 +203,7 @@ private:
 		else
 		{
 			// Move the command to inflight queue
-			resetAecpCommandTimeoutValue(command);
+			resetAecpCommandTimeoutValue(inflight, command);
 			return inflight.inflightCommands.insert(it, std::move(command));
 		}
 	}
@@ -194,21 +214,21 @@ private:
 		auto const now = std::chrono::steady_clock::now();
 
 		// Check if we don't have too many inflight commands or sending too fast for this destination macAddress
-		if (inflight.inflightCommands.size() >= getMaxInflightAecpMessages(entityID) || !hasExpired(now, inflight.lastSendTime, getAecpSendInterval(entityID)))
+		if (inflight.inflightCommands.size() >= getMaxInflightAecpMessages(inflight) || !hasExpired(now, inflight.lastSendTime, getAecpSendInterval(entityID)))
 		{
 			return it;
 		}
 
-		// Check if queue is not empty for this entity
-		auto& queue = info.aecpCommandsQueue[entityID].queuedCommands;
-		if (queue.empty())
+		// Get the next queue to process for this entity (if any)
+		auto* const queue = getNextAecpQueue(info.aecpCommandsQueue[entityID], now);
+		if (queue == nullptr)
 		{
 			return it;
 		}
 
 		// Remove command from queue
-		auto command = std::move(queue.front());
-		queue.pop_front();
+		auto command = std::move(queue->front());
+		queue->pop_front();
 
 		return setCommandInflight(protocolInterface, info, inflight, it, std::move(command));
 	}
@@ -272,13 +292,14 @@ private:
 		return checkQueue(protocolInterface, info, macAddress, inflight, retIt);
 	}
 
+	std::list<AecpCommandInfo>* getNextAecpQueue(QueuedAecpInfo& queuedInfo, std::chrono::time_point<std::chrono::steady_clock> const& currentTime) noexcept;
 	bool isAEMUnsolicitedResponse(Aecpdu const& aecpdu) const noexcept;
 	bool shouldRearmTimer(Aecpdu const& aecpdu) const noexcept;
-	void resetAecpCommandTimeoutValue(AecpCommandInfo& command) const noexcept;
+	void resetAecpCommandTimeoutValue(InflightAecpInfo const& inflight, AecpCommandInfo& command) const noexcept;
 	void resetAcmpCommandTimeoutValue(AcmpCommandInfo& command) const noexcept;
 	AecpSequenceID getNextAecpSequenceID(CommandEntityInfo& info) noexcept;
 	AcmpSequenceID getNextAcmpSequenceID(CommandEntityInfo& info) noexcept;
-	size_t getMaxInflightAecpMessages(UniqueIdentifier const& entityID) const noexcept;
+	size_t getMaxInflightAecpMessages(InflightAecpInfo const& inflight) const noexcept;
 	std::chrono::milliseconds getAecpSendInterval(UniqueIdentifier const& entityID) const noexcept;
 	size_t getMaxInflightAcmpMessages(networkInterface::MacAddress const& macAddress) const noexcept;
 	std::chrono::milliseconds getAcmpSendInterval(networkInterface::MacAddress const& macAddress) const noexcept;
@@ -287,6 +308,7 @@ private:
 	Manager* _manager{ nullptr };
 	Delegate* _delegate{ nullptr };
 	CommandEntities _commandEntities{};
+	ProtocolInterface::AecpCongestionControlParameters _aecpCongestionControlParameters{};
 };
 
 } // namespace stateMachine
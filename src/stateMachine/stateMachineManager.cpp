@@ -27,6 +27,7 @@
 
 #include "stateMachineManager.hpp"
 #include "logHelper.hpp"
+#include "dispatchTable.hpp"
 
 // Only enable instrumentation in static library and in debug (for unit testing mainly)
 #if defined(DEBUG) && defined(la_avdecc_static_STATICS)
@@ -336,7 +337,8 @@ void Manager::processAdpdu(Adpdu const& adpdu) noexcept
 {
 	// Dispatching and handling of ADP messages is done on this layer
 
-	static auto const s_Dispatch = std::unordered_map<AdpMessageType::value_type, std::function<void(Manager* const manager, Adpdu const& adpdu)>>{
+	using Handler = void (*)(Manager* const manager, Adpdu const& adpdu);
+	static auto const s_Dispatch = utils::DispatchTable<AdpMessageType::value_type, Handler, 0x04>{
 		// Entity Available
 		{ AdpMessageType::EntityAvailable.getValue(),
 			[](Manager* const manager, Adpdu const& adpdu)
@@ -358,10 +360,10 @@ void Manager::processAdpdu(Adpdu const& adpdu) noexcept
 	};
 
 	auto const messageType = adpdu.getMessageType().getValue();
-	auto const& it = s_Dispatch.find(messageType);
-	if (it != s_Dispatch.end())
+	auto const handler = s_Dispatch.find(messageType);
+	if (handler != nullptr)
 	{
-		utils::invokeProtectedHandler(it->second, this, adpdu);
+		utils::invokeProtectedHandler(handler, this, adpdu);
 	}
 }
 
@@ -564,6 +566,16 @@ ProtocolInterface::Error Manager::sendAcmpCommand(Acmpdu::UniquePointer&& acmpdu
 	return _commandStateMachine.sendAcmpCommand(std::move(acmpdu), onResult);
 }
 
+ProtocolInterface::Error Manager::setAecpCongestionControlParameters(ProtocolInterface::AecpCongestionControlParameters const& parameters) noexcept
+{
+	return _commandStateMachine.setAecpCongestionControlParameters(parameters);
+}
+
+ProtocolInterface::Error Manager::getAecpCongestionControlStatistics(UniqueIdentifier const targetEntityID, ProtocolInterface::AecpCongestionControlStatistics& statistics) const noexcept
+{
+	return _commandStateMachine.getAecpCongestionControlStatistics(targetEntityID, statistics);
+}
+
 /* ************************************************************ */
 /* Private methods                                              */
 /* ************************************************************ */
@@ -106,6 +106,8 @@ public:
 	/* ************************************************************ */
 	ProtocolInterface::Error sendAecpCommand(Aecpdu::UniquePointer&& aecpdu, ProtocolInterface::AecpCommandResultHandler const& onResult) noexcept;
 	ProtocolInterface::Error sendAcmpCommand(Acmpdu::UniquePointer&& acmpdu, ProtocolInterface::AcmpCommandResultHandler const& onResult) noexcept;
+	ProtocolInterface::Error setAecpCongestionControlParameters(ProtocolInterface::AecpCongestionControlParameters const& parameters) noexcept;
+	ProtocolInterface::Error getAecpCongestionControlStatistics(UniqueIdentifier const targetEntityID, ProtocolInterface::AecpCongestionControlStatistics& statistics) const noexcept;
 
 private:
 	/* ************************************************************ */
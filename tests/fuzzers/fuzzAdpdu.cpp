@@ -0,0 +1,45 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file fuzzAdpdu.cpp
+* @author Christophe Calmejane
+* @brief Fuzzer for the ADPDU deserializer (deserialize<Adpdu>).
+*/
+
+#include "fuzzerUtils.hpp"
+
+// Public API
+#include <la/avdecc/internals/protocolAdpdu.hpp>
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, size_t size)
+{
+	auto const [avtpdu, avtpduSize] = fuzzer::getAvtpdu(data, size);
+
+	fuzzer::runProtected(
+		[avtpdu = avtpdu, avtpduSize = avtpduSize]()
+		{
+			auto des = la::avdecc::protocol::DeserializationBuffer{ avtpdu, avtpduSize };
+			auto adpdu = la::avdecc::protocol::Adpdu{};
+			la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(&adpdu, des);
+			la::avdecc::protocol::deserialize<la::avdecc::protocol::Adpdu>(&adpdu, des);
+		});
+
+	return 0;
+}
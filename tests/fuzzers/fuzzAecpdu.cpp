@@ -0,0 +1,89 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file fuzzAecpdu.cpp
+* @author Christophe Calmejane
+* @brief Fuzzer for the AECPDU deserializers (deserialize<Aecpdu> for AEM, AA and MVU messages).
+*/
+
+#include "fuzzerUtils.hpp"
+
+// Public API
+#include <la/avdecc/internals/protocolAemAecpdu.hpp>
+#include <la/avdecc/internals/protocolAaAecpdu.hpp>
+#include <la/avdecc/internals/protocolMvuAecpdu.hpp>
+
+#include <cstring>
+
+using la::avdecc::protocol::AecpMessageType;
+
+/** Creates the AECPDU matching the message type (and the ProtocolIdentifier for VendorUnique messages), like the EthernetPacketDispatcher does */
+static la::avdecc::protocol::Aecpdu::UniquePointer createAecpdu(std::uint8_t const* const avtpdu, size_t const avtpduSize) noexcept
+{
+	auto const messageType = AecpMessageType{ static_cast<AecpMessageType::value_type>(avtpdu[1] & 0x7f) };
+
+	if (messageType == AecpMessageType::AemCommand || messageType == AecpMessageType::AemResponse)
+	{
+		return la::avdecc::protocol::AemAecpdu::create(messageType == AecpMessageType::AemResponse);
+	}
+	if (messageType == AecpMessageType::AddressAccessCommand || messageType == AecpMessageType::AddressAccessResponse)
+	{
+		return la::avdecc::protocol::AaAecpdu::create(messageType == AecpMessageType::AddressAccessResponse);
+	}
+	if (messageType == AecpMessageType::VendorUniqueCommand || messageType == AecpMessageType::VendorUniqueResponse)
+	{
+		auto constexpr ProtocolIdentifierOffset = la::avdecc::protocol::AvtpduControl::HeaderLength + la::avdecc::protocol::Aecpdu::HeaderLength;
+		if (avtpduSize >= (ProtocolIdentifierOffset + la::avdecc::protocol::VuAecpdu::ProtocolIdentifier::Size))
+		{
+			auto protocolIdentifier = la::avdecc::protocol::VuAecpdu::ProtocolIdentifier::ArrayType{};
+			std::memcpy(protocolIdentifier.data(), avtpdu + ProtocolIdentifierOffset, la::avdecc::protocol::VuAecpdu::ProtocolIdentifier::Size);
+			if (la::avdecc::protocol::VuAecpdu::ProtocolIdentifier{ protocolIdentifier } == la::avdecc::protocol::MvuAecpdu::ProtocolID)
+			{
+				return la::avdecc::protocol::MvuAecpdu::create(messageType == AecpMessageType::VendorUniqueResponse);
+			}
+		}
+	}
+	return { nullptr, nullptr };
+}
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, size_t size)
+{
+	auto const [avtpdu, avtpduSize] = fuzzer::getAvtpdu(data, size);
+	if (avtpduSize < 2)
+	{
+		return 0;
+	}
+
+	auto aecpdu = createAecpdu(avtpdu, avtpduSize);
+	if (!aecpdu)
+	{
+		return 0;
+	}
+
+	fuzzer::runProtected(
+		[avtpdu = avtpdu, avtpduSize = avtpduSize, &aecpdu]()
+		{
+			auto des = la::avdecc::protocol::DeserializationBuffer{ avtpdu, avtpduSize };
+			la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(aecpdu.get(), des);
+			la::avdecc::protocol::deserialize<la::avdecc::protocol::Aecpdu>(aecpdu.get(), des);
+		});
+
+	return 0;
+}
@@ -0,0 +1,195 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file fuzzAemPayloads.cpp
+* @author Christophe Calmejane
+* @brief Fuzzer for the AEM payloads deserializers (protocol::aemPayload::deserialize*), dispatched on the command type of the AEM AECPDU.
+*/
+
+#include "fuzzerUtils.hpp"
+
+// Public API
+#include <la/avdecc/internals/protocolAemAecpdu.hpp>
+
+// Internal API
+#include "protocol/protocolAemPayloads.hpp"
+#include "dispatchTable.hpp"
+
+namespace aemPayload = la::avdecc::protocol::aemPayload;
+using la::avdecc::protocol::AemAecpdu;
+using la::avdecc::protocol::AemAecpStatus;
+using la::avdecc::protocol::AemCommandType;
+using la::avdecc::entity::LocalEntity;
+using la::avdecc::entity::model::DescriptorType;
+
+using PayloadDeserializer = void (*)(LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload);
+using DescriptorDeserializer = void (*)(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status);
+
+// clang-format off
+#define COMMAND(Name) [](LocalEntity::AemCommandStatus const /*status*/, AemAecpdu::Payload const& payload) { aemPayload::deserialize##Name##Command(payload); }
+#define RESPONSE(Name) [](LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload) { aemPayload::deserialize##Name##Response(status, payload); }
+#define DESCRIPTOR(Name) [](AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status) { aemPayload::deserializeRead##Name##DescriptorResponse(payload, commonSize, status); }
+// clang-format on
+
+static void deserializeReadDescriptorResponse(LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload)
+{
+	static auto const s_Dispatch = la::avdecc::utils::DispatchTable<std::uint16_t, DescriptorDeserializer, 0x30>{
+		{ static_cast<std::uint16_t>(DescriptorType::Entity), DESCRIPTOR(Entity) },
+		{ static_cast<std::uint16_t>(DescriptorType::Configuration), DESCRIPTOR(Configuration) },
+		{ static_cast<std::uint16_t>(DescriptorType::AudioUnit), DESCRIPTOR(AudioUnit) },
+		{ static_cast<std::uint16_t>(DescriptorType::StreamInput), DESCRIPTOR(Stream) },
+		{ static_cast<std::uint16_t>(DescriptorType::StreamOutput), DESCRIPTOR(Stream) },
+		{ static_cast<std::uint16_t>(DescriptorType::JackInput), DESCRIPTOR(Jack) },
+		{ static_cast<std::uint16_t>(DescriptorType::JackOutput), DESCRIPTOR(Jack) },
+		{ static_cast<std::uint16_t>(DescriptorType::AvbInterface), DESCRIPTOR(AvbInterface) },
+		{ static_cast<std::uint16_t>(DescriptorType::ClockSource), DESCRIPTOR(ClockSource) },
+		{ static_cast<std::uint16_t>(DescriptorType::MemoryObject), DESCRIPTOR(MemoryObject) },
+		{ static_cast<std::uint16_t>(DescriptorType::Locale), DESCRIPTOR(Locale) },
+		{ static_cast<std::uint16_t>(DescriptorType::Strings), DESCRIPTOR(Strings) },
+		{ static_cast<std::uint16_t>(DescriptorType::StreamPortInput), DESCRIPTOR(StreamPort) },
+		{ static_cast<std::uint16_t>(DescriptorType::StreamPortOutput), DESCRIPTOR(StreamPort) },
+		{ static_cast<std::uint16_t>(DescriptorType::ExternalPortInput), DESCRIPTOR(ExternalPort) },
+		{ static_cast<std::uint16_t>(DescriptorType::ExternalPortOutput), DESCRIPTOR(ExternalPort) },
+		{ static_cast<std::uint16_t>(DescriptorType::InternalPortInput), DESCRIPTOR(InternalPort) },
+		{ static_cast<std::uint16_t>(DescriptorType::InternalPortOutput), DESCRIPTOR(InternalPort) },
+		{ static_cast<std::uint16_t>(DescriptorType::AudioCluster), DESCRIPTOR(AudioCluster) },
+		{ static_cast<std::uint16_t>(DescriptorType::AudioMap), DESCRIPTOR(AudioMap) },
+		{ static_cast<std::uint16_t>(DescriptorType::Control), DESCRIPTOR(Control) },
+		{ static_cast<std::uint16_t>(DescriptorType::ClockDomain), DESCRIPTOR(ClockDomain) },
+		{ static_cast<std::uint16_t>(DescriptorType::Timing), DESCRIPTOR(Timing) },
+		{ static_cast<std::uint16_t>(DescriptorType::PtpInstance), DESCRIPTOR(PtpInstance) },
+		{ static_cast<std::uint16_t>(DescriptorType::PtpPort), DESCRIPTOR(PtpPort) },
+	};
+
+	auto const [commonSize, configurationIndex, descriptorType, descriptorIndex] = aemPayload::deserializeReadDescriptorCommonResponse(status, payload);
+	if (auto const deserializer = s_Dispatch.find(static_cast<std::uint16_t>(descriptorType)); deserializer != nullptr)
+	{
+		deserializer(payload, commonSize, AemAecpStatus{ static_cast<AemAecpStatus::value_type>(status) });
+	}
+}
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, size_t size)
+{
+	// Indexed by command type (AEM command types are below 0x80)
+	static auto const s_CommandDispatch = la::avdecc::utils::DispatchTable<AemCommandType::value_type, PayloadDeserializer, 0x80>{
+		{ AemCommandType::AcquireEntity.getValue(), COMMAND(AcquireEntity) },
+		{ AemCommandType::LockEntity.getValue(), COMMAND(LockEntity) },
+		{ AemCommandType::ReadDescriptor.getValue(), COMMAND(ReadDescriptor) },
+		{ AemCommandType::SetConfiguration.getValue(), COMMAND(SetConfiguration) },
+		{ AemCommandType::SetStreamFormat.getValue(), COMMAND(SetStreamFormat) },
+		{ AemCommandType::GetStreamFormat.getValue(), COMMAND(GetStreamFormat) },
+		{ AemCommandType::SetStreamInfo.getValue(), COMMAND(SetStreamInfo) },
+		{ AemCommandType::GetStreamInfo.getValue(), COMMAND(GetStreamInfo) },
+		{ AemCommandType::SetName.getValue(), COMMAND(SetName) },
+		{ AemCommandType::GetName.getValue(), COMMAND(GetName) },
+		{ AemCommandType::SetAssociationID.getValue(), COMMAND(SetAssociationID) },
+		{ AemCommandType::SetSamplingRate.getValue(), COMMAND(SetSamplingRate) },
+		{ AemCommandType::GetSamplingRate.getValue(), COMMAND(GetSamplingRate) },
+		{ AemCommandType::SetClockSource.getValue(), COMMAND(SetClockSource) },
+		{ AemCommandType::GetClockSource.getValue(), COMMAND(GetClockSource) },
+		{ AemCommandType::SetControl.getValue(), COMMAND(SetControl) },
+		{ AemCommandType::GetControl.getValue(), COMMAND(GetControl) },
+		{ AemCommandType::StartStreaming.getValue(), COMMAND(StartStreaming) },
+		{ AemCommandType::StopStreaming.getValue(), COMMAND(StopStreaming) },
+		{ AemCommandType::GetAvbInfo.getValue(), COMMAND(GetAvbInfo) },
+		{ AemCommandType::GetAsPath.getValue(), COMMAND(GetAsPath) },
+		{ AemCommandType::GetCounters.getValue(), COMMAND(GetCounters) },
+		{ AemCommandType::Reboot.getValue(), COMMAND(Reboot) },
+		{ AemCommandType::GetAudioMap.getValue(), COMMAND(GetAudioMap) },
+		{ AemCommandType::AddAudioMappings.getValue(), COMMAND(AddAudioMappings) },
+		{ AemCommandType::RemoveAudioMappings.getValue(), COMMAND(RemoveAudioMappings) },
+		{ AemCommandType::StartOperation.getValue(), COMMAND(StartOperation) },
+		{ AemCommandType::AbortOperation.getValue(), COMMAND(AbortOperation) },
+		{ AemCommandType::SetMemoryObjectLength.getValue(), COMMAND(SetMemoryObjectLength) },
+		{ AemCommandType::GetMemoryObjectLength.getValue(), COMMAND(GetMemoryObjectLength) },
+		{ AemCommandType::GetDynamicInfo.getValue(), COMMAND(GetDynamicInfo) },
+		{ AemCommandType::SetMaxTransitTime.getValue(), COMMAND(SetMaxTransitTime) },
+		{ AemCommandType::GetMaxTransitTime.getValue(), COMMAND(GetMaxTransitTime) },
+	};
+	static auto const s_ResponseDispatch = la::avdecc::utils::DispatchTable<AemCommandType::value_type, PayloadDeserializer, 0x80>{
+		{ AemCommandType::AcquireEntity.getValue(), RESPONSE(AcquireEntity) },
+		{ AemCommandType::LockEntity.getValue(), RESPONSE(LockEntity) },
+		{ AemCommandType::ReadDescriptor.getValue(), deserializeReadDescriptorResponse },
+		{ AemCommandType::SetConfiguration.getValue(), RESPONSE(SetConfiguration) },
+		{ AemCommandType::GetConfiguration.getValue(), RESPONSE(GetConfiguration) },
+		{ AemCommandType::SetStreamFormat.getValue(), RESPONSE(SetStreamFormat) },
+		{ AemCommandType::GetStreamFormat.getValue(), RESPONSE(GetStreamFormat) },
+		{ AemCommandType::SetStreamInfo.getValue(), RESPONSE(SetStreamInfo) },
+		{ AemCommandType::GetStreamInfo.getValue(), RESPONSE(GetStreamInfo) },
+		{ AemCommandType::SetName.getValue(), RESPONSE(SetName) },
+		{ AemCommandType::GetName.getValue(), RESPONSE(GetName) },
+		{ AemCommandType::SetAssociationID.getValue(), RESPONSE(SetAssociationID) },
+		{ AemCommandType::GetAssociationID.getValue(), RESPONSE(GetAssociationID) },
+		{ AemCommandType::SetSamplingRate.getValue(), RESPONSE(SetSamplingRate) },
+		{ AemCommandType::GetSamplingRate.getValue(), RESPONSE(GetSamplingRate) },
+		{ AemCommandType::SetClockSource.getValue(), RESPONSE(SetClockSource) },
+		{ AemCommandType::GetClockSource.getValue(), RESPONSE(GetClockSource) },
+		{ AemCommandType::SetControl.getValue(), RESPONSE(SetControl) },
+		{ AemCommandType::GetControl.getValue(), RESPONSE(GetControl) },
+		{ AemCommandType::StartStreaming.getValue(), RESPONSE(StartStreaming) },
+		{ AemCommandType::StopStreaming.getValue(), RESPONSE(StopStreaming) },
+		{ AemCommandType::GetAvbInfo.getValue(), RESPONSE(GetAvbInfo) },
+		{ AemCommandType::GetAsPath.getValue(), RESPONSE(GetAsPath) },
+		{ AemCommandType::GetCounters.getValue(), RESPONSE(GetCounters) },
+		{ AemCommandType::Reboot.getValue(), RESPONSE(Reboot) },
+		{ AemCommandType::GetAudioMap.getValue(), RESPONSE(GetAudioMap) },
+		{ AemCommandType::AddAudioMappings.getValue(), RESPONSE(AddAudioMappings) },
+		{ AemCommandType::RemoveAudioMappings.getValue(), RESPONSE(RemoveAudioMappings) },
+		{ AemCommandType::StartOperation.getValue(), RESPONSE(StartOperation) },
+		{ AemCommandType::AbortOperation.getValue(), RESPONSE(AbortOperation) },
+		{ AemCommandType::OperationStatus.getValue(), [](LocalEntity::AemCommandStatus const /*status*/, AemAecpdu::Payload const& payload) { aemPayload::deserializeOperationStatusResponse(payload); } },
+		{ AemCommandType::SetMemoryObjectLength.getValue(), RESPONSE(SetMemoryObjectLength) },
+		{ AemCommandType::GetMemoryObjectLength.getValue(), RESPONSE(GetMemoryObjectLength) },
+		{ AemCommandType::GetDynamicInfo.getValue(), RESPONSE(GetDynamicInfo) },
+		{ AemCommandType::SetMaxTransitTime.getValue(), RESPONSE(SetMaxTransitTime) },
+		{ AemCommandType::GetMaxTransitTime.getValue(), RESPONSE(GetMaxTransitTime) },
+	};
+
+	auto const [avtpdu, avtpduSize] = fuzzer::getAvtpdu(data, size);
+	if (avtpduSize < 2)
+	{
+		return 0;
+	}
+
+	// Only AEM messages, AEM specific bit of the message type is the response flag
+	auto const messageType = static_cast<std::uint8_t>(avtpdu[1] & 0x7f);
+	if (messageType != la::avdecc::protocol::AecpMessageType::AemCommand.getValue() && messageType != la::avdecc::protocol::AecpMessageType::AemResponse.getValue())
+	{
+		return 0;
+	}
+	auto const isResponse = messageType == la::avdecc::protocol::AecpMessageType::AemResponse.getValue();
+
+	fuzzer::runProtected(
+		[avtpdu = avtpdu, avtpduSize = avtpduSize, isResponse]()
+		{
+			auto des = la::avdecc::protocol::DeserializationBuffer{ avtpdu, avtpduSize };
+			auto aem = AemAecpdu{ isResponse };
+			la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(&aem, des);
+			la::avdecc::protocol::deserialize<la::avdecc::protocol::Aecpdu>(&aem, des);
+
+			auto const& dispatch = isResponse ? s_ResponseDispatch : s_CommandDispatch;
+			if (auto const deserializer = dispatch.find(aem.getCommandType().getValue()); deserializer != nullptr)
+			{
+				deserializer(static_cast<LocalEntity::AemCommandStatus>(aem.getStatus().getValue()), aem.getPayload());
+			}
+		});
+
+	return 0;
+}
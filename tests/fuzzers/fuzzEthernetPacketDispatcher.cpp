@@ -0,0 +1,63 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file fuzzEthernetPacketDispatcher.cpp
+* @author Christophe Calmejane
+* @brief Fuzzer for the whole receive path (EthernetPacketDispatcher and the state machines), through a ProtocolInterfaceVirtual.
+*/
+
+#include "fuzzerUtils.hpp"
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/memoryBuffer.hpp>
+#include <la/avdecc/internals/protocolAdpdu.hpp>
+
+// Internal API
+#include "protocolInterface/protocolInterface_virtual.hpp"
+
+#include <cstring>
+#include <memory>
+
+static auto constexpr ExecutorName = "avdecc::protocol::PI";
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, size_t size)
+{
+	static auto const s_ExecutorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(ExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(ExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	static auto const s_ProtocolInterface = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("FuzzInterface", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } }, ExecutorName));
+
+	if (size < la::avdecc::protocol::EtherLayer2::HeaderLength)
+	{
+		return 0;
+	}
+
+	// Force the destination address and the EtherType, so the fuzzing effort goes to the AVTPDU instead of the frames filtered out by the interface
+	auto frame = la::avdecc::MemoryBuffer{ data, size };
+	auto const& multicastAddress = la::avdecc::protocol::Adpdu::Multicast_Mac_Address;
+	std::memcpy(frame.data(), multicastAddress.data(), multicastAddress.size());
+	frame.data()[12] = static_cast<std::uint8_t>(la::avdecc::protocol::AvtpEtherType >> 8);
+	frame.data()[13] = static_cast<std::uint8_t>(la::avdecc::protocol::AvtpEtherType & 0xff);
+
+	// The virtual interface dispatches the frame on its executor, wait for it to be processed
+	s_ProtocolInterface->injectRawPacket(std::move(frame));
+	la::avdecc::ExecutorManager::getInstance().flush(ExecutorName);
+
+	return 0;
+}
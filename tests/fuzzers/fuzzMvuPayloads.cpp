@@ -0,0 +1,85 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file fuzzMvuPayloads.cpp
+* @author Christophe Calmejane
+* @brief Fuzzer for the MVU payloads deserializers (protocol::mvuPayload::deserialize*), dispatched on the command type of the MVU AECPDU.
+*/
+
+#include "fuzzerUtils.hpp"
+
+// Public API
+#include <la/avdecc/internals/protocolMvuAecpdu.hpp>
+
+// Internal API
+#include "protocol/protocolMvuPayloads.hpp"
+
+#include <cstring>
+
+using la::avdecc::protocol::AecpMessageType;
+using la::avdecc::protocol::MvuAecpdu;
+using la::avdecc::protocol::MvuCommandType;
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, size_t size)
+{
+	auto const [avtpdu, avtpduSize] = fuzzer::getAvtpdu(data, size);
+
+	// Only MVU messages
+	auto constexpr ProtocolIdentifierOffset = la::avdecc::protocol::AvtpduControl::HeaderLength + la::avdecc::protocol::Aecpdu::HeaderLength;
+	if (avtpduSize < (ProtocolIdentifierOffset + la::avdecc::protocol::VuAecpdu::ProtocolIdentifier::Size))
+	{
+		return 0;
+	}
+	auto const messageType = AecpMessageType{ static_cast<AecpMessageType::value_type>(avtpdu[1] & 0x7f) };
+	if (messageType != AecpMessageType::VendorUniqueCommand && messageType != AecpMessageType::VendorUniqueResponse)
+	{
+		return 0;
+	}
+	auto protocolIdentifier = la::avdecc::protocol::VuAecpdu::ProtocolIdentifier::ArrayType{};
+	std::memcpy(protocolIdentifier.data(), avtpdu + ProtocolIdentifierOffset, la::avdecc::protocol::VuAecpdu::ProtocolIdentifier::Size);
+	if (!(la::avdecc::protocol::VuAecpdu::ProtocolIdentifier{ protocolIdentifier } == MvuAecpdu::ProtocolID))
+	{
+		return 0;
+	}
+	auto const isResponse = messageType == AecpMessageType::VendorUniqueResponse;
+
+	fuzzer::runProtected(
+		[avtpdu = avtpdu, avtpduSize = avtpduSize, isResponse]()
+		{
+			auto des = la::avdecc::protocol::DeserializationBuffer{ avtpdu, avtpduSize };
+			auto mvu = MvuAecpdu{ isResponse };
+			la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(&mvu, des);
+			la::avdecc::protocol::deserialize<la::avdecc::protocol::Aecpdu>(&mvu, des);
+
+			if (mvu.getCommandType() == MvuCommandType::GetMilanInfo)
+			{
+				if (isResponse)
+				{
+					la::avdecc::protocol::mvuPayload::deserializeGetMilanInfoResponse(mvu.getPayload());
+				}
+				else
+				{
+					la::avdecc::protocol::mvuPayload::deserializeGetMilanInfoCommand(mvu.getPayload());
+				}
+			}
+		});
+
+	return 0;
+}
@@ -0,0 +1,75 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file fuzzerMain.cpp
+* @author Christophe Calmejane
+* @brief Standalone driver for the fuzzers, when not built with libFuzzer.
+* @details Runs each file passed on the command line (or each file of the directories passed on the command line) through the fuzzer once,
+*          so the corpus can be replayed as a regression test with any compiler.
+*/
+
+#include "fuzzerUtils.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+static void runFile(std::filesystem::path const& path)
+{
+	auto file = std::ifstream{ path, std::ios::binary };
+	auto const data = std::vector<std::uint8_t>{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+	LLVMFuzzerTestOneInput(data.data(), data.size());
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " <file or directory>..." << std::endl;
+		return 1;
+	}
+
+	auto count = size_t{ 0u };
+	for (auto i = 1; i < argc; ++i)
+	{
+		auto const path = std::filesystem::path{ argv[i] };
+		if (std::filesystem::is_directory(path))
+		{
+			for (auto const& entry : std::filesystem::recursive_directory_iterator{ path })
+			{
+				if (entry.is_regular_file())
+				{
+					runFile(entry.path());
+					++count;
+				}
+			}
+		}
+		else
+		{
+			runFile(path);
+			++count;
+		}
+	}
+
+	std::cout << "Executed " << count << " inputs" << std::endl;
+	return 0;
+}
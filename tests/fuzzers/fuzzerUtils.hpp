@@ -0,0 +1,74 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file fuzzerUtils.hpp
+* @author Christophe Calmejane
+* @brief Helpers shared by all the fuzzers.
+* @details All the fuzzers are fed with complete Ethernet frames (EtherLayer2 header included), so a single seed corpus
+*          (generated by FuzzersCorpus, or raw frames exported from a capture) can be used for all of them.
+*          Malformed input is expected to be rejected with a la::avdecc::Exception or a std::invalid_argument (which is what the
+*          library catches when processing a received message), any other exception escapes the fuzzer and is reported as a crash.
+*/
+
+#pragma once
+
+// Public API
+#include <la/avdecc/internals/exception.hpp>
+#include <la/avdecc/internals/protocolAvtpdu.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, size_t size);
+
+namespace fuzzer
+{
+using Avtpdu = std::pair<std::uint8_t const*, size_t>;
+
+/** Returns the AVTPDU part of an Ethernet frame (empty if the frame is too small) */
+inline Avtpdu getAvtpdu(std::uint8_t const* const data, size_t const size) noexcept
+{
+	if (size < la::avdecc::protocol::EtherLayer2::HeaderLength)
+	{
+		return { nullptr, 0u };
+	}
+	return { data + la::avdecc::protocol::EtherLayer2::HeaderLength, size - la::avdecc::protocol::EtherLayer2::HeaderLength };
+}
+
+/** Runs the specified deserialization, ignoring the exceptions thrown for malformed input */
+template<typename Method>
+void runProtected(Method&& method)
+{
+	try
+	{
+		method();
+	}
+	catch (la::avdecc::Exception const&)
+	{
+		// Expected for malformed payloads
+	}
+	catch (std::invalid_argument const&)
+	{
+		// Expected for malformed PDUs (unpacking errors)
+	}
+}
+
+} // namespace fuzzer
@@ -0,0 +1,50 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file generateCorpus.cpp
+* @author Christophe Calmejane
+* @brief Writes the seed corpus of the fuzzers (one raw Ethernet frame per file) to the specified directory.
+*/
+
+#include "sampleFrames.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char* argv[])
+{
+	if (argc != 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " <output directory>" << std::endl;
+		return 1;
+	}
+
+	auto const outputFolder = std::filesystem::path{ argv[1] };
+	std::filesystem::create_directories(outputFolder);
+
+	for (auto const& frame : sampleFrames::buildSampleFrames())
+	{
+		auto file = std::ofstream{ outputFolder / (frame.name + ".bin"), std::ios::binary };
+		file.write(reinterpret_cast<char const*>(frame.data.data()), static_cast<std::streamsize>(frame.data.size()));
+	}
+
+	return 0;
+}
@@ -776,3 +776,63 @@ TEST(AemPayloads, DeserializeReadControlDescriptorResponse_Utf8)
 #	endif // ENABLE_AVDECC_FEATURE_JSON
 
 #endif // _WIN32 || __APPLE__
+
+TEST(AemPayloads, ValidateResponsePayloadSize)
+{
+	auto const buffer = std::array<std::uint8_t, la::avdecc::protocol::aemPayload::AecpAemGetCountersResponsePayloadSize>{};
+	auto const goodPayload = la::avdecc::protocol::AemAecpdu::Payload{ buffer.data(), buffer.size() };
+	auto const badPayload = la::avdecc::protocol::AemAecpdu::Payload{ buffer.data(), buffer.size() / 2u };
+	auto const reflectedPayload = la::avdecc::protocol::AemAecpdu::Payload{ buffer.data(), la::avdecc::protocol::aemPayload::AecpAemGetCountersCommandPayloadSize };
+
+	// Valid payloads
+	EXPECT_TRUE(la::avdecc::protocol::aemPayload::isValidResponsePayloadSize(la::avdecc::protocol::AemCommandType::GetCounters, la::avdecc::entity::LocalEntity::AemCommandStatus::Success, goodPayload));
+	EXPECT_TRUE(la::avdecc::protocol::aemPayload::isValidResponsePayloadSize(la::avdecc::protocol::AemCommandType::GetCounters, la::avdecc::entity::LocalEntity::AemCommandStatus::NotImplemented, reflectedPayload));
+	EXPECT_NO_THROW(la::avdecc::protocol::aemPayload::deserializeGetCountersResponse(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, goodPayload));
+
+	// Invalid payloads, must be rejected by both the validation and the deserialization
+	EXPECT_FALSE(la::avdecc::protocol::aemPayload::isValidResponsePayloadSize(la::avdecc::protocol::AemCommandType::GetCounters, la::avdecc::entity::LocalEntity::AemCommandStatus::Success, badPayload));
+	EXPECT_THROW(la::avdecc::protocol::aemPayload::deserializeGetCountersResponse(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, badPayload), la::avdecc::protocol::aemPayload::IncorrectPayloadSizeException);
+	EXPECT_FALSE(la::avdecc::protocol::aemPayload::isValidResponsePayloadSize(la::avdecc::protocol::AemCommandType::GetCounters, la::avdecc::entity::LocalEntity::AemCommandStatus::NotImplemented, goodPayload));
+	EXPECT_FALSE(la::avdecc::protocol::aemPayload::isValidResponsePayloadSize(la::avdecc::protocol::AemCommandType::GetCounters, la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemAecpdu::Payload{ nullptr, buffer.size() }));
+	EXPECT_FALSE(la::avdecc::protocol::aemPayload::isValidResponsePayloadSize(la::avdecc::protocol::AemCommandType::OperationStatus, la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemAecpdu::Payload{ buffer.data(), la::avdecc::protocol::aemPayload::AecpAemOperationStatusResponsePayloadSize - 1u }));
+
+	// Unknown command type cannot be validated
+	EXPECT_TRUE(la::avdecc::protocol::aemPayload::isValidResponsePayloadSize(la::avdecc::protocol::AemCommandType::InvalidCommandType, la::avdecc::entity::LocalEntity::AemCommandStatus::Success, badPayload));
+}
+
+TEST(AemPayloads, UnpackDynamicControlValues)
+{
+	using DynamicValues = la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<double>>;
+
+	auto ser = la::avdecc::Serializer<la::avdecc::protocol::AemAecpdu::MaximumPayloadBufferLength>{};
+	ser << double{ 1.5 };
+	auto const packedValues = la::avdecc::MemoryBuffer{ ser.data(), ser.usedBytes() };
+
+	// Single linear value is stored inline
+	auto const values = la::avdecc::entity::model::unpackDynamicControlValues(packedValues, la::avdecc::entity::model::ControlValueType::Type::ControlLinearDouble, 1u);
+	ASSERT_TRUE(values.has_value());
+	ASSERT_TRUE(values->isValid());
+	ASSERT_EQ(1u, values->size());
+	auto const& dynamicValues = values->getValues<DynamicValues>();
+	EXPECT_TRUE(dynamicValues.getValues().isInline());
+	EXPECT_EQ(1.5, dynamicValues.getValues()[0].currentValue);
+	EXPECT_EQ(&dynamicValues, &values->getValues<DynamicValues>()); // No copy is made
+	EXPECT_THROW(values->getValues<la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<float>>>(), std::invalid_argument);
+
+	// Copy and move
+	auto copy = *values;
+	EXPECT_TRUE(copy.isEqualTo<DynamicValues>(*values));
+	auto moved = std::move(copy);
+	EXPECT_TRUE(moved.isEqualTo<DynamicValues>(*values));
+	EXPECT_FALSE(copy.isValid());
+
+	// Heap stored values
+	auto utf8 = la::avdecc::entity::model::UTF8StringValueDynamic{};
+	utf8.currentValue[0] = 'A';
+	auto const utf8Values = la::avdecc::entity::model::ControlValues{ utf8 };
+	auto utf8Copy = utf8Values;
+	EXPECT_TRUE(utf8Copy.isEqualTo<la::avdecc::entity::model::UTF8StringValueDynamic>(utf8Values));
+	utf8Copy = moved;
+	EXPECT_TRUE(utf8Copy.isEqualTo<DynamicValues>(*values));
+	EXPECT_EQ(std::uint8_t{ 'A' }, utf8Values.getValues<la::avdecc::entity::model::UTF8StringValueDynamic>().currentValue[0]);
+}
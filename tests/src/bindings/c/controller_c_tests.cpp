@@ -0,0 +1,142 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controller_c_tests.cpp
+* @author Christophe Calmejane
+*/
+
+// Public API (C bindings only)
+#include <la/avdecc/controller/avdeccController.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr auto ControllerExecutorName = "avdecc::c::tests::controller";
+constexpr auto SenderExecutorName = "avdecc::c::tests::sender";
+constexpr auto EntityID = avdecc_unique_identifier_t{ 0x0102030405060708 };
+
+static std::vector<avdecc_controller_event_t> s_receivedEvents{};
+
+void LA_AVDECC_BINDINGS_C_CALL_CONVENTION onEvents(LA_AVDECC_CONTROLLER_HANDLE const /*handle*/, avdecc_controller_event_cp const events, size_t const eventsCount)
+{
+	s_receivedEvents.insert(s_receivedEvents.end(), events, events + eventsCount);
+}
+
+avdecc_controller_error_t getEntityStatus(LA_AVDECC_CONTROLLER_HANDLE const handle) noexcept
+{
+	LA_AVDECC_CONTROLLED_ENTITY_GUARD_HANDLE guardHandle{ nullptr };
+	auto const error = LA_AVDECC_Controller_getControlledEntityGuard(handle, EntityID, &guardHandle);
+	if (error == avdecc_controller_error_no_error)
+	{
+		LA_AVDECC_ControlledEntityGuard_release(guardHandle);
+	}
+	return error;
+}
+
+bool waitForEntityStatus(LA_AVDECC_CONTROLLER_HANDLE const handle, avdecc_controller_error_t const expectedStatus) noexcept
+{
+	auto const timeout = std::chrono::steady_clock::now() + std::chrono::seconds{ 10 };
+	while (getEntityStatus(handle) != expectedStatus)
+	{
+		if (std::chrono::steady_clock::now() > timeout)
+		{
+			return false;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+	}
+	return true;
+}
+} // namespace
+
+TEST(ControllerC, EventsLost)
+{
+	LA_AVDECC_initialize();
+
+	LA_AVDECC_EXECUTOR_WRAPPER_HANDLE controllerExecutor{ nullptr };
+	LA_AVDECC_EXECUTOR_WRAPPER_HANDLE senderExecutor{ nullptr };
+	ASSERT_EQ(avdecc_executor_error_no_error, LA_AVDECC_Executor_createQueueExecutor(ControllerExecutorName, &controllerExecutor));
+	ASSERT_EQ(avdecc_executor_error_no_error, LA_AVDECC_Executor_createQueueExecutor(SenderExecutorName, &senderExecutor));
+
+	LA_AVDECC_CONTROLLER_HANDLE controller{ nullptr };
+	ASSERT_EQ(avdecc_controller_error_no_error, LA_AVDECC_Controller_create(avdecc_protocol_interface_type_virtual, "VirtualInterfaceC", 0x0003, 0u, "en", ControllerExecutorName, &controller));
+	LA_AVDECC_PROTOCOL_INTERFACE_HANDLE sender{ nullptr };
+	ASSERT_EQ(avdecc_protocol_interface_error_no_error, LA_AVDECC_ProtocolInterface_create(avdecc_protocol_interface_type_virtual, "VirtualInterfaceC", SenderExecutorName, &sender));
+
+	// Advertise an entity without AEM support (online without enumeration)
+	auto adpdu = avdecc_protocol_adpdu_t{};
+	LA_AVDECC_ProtocolInterface_getMacAddress(sender, &adpdu.src_address);
+	auto const* const multicastAddress = LA_AVDECC_Protocol_Adpdu_getMulticastMacAddress();
+	std::copy(std::begin(*multicastAddress), std::end(*multicastAddress), std::begin(adpdu.dest_address));
+	adpdu.message_type = avdecc_protocol_adp_message_type_entity_available;
+	adpdu.valid_time = 31u;
+	adpdu.entity_id = EntityID;
+	adpdu.association_id = LA_AVDECC_getNullUniqueIdentifier();
+	adpdu.gptp_grandmaster_id = LA_AVDECC_getNullUniqueIdentifier();
+	ASSERT_EQ(avdecc_protocol_interface_error_no_error, LA_AVDECC_ProtocolInterface_sendAdpMessage(sender, &adpdu));
+	ASSERT_TRUE(waitForEntityStatus(controller, avdecc_controller_error_no_error));
+
+	// Change the entity capabilities more times than the pending events queue can hold, without dispatching
+	auto constexpr ChangesCount = 20000u;
+	for (auto i = 0u; i < ChangesCount; ++i)
+	{
+		++adpdu.available_index;
+		adpdu.entity_capabilities = (i % 2u) == 0u ? avdecc_entity_entity_capabilities_class_a_supported : avdecc_entity_entity_capabilities_none;
+		ASSERT_EQ(avdecc_protocol_interface_error_no_error, LA_AVDECC_ProtocolInterface_sendAdpMessage(sender, &adpdu));
+	}
+
+	// Depart the entity, messages are processed in order so all changes have been processed once the entity is offline
+	adpdu.message_type = avdecc_protocol_adp_message_type_entity_departing;
+	ASSERT_EQ(avdecc_protocol_interface_error_no_error, LA_AVDECC_ProtocolInterface_sendAdpMessage(sender, &adpdu));
+	ASSERT_TRUE(waitForEntityStatus(controller, avdecc_controller_error_unknown_entity));
+
+	// Drain the queue: the kept events are delivered in order, followed by a single events_lost event
+	s_receivedEvents.clear();
+	EXPECT_EQ(avdecc_controller_error_no_error, LA_AVDECC_Controller_dispatchEvents(controller, &onEvents));
+	ASSERT_LT(2u, s_receivedEvents.size());
+	EXPECT_GT(ChangesCount, s_receivedEvents.size());
+	EXPECT_EQ(avdecc_controller_event_type_entity_online, s_receivedEvents.front().event_type);
+	EXPECT_EQ(EntityID, s_receivedEvents.front().entity_id);
+	EXPECT_EQ(avdecc_controller_event_type_entity_capabilities_changed, s_receivedEvents[1].event_type);
+	EXPECT_EQ(avdecc_controller_event_type_events_lost, s_receivedEvents.back().event_type);
+	EXPECT_EQ(1, std::count_if(s_receivedEvents.begin(), s_receivedEvents.end(),
+									[](auto const& event)
+									{
+										return event.event_type == avdecc_controller_event_type_events_lost;
+									}));
+
+	// Queue is empty once drained, and the events lost notification is not repeated
+	s_receivedEvents.clear();
+	EXPECT_EQ(avdecc_controller_error_no_error, LA_AVDECC_Controller_dispatchEvents(controller, &onEvents));
+	EXPECT_TRUE(s_receivedEvents.empty());
+
+	EXPECT_EQ(avdecc_protocol_interface_error_no_error, LA_AVDECC_ProtocolInterface_destroy(sender));
+	EXPECT_EQ(avdecc_controller_error_no_error, LA_AVDECC_Controller_destroy(controller));
+	EXPECT_EQ(avdecc_executor_error_no_error, LA_AVDECC_Executor_destroy(senderExecutor));
+	EXPECT_EQ(avdecc_executor_error_no_error, LA_AVDECC_Executor_destroy(controllerExecutor));
+
+	LA_AVDECC_uninitialize();
+}
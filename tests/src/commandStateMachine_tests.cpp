@@ -22,7 +22,308 @@
 * @author Christophe Calmejane
 */
 
+// Public API
+#include <la/avdecc/internals/protocolAemAecpdu.hpp>
+
 // Internal API
+#include "stateMachine/aecpCongestionControl.hpp"
 #include "stateMachine/commandStateMachine.hpp"
+#include "stateMachine/stateMachineManager.hpp"
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+static auto const ControllerEntityID = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+static auto const TargetEntityID = la::avdecc::UniqueIdentifier{ 0x0001000000000002 };
+
+/** Records the AEM commands sent on the network (always failing, so commands are not kept inflight) */
+class RecordingDelegate final : public la::avdecc::protocol::stateMachine::ProtocolInterfaceDelegate, public la::avdecc::protocol::stateMachine::CommandStateMachine::Delegate
+{
+public:
+	std::vector<la::avdecc::protocol::AemCommandType> const& getSentCommands() const noexcept
+	{
+		return _sentCommands;
+	}
+
+private:
+	// la::avdecc::protocol::stateMachine::ProtocolInterfaceDelegate overrides
+	virtual void onAecpCommand(la::avdecc::protocol::Aecpdu const& /*aecpdu*/) noexcept override {}
+	virtual void onAcmpCommand(la::avdecc::protocol::Acmpdu const& /*acmpdu*/) noexcept override {}
+	virtual void onAcmpResponse(la::avdecc::protocol::Acmpdu const& /*acmpdu*/) noexcept override {}
+	virtual la::avdecc::protocol::ProtocolInterface::Error sendMessage(la::avdecc::protocol::Adpdu const& /*adpdu*/) const noexcept override
+	{
+		return la::avdecc::protocol::ProtocolInterface::Error::TransportError;
+	}
+	virtual la::avdecc::protocol::ProtocolInterface::Error sendMessage(la::avdecc::protocol::Aecpdu const& aecpdu) const noexcept override
+	{
+		_sentCommands.push_back(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu).getCommandType());
+		return la::avdecc::protocol::ProtocolInterface::Error::TransportError;
+	}
+	virtual la::avdecc::protocol::ProtocolInterface::Error sendMessage(la::avdecc::protocol::Acmpdu const& /*acmpdu*/) const noexcept override
+	{
+		return la::avdecc::protocol::ProtocolInterface::Error::TransportError;
+	}
+	virtual std::uint32_t getVuAecpCommandTimeoutMsec(la::avdecc::protocol::VuAecpdu::ProtocolIdentifier const& /*protocolIdentifier*/, la::avdecc::protocol::VuAecpdu const& /*aecpdu*/) const noexcept override
+	{
+		return 250u;
+	}
+	// la::avdecc::protocol::stateMachine::CommandStateMachine::Delegate overrides
+	virtual void onAecpAemUnsolicitedResponse(la::avdecc::protocol::AemAecpdu const& /*aecpdu*/) noexcept override {}
+	virtual void onAecpAemIdentifyNotification(la::avdecc::protocol::AemAecpdu const& /*aecpdu*/) noexcept override {}
+	virtual void onAecpRetry(la::avdecc::UniqueIdentifier const& /*entityID*/) noexcept override {}
+	virtual void onAecpTimeout(la::avdecc::UniqueIdentifier const& /*entityID*/) noexcept override {}
+	virtual void onAecpUnexpectedResponse(la::avdecc::UniqueIdentifier const& /*entityID*/) noexcept override {}
+	virtual void onAecpResponseTime(la::avdecc::UniqueIdentifier const& /*entityID*/, std::chrono::milliseconds const& /*responseTime*/) noexcept override {}
+
+	mutable std::vector<la::avdecc::protocol::AemCommandType> _sentCommands{};
+};
+
+class LocalEntity final : public la::avdecc::entity::LocalEntity
+{
+public:
+	LocalEntity()
+		: la::avdecc::entity::LocalEntity{ la::avdecc::entity::Entity::CommonInformation{ ControllerEntityID }, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, la::avdecc::entity::Entity::InterfaceInformation{} } } }
+	{
+	}
+
+private:
+	// la::avdecc::entity::LocalEntity overrides
+	virtual bool enableEntityAdvertising(std::uint32_t const /*availableDuration*/, std::optional<la::avdecc::entity::model::AvbInterfaceIndex> const /*interfaceIndex*/) noexcept override
+	{
+		return false;
+	}
+	virtual void disableEntityAdvertising(std::optional<la::avdecc::entity::model::AvbInterfaceIndex> const /*interfaceIndex*/) noexcept override {}
+	virtual bool discoverRemoteEntities() const noexcept override
+	{
+		return false;
+	}
+	virtual bool discoverRemoteEntity(la::avdecc::UniqueIdentifier const /*entityID*/) const noexcept override
+	{
+		return false;
+	}
+	virtual bool forgetRemoteEntity(la::avdecc::UniqueIdentifier const /*entityID*/) const noexcept override
+	{
+		return false;
+	}
+	virtual void setAutomaticDiscoveryDelay(std::chrono::milliseconds const /*delay*/) noexcept override {}
+	virtual void lock() noexcept override {}
+	virtual void unlock() noexcept override {}
+	virtual bool isSelfLocked() const noexcept override
+	{
+		return true;
+	}
+};
+
+la::avdecc::protocol::Aecpdu::UniquePointer makeAemCommand(la::avdecc::protocol::AemCommandType const commandType)
+{
+	auto frame = la::avdecc::protocol::AemAecpdu::create(false);
+	auto* aem = static_cast<la::avdecc::protocol::AemAecpdu*>(frame.get());
+	aem->setMessageType(la::avdecc::protocol::AecpMessageType::AemCommand);
+	aem->setStatus(la::avdecc::protocol::AecpStatus::Success);
+	aem->setTargetEntityID(TargetEntityID);
+	aem->setControllerEntityID(ControllerEntityID);
+	aem->setUnsolicited(false);
+	aem->setCommandType(commandType);
+	return frame;
+}
+
+} // namespace
+
+TEST(CommandStateMachine, AecpCommandPriority)
+{
+	using Priority = la::avdecc::protocol::stateMachine::CommandStateMachine::AecpCommandPriority;
+
+	EXPECT_EQ(Priority::Enumeration, la::avdecc::protocol::stateMachine::CommandStateMachine::getAecpCommandPriority(*makeAemCommand(la::avdecc::protocol::AemCommandType::ReadDescriptor)));
+	EXPECT_EQ(Priority::Background, la::avdecc::protocol::stateMachine::CommandStateMachine::getAecpCommandPriority(*makeAemCommand(la::avdecc::protocol::AemCommandType::GetCounters)));
+	EXPECT_EQ(Priority::Interactive, la::avdecc::protocol::stateMachine::CommandStateMachine::getAecpCommandPriority(*makeAemCommand(la::avdecc::protocol::AemCommandType::SetControl)));
+	EXPECT_EQ(Priority::Interactive, la::avdecc::protocol::stateMachine::CommandStateMachine::getAecpCommandPriority(*makeAemCommand(la::avdecc::protocol::AemCommandType::AcquireEntity)));
+}
+
+TEST(CommandStateMachine, AecpDynamicInfoCommandPriority)
+{
+	using Priority = la::avdecc::protocol::stateMachine::CommandStateMachine::AecpCommandPriority;
+
+	// Sub-commands: specific_command_length, reserved, status, reserved, command_type, then 4 bytes of descriptor_type/descriptor_index
+	auto const getCounters = std::vector<std::uint8_t>{ 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x05, 0x00, 0x00 };
+	auto const getName = std::vector<std::uint8_t>{ 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00 };
+
+	// Counters polling only queries counters
+	{
+		auto command = makeAemCommand(la::avdecc::protocol::AemCommandType::GetDynamicInfo);
+		auto payload = getCounters;
+		payload.insert(payload.end(), getCounters.begin(), getCounters.end());
+		static_cast<la::avdecc::protocol::AemAecpdu&>(*command).setCommandSpecificData(payload.data(), payload.size());
+		EXPECT_EQ(Priority::Background, la::avdecc::protocol::stateMachine::CommandStateMachine::getAecpCommandPriority(*command));
+	}
+	// Enumeration queries other information
+	{
+		auto command = makeAemCommand(la::avdecc::protocol::AemCommandType::GetDynamicInfo);
+		auto payload = getCounters;
+		payload.insert(payload.end(), getName.begin(), getName.end());
+		static_cast<la::avdecc::protocol::AemAecpdu&>(*command).setCommandSpecificData(payload.data(), payload.size());
+		EXPECT_EQ(Priority::Enumeration, la::avdecc::protocol::stateMachine::CommandStateMachine::getAecpCommandPriority(*command));
+	}
+	// Empty (or malformed) payload
+	EXPECT_EQ(Priority::Enumeration, la::avdecc::protocol::stateMachine::CommandStateMachine::getAecpCommandPriority(*makeAemCommand(la::avdecc::protocol::AemCommandType::GetDynamicInfo)));
+}
+
+TEST(CommandStateMachine, AecpPriorityQueuing)
+{
+	auto delegate = RecordingDelegate{};
+	auto manager = la::avdecc::protocol::stateMachine::Manager{ nullptr, &delegate, nullptr, nullptr, &delegate };
+	auto stateMachine = la::avdecc::protocol::stateMachine::CommandStateMachine{ &manager, &delegate };
+	auto entity = LocalEntity{};
+	stateMachine.registerLocalEntity(entity);
+
+	auto const send = [&stateMachine](la::avdecc::protocol::AemCommandType const commandType)
+	{
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, stateMachine.sendAecpCommand(makeAemCommand(commandType), [](la::avdecc::protocol::Aecpdu const* const /*response*/, la::avdecc::protocol::ProtocolInterface::Error const /*error*/) {}));
+	};
+	auto const processQueue = [&stateMachine]()
+	{
+		// Commands are sent at most every millisecond to a given entity
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 2 });
+		stateMachine.checkInflightCommandsTimeoutExpiracy();
+	};
+
+	// First command is sent directly, others are queued
+	send(la::avdecc::protocol::AemCommandType::GetCounters);
+	send(la::avdecc::protocol::AemCommandType::GetCounters);
+	send(la::avdecc::protocol::AemCommandType::ReadDescriptor);
+	send(la::avdecc::protocol::AemCommandType::ReadDescriptor);
+	send(la::avdecc::protocol::AemCommandType::SetControl);
+	for (auto i = 0u; i < 4u; ++i)
+	{
+		processQueue();
+	}
+
+	auto const expected = std::vector<la::avdecc::protocol::AemCommandType>{ la::avdecc::protocol::AemCommandType::GetCounters, la::avdecc::protocol::AemCommandType::SetControl, la::avdecc::protocol::AemCommandType::ReadDescriptor, la::avdecc::protocol::AemCommandType::ReadDescriptor, la::avdecc::protocol::AemCommandType::GetCounters };
+	EXPECT_EQ(expected, delegate.getSentCommands());
+
+	stateMachine.unregisterLocalEntity(entity);
+}
+
+TEST(CommandStateMachine, AecpStarvationProtection)
+{
+	auto delegate = RecordingDelegate{};
+	auto manager = la::avdecc::protocol::stateMachine::Manager{ nullptr, &delegate, nullptr, nullptr, &delegate };
+	auto stateMachine = la::avdecc::protocol::stateMachine::CommandStateMachine{ &manager, &delegate };
+	auto entity = LocalEntity{};
+	stateMachine.registerLocalEntity(entity);
+
+	auto const send = [&stateMachine](la::avdecc::protocol::AemCommandType const commandType)
+	{
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, stateMachine.sendAecpCommand(makeAemCommand(commandType), [](la::avdecc::protocol::Aecpdu const* const /*response*/, la::avdecc::protocol::ProtocolInterface::Error const /*error*/) {}));
+	};
+
+	// Queue an enumeration command behind a sent one
+	send(la::avdecc::protocol::AemCommandType::ReadDescriptor);
+	send(la::avdecc::protocol::AemCommandType::ReadDescriptor);
+
+	// Let it starve, then queue interactive commands (the starved enumeration command is sent before the interactive ones)
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 300 });
+	send(la::avdecc::protocol::AemCommandType::SetControl);
+	send(la::avdecc::protocol::AemCommandType::SetControl);
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 2 });
+	stateMachine.checkInflightCommandsTimeoutExpiracy();
+
+	auto const expected = std::vector<la::avdecc::protocol::AemCommandType>{ la::avdecc::protocol::AemCommandType::ReadDescriptor, la::avdecc::protocol::AemCommandType::ReadDescriptor, la::avdecc::protocol::AemCommandType::SetControl };
+	EXPECT_EQ(expected, delegate.getSentCommands());
+
+	stateMachine.unregisterLocalEntity(entity);
+}
+
+TEST(CommandStateMachine, AecpCongestionControl)
+{
+	using namespace std::chrono_literals;
+	auto parameters = la::avdecc::protocol::ProtocolInterface::AecpCongestionControlParameters{};
+	parameters.minInflightCommands = 1u;
+	parameters.initialInflightCommands = 8u;
+	parameters.maxInflightCommands = 16u;
+	parameters.minTimeout = 250ms;
+	parameters.maxTimeout = 2000ms;
+	ASSERT_TRUE(la::avdecc::protocol::stateMachine::AecpCongestionControl::isValid(parameters));
+
+	auto congestionControl = la::avdecc::protocol::stateMachine::AecpCongestionControl{};
+	auto const now = std::chrono::steady_clock::now();
+
+	// Initial state
+	EXPECT_EQ(8u, congestionControl.getMaxInflightCommands(parameters));
+	EXPECT_EQ(250ms, congestionControl.getTimeout(parameters));
+
+	// Timeout: window halved and timer backed off
+	congestionControl.onTimeout(parameters, now);
+	EXPECT_EQ(4u, congestionControl.getMaxInflightCommands(parameters));
+	EXPECT_EQ(500ms, congestionControl.getTimeout(parameters));
+
+	// Other commands timing out during the same round trip belong to the same congestion event
+	congestionControl.onTimeout(parameters, now + 1ms);
+	congestionControl.onTimeout(parameters, now + 2ms);
+	congestionControl.onTimeout(parameters, now + 3ms);
+	EXPECT_EQ(4u, congestionControl.getMaxInflightCommands(parameters));
+	EXPECT_EQ(500ms, congestionControl.getTimeout(parameters));
+
+	// Timeouts of the next round trips are new congestion events
+	congestionControl.onTimeout(parameters, now + 500ms);
+	EXPECT_EQ(2u, congestionControl.getMaxInflightCommands(parameters));
+	EXPECT_EQ(1000ms, congestionControl.getTimeout(parameters));
+	congestionControl.onTimeout(parameters, now + 1500ms);
+	EXPECT_EQ(1u, congestionControl.getMaxInflightCommands(parameters));
+	EXPECT_EQ(2000ms, congestionControl.getTimeout(parameters));
+	congestionControl.onTimeout(parameters, now + 3500ms);
+	EXPECT_EQ(1u, congestionControl.getMaxInflightCommands(parameters));
+	EXPECT_EQ(2000ms, congestionControl.getTimeout(parameters));
+
+	// Response without valid sample (retried command): window increased, timer still backed off
+	congestionControl.onResponse(parameters, std::nullopt);
+	EXPECT_EQ(2u, congestionControl.getMaxInflightCommands(parameters));
+	EXPECT_EQ(2000ms, congestionControl.getTimeout(parameters));
+
+	// Valid samples: timeout computed from the response times (SRTT + 4 * RTTVAR)
+	congestionControl.onResponse(parameters, std::chrono::microseconds{ 200ms });
+	EXPECT_EQ(600ms, congestionControl.getTimeout(parameters));
+	congestionControl.onResponse(parameters, std::chrono::microseconds{ 200ms });
+	EXPECT_EQ(500ms, congestionControl.getTimeout(parameters));
+	auto const statistics = congestionControl.getStatistics(parameters);
+	EXPECT_EQ(std::chrono::microseconds{ 200ms }, statistics.smoothedResponseTime);
+	EXPECT_EQ(std::chrono::microseconds{ 75ms }, statistics.responseTimeVariation);
+
+	// Fast responses: timeout bounded by the minimum
+	for (auto i = 0u; i < 50u; ++i)
+	{
+		congestionControl.onResponse(parameters, std::chrono::microseconds{ 1ms });
+	}
+	EXPECT_EQ(250ms, congestionControl.getTimeout(parameters));
+
+	// Additive increase, above the initial window
+	EXPECT_EQ(10u, congestionControl.getMaxInflightCommands(parameters));
+	for (auto i = 0u; i < 200u; ++i)
+	{
+		congestionControl.onResponse(parameters, std::chrono::microseconds{ 1ms });
+	}
+	// Bounded by the maximum
+	EXPECT_EQ(16u, congestionControl.getMaxInflightCommands(parameters));
+
+	// New bounds are immediately applied
+	parameters.initialInflightCommands = 2u;
+	parameters.maxInflightCommands = 2u;
+	EXPECT_EQ(2u, congestionControl.getMaxInflightCommands(parameters));
+
+	// Invalid bounds
+	parameters.minInflightCommands = 0u;
+	EXPECT_FALSE(la::avdecc::protocol::stateMachine::AecpCongestionControl::isValid(parameters));
+	parameters.minInflightCommands = 4u;
+	EXPECT_FALSE(la::avdecc::protocol::stateMachine::AecpCongestionControl::isValid(parameters));
+	parameters.minInflightCommands = 1u;
+	parameters.initialInflightCommands = 3u;
+	EXPECT_FALSE(la::avdecc::protocol::stateMachine::AecpCongestionControl::isValid(parameters));
+
+	// Default cap above the initial window
+	auto const defaultParameters = la::avdecc::protocol::ProtocolInterface::AecpCongestionControlParameters{};
+	EXPECT_TRUE(la::avdecc::protocol::stateMachine::AecpCongestionControl::isValid(defaultParameters));
+	EXPECT_GT(defaultParameters.maxInflightCommands, defaultParameters.initialInflightCommands);
+}
@@ -589,3 +589,129 @@ TEST(ControlledEntity, VisitorValidation)
 	auto visitor = Visitor{};
 	entity->accept(&visitor);
 }
+
+TEST(CountersHistory, MemoryBudget)
+{
+	auto const samplesCount = std::uint16_t{ 4u };
+	auto const budget = std::make_shared<la::avdecc::controller::CountersHistoryBudget>(samplesCount, la::avdecc::controller::CountersHistory::getMemorySize(samplesCount));
+
+	auto history = la::avdecc::controller::CountersHistory::create(budget);
+	ASSERT_NE(nullptr, history);
+	EXPECT_EQ(budget->getMaxMemorySize(), budget->getUsedMemorySize());
+
+	// Budget exhausted
+	EXPECT_EQ(nullptr, la::avdecc::controller::CountersHistory::create(budget));
+
+	// Memory is given back to the budget when the history is destroyed
+	history.reset();
+	EXPECT_EQ(0u, budget->getUsedMemorySize());
+	EXPECT_NE(nullptr, la::avdecc::controller::CountersHistory::create(budget));
+}
+
+TEST(CountersHistory, Statistics)
+{
+	auto const budget = std::make_shared<la::avdecc::controller::CountersHistoryBudget>(std::uint16_t{ 4u }, std::size_t{ 64u * 1024u });
+	auto history = la::avdecc::controller::CountersHistory::create(budget);
+	ASSERT_NE(nullptr, history);
+
+	auto const position = la::avdecc::entity::StreamInputCounterValidFlags::getPosition(la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked);
+	auto const validCounters = la::avdecc::utils::to_integral(la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked);
+	auto const start = la::avdecc::controller::CountersHistory::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const record = [&history, &start, position, validCounters](std::chrono::seconds const offset, la::avdecc::entity::model::DescriptorCounter const value)
+	{
+		auto counters = la::avdecc::entity::model::DescriptorCounters{};
+		counters[position] = value;
+		history->record(start + offset, validCounters, counters);
+	};
+
+	// Not enough samples
+	record(std::chrono::seconds{ 0 }, 0u);
+	EXPECT_FALSE(history->getStatistics(position, std::chrono::seconds{ 10 }));
+
+	record(std::chrono::seconds{ 1 }, 10u);
+	record(std::chrono::seconds{ 2 }, 30u);
+	record(std::chrono::seconds{ 3 }, 60u);
+
+	// Whole history
+	{
+		auto const stats = history->getStatistics(position, std::chrono::seconds{ 10 });
+		ASSERT_TRUE(stats);
+		EXPECT_EQ(60u, stats->delta);
+		EXPECT_EQ(std::chrono::milliseconds{ 3000 }, stats->duration);
+		EXPECT_DOUBLE_EQ(20.0, stats->ratePerSecond);
+		EXPECT_EQ(4u, stats->samplesCount);
+	}
+
+	// Sliding window
+	{
+		auto const stats = history->getStatistics(position, std::chrono::milliseconds{ 1500 });
+		ASSERT_TRUE(stats);
+		EXPECT_EQ(30u, stats->delta);
+		EXPECT_EQ(std::chrono::milliseconds{ 1000 }, stats->duration);
+		EXPECT_EQ(2u, stats->samplesCount);
+	}
+
+	// Oldest sample is overwritten when full
+	record(std::chrono::seconds{ 4 }, 100u);
+	{
+		auto const stats = history->getStatistics(position, std::chrono::seconds{ 10 });
+		ASSERT_TRUE(stats);
+		EXPECT_EQ(90u, stats->delta);
+		EXPECT_EQ(4u, stats->samplesCount);
+	}
+
+	// Counter not in the history
+	EXPECT_FALSE(history->getStatistics(position + 1u, std::chrono::seconds{ 10 }));
+}
+
+TEST(CountersHistory, OnlyChangedCountersStored)
+{
+	auto const budget = std::make_shared<la::avdecc::controller::CountersHistoryBudget>(std::uint16_t{ 4u }, std::size_t{ 64u * 1024u });
+	auto history = la::avdecc::controller::CountersHistory::create(budget);
+	ASSERT_NE(nullptr, history);
+
+	auto const framesPosition = la::avdecc::entity::StreamInputCounterValidFlags::getPosition(la::avdecc::entity::StreamInputCounterValidFlag::FramesRx);
+	auto const unlockedPosition = la::avdecc::entity::StreamInputCounterValidFlags::getPosition(la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked);
+	auto const validCounters = la::avdecc::utils::to_integral(la::avdecc::entity::StreamInputCounterValidFlag::FramesRx) | la::avdecc::utils::to_integral(la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked);
+	auto const start = la::avdecc::controller::CountersHistory::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const record = [&history, &start, framesPosition, unlockedPosition, validCounters](std::chrono::seconds const offset, la::avdecc::entity::model::DescriptorCounter const frames, la::avdecc::entity::model::DescriptorCounter const unlocked)
+	{
+		auto counters = la::avdecc::entity::model::DescriptorCounters{};
+		counters[framesPosition] = frames;
+		counters[unlockedPosition] = unlocked;
+		history->record(start + offset, validCounters, counters);
+	};
+
+	// First sample stores all the valid counters, then only the changed ones
+	record(std::chrono::seconds{ 0 }, 100u, 5u);
+	EXPECT_EQ(2u, history->getStoredValuesCount());
+	record(std::chrono::seconds{ 1 }, 200u, 5u);
+	record(std::chrono::seconds{ 2 }, 300u, 5u);
+	EXPECT_EQ(4u, history->getStoredValuesCount());
+
+	// Unchanged counter value is rebuilt from its last change
+	{
+		auto const stats = history->getStatistics(unlockedPosition, std::chrono::seconds{ 10 });
+		ASSERT_TRUE(stats);
+		EXPECT_EQ(0u, stats->delta);
+		EXPECT_EQ(3u, stats->samplesCount);
+	}
+
+	// Values of the dropped samples are kept as the base values
+	record(std::chrono::seconds{ 3 }, 400u, 5u);
+	record(std::chrono::seconds{ 4 }, 500u, 7u);
+	record(std::chrono::seconds{ 5 }, 600u, 7u);
+	EXPECT_EQ(4u, history->size());
+	{
+		auto const stats = history->getStatistics(unlockedPosition, std::chrono::seconds{ 10 });
+		ASSERT_TRUE(stats);
+		EXPECT_EQ(2u, stats->delta);
+		EXPECT_EQ(std::chrono::milliseconds{ 3000 }, stats->duration);
+	}
+	{
+		auto const stats = history->getStatistics(framesPosition, std::chrono::seconds{ 10 });
+		ASSERT_TRUE(stats);
+		EXPECT_EQ(300u, stats->delta);
+		EXPECT_DOUBLE_EQ(100.0, stats->ratePerSecond);
+	}
+}
@@ -25,6 +25,7 @@
 // Public API
 #include <la/avdecc/executor.hpp>
 #include <la/avdecc/controller/avdeccController.hpp>
+#include <la/avdecc/internals/endStation.hpp>
 #include <la/avdecc/internals/protocolAemAecpdu.hpp>
 #include <la/avdecc/internals/protocolAemPayloadSizes.hpp>
 #include <la/avdecc/internals/entityModelControlValuesTraits.hpp>
@@ -34,6 +35,7 @@
 #include "controller/avdeccControllerImpl.hpp"
 #include "entity/controllerEntityImpl.hpp"
 #include "protocolInterface/protocolInterface_virtual.hpp"
+#include "protocol/protocolAemPayloads.hpp"
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -41,6 +43,10 @@
 #include <thread>
 #include <chrono>
 #include <future>
+#include <mutex>
+#include <fstream>
+#include <array>
+#include <atomic>
 #include <vector>
 #include <cstdint>
 
@@ -683,6 +689,613 @@ TEST_F(Controller_F, VirtualEntityFromEntityModelFile)
 	}
 }
 
+TEST_F(Controller_F, ControlledEntitySnapshot)
+{
+	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x0102030405060708 };
+	auto builder = Builder{ la::avdecc::controller::ControlledEntity::CompatibilityFlags{ la::avdecc::controller::ControlledEntity::CompatibilityFlag::IEEE17221 } };
+	auto& controller = getController();
+
+	// Offline entity
+	EXPECT_EQ(nullptr, controller.getControlledEntitySnapshot(EntityID));
+
+	{
+		auto const [error, message] = controller.createVirtualEntityFromEntityModelFile("data/SimpleEntityModel.json", &builder, false);
+		ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
+	}
+
+	auto const snapshot = controller.getControlledEntitySnapshot(EntityID);
+	ASSERT_NE(nullptr, snapshot);
+	{
+		auto const entity = controller.getControlledEntityGuard(EntityID);
+		ASSERT_TRUE(!!entity);
+		EXPECT_NE(&*entity, snapshot.get());
+		EXPECT_EQ(entity->getEntity().getEntityID(), snapshot->getEntity().getEntityID());
+		EXPECT_EQ(entity->getCompatibilityFlags(), snapshot->getCompatibilityFlags());
+		EXPECT_EQ(entity->getCurrentConfigurationIndex(), snapshot->getCurrentConfigurationIndex());
+		EXPECT_EQ(entity->getEntityNode().dynamicModel.entityName, snapshot->getEntityNode().dynamicModel.entityName);
+		EXPECT_EQ(entity->getCurrentConfigurationNode().streamInputs.size(), snapshot->getCurrentConfigurationNode().streamInputs.size());
+	}
+
+	// Snapshot outlives the entity
+	EXPECT_TRUE(controller.unloadVirtualEntity(EntityID));
+	EXPECT_EQ(nullptr, controller.getControlledEntitySnapshot(EntityID));
+	EXPECT_EQ(EntityID, snapshot->getEntity().getEntityID());
+	EXPECT_NO_THROW(snapshot->getCurrentConfigurationNode());
+}
+
+TEST_F(Controller_F, ControlledEntitySnapshotConcurrentReaders)
+{
+	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x0102030405060708 };
+	auto constexpr ReadersCount = 4u;
+	auto constexpr ChangesCount = 200u;
+	auto builder = Builder{ la::avdecc::controller::ControlledEntity::CompatibilityFlags{ la::avdecc::controller::ControlledEntity::CompatibilityFlag::IEEE17221 } };
+	auto& controller = static_cast<la::avdecc::controller::ControllerImpl&>(getController());
+
+	{
+		auto const [error, message] = controller.createVirtualEntityFromEntityModelFile("data/SimpleEntityModel.json", &builder, false);
+		ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
+	}
+
+	// Run a job on the networking thread, and wait for it to complete (as well as the snapshots publication it might have scheduled)
+	auto const runOnNetworkThread = [](std::function<void()> const& job)
+	{
+		auto promise = std::promise<void>{};
+		la::avdecc::ExecutorManager::getInstance().pushJob(DefaultExecutorName,
+			[&job, &promise]()
+			{
+				job();
+				la::avdecc::ExecutorManager::getInstance().pushJob(DefaultExecutorName,
+					[&promise]()
+					{
+						promise.set_value();
+					});
+			});
+		ASSERT_EQ(std::future_status::ready, promise.get_future().wait_for(std::chrono::seconds{ 5 }));
+	};
+
+	auto const initialSnapshot = controller.getControlledEntitySnapshot(EntityID);
+	ASSERT_NE(nullptr, initialSnapshot);
+	auto const initialName = initialSnapshot->getEntityNode().dynamicModel.entityName;
+	auto const streamInputsCount = initialSnapshot->getCurrentConfigurationNode().streamInputs.size();
+
+	// State only change, the new snapshot shares the model of the previous one
+	runOnNetworkThread(
+		[&controller]()
+		{
+			auto entity = controller.getControlledEntityImplGuard(EntityID);
+			entity->setAcquireState(la::avdecc::controller::model::AcquireState::AcquiredByOther);
+		});
+	auto const stateSnapshot = controller.getControlledEntitySnapshot(EntityID);
+	ASSERT_NE(nullptr, stateSnapshot);
+	EXPECT_NE(initialSnapshot, stateSnapshot);
+	EXPECT_EQ(la::avdecc::controller::model::AcquireState::AcquiredByOther, stateSnapshot->getAcquireState());
+	EXPECT_NE(initialSnapshot->getAcquireState(), stateSnapshot->getAcquireState());
+	EXPECT_EQ(&initialSnapshot->getEntityNode(), &stateSnapshot->getEntityNode());
+
+	// Readers continuously traverse the latest snapshot, the entity and group names are always changed together so they must always match
+	auto shouldStop = std::atomic_bool{ false };
+	auto readsCount = std::atomic<std::uint64_t>{ 0u };
+	auto errorsCount = std::atomic<std::uint64_t>{ 0u };
+	auto readers = std::vector<std::thread>{};
+	for (auto i = 0u; i < ReadersCount; ++i)
+	{
+		readers.emplace_back(
+			[&]()
+			{
+				while (!shouldStop)
+				{
+					auto const snapshot = controller.getControlledEntitySnapshot(EntityID);
+					if (!snapshot)
+					{
+						++errorsCount;
+						continue;
+					}
+					auto const& entityNode = snapshot->getEntityNode();
+					if (entityNode.dynamicModel.entityName != entityNode.dynamicModel.groupName && entityNode.dynamicModel.entityName != initialName)
+					{
+						++errorsCount;
+					}
+					if (snapshot->getCurrentConfigurationNode().streamInputs.size() != streamInputsCount)
+					{
+						++errorsCount;
+					}
+					++readsCount;
+				}
+			});
+	}
+
+	// Readers never wait for the entities lock, even when held by another thread
+	{
+		auto const entity = controller.getControlledEntityGuard(EntityID);
+		ASSERT_TRUE(!!entity);
+		auto const readsBefore = readsCount.load();
+		auto const timeout = std::chrono::steady_clock::now() + std::chrono::seconds{ 5 };
+		while (readsCount <= readsBefore + ReadersCount * 100u && std::chrono::steady_clock::now() < timeout)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+		}
+		EXPECT_GT(readsCount.load(), readsBefore + ReadersCount * 100u);
+	}
+
+	// Modify the model from the networking thread while the readers are running
+	auto lastName = la::avdecc::entity::model::AvdeccFixedString{};
+	for (auto i = 0u; i < ChangesCount; ++i)
+	{
+		auto const name = la::avdecc::entity::model::AvdeccFixedString{ "Name " + std::to_string(i) };
+		la::avdecc::ExecutorManager::getInstance().pushJob(DefaultExecutorName,
+			[&controller, name]()
+			{
+				auto entity = controller.getControlledEntityImplGuard(EntityID);
+				entity->setEntityName(name, la::avdecc::controller::TreeModelAccessStrategy::NotFoundBehavior::Throw);
+				entity->setEntityGroupName(name, la::avdecc::controller::TreeModelAccessStrategy::NotFoundBehavior::Throw);
+			});
+		lastName = name;
+	}
+	runOnNetworkThread([]() {});
+
+	shouldStop = true;
+	for (auto& reader : readers)
+	{
+		reader.join();
+	}
+	EXPECT_EQ(0u, errorsCount.load());
+
+	// Latest snapshot has all the changes, and has its own copy of the model
+	auto const latestSnapshot = controller.getControlledEntitySnapshot(EntityID);
+	ASSERT_NE(nullptr, latestSnapshot);
+	EXPECT_EQ(lastName, latestSnapshot->getEntityNode().dynamicModel.entityName);
+	EXPECT_EQ(lastName, latestSnapshot->getEntityNode().dynamicModel.groupName);
+	EXPECT_NE(&initialSnapshot->getEntityNode(), &latestSnapshot->getEntityNode());
+
+	// Previously returned snapshots are never modified
+	EXPECT_EQ(initialName, initialSnapshot->getEntityNode().dynamicModel.entityName);
+	EXPECT_EQ(initialName, stateSnapshot->getEntityNode().dynamicModel.entityName);
+	EXPECT_NE(la::avdecc::controller::model::AcquireState::AcquiredByOther, initialSnapshot->getAcquireState());
+}
+
+TEST_F(Controller_F, LoadConfigurationStaticModel)
+{
+	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x0102030405060708 };
+	auto builder = Builder{ la::avdecc::controller::ControlledEntity::CompatibilityFlags{ la::avdecc::controller::ControlledEntity::CompatibilityFlag::IEEE17221 } };
+	auto& controller = getController();
+
+	auto const loadConfiguration = [&controller](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ConfigurationIndex const configurationIndex)
+	{
+		auto promise = std::promise<std::pair<bool, la::avdecc::entity::ControllerEntity::AemCommandStatus>>{};
+		auto future = promise.get_future();
+		controller.loadConfigurationStaticModel(entityID, configurationIndex,
+			[&promise](la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::ControllerEntity::AemCommandStatus const status)
+			{
+				promise.set_value({ entity != nullptr, status });
+			});
+		EXPECT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds{ 1 }));
+		return future.get();
+	};
+
+	// Offline entity
+	EXPECT_EQ(std::make_pair(false, la::avdecc::entity::ControllerEntity::AemCommandStatus::UnknownEntity), loadConfiguration(EntityID, 0u));
+
+	{
+		auto const [error, message] = controller.createVirtualEntityFromEntityModelFile("data/SimpleEntityModel.json", &builder, false);
+		ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
+	}
+
+	// Already loaded configuration
+	EXPECT_EQ(std::make_pair(true, la::avdecc::entity::ControllerEntity::AemCommandStatus::Success), loadConfiguration(EntityID, 0u));
+
+	// Unknown configuration
+	EXPECT_EQ(std::make_pair(true, la::avdecc::entity::ControllerEntity::AemCommandStatus::NoSuchDescriptor), loadConfiguration(EntityID, 10u));
+}
+
+TEST_F(Controller_F, LoadConfigurationStaticModelOnDemand)
+{
+	static auto constexpr ResponderExecutorName = "LoadConfigurationStaticModelOnDemand";
+
+	class ControllerObserver final : public la::avdecc::controller::Controller::DefaultedObserver
+	{
+	public:
+		std::future<void> getOnlineFuture() noexcept
+		{
+			return _onlinePromise.get_future();
+		}
+
+	private:
+		virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const /*entity*/) noexcept override
+		{
+			_onlinePromise.set_value();
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ControllerObserver);
+
+		std::promise<void> _onlinePromise{};
+	};
+
+	class ResponderObserver final : public la::avdecc::protocol::ProtocolInterface::Observer
+	{
+	public:
+		std::atomic_size_t nonCurrentConfigurationReads{ 0u };
+
+	private:
+		virtual void onAecpCommand(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
+		{
+			if (aecpdu.getMessageType() != la::avdecc::protocol::AecpMessageType::AemCommand)
+			{
+				return;
+			}
+			auto const& aem = static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu);
+			if (aem.getCommandType() == la::avdecc::protocol::AemCommandType::ReadDescriptor)
+			{
+				auto const [configurationIndex, descriptorType, descriptorIndex] = la::avdecc::protocol::aemPayload::deserializeReadDescriptorCommand(aem.getPayload());
+				if (descriptorType == la::avdecc::entity::model::DescriptorType::Configuration && descriptorIndex == 1u)
+				{
+					++nonCurrentConfigurationReads;
+				}
+			}
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ResponderObserver);
+	};
+
+	auto& controller = getController();
+	auto controllerObserver = ControllerObserver{};
+	controller.registerObserver(&controllerObserver);
+	auto onlineFuture = controllerObserver.getOnlineFuture();
+
+	// Responder entity with 2 configurations, the non-current one declaring a STREAM_INPUT (not retrieved during enumeration)
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	entityTree.dynamicModel.currentConfiguration = 0u;
+	entityTree.configurationTrees[0u] = {};
+	entityTree.configurationTrees[1u].streamInputModels[0u] = {};
+
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(ResponderExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(ResponderExecutorName, la::avdecc::utils::ThreadPriority::Normal));
+	auto responder = la::avdecc::EndStation::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "VirtualInterface", ResponderExecutorName);
+	auto responderObserver = ResponderObserver{};
+	responder->getProtocolInterface()->registerObserver(&responderObserver);
+	auto* const responderEntity = responder->addControllerEntity(0x0002, la::avdecc::UniqueIdentifier{}, &entityTree, nullptr);
+	ASSERT_NE(nullptr, responderEntity);
+	auto const entityID = responderEntity->getEntityID();
+	ASSERT_TRUE(responderEntity->enableEntityAdvertising(10u));
+
+	// Wait for the entity to be enumerated
+	ASSERT_EQ(std::future_status::ready, onlineFuture.wait_for(std::chrono::seconds{ 5 }));
+	EXPECT_EQ(1u, responderObserver.nonCurrentConfigurationReads);
+	{
+		auto const entity = controller.getControlledEntityGuard(entityID);
+		ASSERT_TRUE(!!entity);
+		EXPECT_TRUE(entity->getConfigurationNode(1u).streamInputs.empty());
+	}
+
+	// Request the non-current configuration twice from the networking thread, so both requests are pending at the same time
+	auto promises = std::array<std::promise<std::pair<bool, la::avdecc::entity::ControllerEntity::AemCommandStatus>>, 2>{};
+	auto futures = std::array<std::future<std::pair<bool, la::avdecc::entity::ControllerEntity::AemCommandStatus>>, 2>{ promises[0].get_future(), promises[1].get_future() };
+	la::avdecc::ExecutorManager::getInstance().pushJob(DefaultExecutorName,
+		[&controller, &promises, entityID]()
+		{
+			for (auto& promise : promises)
+			{
+				controller.loadConfigurationStaticModel(entityID, 1u,
+					[&promise](la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::ControllerEntity::AemCommandStatus const status)
+					{
+						promise.set_value({ entity != nullptr, status });
+					});
+			}
+		});
+
+	for (auto& future : futures)
+	{
+		ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds{ 5 }));
+		EXPECT_EQ(std::make_pair(true, la::avdecc::entity::ControllerEntity::AemCommandStatus::Success), future.get());
+	}
+
+	// Concurrent requests were coalesced into a single retrieval
+	EXPECT_EQ(2u, responderObserver.nonCurrentConfigurationReads);
+
+	responder->getProtocolInterface()->unregisterObserver(&responderObserver);
+	controller.unregisterObserver(&controllerObserver);
+}
+
+TEST_F(Controller_F, ReuseRecentEntityModel)
+{
+	static auto constexpr ResponderExecutorName = "ReuseRecentEntityModel";
+
+	class ControllerObserver final : public la::avdecc::controller::Controller::DefaultedObserver
+	{
+	public:
+		std::future<void> expectOnline() noexcept
+		{
+			auto const lg = std::lock_guard{ _lock };
+			_onlinePromise = std::promise<void>{};
+			return _onlinePromise.get_future();
+		}
+		std::future<void> expectOffline() noexcept
+		{
+			auto const lg = std::lock_guard{ _lock };
+			_offlinePromise = std::promise<void>{};
+			return _offlinePromise.get_future();
+		}
+
+	private:
+		virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const /*entity*/) noexcept override
+		{
+			auto const lg = std::lock_guard{ _lock };
+			_onlinePromise.set_value();
+		}
+		virtual void onEntityOffline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const /*entity*/) noexcept override
+		{
+			auto const lg = std::lock_guard{ _lock };
+			_offlinePromise.set_value();
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ControllerObserver);
+
+		std::mutex _lock{};
+		std::promise<void> _onlinePromise{};
+		std::promise<void> _offlinePromise{};
+	};
+
+	class ResponderObserver final : public la::avdecc::protocol::ProtocolInterface::Observer
+	{
+	public:
+		std::atomic_size_t getNameCommands{ 0u };
+
+	private:
+		virtual void onAecpCommand(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
+		{
+			if (aecpdu.getMessageType() == la::avdecc::protocol::AecpMessageType::AemCommand && static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu).getCommandType() == la::avdecc::protocol::AemCommandType::GetName)
+			{
+				++getNameCommands;
+			}
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ResponderObserver);
+	};
+
+	auto& controller = static_cast<la::avdecc::controller::ControllerImpl&>(getController());
+	auto controllerObserver = ControllerObserver{};
+	controller.registerObserver(&controllerObserver);
+	auto onlineFuture = controllerObserver.expectOnline();
+
+	// Responder entity with an EntityModelID (EntityModel cache not enabled)
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	entityTree.dynamicModel.currentConfiguration = 0u;
+	entityTree.configurationTrees[0u] = {};
+	entityTree.configurationTrees[1u].streamInputModels[0u] = {};
+
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(ResponderExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(ResponderExecutorName, la::avdecc::utils::ThreadPriority::Normal));
+	auto responder = la::avdecc::EndStation::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "VirtualInterface", ResponderExecutorName);
+	auto responderObserver = ResponderObserver{};
+	responder->getProtocolInterface()->registerObserver(&responderObserver);
+	auto* const responderEntity = responder->addControllerEntity(0x0002, la::avdecc::UniqueIdentifier{ 0x001B92FFFF000002 }, &entityTree, nullptr);
+	ASSERT_NE(nullptr, responderEntity);
+	auto const entityID = responderEntity->getEntityID();
+	ASSERT_TRUE(responderEntity->enableEntityAdvertising(10u));
+	ASSERT_EQ(std::future_status::ready, onlineFuture.wait_for(std::chrono::seconds{ 5 }));
+
+	// Names are retrieved with the descriptors when enumerating the static model, GET_NAME is only used when reusing a model (to retrieve the dynamic part of the descriptors)
+	EXPECT_EQ(0u, responderObserver.getNameCommands);
+
+	// Run a job on the networking thread (where the recent models are managed), and wait for it to complete
+	auto const runOnNetworkThread = [](std::function<void()> const& job)
+	{
+		auto promise = std::promise<void>{};
+		la::avdecc::ExecutorManager::getInstance().pushJob(DefaultExecutorName,
+			[&job, &promise]()
+			{
+				job();
+				promise.set_value();
+			});
+		ASSERT_EQ(std::future_status::ready, promise.get_future().wait_for(std::chrono::seconds{ 5 }));
+	};
+
+	auto const goOfflineAndOnline = [&controllerObserver, responderEntity](std::function<void()> const& whileOffline)
+	{
+		auto offlineFuture = controllerObserver.expectOffline();
+		responderEntity->disableEntityAdvertising();
+		ASSERT_EQ(std::future_status::ready, offlineFuture.wait_for(std::chrono::seconds{ 5 }));
+		whileOffline();
+		auto onlineFuture = controllerObserver.expectOnline();
+		ASSERT_TRUE(responderEntity->enableEntityAdvertising(10u));
+		ASSERT_EQ(std::future_status::ready, onlineFuture.wait_for(std::chrono::seconds{ 5 }));
+	};
+
+	// Coming back online with an unchanged CONFIGURATION descriptor, the previous model is reused
+	goOfflineAndOnline(
+		[&controller, &runOnNetworkThread]()
+		{
+			runOnNetworkThread(
+				[&controller]()
+				{
+					EXPECT_EQ(1u, controller._recentEntityModels.getEntityModelsCount());
+				});
+		});
+	EXPECT_EQ(2u, responderObserver.getNameCommands);
+	{
+		auto const entity = controller.getControlledEntityGuard(entityID);
+		ASSERT_TRUE(!!entity);
+		EXPECT_FALSE(entity->gotFatalEnumerationError());
+		EXPECT_EQ(2u, entity->getEntityNode().configurations.size());
+	}
+
+	// Model changed in the meantime (different CONFIGURATION descriptor), the whole static model is retrieved
+	goOfflineAndOnline(
+		[&controller, &runOnNetworkThread, entityID]()
+		{
+			runOnNetworkThread(
+				[&controller, entityID]()
+				{
+					auto& recentModel = controller._recentEntityModels._models.at(entityID);
+					recentModel.entityNode.configurations.at(0u).staticModel.descriptorCounts[la::avdecc::entity::model::DescriptorType::StreamInput] = 1u;
+				});
+		});
+	EXPECT_EQ(2u, responderObserver.getNameCommands);
+	{
+		auto const entity = controller.getControlledEntityGuard(entityID);
+		ASSERT_TRUE(!!entity);
+		EXPECT_FALSE(entity->gotFatalEnumerationError());
+		EXPECT_TRUE(entity->getCurrentConfigurationNode().streamInputs.empty());
+	}
+
+	responder->getProtocolInterface()->unregisterObserver(&responderObserver);
+	controller.unregisterObserver(&controllerObserver);
+}
+
+TEST_F(Controller_F, ResyncAfterUnsolicitedNotificationLoss)
+{
+	static auto constexpr ResponderExecutorName = "ResyncAfterUnsolicitedNotificationLoss";
+
+	class ControllerObserver final : public la::avdecc::controller::Controller::DefaultedObserver
+	{
+	public:
+		std::future<void> getOnlineFuture() noexcept
+		{
+			return _onlinePromise.get_future();
+		}
+
+	private:
+		virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const /*entity*/) noexcept override
+		{
+			_onlinePromise.set_value();
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ControllerObserver);
+
+		std::promise<void> _onlinePromise{};
+	};
+
+	auto& controller = static_cast<la::avdecc::controller::ControllerImpl&>(getController());
+	auto controllerObserver = ControllerObserver{};
+	controller.registerObserver(&controllerObserver);
+	auto onlineFuture = controllerObserver.getOnlineFuture();
+
+	// Responder entity, enumerated by the controller
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	entityTree.dynamicModel.currentConfiguration = 0u;
+	entityTree.configurationTrees[0u] = {};
+
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(ResponderExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(ResponderExecutorName, la::avdecc::utils::ThreadPriority::Normal));
+	auto responder = la::avdecc::EndStation::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "VirtualInterface", ResponderExecutorName);
+	auto* const responderEntity = responder->addControllerEntity(0x0002, la::avdecc::UniqueIdentifier{}, &entityTree, nullptr);
+	ASSERT_NE(nullptr, responderEntity);
+	auto const entityID = responderEntity->getEntityID();
+	ASSERT_TRUE(responderEntity->enableEntityAdvertising(10u));
+	ASSERT_EQ(std::future_status::ready, onlineFuture.wait_for(std::chrono::seconds{ 5 }));
+
+	// Run a job on the networking thread (where the controller processes the network messages), and wait for it to complete
+	auto const runOnNetworkThread = [&controller](std::function<void()> const& job)
+	{
+		auto promise = std::promise<void>{};
+		la::avdecc::ExecutorManager::getInstance().pushJob(DefaultExecutorName,
+			[&controller, &job, &promise]()
+			{
+				auto const lg = std::lock_guard{ *controller._controller };
+				job();
+				promise.set_value();
+			});
+		ASSERT_EQ(std::future_status::ready, promise.get_future().wait_for(std::chrono::seconds{ 5 }));
+	};
+
+	// Subscribed Milan entity (sequence of unsolicited notifications is checked), all REGISTER_UNSOLICITED_NOTIFICATION retries already used during enumeration
+	runOnNetworkThread(
+		[&controller, entityID]()
+		{
+			auto entity = controller.getControlledEntityImplGuard(entityID);
+			ASSERT_TRUE(!!entity);
+			ASSERT_TRUE(entity->wasAdvertised());
+			ASSERT_TRUE(entity->getEnumerationSteps().empty());
+			auto milanInfo = la::avdecc::entity::model::MilanInfo{};
+			milanInfo.protocolVersion = 1u;
+			entity->setMilanInfo(milanInfo);
+			entity->setSubscribedToUnsolicitedNotifications(true);
+			entity->setUnsolicitedNotificationsSupported(true);
+			entity->getRegisterUnsolRetryTimer();
+			entity->getRegisterUnsolRetryTimer();
+			EXPECT_FALSE(entity->getRegisterUnsolRetryTimer().first);
+		});
+
+	// Gap in the sequence of unsolicited notifications
+	runOnNetworkThread(
+		[&controller, entityID]()
+		{
+			controller.onAemAecpUnsolicitedReceived(nullptr, entityID, la::avdecc::protocol::AecpSequenceID{ 10u });
+			controller.onAemAecpUnsolicitedReceived(nullptr, entityID, la::avdecc::protocol::AecpSequenceID{ 11u });
+			controller.onAemAecpUnsolicitedReceived(nullptr, entityID, la::avdecc::protocol::AecpSequenceID{ 13u });
+			auto entity = controller.getControlledEntityImplGuard(entityID);
+			ASSERT_TRUE(!!entity);
+			EXPECT_EQ(1u, entity->getAemAecpUnsolicitedLossCounter());
+			EXPECT_EQ(la::avdecc::protocol::AecpSequenceID{ 14u }, entity->_expectedSequenceID);
+		});
+	EXPECT_TRUE(controller._resyncScheduler.isResyncPending(entityID));
+
+	// Resynchronize (checking the state right after, before any response can be processed on the networking thread)
+	controller.resyncEntity(entityID);
+	runOnNetworkThread(
+		[&controller, entityID]()
+		{
+			{
+				auto entity = controller.getControlledEntityImplGuard(entityID);
+				ASSERT_TRUE(!!entity);
+				EXPECT_TRUE(entity->getEnumerationSteps().test(la::avdecc::controller::ControlledEntityImpl::EnumerationStep::GetDynamicInfo));
+				EXPECT_FALSE(entity->gotExpectedRegisterUnsol());
+				EXPECT_FALSE(entity->_expectedSequenceID.has_value());
+				EXPECT_EQ(0u, entity->_registerUnsolRetryCount);
+				EXPECT_TRUE(entity->isSubscribedToUnsolicitedNotifications());
+			}
+
+			// Notifications restart the sequence with any value, then the new sequence is checked
+			controller.onAemAecpUnsolicitedReceived(nullptr, entityID, la::avdecc::protocol::AecpSequenceID{ 100u });
+			controller.onAemAecpUnsolicitedReceived(nullptr, entityID, la::avdecc::protocol::AecpSequenceID{ 101u });
+			{
+				auto entity = controller.getControlledEntityImplGuard(entityID);
+				ASSERT_TRUE(!!entity);
+				EXPECT_EQ(1u, entity->getAemAecpUnsolicitedLossCounter());
+			}
+
+			// Fatal error while registering again, the already advertised entity is only no longer subscribed
+			controller.onRegisterUnsolicitedNotificationsResult(nullptr, entityID, la::avdecc::entity::ControllerEntity::AemCommandStatus::InternalError);
+			{
+				auto entity = controller.getControlledEntityImplGuard(entityID);
+				ASSERT_TRUE(!!entity);
+				EXPECT_FALSE(entity->gotFatalEnumerationError());
+				EXPECT_FALSE(entity->isSubscribedToUnsolicitedNotifications());
+				EXPECT_FALSE(entity->getEnumerationSteps().test(la::avdecc::controller::ControlledEntityImpl::EnumerationStep::RegisterUnsol));
+				EXPECT_TRUE(entity->wasAdvertised());
+			}
+		});
+
+	controller.unregisterObserver(&controllerObserver);
+}
+
+TEST_F(Controller_F, SerializeNetworkState)
+{
+	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x0102030405060708 };
+	auto builder = Builder{ la::avdecc::controller::ControlledEntity::CompatibilityFlags{ la::avdecc::controller::ControlledEntity::CompatibilityFlag::IEEE17221 } };
+	auto& controller = getController();
+	auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDiagnostics };
+	auto binaryFlags = flags;
+	binaryFlags.set(la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat);
+
+	// Empty network state can be loaded back
+	{
+		auto const [error, message] = controller.serializeAllControlledEntitiesAsJson("OutputEmptyNetworkState.json", flags, "Test", false);
+		ASSERT_EQ(la::avdecc::jsonSerializer::SerializationError::NoError, error);
+		auto const [deserializationError, deserializationMessage, entities] = la::avdecc::controller::Controller::deserializeControlledEntitiesFromJsonNetworkState("OutputEmptyNetworkState.json", flags, false);
+		EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, deserializationError);
+		EXPECT_TRUE(entities.empty());
+	}
+
+	{
+		auto const [error, message] = controller.createVirtualEntityFromEntityModelFile("data/SimpleEntityModel.json", &builder, false);
+		ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
+	}
+
+	// Both formats are streamed to disk and can be loaded back
+	for (auto const& [filePath, serializationFlags] : { std::make_pair(std::string{ "OutputNetworkState.json" }, flags), std::make_pair(std::string{ "OutputNetworkState.ave" }, binaryFlags) })
+	{
+		auto const [error, message] = controller.serializeAllControlledEntitiesAsJson(filePath, serializationFlags, "Test", false);
+		ASSERT_EQ(la::avdecc::jsonSerializer::SerializationError::NoError, error);
+		EXPECT_FALSE(std::ifstream{ filePath + ".tmp" }.is_open()) << "Temporary dump file not replaced";
+		auto const [deserializationError, deserializationMessage, entities] = la::avdecc::controller::Controller::deserializeControlledEntitiesFromJsonNetworkState(filePath, serializationFlags, false);
+		ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, deserializationError);
+		ASSERT_EQ(1u, entities.size());
+		EXPECT_EQ(EntityID, entities[0]->getEntity().getEntityID());
+	}
+}
+
 /*
  * TESTING https://github.com/L-Acoustics/avdecc/issues/84
  * Callback returns BadArguments if passed too many mappings
@@ -823,6 +1436,61 @@ TEST_F(Controller_F, BadArgumentsIfTooManyMappingsPassed)
 	}
 }
 
+TEST_F(Controller_F, BatchCommandsValidation)
+{
+	auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::IgnoreAEMSanityChecks, la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics };
+	auto& controller = getController();
+	{
+		auto const [error, message] = controller.loadVirtualEntityFromJson("data/SimpleEntity.json", flags);
+		ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
+	}
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	auto const unknownEntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000002 };
+
+	// Empty batch
+	{
+		auto handlerCalled = false;
+		controller.executeBatchCommands({},
+			[&handlerCalled](auto const& results, auto const failedCount)
+			{
+				handlerCalled = true;
+				EXPECT_TRUE(results.empty());
+				EXPECT_EQ(0u, failedCount);
+			});
+		EXPECT_TRUE(handlerCalled);
+	}
+
+	// All commands rejected by the validation, the handler is called once before the method returns
+	{
+		using BatchCommand = la::avdecc::controller::Controller::BatchCommand;
+		auto const commands = la::avdecc::controller::Controller::BatchCommands{
+			BatchCommand::makeSetStreamInputFormat(unknownEntityID, 0u, la::avdecc::entity::model::StreamFormat{}),
+			BatchCommand::makeSetStreamInputFormat(entityID, 99u, la::avdecc::entity::model::StreamFormat{}),
+			BatchCommand::makeSetAudioUnitSamplingRate(entityID, 5u, la::avdecc::entity::model::SamplingRate{}),
+			BatchCommand::makeConnectStream({ unknownEntityID, 0u }, { entityID, 99u }),
+			BatchCommand::makeConnectStream({ entityID, 0u }, { unknownEntityID, 0u }),
+		};
+		auto handlerCallsCount = 0u;
+		controller.executeBatchCommands(commands,
+			[&handlerCallsCount](auto const& results, auto const failedCount)
+			{
+				++handlerCallsCount;
+				ASSERT_EQ(5u, results.size());
+				EXPECT_EQ(5u, failedCount);
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::UnknownEntity, results[0].aemStatus);
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::NoSuchDescriptor, results[1].aemStatus);
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::NoSuchDescriptor, results[2].aemStatus);
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::ControlStatus::ListenerUnknownID, results[3].controlStatus);
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::ControlStatus::UnknownEntity, results[4].controlStatus);
+				for (auto const& result : results)
+				{
+					EXPECT_FALSE(result.isSuccess());
+				}
+			});
+		EXPECT_EQ(1u, handlerCallsCount);
+	}
+}
+
 /*
  * TESTING https://github.com/L-Acoustics/avdecc/issues/85
  * Controller should properly handle cable redundancy
@@ -1005,7 +1673,7 @@ TEST(Controller, ValidControlValues)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 	auto constexpr ControlIndex = la::avdecc::entity::model::ControlIndex{ 0u };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
@@ -1049,7 +1717,7 @@ TEST(Controller, InvalidControlValues)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 	auto& c = static_cast<la::avdecc::controller::ControllerImpl&>(*controller);
@@ -1173,7 +1841,7 @@ TEST(Controller, IdentifyAdvertisedButNoSuchIndex)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1201,7 +1869,7 @@ TEST(Controller, IdentifyAdvertisedButInvalid)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1228,7 +1896,7 @@ TEST(Controller, IdentifyAdvertisedInAudioUnit)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1255,7 +1923,7 @@ TEST(Controller, IdentifyAdvertisedInConfiguration)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1282,7 +1950,7 @@ TEST(Controller, IdentifyAdvertisedInJack)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1309,7 +1977,7 @@ TEST(Controller, NotAdvertisedButFoundInConfiguration)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1337,7 +2005,7 @@ TEST(Controller, NotAdvertisedButFoundInJack)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1365,7 +2033,7 @@ TEST(Controller, NotAdvertisedAndIncorrectlyFoundInAudioUnit)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1392,7 +2060,7 @@ TEST(Controller, InvalidAdvertiseButFoundInConfiguration)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1420,7 +2088,7 @@ TEST(Controller, InvalidAdvertiseButFoundInJack)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -1448,7 +2116,7 @@ TEST(Controller, InvalidAdvertiseAndIncorrectlyFoundInAudioUnit)
 	EXPECT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
 	EXPECT_STREQ("", message.c_str());
 
-	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	static auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
 
 	auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controller->getControlledEntityGuard(EntityID)));
 
@@ -3139,3 +3807,486 @@ TEST(Controller, HashEntityModelV2)
 	EXPECT_TRUE(checksum.has_value());
 	EXPECT_EQ(64u, checksum.value().size());
 }
+
+TEST(CountersPollingScheduler, Budget)
+{
+	auto scheduler = la::avdecc::controller::CountersPollingScheduler{ 0u };
+	auto const start = la::avdecc::controller::CountersPollingScheduler::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const period = std::chrono::milliseconds{ 1000 };
+	auto const entity1 = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+	auto const entity2 = la::avdecc::UniqueIdentifier{ 0x0001000000000002 };
+
+	scheduler.addEntity(entity1, start);
+	scheduler.addEntity(entity2, start);
+
+	// Not enabled
+	EXPECT_TRUE(scheduler.getEntitiesToPoll(start + period * 2).empty());
+
+	// Only one inflight command allowed
+	scheduler.enable(period, 1u, start);
+	auto const now = start + period * 2;
+	auto const entities = scheduler.getEntitiesToPoll(now);
+	ASSERT_EQ(2u, entities.size());
+	EXPECT_EQ(1u, scheduler.startPoll(entities[0], 1u, now).count);
+	EXPECT_EQ(1u, scheduler.getInflightCommands());
+	EXPECT_FALSE(scheduler.hasAvailableBudget());
+	EXPECT_EQ(0u, scheduler.startPoll(entities[1], 1u, now).count);
+	EXPECT_TRUE(scheduler.getEntitiesToPoll(now).empty());
+
+	// Response received, the other entity can be polled
+	scheduler.onPollResponse(entities[0], true, now);
+	EXPECT_EQ(0u, scheduler.getInflightCommands());
+	auto const otherEntities = scheduler.getEntitiesToPoll(now);
+	ASSERT_EQ(1u, otherEntities.size());
+	EXPECT_EQ(entities[1], otherEntities[0]);
+
+	// Removing an entity releases its inflight commands
+	EXPECT_EQ(1u, scheduler.startPoll(otherEntities[0], 3u, now).count);
+	EXPECT_EQ(1u, scheduler.getInflightCommands());
+	scheduler.removeEntity(otherEntities[0]);
+	EXPECT_EQ(0u, scheduler.getInflightCommands());
+}
+
+TEST(CountersPollingScheduler, PollCycleSplitByBudget)
+{
+	auto scheduler = la::avdecc::controller::CountersPollingScheduler{ 0u };
+	auto const start = la::avdecc::controller::CountersPollingScheduler::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const period = std::chrono::milliseconds{ 1000 };
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+
+	scheduler.enable(period, 2u, start);
+	scheduler.addEntity(entityID, start);
+
+	// Entity requires 5 commands, only 2 can be inflight at the same time
+	auto const now = start + period * 2;
+	ASSERT_EQ(1u, scheduler.getEntitiesToPoll(now).size());
+	for (auto const& [expectedFirst, expectedCount] : { std::make_pair(0u, 2u), std::make_pair(2u, 2u), std::make_pair(4u, 1u) })
+	{
+		auto const range = scheduler.startPoll(entityID, 5u, now);
+		EXPECT_EQ(expectedFirst, range.first);
+		EXPECT_EQ(expectedCount, range.count);
+		EXPECT_GE(2u, scheduler.getInflightCommands());
+		for (auto i = 0u; i < range.count; ++i)
+		{
+			scheduler.onPollResponse(entityID, true, now);
+		}
+		EXPECT_EQ(0u, scheduler.getInflightCommands());
+		// Entity is due right away until all its commands have been sent
+		EXPECT_EQ(expectedFirst + expectedCount < 5u, scheduler.getEntitiesToPoll(now).size() == 1u);
+	}
+}
+
+TEST(CountersPollingScheduler, AdaptiveInterval)
+{
+	auto scheduler = la::avdecc::controller::CountersPollingScheduler{ 0u };
+	auto const start = la::avdecc::controller::CountersPollingScheduler::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const period = std::chrono::milliseconds{ 1000 };
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+
+	scheduler.enable(period, 10u, start);
+	scheduler.addEntity(entityID, start);
+	EXPECT_EQ(period, scheduler.getInterval(entityID));
+
+	// Fast response, interval stays at the configured period
+	auto now = start + period * 2;
+	ASSERT_EQ(1u, scheduler.getEntitiesToPoll(now).size());
+	EXPECT_EQ(2u, scheduler.startPoll(entityID, 2u, now).count);
+	scheduler.onPollResponse(entityID, true, now + std::chrono::milliseconds{ 5 });
+	EXPECT_EQ(period, scheduler.getInterval(entityID)); // Not all responses received yet
+	scheduler.onPollResponse(entityID, true, now + std::chrono::milliseconds{ 10 });
+	EXPECT_EQ(period, scheduler.getInterval(entityID));
+
+	// Not due yet
+	EXPECT_TRUE(scheduler.getEntitiesToPoll(now + std::chrono::milliseconds{ 500 }).empty());
+
+	// Failure, interval backs off
+	now += period * 2;
+	ASSERT_EQ(1u, scheduler.getEntitiesToPoll(now).size());
+	EXPECT_EQ(1u, scheduler.startPoll(entityID, 1u, now).count);
+	scheduler.onPollResponse(entityID, false, now + std::chrono::milliseconds{ 10 });
+	EXPECT_EQ(period * 2, scheduler.getInterval(entityID));
+
+	// Slow response, interval grows with the response time (capped to the maximum interval)
+	now += period * 4;
+	ASSERT_EQ(1u, scheduler.getEntitiesToPoll(now).size());
+	EXPECT_EQ(1u, scheduler.startPoll(entityID, 1u, now).count);
+	scheduler.onPollResponse(entityID, true, now + std::chrono::milliseconds{ 2000 });
+	EXPECT_EQ(period * la::avdecc::controller::CountersPollingScheduler::MaxIntervalFactor, scheduler.getInterval(entityID));
+}
+
+TEST(CountersPollingScheduler, UnsolicitedCoverage)
+{
+	auto scheduler = la::avdecc::controller::CountersPollingScheduler{ 0u };
+	auto const start = la::avdecc::controller::CountersPollingScheduler::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const period = std::chrono::milliseconds{ 1000 };
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+
+	scheduler.enable(period, 10u, start);
+	scheduler.addEntity(entityID, start);
+
+	// Recently received unsolicited counters, not polled
+	scheduler.onUnsolicitedCounters(entityID, start + std::chrono::milliseconds{ 1500 });
+	EXPECT_TRUE(scheduler.getEntitiesToPoll(start + std::chrono::milliseconds{ 2000 }).empty());
+
+	// Unsolicited counters stopped, polled again
+	EXPECT_EQ(1u, scheduler.getEntitiesToPoll(start + std::chrono::milliseconds{ 3000 }).size());
+}
+
+TEST(ResyncScheduler, CoalesceRequests)
+{
+	auto scheduler = la::avdecc::controller::ResyncScheduler{};
+	auto const start = la::avdecc::controller::ResyncScheduler::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const delay = la::avdecc::controller::ResyncScheduler::RequestDelay;
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+
+	// Successive losses only trigger a single resync, after the request delay
+	scheduler.requestResync(entityID, start);
+	scheduler.requestResync(entityID, start + delay / 2);
+	EXPECT_TRUE(scheduler.getEntitiesToResync(start + delay / 2).empty());
+	auto now = start + delay;
+	ASSERT_EQ(1u, scheduler.getEntitiesToResync(now).size());
+	EXPECT_TRUE(scheduler.getEntitiesToResync(now + delay * 2).empty());
+	EXPECT_EQ(1u, scheduler.getResyncsInProgress());
+
+	// Completed
+	scheduler.onResyncCompleted(entityID, now + delay);
+	EXPECT_EQ(0u, scheduler.getResyncsInProgress());
+	EXPECT_FALSE(scheduler.isResyncPending(entityID));
+
+	// Loss while resynchronizing, resync again once completed
+	now += delay * 4;
+	scheduler.requestResync(entityID, now);
+	now += delay;
+	ASSERT_EQ(1u, scheduler.getEntitiesToResync(now).size());
+	scheduler.requestResync(entityID, now);
+	scheduler.onResyncCompleted(entityID, now);
+	EXPECT_TRUE(scheduler.isResyncPending(entityID));
+	EXPECT_TRUE(scheduler.getEntitiesToResync(now).empty());
+	EXPECT_EQ(1u, scheduler.getEntitiesToResync(now + delay).size());
+
+	// Removing the entity cancels the resync
+	scheduler.removeEntity(entityID);
+	EXPECT_FALSE(scheduler.isResyncPending(entityID));
+	EXPECT_EQ(0u, scheduler.getResyncsInProgress());
+}
+
+TEST(ResyncScheduler, RateLimit)
+{
+	using ResyncScheduler = la::avdecc::controller::ResyncScheduler;
+	auto scheduler = ResyncScheduler{};
+	auto const start = ResyncScheduler::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const entity1 = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+	auto const entity2 = la::avdecc::UniqueIdentifier{ 0x0001000000000002 };
+	auto const entity3 = la::avdecc::UniqueIdentifier{ 0x0001000000000003 };
+
+	scheduler.requestResync(entity1, start);
+	scheduler.requestResync(entity2, start + std::chrono::milliseconds{ 1 });
+	scheduler.requestResync(entity3, start + std::chrono::milliseconds{ 2 });
+
+	// Only one start per interval, oldest request first
+	auto now = start + ResyncScheduler::RequestDelay * 2;
+	auto entities = scheduler.getEntitiesToResync(now);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity1, entities[0]);
+	EXPECT_TRUE(scheduler.getEntitiesToResync(now + ResyncScheduler::StartInterval / 2).empty());
+	now += ResyncScheduler::StartInterval;
+	entities = scheduler.getEntitiesToResync(now);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity2, entities[0]);
+
+	// Maximum concurrent resyncs reached
+	now += ResyncScheduler::StartInterval;
+	EXPECT_TRUE(scheduler.getEntitiesToResync(now).empty());
+
+	// Postponed entity goes back to the queue, releasing the budget
+	scheduler.onResyncPostponed(entity1, now);
+	entities = scheduler.getEntitiesToResync(now);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity3, entities[0]);
+
+	// Uncompleted resyncs expire
+	now += ResyncScheduler::Timeout;
+	entities = scheduler.getEntitiesToResync(now);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity1, entities[0]);
+	EXPECT_FALSE(scheduler.isResyncPending(entity2));
+	EXPECT_FALSE(scheduler.isResyncPending(entity3));
+}
+
+TEST(EnumerationScheduler, PriorityOrder)
+{
+	using EnumerationScheduler = la::avdecc::controller::EnumerationScheduler;
+	using Priority = EnumerationScheduler::Priority;
+	auto scheduler = EnumerationScheduler{};
+	auto const now = EnumerationScheduler::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const entity1 = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+	auto const entity2 = la::avdecc::UniqueIdentifier{ 0x0001000000000002 };
+	auto const entity3 = la::avdecc::UniqueIdentifier{ 0x0001000000000003 };
+	auto const entity4 = la::avdecc::UniqueIdentifier{ 0x0001000000000004 };
+
+	// Disabled, entities start right away
+	scheduler.onEntityDiscovered(entity1, false, now);
+	EXPECT_TRUE(scheduler.requestStaticModel(entity1, now));
+	scheduler.onStaticModelCompleted(entity1);
+
+	// Only one entity at a time
+	scheduler.enable(1u);
+	scheduler.setPriority(entity4, Priority::Visible);
+	scheduler.onEntityDiscovered(entity2, false, now);
+	scheduler.onEntityDiscovered(entity3, true, now);
+	scheduler.onEntityDiscovered(entity4, false, now);
+	EXPECT_TRUE(scheduler.requestStaticModel(entity2, now));
+	EXPECT_FALSE(scheduler.requestStaticModel(entity3, now));
+	EXPECT_FALSE(scheduler.requestStaticModel(entity4, now));
+	EXPECT_TRUE(scheduler.getEntitiesToStart(now).empty());
+	EXPECT_EQ(2u, scheduler.getStatistics(now).waitingEntities);
+
+	// Visible entity first, then the talker
+	scheduler.onStaticModelCompleted(entity2);
+	auto entities = scheduler.getEntitiesToStart(now);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity4, entities[0]);
+	EXPECT_TRUE(scheduler.requestStaticModel(entity4, now));
+
+	// Entity going offline releases the budget
+	scheduler.removeEntity(entity4);
+	entities = scheduler.getEntitiesToStart(now);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity3, entities[0]);
+
+	// Entities stuck for too long no longer count
+	scheduler.onEntityDiscovered(entity1, false, now);
+	EXPECT_FALSE(scheduler.requestStaticModel(entity1, now));
+	entities = scheduler.getEntitiesToStart(now + EnumerationScheduler::Timeout);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity1, entities[0]);
+
+	// Disabling releases all waiting entities
+	scheduler.onEntityDiscovered(entity2, false, now);
+	EXPECT_FALSE(scheduler.requestStaticModel(entity2, now));
+	scheduler.disable();
+	entities = scheduler.getEntitiesToStart(now);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity2, entities[0]);
+
+	// Changing the priority of a waiting entity moves it in the queue (entity1 still uses the budget)
+	auto const later = now + EnumerationScheduler::Timeout;
+	scheduler.enable(1u);
+	scheduler.setPriority(entity4, std::nullopt);
+	scheduler.onEntityDiscovered(entity3, true, later);
+	scheduler.onEntityDiscovered(entity4, false, later);
+	EXPECT_FALSE(scheduler.requestStaticModel(entity3, later));
+	EXPECT_FALSE(scheduler.requestStaticModel(entity4, later));
+	scheduler.setPriority(entity4, Priority::Visible);
+	scheduler.onStaticModelCompleted(entity1);
+	entities = scheduler.getEntitiesToStart(later);
+	ASSERT_EQ(1u, entities.size());
+	EXPECT_EQ(entity4, entities[0]);
+	EXPECT_EQ(1u, scheduler.getStatistics(later).waitingEntities);
+	EXPECT_EQ(1u, scheduler.getStatistics(later).enumeratingEntities);
+}
+
+TEST(EnumerationScheduler, Statistics)
+{
+	using EnumerationScheduler = la::avdecc::controller::EnumerationScheduler;
+	auto scheduler = EnumerationScheduler{};
+	auto const start = EnumerationScheduler::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const entity1 = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+	auto const entity2 = la::avdecc::UniqueIdentifier{ 0x0001000000000002 };
+
+	EXPECT_FALSE(scheduler.getStatistics(start).timeToFirstUsableEntity);
+
+	// Entities are only counted in the budget while scheduling
+	scheduler.enable(2u);
+	scheduler.onEntityDiscovered(entity1, false, start);
+	scheduler.onEntityDiscovered(entity2, false, start + std::chrono::milliseconds{ 100 });
+	EXPECT_TRUE(scheduler.requestStaticModel(entity1, start));
+	EXPECT_TRUE(scheduler.requestStaticModel(entity2, start + std::chrono::milliseconds{ 100 }));
+	EXPECT_EQ(2u, scheduler.getStatistics(start + std::chrono::milliseconds{ 100 }).enumeratingEntities);
+
+	scheduler.onStaticModelCompleted(entity2);
+	scheduler.onEntityUsable(entity2, start + std::chrono::milliseconds{ 300 });
+	scheduler.onStaticModelCompleted(entity1);
+	scheduler.onEntityUsable(entity1, start + std::chrono::milliseconds{ 600 });
+
+	auto const statistics = scheduler.getStatistics(start + std::chrono::milliseconds{ 600 });
+	EXPECT_EQ(0u, statistics.waitingEntities);
+	EXPECT_EQ(0u, statistics.enumeratingEntities);
+	EXPECT_EQ(2u, statistics.usableEntities);
+	ASSERT_TRUE(statistics.timeToFirstUsableEntity);
+	EXPECT_EQ(std::chrono::milliseconds{ 300 }, *statistics.timeToFirstUsableEntity);
+	EXPECT_EQ(std::chrono::milliseconds{ 400 }, statistics.averageTimeToUsable);
+	EXPECT_EQ(std::chrono::milliseconds{ 600 }, statistics.maxTimeToUsable);
+}
+
+TEST(RecentEntityModels, TakeEntityModel)
+{
+	using RecentEntityModels = la::avdecc::controller::RecentEntityModels;
+	auto models = RecentEntityModels{};
+	auto const start = RecentEntityModels::Clock::time_point{} + std::chrono::hours{ 1 };
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+	auto const entityModelID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	auto const otherEntityModelID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000002 };
+	auto const makeModel = []()
+	{
+		auto entityNode = la::avdecc::controller::model::EntityNode{};
+		entityNode.configurations.emplace(la::avdecc::entity::model::ConfigurationIndex{ 0u }, la::avdecc::controller::model::ConfigurationNode{ la::avdecc::entity::model::ConfigurationIndex{ 0u } });
+		return entityNode;
+	};
+
+	// Same model
+	models.addEntityModel(entityID, entityModelID, makeModel(), start);
+	auto model = models.takeEntityModel(entityID, entityModelID, start + std::chrono::seconds{ 1 });
+	ASSERT_TRUE(model.has_value());
+	EXPECT_EQ(1u, model->configurations.size());
+	EXPECT_EQ(0u, models.getEntityModelsCount());
+
+	// Different model
+	models.addEntityModel(entityID, entityModelID, makeModel(), start);
+	EXPECT_FALSE(models.takeEntityModel(entityID, otherEntityModelID, start + std::chrono::seconds{ 1 }).has_value());
+	EXPECT_EQ(0u, models.getEntityModelsCount());
+
+	// Expired model
+	models.addEntityModel(entityID, entityModelID, makeModel(), start);
+	EXPECT_FALSE(models.takeEntityModel(entityID, entityModelID, start + RecentEntityModels::RetentionTime).has_value());
+}
+
+TEST(StreamConnectionsIndex, ConnectDisconnect)
+{
+	auto index = la::avdecc::controller::StreamConnectionsIndex{};
+	auto const talker = la::avdecc::entity::model::StreamIdentification{ la::avdecc::UniqueIdentifier{ 0x0001000000000001 }, 0u };
+	auto const otherTalker = la::avdecc::entity::model::StreamIdentification{ la::avdecc::UniqueIdentifier{ 0x0001000000000001 }, 1u };
+	auto const listener1 = la::avdecc::entity::model::StreamIdentification{ la::avdecc::UniqueIdentifier{ 0x0001000000000002 }, 0u };
+	auto const listener2 = la::avdecc::entity::model::StreamIdentification{ la::avdecc::UniqueIdentifier{ 0x0001000000000003 }, 2u };
+
+	index.setListenerConnection(listener1, talker);
+	index.setListenerConnection(listener2, talker);
+	EXPECT_EQ(2u, index.getListeners(talker).size());
+	ASSERT_TRUE(index.getTalker(listener1).has_value());
+	EXPECT_EQ(talker, *index.getTalker(listener1));
+
+	// Switch to another talker
+	index.setListenerConnection(listener1, otherTalker);
+	EXPECT_EQ(1u, index.getListeners(talker).size());
+	EXPECT_EQ(1u, index.getListeners(otherTalker).count(listener1));
+
+	// Disconnect
+	index.setListenerConnection(listener2, {});
+	EXPECT_TRUE(index.getListeners(talker).empty());
+	EXPECT_FALSE(index.getTalker(listener2).has_value());
+	EXPECT_EQ(1u, index.size());
+}
+
+TEST(StreamConnectionsIndex, RemoveListenerEntity)
+{
+	auto index = la::avdecc::controller::StreamConnectionsIndex{};
+	auto const talkerID = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+	auto const listenerID = la::avdecc::UniqueIdentifier{ 0x0001000000000002 };
+	auto const otherListenerID = la::avdecc::UniqueIdentifier{ 0x0001000000000003 };
+
+	for (auto streamIndex = la::avdecc::entity::model::StreamIndex{ 0u }; streamIndex < 4u; ++streamIndex)
+	{
+		index.setListenerConnection({ listenerID, streamIndex }, { talkerID, streamIndex });
+		index.setListenerConnection({ otherListenerID, streamIndex }, { talkerID, 0u });
+	}
+	// Talker streams of the listener entity itself
+	index.setListenerConnection({ otherListenerID, 4u }, { listenerID, 0u });
+
+	index.removeListenerEntity(listenerID);
+	EXPECT_EQ(5u, index.size());
+	EXPECT_EQ(4u, index.getListeners({ talkerID, 0u }).size());
+	EXPECT_TRUE(index.getListeners({ talkerID, 1u }).empty());
+	EXPECT_EQ(1u, index.getListeners({ listenerID, 0u }).size());
+}
+
+TEST(MediaClockChainsIndex, Dependencies)
+{
+	auto index = la::avdecc::controller::MediaClockChainsIndex{};
+	auto const entityA = la::avdecc::UniqueIdentifier{ 0x000000000000000A };
+	auto const entityB = la::avdecc::UniqueIdentifier{ 0x000000000000000B };
+	auto const entityC = la::avdecc::UniqueIdentifier{ 0x000000000000000C };
+	auto const makeChain = [](std::vector<la::avdecc::UniqueIdentifier> const& entities)
+	{
+		auto chain = la::avdecc::controller::model::MediaClockChain{};
+		for (auto const entityID : entities)
+		{
+			auto node = la::avdecc::controller::model::MediaClockChainNode{};
+			node.entityID = entityID;
+			chain.push_back(node);
+		}
+		return chain;
+	};
+
+	// C -> B -> A, and B -> A
+	index.setChain({ entityC, 0u }, makeChain({ entityC, entityB, entityA }));
+	index.setChain({ entityB, 0u }, makeChain({ entityB, entityA }));
+	EXPECT_EQ(2u, index.getChains(entityA).size());
+	EXPECT_EQ(1u, index.getChains(entityC).size());
+
+	// C now only has its internal clock
+	index.setChain({ entityC, 0u }, makeChain({ entityC }));
+	EXPECT_EQ(1u, index.getChains(entityA).size());
+	EXPECT_EQ(1u, index.getChains(entityB).size());
+
+	// B goes offline
+	index.removeEntityChains(entityB);
+	EXPECT_TRUE(index.getChains(entityA).empty());
+	EXPECT_TRUE(index.getChains(entityB).empty());
+	EXPECT_EQ(1u, index.size());
+}
+
+TEST(ControlValuesStreams, DecimationAndRing)
+{
+	auto streams = la::avdecc::controller::ControlValuesStreams{};
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001000000000001 };
+	auto const packValue = [](std::uint8_t const value)
+	{
+		auto buffer = la::avdecc::MemoryBuffer{};
+		buffer.append(value);
+		return buffer;
+	};
+
+	// Nobody is streaming
+	EXPECT_FALSE(streams.dispatch(entityID, 0u, packValue(1u)));
+
+	// One sample out of 2 is kept, ring of 4 samples
+	auto const subscription = std::make_shared<la::avdecc::controller::ControlValuesSubscriptionImpl>(entityID, la::avdecc::entity::model::ControlIndex{ 0u }, std::uint16_t{ 2u }, std::uint16_t{ 4u });
+	streams.addSubscription(subscription, la::avdecc::entity::model::ControlValueType::Type::ControlLinearUInt8, 1u);
+	EXPECT_FALSE(streams.dispatch(entityID, 1u, packValue(1u)));
+	for (auto value = std::uint8_t{ 1u }; value <= 12u; ++value)
+	{
+		EXPECT_TRUE(streams.dispatch(entityID, 0u, packValue(value)));
+	}
+
+	// 6 samples pass the decimation, only 4 are kept and 2 are dropped as the ring is full
+	EXPECT_EQ(2u, subscription->getDroppedSamplesCount());
+	auto sample = la::avdecc::controller::Controller::ControlValuesSubscription::Sample{};
+	for (auto const expected : { 2.0, 4.0, 6.0, 8.0 })
+	{
+		ASSERT_TRUE(subscription->pop(sample));
+		EXPECT_EQ(1u, sample.valuesCount);
+		EXPECT_EQ(expected, sample.values[0]);
+	}
+	EXPECT_FALSE(subscription->pop(sample));
+
+	// Truncated values are not streamed
+	EXPECT_FALSE(streams.dispatch(entityID, 0u, la::avdecc::MemoryBuffer{}));
+
+	streams.removeSubscription(subscription.get());
+	EXPECT_FALSE(streams.dispatch(entityID, 0u, packValue(1u)));
+
+	// All the subscriptions of an entity are dropped when it goes offline (or changes its configuration)
+	auto const otherEntityID = la::avdecc::UniqueIdentifier{ 0x0001000000000002 };
+	auto const otherSubscription = std::make_shared<la::avdecc::controller::ControlValuesSubscriptionImpl>(otherEntityID, la::avdecc::entity::model::ControlIndex{ 0u }, std::uint16_t{ 1u }, std::uint16_t{ 4u });
+	streams.addSubscription(std::make_shared<la::avdecc::controller::ControlValuesSubscriptionImpl>(entityID, la::avdecc::entity::model::ControlIndex{ 0u }, std::uint16_t{ 1u }, std::uint16_t{ 4u }), la::avdecc::entity::model::ControlValueType::Type::ControlLinearUInt8, 1u);
+	streams.addSubscription(std::make_shared<la::avdecc::controller::ControlValuesSubscriptionImpl>(entityID, la::avdecc::entity::model::ControlIndex{ 1u }, std::uint16_t{ 1u }, std::uint16_t{ 4u }), la::avdecc::entity::model::ControlValueType::Type::ControlLinearUInt8, 1u);
+	streams.addSubscription(otherSubscription, la::avdecc::entity::model::ControlValueType::Type::ControlLinearUInt8, 1u);
+	streams.removeEntity(entityID);
+	EXPECT_FALSE(streams.dispatch(entityID, 0u, packValue(1u)));
+	EXPECT_FALSE(streams.dispatch(entityID, 1u, packValue(1u)));
+	EXPECT_TRUE(streams.dispatch(otherEntityID, 0u, packValue(1u)));
+	streams.removeSubscription(otherSubscription.get());
+
+	EXPECT_TRUE(la::avdecc::controller::ControlValuesStreams::isStreamable(la::avdecc::entity::model::ControlValueType::Type::ControlArrayFloat));
+	EXPECT_FALSE(la::avdecc::controller::ControlValuesStreams::isStreamable(la::avdecc::entity::model::ControlValueType::Type::ControlUtf8));
+}
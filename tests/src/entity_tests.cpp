@@ -24,8 +24,14 @@
 
 // Public API
 #include <la/avdecc/internals/entity.hpp>
+#include <la/avdecc/internals/entityModelTreeDynamic.hpp>
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
 
 TEST(Entity, GenerateEID)
 {
@@ -43,3 +49,149 @@ TEST(Entity, GenerateEID)
 		EXPECT_EQ(0x0102030405067788u, eid.getValue());
 	}
 }
+
+TEST(DescriptorCountersStorage, MapInterface)
+{
+	auto counters = la::avdecc::entity::model::StreamInputCounters{};
+	EXPECT_TRUE(counters.empty());
+	EXPECT_EQ(counters.end(), counters.find(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked));
+
+	counters[la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked] = 3u;
+	counters.insert(std::make_pair(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked, 5u));
+	EXPECT_EQ(2u, counters.size());
+	EXPECT_EQ(5u, counters.at(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked));
+	EXPECT_THROW(counters.at(la::avdecc::entity::StreamInputCounterValidFlag::FramesRx), std::out_of_range);
+
+	// Not a single bit flag: rejected
+	EXPECT_FALSE(la::avdecc::entity::model::StreamInputCounters::isValidKey(la::avdecc::entity::StreamInputCounterValidFlag::None));
+	EXPECT_THROW(counters.insert(std::make_pair(la::avdecc::entity::StreamInputCounterValidFlag::None, 1u)), std::out_of_range);
+	EXPECT_THROW(counters.emplace(static_cast<la::avdecc::entity::StreamInputCounterValidFlag>(0x3u), 1u), std::out_of_range);
+	EXPECT_EQ(2u, counters.size());
+
+	// Iteration is in ascending flag order, over valid counters only
+	auto it = counters.begin();
+	ASSERT_NE(counters.end(), it);
+	EXPECT_EQ(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked, it->first);
+	++it;
+	ASSERT_NE(counters.end(), it);
+	EXPECT_EQ(la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked, it->first);
+	EXPECT_EQ(3u, it->second);
+	++it;
+	EXPECT_EQ(counters.end(), it);
+
+	EXPECT_EQ(1u, counters.erase(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked));
+	EXPECT_EQ(0u, counters.count(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked));
+	EXPECT_EQ(1u, counters.size());
+}
+
+TEST(DescriptorCountersStorage, ChangesTracking)
+{
+	auto counters = la::avdecc::entity::model::StreamInputCounters{};
+	auto validFlags = la::avdecc::entity::StreamInputCounterValidFlags{ la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked, la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked };
+	auto rawCounters = la::avdecc::entity::model::DescriptorCounters{};
+	auto const lockedPosition = validFlags.getPosition(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked);
+	auto const unlockedPosition = validFlags.getPosition(la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked);
+
+	// First update: all counters are new
+	rawCounters[lockedPosition] = 10u;
+	rawCounters[unlockedPosition] = 9u;
+	counters.update(validFlags, rawCounters);
+	EXPECT_EQ(validFlags, counters.getChangedCounters());
+	EXPECT_EQ(0u, counters.getDelta(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked));
+
+	// Same values: nothing changed
+	counters.update(validFlags, rawCounters);
+	EXPECT_TRUE(counters.getChangedCounters().empty());
+
+	// Only one counter changes
+	rawCounters[lockedPosition] = 12u;
+	counters.update(validFlags, rawCounters);
+	EXPECT_EQ(la::avdecc::entity::StreamInputCounterValidFlags{ la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked }, counters.getChangedCounters());
+	EXPECT_EQ(2u, counters.getDelta(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked));
+	EXPECT_EQ(0u, counters.getDelta(la::avdecc::entity::StreamInputCounterValidFlag::MediaUnlocked));
+	EXPECT_EQ(12u, counters.at(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked));
+
+	// Counter wrap around
+	rawCounters[lockedPosition] = 1u;
+	auto wrapped = counters;
+	wrapped.update(validFlags, rawCounters);
+	EXPECT_EQ(static_cast<la::avdecc::entity::model::DescriptorCounter>(1u - 12u), wrapped.getDelta(la::avdecc::entity::StreamInputCounterValidFlag::MediaLocked));
+
+	// Equality ignores changes tracking
+	EXPECT_NE(counters, wrapped);
+	counters.update(validFlags, rawCounters);
+	EXPECT_EQ(counters, wrapped);
+}
+
+TEST(FlatSet, SetInterface)
+{
+	auto rates = la::avdecc::entity::model::SamplingRates{ la::avdecc::entity::model::SamplingRate{ 0, 96000 }, la::avdecc::entity::model::SamplingRate{ 0, 48000 } };
+	EXPECT_TRUE(rates.isInline());
+	EXPECT_EQ(2u, rates.size());
+	EXPECT_EQ(la::avdecc::entity::model::SamplingRate(0, 48000), *rates.begin());
+
+	// Duplicates are ignored
+	EXPECT_FALSE(rates.insert(la::avdecc::entity::model::SamplingRate{ 0, 96000 }).second);
+	EXPECT_TRUE(rates.insert(la::avdecc::entity::model::SamplingRate{ 0, 44100 }).second);
+	EXPECT_EQ(3u, rates.size());
+	EXPECT_EQ(1u, rates.count(la::avdecc::entity::model::SamplingRate{ 0, 44100 }));
+	EXPECT_EQ(rates.end(), rates.find(la::avdecc::entity::model::SamplingRate{ 0, 192000 }));
+
+	EXPECT_EQ(1u, rates.erase(la::avdecc::entity::model::SamplingRate{ 0, 48000 }));
+	EXPECT_EQ(0u, rates.erase(la::avdecc::entity::model::SamplingRate{ 0, 48000 }));
+	EXPECT_EQ(2u, rates.size());
+
+	auto const copy = rates;
+	EXPECT_EQ(copy, rates);
+	rates.clear();
+	EXPECT_TRUE(rates.empty());
+	EXPECT_NE(copy, rates);
+}
+
+TEST(FlatSet, SameOrderingAsStdSet)
+{
+	auto const values = std::vector<std::uint16_t>{ 12u, 3u, 7u, 3u, 25u, 0u, 18u, 7u, 4u, 31u, 1u, 9u, 25u, 2u };
+	auto flatSet = la::avdecc::utils::FlatSet<std::uint16_t, 4>{};
+	auto stdSet = std::set<std::uint16_t>{};
+
+	for (auto const v : values)
+	{
+		EXPECT_EQ(stdSet.insert(v).second, flatSet.insert(v).second);
+		EXPECT_EQ(stdSet.size(), flatSet.size());
+		EXPECT_TRUE(std::equal(stdSet.begin(), stdSet.end(), flatSet.begin(), flatSet.end()));
+	}
+	// Moved to heap storage once inline capacity is exceeded
+	EXPECT_FALSE(flatSet.isInline());
+
+	for (auto const v : values)
+	{
+		EXPECT_EQ(stdSet.erase(v), flatSet.erase(v));
+		EXPECT_TRUE(std::equal(stdSet.begin(), stdSet.end(), flatSet.begin(), flatSet.end()));
+	}
+	EXPECT_TRUE(flatSet.empty());
+}
+
+TEST(SmallVector, SelfReferencingInsertion)
+{
+	// Inserting one of its own elements when the inline storage is full (the element must be read before being relocated to the heap)
+	{
+		auto v = la::avdecc::utils::SmallVector<int, 1>{};
+		v.push_back(42);
+		v.push_back(v.front());
+		EXPECT_FALSE(v.isInline());
+		EXPECT_EQ((la::avdecc::utils::SmallVector<int, 1>{ 42, 42 }), v);
+	}
+	{
+		auto v = la::avdecc::utils::SmallVector<std::string, 2>{};
+		v.emplace_back("first");
+		v.emplace_back("second");
+		v.emplace_back(v.back());
+		v.emplace_back(v[0], 0u, 3u);
+		EXPECT_EQ((la::avdecc::utils::SmallVector<std::string, 2>{ "first", "second", "second", "fir" }), v);
+	}
+	{
+		auto v = la::avdecc::utils::SmallVector<int, 2>{ 7 };
+		v.resize(5u, v.front());
+		EXPECT_EQ((la::avdecc::utils::SmallVector<int, 2>{ 7, 7, 7, 7, 7 }), v);
+	}
+}
@@ -0,0 +1,279 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_pcapReplay_tests.cpp
+* @author Christophe Calmejane
+*/
+
+// Public API
+#include <la/avdecc/executor.hpp>
+
+// Internal API
+#include "protocolInterface/protocolInterface_pcapReplay.hpp"
+#include "sampleFrames.hpp"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <chrono>
+#include <string>
+#include <memory>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+static auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
+static auto const ReplayMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x1B, 0x92, 0x00, 0x00, 0xC1 } };
+
+struct CapturedFrame
+{
+	std::chrono::microseconds timestamp{};
+	std::vector<std::uint8_t> data{};
+};
+
+/** Writes a (classic format) pcap capture file containing the specified ethernet frames */
+std::string writeCaptureFile(std::string const& fileName, std::vector<CapturedFrame> const& frames)
+{
+	auto const filePath = (std::filesystem::temp_directory_path() / fileName).string();
+	auto stream = std::ofstream{ filePath, std::ios::binary | std::ios::trunc };
+
+	auto const write32 = [&stream](std::uint32_t const value)
+	{
+		stream.write(reinterpret_cast<char const*>(&value), sizeof(value));
+	};
+	auto const write16 = [&stream](std::uint16_t const value)
+	{
+		stream.write(reinterpret_cast<char const*>(&value), sizeof(value));
+	};
+
+	// Global header (written in native byte order, the magic number telling the reader which one it is)
+	write32(0xa1b2c3d4); // Magic number (microsecond resolution)
+	write16(2); // Major version
+	write16(4); // Minor version
+	write32(0); // Timezone offset
+	write32(0); // Timestamp accuracy
+	write32(65535); // Snapshot length
+	write32(1); // Link type (LINKTYPE_ETHERNET)
+
+	// Records
+	for (auto const& frame : frames)
+	{
+		write32(static_cast<std::uint32_t>(frame.timestamp.count() / 1000000));
+		write32(static_cast<std::uint32_t>(frame.timestamp.count() % 1000000));
+		write32(static_cast<std::uint32_t>(frame.data.size())); // Captured length
+		write32(static_cast<std::uint32_t>(frame.data.size())); // Original length
+		stream.write(reinterpret_cast<char const*>(frame.data.data()), frame.data.size());
+	}
+
+	return filePath;
+}
+
+std::vector<std::uint8_t> makeNonAvdeccFrame()
+{
+	auto frame = std::vector<std::uint8_t>(60u, std::uint8_t{ 0u });
+	// Broadcast destination, IPv4 EtherType
+	std::fill_n(frame.begin(), 6, std::uint8_t{ 0xFF });
+	frame[12] = 0x08;
+	frame[13] = 0x00;
+	return frame;
+}
+
+class ProtocolInterfacePCapReplay_F : public ::testing::Test
+{
+public:
+	virtual void SetUp() override
+	{
+		_ew = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	}
+
+	virtual void TearDown() override
+	{
+		_pi.reset();
+	}
+
+	/** Returns true if the pcap library is available (capture files cannot be replayed without it) */
+	bool isSupported() const noexcept
+	{
+		if (!la::avdecc::protocol::ProtocolInterfacePcapReplay::isSupported())
+		{
+			std::cout << "Pcap library not available, cannot replay capture files\n";
+			return false;
+		}
+		return true;
+	}
+
+	la::avdecc::protocol::ProtocolInterfacePcapReplay& createProtocolInterface(std::string const& captureFilePath, la::avdecc::protocol::ProtocolInterfacePcapReplay::ReplayMode const replayMode)
+	{
+		_pi = std::unique_ptr<la::avdecc::protocol::ProtocolInterfacePcapReplay>(la::avdecc::protocol::ProtocolInterfacePcapReplay::createRawProtocolInterfacePcapReplay(captureFilePath, ReplayMacAddress, DefaultExecutorName, replayMode));
+		return *_pi;
+	}
+
+private:
+	la::avdecc::ExecutorManager::ExecutorWrapper::UniquePointer _ew{ nullptr, nullptr };
+	std::unique_ptr<la::avdecc::protocol::ProtocolInterfacePcapReplay> _pi{ nullptr };
+};
+} // namespace
+
+TEST_F(ProtocolInterfacePCapReplay_F, InvalidFile)
+{
+	if (isSupported())
+	{
+		// Not using EXPECT_THROW, we want to check the error code inside our custom exception
+		try
+		{
+			createProtocolInterface((std::filesystem::temp_directory_path() / "avdecc_no_such_capture.pcap").string(), la::avdecc::protocol::ProtocolInterfacePcapReplay::ReplayMode::AsFastAsPossible);
+			EXPECT_FALSE(true); // We expect an exception to have been raised
+		}
+		catch (la::avdecc::protocol::ProtocolInterface::Exception const& e)
+		{
+			EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::InterfaceNotFound, e.getError());
+		}
+	}
+}
+
+TEST_F(ProtocolInterfacePCapReplay_F, ReplayAsFastAsPossible)
+{
+	class Observer : public la::avdecc::protocol::ProtocolInterface::Observer
+	{
+	public:
+		std::future<la::avdecc::UniqueIdentifier> getEntityOnlineFuture() noexcept
+		{
+			return _entityOnlinePromise.get_future();
+		}
+
+	private:
+		// la::avdecc::protocol::ProtocolInterface::Observer overrides
+		virtual void onRemoteEntityOnline(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::entity::Entity const& entity) noexcept override
+		{
+			_entityOnlinePromise.set_value(entity.getEntityID());
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(Observer);
+
+		std::promise<la::avdecc::UniqueIdentifier> _entityOnlinePromise{};
+	};
+
+	if (isSupported())
+	{
+		auto const adpFrame = sampleFrames::makeAdpFrame().data;
+		auto const truncatedFrame = std::vector<std::uint8_t>{ adpFrame.begin(), adpFrame.begin() + la::avdecc::protocol::EtherLayer2::HeaderLength };
+		auto const captureFilePath = writeCaptureFile("avdecc_replay_fast.pcap", { { std::chrono::seconds{ 10 }, makeNonAvdeccFrame() }, { std::chrono::seconds{ 11 }, adpFrame }, { std::chrono::seconds{ 12 }, truncatedFrame } });
+
+		Observer obs;
+		auto& pi = createProtocolInterface(captureFilePath, la::avdecc::protocol::ProtocolInterfacePcapReplay::ReplayMode::AsFastAsPossible);
+		pi.registerObserver(&obs);
+
+		auto const replayStart = std::chrono::steady_clock::now();
+		EXPECT_TRUE(pi.startReplay());
+		EXPECT_FALSE(pi.startReplay()); // Already started
+		ASSERT_TRUE(pi.waitForReplayCompleted(std::chrono::seconds{ 5 }));
+		// Frames 1 second apart in the capture, but replayed without any delay
+		EXPECT_GT(std::chrono::milliseconds{ 1000 }, std::chrono::steady_clock::now() - replayStart);
+
+		auto fut = obs.getEntityOnlineFuture();
+		ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds{ 1 }));
+		EXPECT_EQ(sampleFrames::TalkerEntityID, fut.get());
+
+		auto const statistics = pi.getStatistics();
+		EXPECT_EQ(3u, statistics.framesRead);
+		EXPECT_EQ(1u, statistics.framesDispatched);
+		EXPECT_EQ(2u, statistics.framesIgnored);
+
+		pi.unregisterObserver(&obs);
+		std::filesystem::remove(captureFilePath);
+	}
+}
+
+TEST_F(ProtocolInterfacePCapReplay_F, ReplayOriginalTiming)
+{
+	if (isSupported())
+	{
+		auto const adpFrame = sampleFrames::makeAdpFrame().data;
+		auto const captureFilePath = writeCaptureFile("avdecc_replay_timing.pcap", { { std::chrono::seconds{ 10 }, adpFrame }, { std::chrono::seconds{ 10 } + std::chrono::milliseconds{ 300 }, adpFrame } });
+
+		auto& pi = createProtocolInterface(captureFilePath, la::avdecc::protocol::ProtocolInterfacePcapReplay::ReplayMode::OriginalTiming);
+
+		auto const replayStart = std::chrono::steady_clock::now();
+		EXPECT_TRUE(pi.startReplay());
+		ASSERT_TRUE(pi.waitForReplayCompleted(std::chrono::seconds{ 5 }));
+		// The second frame must not have been dispatched before its time
+		EXPECT_LE(std::chrono::milliseconds{ 300 }, std::chrono::steady_clock::now() - replayStart);
+		EXPECT_EQ(2u, pi.getStatistics().framesDispatched);
+
+		std::filesystem::remove(captureFilePath);
+	}
+}
+
+TEST_F(ProtocolInterfacePCapReplay_F, ReplayBoundsFramesInFlight)
+{
+	if (isSupported())
+	{
+		static constexpr auto FramesCount = size_t{ 4u * la::avdecc::protocol::ProtocolInterfacePcapReplay::MaxFramesInFlight };
+		auto const frames = std::vector<CapturedFrame>(FramesCount, CapturedFrame{ std::chrono::seconds{ 10 }, makeNonAvdeccFrame() });
+		auto const captureFilePath = writeCaptureFile("avdecc_replay_bounded.pcap", frames);
+
+		auto& pi = createProtocolInterface(captureFilePath, la::avdecc::protocol::ProtocolInterfacePcapReplay::ReplayMode::AsFastAsPossible);
+
+		// Block the processing queue, the replay must stop reading the capture file
+		auto blockPromise = std::promise<void>{};
+		la::avdecc::ExecutorManager::getInstance().pushJob(DefaultExecutorName,
+			[blockFuture = blockPromise.get_future().share()]()
+			{
+				blockFuture.wait();
+			});
+
+		EXPECT_TRUE(pi.startReplay());
+		EXPECT_FALSE(pi.waitForReplayCompleted(std::chrono::milliseconds{ 200 }));
+		// The frame read when the limit is reached is only pushed once the queue has been drained
+		EXPECT_GE(la::avdecc::protocol::ProtocolInterfacePcapReplay::MaxFramesInFlight + 1u, pi.getStatistics().framesRead);
+
+		// Unblock the processing queue, all the frames must be replayed
+		blockPromise.set_value();
+		ASSERT_TRUE(pi.waitForReplayCompleted(std::chrono::seconds{ 5 }));
+		auto const statistics = pi.getStatistics();
+		EXPECT_EQ(FramesCount, statistics.framesRead);
+		EXPECT_EQ(FramesCount, statistics.framesIgnored);
+
+		std::filesystem::remove(captureFilePath);
+	}
+}
+
+TEST_F(ProtocolInterfacePCapReplay_F, CountSentMessages)
+{
+	if (isSupported())
+	{
+		auto const captureFilePath = writeCaptureFile("avdecc_replay_empty.pcap", {});
+
+		auto& pi = createProtocolInterface(captureFilePath, la::avdecc::protocol::ProtocolInterfacePcapReplay::ReplayMode::AsFastAsPossible);
+
+		// Nothing is sent on the network, only counted
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, pi.discoverRemoteEntities());
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, pi.discoverRemoteEntity(sampleFrames::TalkerEntityID));
+
+		auto const statistics = pi.getStatistics();
+		EXPECT_EQ(2u, statistics.adpduSent);
+		EXPECT_EQ(0u, statistics.aecpduSent);
+		EXPECT_EQ(0u, statistics.acmpduSent);
+		EXPECT_EQ(2u * (la::avdecc::protocol::EtherLayer2::HeaderLength + la::avdecc::protocol::AvtpduControl::HeaderLength + la::avdecc::protocol::Adpdu::Length), statistics.bytesSent);
+
+		std::filesystem::remove(captureFilePath);
+	}
+}
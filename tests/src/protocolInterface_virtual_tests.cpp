@@ -125,6 +125,77 @@ TEST(ProtocolInterfaceVirtual, SendMessage)
 	ASSERT_NE(std::future_status::timeout, status);
 }
 
+TEST(ProtocolInterfaceVirtual, SendMessagePreParsedPdu)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	class Observer : public la::avdecc::protocol::ProtocolInterface::Observer
+	{
+	public:
+		std::future<la::avdecc::entity::Entity> getFuture() noexcept
+		{
+			return _promise.get_future();
+		}
+
+	private:
+		virtual void onRemoteEntityOnline(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::entity::Entity const& entity) noexcept override
+		{
+			_promise.set_value(entity);
+		}
+		std::promise<la::avdecc::entity::Entity> _promise{};
+		DECLARE_AVDECC_OBSERVER_GUARD(Observer);
+	};
+
+	auto intfc1 = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterfacePreParsed", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } }, DefaultExecutorName));
+	auto intfc2 = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterfacePreParsed", { { 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b } }, DefaultExecutorName));
+	auto intfc3 = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterfacePreParsed", { { 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11 } }, DefaultExecutorName));
+	intfc1->setPreParsedPduDelivery(true);
+
+	auto obs2 = Observer{};
+	auto obs3 = Observer{};
+	intfc2->registerObserver(&obs2);
+	intfc3->registerObserver(&obs3);
+
+	// Build adpdu frame
+	auto adpdu = la::avdecc::protocol::Adpdu{};
+	// Set Ether2 fields
+	adpdu.setSrcAddress(intfc1->getMacAddress());
+	adpdu.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+	// Set ADP fields
+	adpdu.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+	adpdu.setValidTime(2);
+	adpdu.setEntityID(la::avdecc::UniqueIdentifier{ 0x0001020304050607 });
+	adpdu.setEntityModelID(la::avdecc::UniqueIdentifier{ 0x0102030405060708 });
+	adpdu.setEntityCapabilities({});
+	adpdu.setTalkerStreamSources(0);
+	adpdu.setTalkerCapabilities({});
+	adpdu.setListenerStreamSinks(0);
+	adpdu.setListenerCapabilities({});
+	adpdu.setControllerCapabilities(la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented });
+	adpdu.setAvailableIndex(1);
+	adpdu.setGptpGrandmasterID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setGptpDomainNumber(0);
+	adpdu.setIdentifyControlIndex(0);
+	adpdu.setInterfaceIndex(0);
+	adpdu.setAssociationID(la::avdecc::UniqueIdentifier{});
+
+	auto fut2 = obs2.getFuture();
+	auto fut3 = obs3.getFuture();
+
+	// Send the adp message, it will be shared (already parsed) by all the other interfaces
+	intfc1->sendAdpMessage(adpdu);
+
+	ASSERT_NE(std::future_status::timeout, fut2.wait_for(std::chrono::milliseconds(100)));
+	ASSERT_NE(std::future_status::timeout, fut3.wait_for(std::chrono::milliseconds(100)));
+
+	auto const entity2 = fut2.get();
+	auto const entity3 = fut3.get();
+	EXPECT_EQ(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, entity2.getEntityID());
+	EXPECT_EQ(la::avdecc::UniqueIdentifier{ 0x0102030405060708 }, entity2.getEntityModelID());
+	EXPECT_EQ(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, entity3.getEntityID());
+	EXPECT_EQ(la::avdecc::UniqueIdentifier{ 0x0102030405060708 }, entity3.getEntityModelID());
+}
+
 TEST(ProtocolInterfaceVirtual, RegisterAfterDiscoveredEntities)
 {
 	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
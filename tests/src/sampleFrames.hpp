@@ -0,0 +1,239 @@
+/*
+* Copyright (C) 2016-2025, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file sampleFrames.hpp
+* @author Christophe Calmejane
+* @brief Representative AVDECC frames of each PDU type, shared by the fuzzers (seed corpus) and the benchmarks.
+*/
+
+#pragma once
+
+// Public API
+#include <la/avdecc/internals/protocolAdpdu.hpp>
+#include <la/avdecc/internals/protocolAcmpdu.hpp>
+#include <la/avdecc/internals/protocolAemAecpdu.hpp>
+#include <la/avdecc/internals/protocolAaAecpdu.hpp>
+#include <la/avdecc/internals/protocolMvuAecpdu.hpp>
+
+// Internal API
+#include "protocol/protocolAemPayloads.hpp"
+#include "protocol/protocolMvuPayloads.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** A complete Ethernet frame (EtherLayer2 header included), as received from the network */
+struct SampleFrame
+{
+	std::string name{};
+	std::vector<std::uint8_t> data{};
+};
+using SampleFrames = std::vector<SampleFrame>;
+
+namespace sampleFrames
+{
+static auto constexpr TalkerEntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE000001 };
+static auto constexpr ListenerEntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE000002 };
+static auto constexpr ControllerEntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE0000C0 };
+static auto const EntityMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x1B, 0x92, 0x00, 0x00, 0x01 } };
+static auto const ControllerMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x1B, 0x92, 0x00, 0x00, 0xC0 } };
+
+template<class PduType>
+std::vector<std::uint8_t> serializeFrame(la::avdecc::protocol::EtherLayer2 const& pdu)
+{
+	auto buffer = la::avdecc::protocol::SerializationBuffer{};
+
+	// Start with EtherLayer2
+	la::avdecc::protocol::serialize<la::avdecc::protocol::EtherLayer2>(pdu, buffer);
+	// Then Avtp control
+	la::avdecc::protocol::serialize<la::avdecc::protocol::AvtpduControl>(pdu, buffer);
+	// Then the PDU itself
+	la::avdecc::protocol::serialize<PduType>(pdu, buffer);
+
+	return { buffer.data(), buffer.data() + buffer.size() };
+}
+
+inline SampleFrame makeAdpFrame()
+{
+	auto adpdu = la::avdecc::protocol::Adpdu{};
+	adpdu.setSrcAddress(EntityMacAddress);
+	adpdu.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+	adpdu.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+	adpdu.setValidTime(31);
+	adpdu.setEntityID(TalkerEntityID);
+	adpdu.setEntityModelID(la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 });
+	adpdu.setEntityCapabilities(la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported, la::avdecc::entity::EntityCapability::VendorUniqueSupported });
+	adpdu.setTalkerStreamSources(2);
+	adpdu.setTalkerCapabilities(la::avdecc::entity::TalkerCapabilities{ la::avdecc::entity::TalkerCapability::Implemented, la::avdecc::entity::TalkerCapability::AudioSource });
+	adpdu.setListenerStreamSinks(2);
+	adpdu.setListenerCapabilities(la::avdecc::entity::ListenerCapabilities{ la::avdecc::entity::ListenerCapability::Implemented, la::avdecc::entity::ListenerCapability::AudioSink });
+	adpdu.setControllerCapabilities({});
+	adpdu.setAvailableIndex(12);
+	adpdu.setGptpGrandmasterID(la::avdecc::UniqueIdentifier{ 0x001B92FFFE00AAAA });
+	adpdu.setGptpDomainNumber(0);
+	adpdu.setIdentifyControlIndex(0);
+	adpdu.setInterfaceIndex(0);
+	adpdu.setAssociationID(la::avdecc::UniqueIdentifier{});
+	return { "adp_entity_available", serializeFrame<la::avdecc::protocol::Adpdu>(adpdu) };
+}
+
+inline SampleFrame makeAcmpFrame()
+{
+	auto acmpdu = la::avdecc::protocol::Acmpdu{};
+	acmpdu.setSrcAddress(EntityMacAddress);
+	acmpdu.setDestAddress(la::avdecc::protocol::Acmpdu::Multicast_Mac_Address);
+	acmpdu.setMessageType(la::avdecc::protocol::AcmpMessageType::ConnectRxResponse);
+	acmpdu.setStatus(la::avdecc::protocol::AcmpStatus::Success);
+	acmpdu.setControllerEntityID(ControllerEntityID);
+	acmpdu.setTalkerEntityID(TalkerEntityID);
+	acmpdu.setListenerEntityID(ListenerEntityID);
+	acmpdu.setTalkerUniqueID(0);
+	acmpdu.setListenerUniqueID(1);
+	acmpdu.setStreamDestAddress({ { 0x91, 0xE0, 0xF0, 0x00, 0x12, 0x34 } });
+	acmpdu.setConnectionCount(1);
+	acmpdu.setSequenceID(42);
+	acmpdu.setFlags(la::avdecc::entity::ConnectionFlags{ la::avdecc::entity::ConnectionFlag::StreamingWait });
+	acmpdu.setStreamVlanID(2);
+	return { "acmp_connect_rx_response", serializeFrame<la::avdecc::protocol::Acmpdu>(acmpdu) };
+}
+
+template<size_t PayloadSize>
+SampleFrame makeAemFrame(std::string const& name, bool const isResponse, bool const isUnsolicited, la::avdecc::protocol::AemCommandType const commandType, la::avdecc::Serializer<PayloadSize> const& payload)
+{
+	auto aecpdu = la::avdecc::protocol::AemAecpdu{ isResponse };
+	aecpdu.setSrcAddress(isResponse ? EntityMacAddress : ControllerMacAddress);
+	aecpdu.setDestAddress(isResponse ? ControllerMacAddress : EntityMacAddress);
+	aecpdu.setStatus(la::avdecc::protocol::AecpStatus::Success);
+	aecpdu.setTargetEntityID(TalkerEntityID);
+	aecpdu.setControllerEntityID(ControllerEntityID);
+	aecpdu.setSequenceID(1234);
+	aecpdu.setUnsolicited(isUnsolicited);
+	aecpdu.setCommandType(commandType);
+	aecpdu.setCommandSpecificData(payload.data(), payload.usedBytes());
+	return { name, serializeFrame<la::avdecc::protocol::Aecpdu>(aecpdu) };
+}
+
+inline SampleFrame makeAaFrame()
+{
+	auto aecpdu = la::avdecc::protocol::AaAecpdu{ true };
+	aecpdu.setSrcAddress(EntityMacAddress);
+	aecpdu.setDestAddress(ControllerMacAddress);
+	aecpdu.setStatus(la::avdecc::protocol::AecpStatus::Success);
+	aecpdu.setTargetEntityID(TalkerEntityID);
+	aecpdu.setControllerEntityID(ControllerEntityID);
+	aecpdu.setSequenceID(1235);
+	aecpdu.addTlv(la::avdecc::entity::addressAccess::Tlv{ 0x1000, la::avdecc::protocol::AaMode::Read, la::avdecc::entity::addressAccess::Tlv::memory_data_type(64u, std::uint8_t{ 0xA5 }) });
+	return { "aa_read_response", serializeFrame<la::avdecc::protocol::Aecpdu>(aecpdu) };
+}
+
+inline SampleFrame makeMvuFrame()
+{
+	auto info = la::avdecc::entity::model::MilanInfo{};
+	info.protocolVersion = 1;
+	info.featuresFlags = la::avdecc::entity::MilanInfoFeaturesFlags{ la::avdecc::entity::MilanInfoFeaturesFlag::Redundancy };
+	info.certificationVersion = 0x01000000;
+	auto const payload = la::avdecc::protocol::mvuPayload::serializeGetMilanInfoResponse(info);
+
+	auto aecpdu = la::avdecc::protocol::MvuAecpdu{ true };
+	aecpdu.setSrcAddress(EntityMacAddress);
+	aecpdu.setDestAddress(ControllerMacAddress);
+	aecpdu.setStatus(la::avdecc::protocol::AecpStatus::Success);
+	aecpdu.setTargetEntityID(TalkerEntityID);
+	aecpdu.setControllerEntityID(ControllerEntityID);
+	aecpdu.setSequenceID(1236);
+	aecpdu.setCommandType(la::avdecc::protocol::MvuCommandType::GetMilanInfo);
+	aecpdu.setCommandSpecificData(payload.data(), payload.usedBytes());
+	return { "mvu_get_milan_info_response", serializeFrame<la::avdecc::protocol::Aecpdu>(aecpdu) };
+}
+
+/** Returns a set of representative frames of each PDU type (and of the most common AEM payloads), built using the library serializers */
+inline SampleFrames buildSampleFrames()
+{
+	namespace aemPayload = la::avdecc::protocol::aemPayload;
+	using la::avdecc::protocol::AemCommandType;
+	using la::avdecc::entity::model::DescriptorType;
+
+	auto frames = SampleFrames{};
+
+	frames.push_back(makeAdpFrame());
+	frames.push_back(makeAcmpFrame());
+
+	// AEM commands
+	frames.push_back(makeAemFrame("aem_acquire_entity_command", false, false, AemCommandType::AcquireEntity, aemPayload::serializeAcquireEntityCommand(la::avdecc::protocol::AemAcquireEntityFlags::None, la::avdecc::UniqueIdentifier::getNullUniqueIdentifier(), DescriptorType::Entity, 0)));
+	frames.push_back(makeAemFrame("aem_read_descriptor_command", false, false, AemCommandType::ReadDescriptor, aemPayload::serializeReadDescriptorCommand(0, DescriptorType::StreamInput, 1)));
+
+	// AEM READ_DESCRIPTOR responses
+	{
+		auto descriptor = la::avdecc::entity::model::EntityDescriptor{};
+		descriptor.entityID = TalkerEntityID;
+		descriptor.entityModelID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+		descriptor.talkerStreamSources = 2;
+		descriptor.listenerStreamSinks = 2;
+		descriptor.availableIndex = 12;
+		descriptor.entityName = la::avdecc::entity::model::AvdeccFixedString{ "Sample Entity" };
+		descriptor.firmwareVersion = la::avdecc::entity::model::AvdeccFixedString{ "1.2.3" };
+		descriptor.serialNumber = la::avdecc::entity::model::AvdeccFixedString{ "0123456789" };
+		descriptor.configurationsCount = 2;
+		auto ser = aemPayload::serializeReadDescriptorCommonResponse(0, DescriptorType::Entity, 0);
+		aemPayload::serializeReadEntityDescriptorResponse(ser, descriptor);
+		frames.push_back(makeAemFrame("aem_read_entity_descriptor_response", true, false, AemCommandType::ReadDescriptor, ser));
+	}
+	{
+		auto descriptor = la::avdecc::entity::model::ConfigurationDescriptor{};
+		descriptor.objectName = la::avdecc::entity::model::AvdeccFixedString{ "Default Configuration" };
+		descriptor.descriptorCounts = { { DescriptorType::AudioUnit, 1 }, { DescriptorType::StreamInput, 2 }, { DescriptorType::StreamOutput, 2 }, { DescriptorType::AvbInterface, 1 }, { DescriptorType::ClockSource, 3 }, { DescriptorType::Locale, 1 }, { DescriptorType::Control, 4 }, { DescriptorType::ClockDomain, 1 } };
+		auto ser = aemPayload::serializeReadDescriptorCommonResponse(0, DescriptorType::Configuration, 0);
+		aemPayload::serializeReadConfigurationDescriptorResponse(ser, descriptor);
+		frames.push_back(makeAemFrame("aem_read_configuration_descriptor_response", true, false, AemCommandType::ReadDescriptor, ser));
+	}
+
+	// AEM responses and unsolicited notifications
+	{
+		auto info = la::avdecc::entity::model::StreamInfo{};
+		info.streamInfoFlags = la::avdecc::entity::StreamInfoFlags{ la::avdecc::entity::StreamInfoFlag::Connected, la::avdecc::entity::StreamInfoFlag::StreamIDValid, la::avdecc::entity::StreamInfoFlag::StreamDestMacValid };
+		info.streamID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE000001 };
+		info.streamDestMac = { { 0x91, 0xE0, 0xF0, 0x00, 0x12, 0x34 } };
+		frames.push_back(makeAemFrame("aem_get_stream_info_response", true, true, AemCommandType::GetStreamInfo, aemPayload::serializeGetStreamInfoResponse(DescriptorType::StreamInput, 0, info)));
+	}
+	{
+		auto counters = la::avdecc::entity::model::DescriptorCounters{};
+		for (auto i = 0u; i < counters.size(); ++i)
+		{
+			counters[i] = i * 17u;
+		}
+		frames.push_back(makeAemFrame("aem_get_counters_response", true, true, AemCommandType::GetCounters, aemPayload::serializeGetCountersResponse(DescriptorType::AvbInterface, 0, 0x0000FFFF, counters)));
+	}
+	{
+		auto mappings = la::avdecc::entity::model::AudioMappings{};
+		for (auto i = std::uint16_t{ 0u }; i < 8u; ++i)
+		{
+			mappings.push_back({ 0, i, 0, i });
+		}
+		frames.push_back(makeAemFrame("aem_get_audio_map_response", true, false, AemCommandType::GetAudioMap, aemPayload::serializeGetAudioMapResponse(DescriptorType::StreamPortInput, 0, 0, 1, mappings)));
+	}
+
+	frames.push_back(makeAaFrame());
+	frames.push_back(makeMvuFrame());
+
+	return frames;
+}
+
+} // namespace sampleFrames